@@ -27,11 +27,6 @@ ChooseColorView::ChooseColorView(xpcc::gui::GuiViewStack* stack,
 
 }
 
-bool ChooseColorView::hasChanged()
-{
-	return true;
-}
-
 void ChooseColorView::activate_yellow(const InputEvent& ev, Widget* w, void* data)
 {
 	(void) ev;
@@ -17,9 +17,6 @@ public:
 
 	~ChooseColorView() {}
 
-	bool
-	hasChanged();
-
 	static void
 	activate_yellow(const InputEvent&, Widget*, void*);
 
@@ -14,9 +14,3 @@ HomeView::HomeView(xpcc::gui::GuiViewStack* stack, uint8_t identifier) :
 	this->pack(&checkbox1, xpcc::glcd::Point(60, 140));
 	this->pack(&rocker1, xpcc::glcd::Point(60, 200));
 }
-
-bool
-HomeView::hasChanged()
-{
-	return true;
-}
@@ -14,8 +14,6 @@ public:
 
 	~HomeView() {}
 
-	bool
-	hasChanged();
 private:
 	xpcc::gui::ButtonWidget toggleLedButton;
 	xpcc::gui::ButtonWidget doNothingButton;
@@ -20,8 +20,3 @@ Overview::Overview(xpcc::gui::GuiViewStack* stack, uint8_t identifier) :
 	this->pack(&tabpanel, xpcc::glcd::Point(0, 0));
 
 }
-
-bool Overview::hasChanged()
-{
-	return true;
-}
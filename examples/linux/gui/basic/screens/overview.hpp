@@ -17,9 +17,6 @@ public:
 
 	~Overview() {}
 
-	bool
-	hasChanged();
-
 public:
 	xpcc::gui::TabPanel tabpanel;
 	xpcc::gui::ButtonWidget buttonLeft;
@@ -15,6 +15,7 @@
 #if (XPCC__CLOCK_TESTMODE == 1)
 
 	xpcc::Clock::Type xpcc::Clock::time = 0;
+	xpcc::PreciseClock::Type xpcc::PreciseClock::time = 0;
 
 	template< typename TimestampType >
 	TimestampType
@@ -23,19 +24,41 @@
 		return TimestampType(time);
 	}
 
+	template< typename TimestampType >
+	TimestampType
+	xpcc::PreciseClock::now()
+	{
+		return TimestampType(time);
+	}
+
+#	define XPCC__PRECISE_CLOCK_INSTANTIATE 1
+
 #elif ( defined(XPCC__OS_UNIX) || defined(XPCC__OS_OSX) )
-#	include <sys/time.h>
+#	include <time.h>
 
 	template< typename TimestampType >
 	TimestampType
 	xpcc::Clock::now()
 	{
-		struct timeval now;
-		gettimeofday(&now, 0);
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
 
-		return TimestampType( now.tv_sec*1000 + now.tv_usec/1000 );
+		// the timestamp overflow is intended here
+		return TimestampType( uint64_t(now.tv_sec)*1000 + now.tv_nsec/1000000 );
 	}
 
+	template< typename TimestampType >
+	TimestampType
+	xpcc::PreciseClock::now()
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		return TimestampType( uint64_t(now.tv_sec)*1000000 + now.tv_nsec/1000 );
+	}
+
+#	define XPCC__PRECISE_CLOCK_INSTANTIATE 1
+
 #elif defined(XPCC__OS_WIN32) || defined(XPCC__OS_WIN64)
 #	include <windows.h>
 
@@ -49,6 +72,19 @@
 		return TimestampType( now.wMilliseconds + now.wSecond*1000 + now.wMinute*1000*60 );
 	}
 
+	template< typename TimestampType >
+	TimestampType
+	xpcc::PreciseClock::now()
+	{
+		LARGE_INTEGER frequency, now;
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&now);
+
+		return TimestampType( uint64_t(now.QuadPart) * 1000000 / uint64_t(frequency.QuadPart) );
+	}
+
+#	define XPCC__PRECISE_CLOCK_INSTANTIATE 1
+
 #elif defined(XPCC__CPU_AVR) || defined(XPCC__CPU_ARM) || defined(XPCC__CPU_AVR32)
 #	include <xpcc/architecture/driver/atomic/lock.hpp>
 
@@ -70,6 +106,27 @@
 		return TimestampType(tempTime);
 	}
 
+#	if !(defined(XPCC__CPU_CORTEX_M0) || defined(XPCC__CPU_CORTEX_M3) || defined(XPCC__CPU_CORTEX_M4))
+	// Cortex-M targets implement the precise clock in the SysTick driver
+	xpcc::PreciseClock::Type xpcc::PreciseClock::time = 0;
+
+	template< typename TimestampType >
+	TimestampType
+	xpcc::PreciseClock::now()
+	{
+		typename TimestampType::Type tempTime;
+		{
+#if defined(XPCC__CPU_AVR)
+			atomic::Lock lock;
+#endif
+			tempTime = typename TimestampType::Type(time);
+		}
+		return TimestampType(tempTime);
+	}
+
+#		define XPCC__PRECISE_CLOCK_INSTANTIATE 1
+#	endif
+
 #else
 #	error	"Don't know how to create a Timestamp for this target!"
 #endif
@@ -77,3 +134,8 @@
 // explicit declaration of what member function templates we need to generate
 template xpcc::ShortTimestamp xpcc::Clock::now();
 template xpcc::Timestamp xpcc::Clock::now();
+
+#if defined(XPCC__PRECISE_CLOCK_INSTANTIATE)
+template xpcc::ShortTimestamp xpcc::PreciseClock::now();
+template xpcc::Timestamp xpcc::PreciseClock::now();
+#endif
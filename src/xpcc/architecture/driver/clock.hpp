@@ -19,8 +19,8 @@ namespace xpcc
 /**
  * Internal system-tick timer
  *
- * This class is implemented using `gettimeofday()` from <sys/time.h> for
- * any Unix-OS.
+ * This class is implemented using `clock_gettime(CLOCK_MONOTONIC)` from
+ * <time.h> for any Unix-OS.
  *
  * For Cortex-M targets the user has to enable the `xpcc::SysTick` timer.
  *
@@ -73,6 +73,64 @@ protected:
 	static Type time;
 };
 
+/**
+ * Internal high-resolution timer with microsecond timebase.
+ *
+ * This clock is monotonic and overflows every 71 minutes, so it can be used
+ * with xpcc::Timestamp for timeouts of up to 35 minutes, or with
+ * xpcc::ShortTimestamp for timeouts of up to 32 milliseconds.
+ *
+ * For any Unix-OS this class is implemented using
+ * `clock_gettime(CLOCK_MONOTONIC)` from <time.h>.
+ *
+ * For Cortex-M targets the clock is derived from the DWT cycle counter
+ * (Cortex-M3 and M4) or interpolated from the SysTick counter (Cortex-M0
+ * and M7), so the user has to enable the `xpcc::SysTick` timer, which
+ * also takes care of accumulating cycle counter overflows.
+ *
+ * For the AVRs targets the user has to use the increment() method in a
+ * timer interrupt, just as for xpcc::Clock.
+ *
+ * @see		xpcc::PreciseTimeout
+ * @see		xpcc::PrecisePeriodicTimer
+ *
+ * @ingroup	architecture
+ */
+class PreciseClock
+{
+public:
+	typedef uint32_t Type;
+
+public:
+	/**
+	 * Get the current time in microseconds, either as Timestamp or
+	 * ShortTimestamp.
+	 *
+	 * Provides an atomic access to the current time
+	 */
+	template< typename TimestampType = Timestamp >
+	static TimestampType
+	now();
+
+	static inline ShortTimestamp
+	nowShort()
+	{
+		return now<ShortTimestamp>();
+	}
+
+#if !defined(XPCC__OS_HOSTED)
+	/// Set the current time
+	static inline void
+	increment(uint_fast16_t step = 1)
+	{
+		time += step;
+	}
+#endif
+
+protected:
+	static Type time;
+};
+
 }	// namespace xpcc
 
 #endif	// XPCC_CLOCK_HPP
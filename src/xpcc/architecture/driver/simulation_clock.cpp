@@ -0,0 +1,68 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "xpcc_config.hpp"
+
+#if (XPCC__CLOCK_TESTMODE == 1)
+
+#include "simulation_clock.hpp"
+
+xpcc::SimulationClock::Time xpcc::SimulationClock::time = 0;
+xpcc::SimulationClock::Time xpcc::SimulationClock::nextDeadline = xpcc::SimulationClock::noDeadline;
+xpcc::SimulationClock::TickHandler xpcc::SimulationClock::tickHandler = nullptr;
+
+constexpr xpcc::SimulationClock::Time xpcc::SimulationClock::noDeadline;
+
+// ----------------------------------------------------------------------------
+void
+xpcc::SimulationClock::setTime(Time microseconds)
+{
+	update(microseconds);
+	nextDeadline = noDeadline;
+}
+
+void
+xpcc::SimulationClock::advance(Time microseconds)
+{
+	const Time end = time + microseconds;
+	nextDeadline = noDeadline;
+
+	if (tickHandler)
+	{
+		// the handler may report new deadlines, which are kept
+		for (Time tick = (time / 1000 + 1) * 1000; tick <= end; tick += 1000)
+		{
+			update(tick);
+			tickHandler();
+		}
+	}
+	update(end);
+}
+
+bool
+xpcc::SimulationClock::advanceToNextDeadline(Time limit)
+{
+	const bool pending = (nextDeadline != noDeadline);
+	if (not pending and limit == noDeadline) {
+		// nothing to jump to, the time stays
+		return false;
+	}
+
+	const Time target = (nextDeadline < limit) ? nextDeadline : limit;
+
+	if (target > time) {
+		advance(target - time);
+	}
+	else {
+		nextDeadline = noDeadline;
+	}
+	return pending;
+}
+
+#endif
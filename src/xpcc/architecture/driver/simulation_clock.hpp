@@ -0,0 +1,185 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_SIMULATION_CLOCK_HPP
+#define	XPCC_SIMULATION_CLOCK_HPP
+
+#include <stdint.h>
+
+#include "clock.hpp"
+#include "xpcc_config.hpp"
+
+#if (XPCC__CLOCK_TESTMODE != 1)
+#	error	"xpcc::SimulationClock requires XPCC__CLOCK_TESTMODE = 1!"
+#endif
+
+namespace xpcc
+{
+
+/**
+ * Deterministic virtual time for hosted simulations.
+ *
+ * The simulation clock keeps the virtual time in microseconds and sets
+ * xpcc::Clock and xpcc::PreciseClock accordingly, so that every Timeout,
+ * PeriodicTimer, Protothread and the Dispatcher's retransmissions run in
+ * virtual time.
+ *
+ * Every armed timeout which is polled and has not expired yet reports its
+ * deadline to the simulation clock. When all threads are idle, the time can
+ * then jump directly to the earliest of these deadlines, so that hours
+ * of application behaviour can be simulated in seconds:
+ *
+ * @code
+ * xpcc::SimulationClock::setTime(0);
+ * // call the scheduler every millisecond of virtual time
+ * xpcc::SimulationClock::setTickHandler([]() { scheduler.schedule(); });
+ *
+ * // simulate one hour
+ * xpcc::SimulationClock::runFor(3600ul * 1000 * 1000, []()
+ * {
+ *     dispatcher.update();
+ *     robot.update();
+ * });
+ * @endcode
+ *
+ * Do not modify `TestingClock::time` directly while using this class.
+ *
+ * This class is only available if XPCC__CLOCK_TESTMODE is set to 1.
+ *
+ * @ingroup	architecture
+ */
+class SimulationClock : private Clock, private PreciseClock
+{
+public:
+	/// Virtual time in microseconds
+	typedef uint64_t Time;
+
+	typedef void (*TickHandler)();
+
+	static constexpr Time noDeadline = ~Time(0);
+
+public:
+	/// @return the current virtual time in microseconds
+	static inline Time
+	getTime()
+	{
+		return time;
+	}
+
+	/// Set the virtual time and discard all reported deadlines
+	static void
+	setTime(Time microseconds);
+
+	/**
+	 * Called every millisecond of virtual time, like a timer interrupt.
+	 *
+	 * Use this to drive the xpcc::Scheduler. Pass `nullptr` to remove
+	 * the handler.
+	 */
+	static inline void
+	setTickHandler(TickHandler handler)
+	{
+		tickHandler = handler;
+	}
+
+	/**
+	 * Move the virtual time forward.
+	 *
+	 * The tick handler is called for every millisecond boundary on the way,
+	 * with the clocks set to this boundary. All reported deadlines are
+	 * discarded, since the application has to poll its timeouts again.
+	 */
+	static void
+	advance(Time microseconds);
+
+	/**
+	 * Jump to the earliest deadline reported since the last time step,
+	 * but not beyond `limit`.
+	 *
+	 * If no deadline was reported, the time jumps to `limit`. Without
+	 * a deadline and without a limit the time is not changed.
+	 *
+	 * @return	`true` if a deadline was pending, `false` otherwise
+	 */
+	static bool
+	advanceToNextDeadline(Time limit = noDeadline);
+
+	/**
+	 * Run the simulation for a duration.
+	 *
+	 * Calls `step` and then jumps to the next deadline, until the
+	 * duration has elapsed. `step` is called one last time at the end.
+	 */
+	template< typename Step >
+	static void
+	runFor(Time duration, Step step)
+	{
+		const Time end = time + duration;
+		while (true)
+		{
+			step();
+			if (time >= end)
+				break;
+			advanceToNextDeadline(end);
+		}
+	}
+
+	/// @return the earliest reported deadline or `noDeadline`
+	static inline Time
+	getNextDeadline()
+	{
+		return nextDeadline;
+	}
+
+	/// Report an absolute deadline in microseconds
+	static inline void
+	reportDeadline(Time deadline)
+	{
+		if (deadline < nextDeadline)
+			nextDeadline = deadline;
+	}
+
+	/// @cond
+	// Used by xpcc::GenericTimeout, which reports the remaining time in
+	// the resolution of its clock. Timeouts of other clocks are ignored.
+	static inline void
+	reportRemaining(const Clock *, uint32_t milliseconds)
+	{
+		reportDeadline((Time(Clock::time) + milliseconds) * 1000);
+	}
+
+	static inline void
+	reportRemaining(const PreciseClock *, uint32_t microseconds)
+	{
+		reportDeadline(time + microseconds);
+	}
+
+	static inline void
+	reportRemaining(const void *, uint32_t)
+	{
+	}
+	/// @endcond
+
+private:
+	static inline void
+	update(Time microseconds)
+	{
+		time = microseconds;
+		Clock::time = Clock::Type(microseconds / 1000);
+		PreciseClock::time = PreciseClock::Type(microseconds);
+	}
+
+	static Time time;
+	static Time nextDeadline;
+	static TickHandler tickHandler;
+};
+
+}	// namespace xpcc
+
+#endif	// XPCC_SIMULATION_CLOCK_HPP
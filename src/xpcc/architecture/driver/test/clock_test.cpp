@@ -7,6 +7,8 @@
  */
 // ----------------------------------------------------------------------------
 
+#include <xpcc/processing/timer/timeout.hpp>
+
 #include "testing_clock.hpp"
 
 #include "clock_test.hpp"
@@ -49,3 +51,37 @@ ClockTest::testClock()
 	TestingClock::time = uint32_t(4294967296);
 	TEST_ASSERT_EQUALS(xpcc::Clock::now(), xpcc::Timestamp(0));
 }
+
+void
+ClockTest::testPreciseClock()
+{
+	TestingPreciseClock::time = 0;
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::nowShort(), xpcc::ShortTimestamp(0));
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::now(), xpcc::Timestamp(0));
+
+	TestingPreciseClock::time = 1500;
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::nowShort(), xpcc::ShortTimestamp(1500));
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::now(), xpcc::Timestamp(1500));
+
+	// overflow in timestamp, but not the Clock!
+	TestingPreciseClock::time = 65536 + 10;
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::nowShort(), xpcc::ShortTimestamp(10));
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::now(), xpcc::Timestamp(65546));
+
+	// the precise clock is independent of the millisecond clock
+	TestingClock::time = 20;
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::now(), xpcc::Timestamp(65546));
+
+	// microsecond timeouts must work across the clock overflow
+	TestingPreciseClock::time = 4294967000;
+	xpcc::PreciseTimeout timeout(500);
+	TEST_ASSERT_FALSE(timeout.isExpired());
+
+	TestingPreciseClock::time = 4294967295;
+	TEST_ASSERT_EQUALS(timeout.remaining(), 205l);
+	TEST_ASSERT_FALSE(timeout.isExpired());
+
+	TestingPreciseClock::time = uint32_t(4294967296 + 204);
+	TEST_ASSERT_EQUALS(timeout.remaining(), 0l);
+	TEST_ASSERT_TRUE(timeout.isExpired());
+}
@@ -19,6 +19,9 @@ class ClockTest : public unittest::TestSuite
 public:
 	void
 	testClock();
+
+	void
+	testPreciseClock();
 };
 
 #endif
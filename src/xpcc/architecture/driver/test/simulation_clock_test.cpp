@@ -0,0 +1,155 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/simulation_clock.hpp>
+#include <xpcc/processing/timer.hpp>
+
+#include "simulation_clock_test.hpp"
+
+using xpcc::SimulationClock;
+
+static uint32_t ticks;
+
+static void
+countTicks()
+{
+	ticks++;
+}
+
+// ----------------------------------------------------------------------------
+void
+SimulationClockTest::tearDown()
+{
+	SimulationClock::setTickHandler(nullptr);
+	SimulationClock::setTime(0);
+}
+
+void
+SimulationClockTest::testSetTime()
+{
+	SimulationClock::setTime(12345678);
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 12345678u);
+	TEST_ASSERT_EQUALS(xpcc::Clock::now().getTime(), 12345u);
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::now().getTime(), 12345678u);
+
+	SimulationClock::advance(2500);
+	TEST_ASSERT_EQUALS(xpcc::Clock::now().getTime(), 12348u);
+	TEST_ASSERT_EQUALS(xpcc::PreciseClock::now().getTime(), 12348178u);
+
+	// no deadlines were reported, so the time jumps to the limit
+	TEST_ASSERT_FALSE(SimulationClock::advanceToNextDeadline(20000000));
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 20000000u);
+
+	// without a limit there is nothing to jump to
+	TEST_ASSERT_FALSE(SimulationClock::advanceToNextDeadline());
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 20000000u);
+}
+
+void
+SimulationClockTest::testTickHandler()
+{
+	SimulationClock::setTime(500);
+	ticks = 0;
+	SimulationClock::setTickHandler(countTicks);
+
+	SimulationClock::advance(400);
+	TEST_ASSERT_EQUALS(ticks, 0u);
+
+	// crosses 1ms and 2ms
+	SimulationClock::advance(1100);
+	TEST_ASSERT_EQUALS(ticks, 2u);
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 2000u);
+
+	SimulationClock::advance(10000);
+	TEST_ASSERT_EQUALS(ticks, 12u);
+}
+
+void
+SimulationClockTest::testTimeoutDeadline()
+{
+	SimulationClock::setTime(1000500);
+
+	xpcc::Timeout timeout(100);
+	xpcc::ShortTimeout shortTimeout(30);
+	xpcc::Timeout stopped;
+
+	TEST_ASSERT_FALSE(timeout.isExpired());
+	TEST_ASSERT_FALSE(shortTimeout.isExpired());
+	TEST_ASSERT_FALSE(stopped.isExpired());
+
+	// the deadline is aligned to the millisecond clock
+	TEST_ASSERT_EQUALS(SimulationClock::getNextDeadline(), 1030000u);
+	TEST_ASSERT_TRUE(SimulationClock::advanceToNextDeadline());
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 1030000u);
+
+	TEST_ASSERT_TRUE(shortTimeout.execute());
+	TEST_ASSERT_FALSE(timeout.execute());
+
+	TEST_ASSERT_TRUE(SimulationClock::advanceToNextDeadline());
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 1100000u);
+	TEST_ASSERT_TRUE(timeout.execute());
+
+	// nothing is pending anymore
+	TEST_ASSERT_FALSE(timeout.isArmed());
+	TEST_ASSERT_EQUALS(SimulationClock::getNextDeadline(), SimulationClock::noDeadline);
+
+	// the limit is respected
+	timeout.restart(100);
+	TEST_ASSERT_FALSE(timeout.execute());
+	TEST_ASSERT_TRUE(SimulationClock::advanceToNextDeadline(1150000));
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 1150000u);
+	TEST_ASSERT_FALSE(timeout.execute());
+}
+
+void
+SimulationClockTest::testPreciseTimeoutDeadline()
+{
+	SimulationClock::setTime(1000);
+
+	xpcc::PreciseTimeout precise(250);
+	xpcc::Timeout timeout(1);
+
+	TEST_ASSERT_FALSE(precise.execute());
+	TEST_ASSERT_FALSE(timeout.execute());
+
+	TEST_ASSERT_TRUE(SimulationClock::advanceToNextDeadline());
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 1250u);
+	TEST_ASSERT_TRUE(precise.execute());
+	TEST_ASSERT_FALSE(timeout.execute());
+
+	TEST_ASSERT_TRUE(SimulationClock::advanceToNextDeadline());
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 2000u);
+	TEST_ASSERT_TRUE(timeout.execute());
+}
+
+void
+SimulationClockTest::testRunFor()
+{
+	SimulationClock::setTime(0);
+
+	xpcc::PeriodicTimer timer(1000);
+	uint32_t executions = 0;
+	uint32_t steps = 0;
+
+	// one hour of virtual time
+	SimulationClock::runFor(3600ul * 1000 * 1000, [&]()
+	{
+		steps++;
+		if (timer.execute()) {
+			executions++;
+		}
+	});
+
+	TEST_ASSERT_EQUALS(SimulationClock::getTime(), 3600ul * 1000 * 1000);
+	TEST_ASSERT_EQUALS(executions, 3600u);
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 0u);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 0u);
+	// only one step per deadline
+	TEST_ASSERT_EQUALS(steps, 3601u);
+}
@@ -25,4 +25,12 @@ public:
 	using xpcc::Clock::time;
 };
 
+/// Gain full access to xpcc::PreciseClock
+class TestingPreciseClock : public xpcc::PreciseClock
+{
+public:
+	// expose protected members
+	using xpcc::PreciseClock::time;
+};
+
 #endif
@@ -11,6 +11,7 @@
 #define XPCC_CORTEX_CYCLE_COUNTER_HPP
 
 #include "../../../device.hpp"
+#include <xpcc/processing/timer/timestamp.hpp>
 
 namespace xpcc
 {
@@ -21,14 +22,40 @@ namespace cortex
  * @brief		CPU Cycle Counter
  * @ingroup		cortex
  *
- * Is enabled in the cortex start-up code
+ * Is enabled in the cortex start-up code.
+ *
+ * This class can also be used as a clock with a timebase of one CPU cycle,
+ * for example for measuring execution times or for very short timeouts:
+ *
+ * @code
+ * xpcc::GenericTimeout<xpcc::cortex::CycleCounter, xpcc::Timestamp> timeout(500);
+ * @endcode
+ *
+ * Note that the counter overflows every 2^32 cycles (25 seconds at 168 MHz),
+ * so timeouts must be shorter than half of that.
  */
 class CycleCounter
 {
+public:
+	typedef uint32_t Type;
+
 public:
 	static inline uint32_t getCount() {
 		return DWT->CYCCNT;
 	}
+
+	template< typename TimestampType = xpcc::Timestamp >
+	static inline TimestampType
+	now()
+	{
+		return TimestampType(typename TimestampType::Type(DWT->CYCCNT));
+	}
+
+	static inline xpcc::ShortTimestamp
+	nowShort()
+	{
+		return now<xpcc::ShortTimestamp>();
+	}
 };
 
 } // namespace cortex
@@ -14,6 +14,7 @@
 #include "communicator.hpp"
 
 #include <xpcc/processing/task.hpp>
+#include <xpcc/debug/profiler/profiler.hpp>
 
 namespace xpcc
 {
@@ -23,6 +24,11 @@ namespace xpcc
  *
  * Needs to be part of a xpcc::AbstractComponent
  *
+ * When `XPCC__PROFILER` is enabled, the execution time of `update()` is
+ * recorded in `taskProfile`. The tasks generated by the system design
+ * builder do this already, hand-written tasks have to start their
+ * implementation of `update()` with `XPCC_PROFILE_SCOPE(this->taskProfile);`.
+ *
  * @see		xpcc::Task
  * @see		xpcc::Communicator
  * @see		xpcc::Communicatable
@@ -40,6 +46,12 @@ public:
 
 protected:
 	Communicator *parent;
+
+#if XPCC__PROFILER
+public:
+	/// Execution time statistics of update(), see xpcc::profiler
+	xpcc::profiler::Record taskProfile;
+#endif
 };
 
 }	// namespace xpcc
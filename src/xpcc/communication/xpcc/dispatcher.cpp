@@ -31,10 +31,30 @@
 #include "dispatcher.hpp"
 
 #include <xpcc/debug/logger/logger.hpp>
+#include <xpcc/debug/trace/trace.hpp>
 // set the Loglevel
 #undef  XPCC_LOG_LEVEL
 #define XPCC_LOG_LEVEL xpcc::log::INFO
 
+#if XPCC__TRACE
+namespace
+{
+	// The trace id contains the packet identifier, bit 8 is set for
+	// transmitted packets. The value contains type, ack, destination and source.
+	inline uint32_t
+	tracePacketValue(const xpcc::Header& header)
+	{
+		return (uint32_t(header.type) << 24) | (uint32_t(header.isAcknowledge) << 16) |
+				(uint32_t(header.destination) << 8) | header.source;
+	}
+}
+#	define XPCC_TRACE_PACKET(type, header, transmit) \
+		::xpcc::trace::buffer.record(::xpcc::trace::Category::Dispatcher, type, \
+				(header).packetIdentifier | ((transmit) ? 0x100 : 0), tracePacketValue(header))
+#else
+#	define XPCC_TRACE_PACKET(type, header, transmit)
+#endif
+
 xpcc::Dispatcher::Dispatcher(BackendInterface *backend_, Postman* postman_) :
 	backend(backend_), postman(postman_)
 {
@@ -51,6 +71,7 @@ xpcc::Dispatcher::update()
 	{
 		const Header& header = this->backend->getPacketHeader();
 		const SmartPointer& payload = this->backend->getPacketPayload();
+		XPCC_TRACE_PACKET(xpcc::trace::Type::Begin, header, false);
 		
 		if (header.type == Header::Type::REQUEST && !header.isAcknowledge)
 		{
@@ -67,6 +88,7 @@ xpcc::Dispatcher::update()
 			}
 		}
 		
+		XPCC_TRACE_PACKET(xpcc::trace::Type::End, header, false);
 		this->backend->dropPacket();
 	}
 
@@ -100,6 +122,7 @@ xpcc::Dispatcher::sendAcknowledge(const Header& header)
 			header.source, header.destination,
 			header.packetIdentifier);
 	
+	XPCC_TRACE_PACKET(xpcc::trace::Type::Instant, ackHeader, true);
 	this->backend->sendPacket(ackHeader);
 }
 
@@ -167,6 +190,7 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 	// to one component on board inner component
 	// send message also out, so it is possible to log
 	// communication externally
+	XPCC_TRACE_PACKET(xpcc::trace::Type::Instant, entry->header, true);
 	backend->sendPacket(entry->header, entry->payload);
 	
 	if (entry->header.type == Header::Type::REQUEST)
@@ -178,7 +202,7 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 		{
 			// TODO timer for RESPONSES not handeled yet
 			entry->state = Entry::State::WaitForResponse;
-			entry->time.restart(responseTimeout);
+			entry->time.restart(uint32_t(responseTimeout) * timeoutTicksPerMillisecond);
 			return entry;
 		}
 		else {
@@ -230,6 +254,7 @@ xpcc::Dispatcher::handleWaitingMessages()
 			{
 				// event
 				postman->deliverPacket(entry->header, entry->payload);
+				XPCC_TRACE_PACKET(xpcc::trace::Type::Instant, entry->header, true);
 				backend->sendPacket(entry->header, entry->payload);
 
 				entry = this->entries.remove(entry);
@@ -247,10 +272,11 @@ xpcc::Dispatcher::handleWaitingMessages()
 				{
 					// destination not on board, message has to be sent
 					// out to the backend
+					XPCC_TRACE_PACKET(xpcc::trace::Type::Instant, entry->header, true);
 					backend->sendPacket(entry->header, entry->payload);
 
 					entry->state = Entry::State::WaitForACK;
-					entry->time.restart(acknowledgeTimeout);
+					entry->time.restart(uint32_t(acknowledgeTimeout) * timeoutTicksPerMillisecond);
 
 					++entry;
 				}
@@ -268,10 +294,11 @@ xpcc::Dispatcher::handleWaitingMessages()
 				}
 				else
 				{
+					XPCC_TRACE_PACKET(xpcc::trace::Type::Instant, entry->header, true);
 					backend->sendPacket(entry->header, entry->payload);
 
 					entry->tries++;
-					entry->time.restart(acknowledgeTimeout);
+					entry->time.restart(uint32_t(acknowledgeTimeout) * timeoutTicksPerMillisecond);
 				}
 			}
 
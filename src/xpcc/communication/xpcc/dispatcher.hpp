@@ -34,6 +34,8 @@
 #include <xpcc/processing/timer.hpp>
 #include <xpcc/container/linked_list.hpp>
 
+#include "xpcc_config.hpp"
+
 #include "backend/backend_interface.hpp"
 #include "postman/postman.hpp"
 
@@ -52,9 +54,23 @@ namespace xpcc
 	class Dispatcher
 	{
 	public:
+		/// in milliseconds
 		static const uint16_t acknowledgeTimeout = 500;
+		/// in milliseconds
 		static const uint16_t responseTimeout = 100;
 
+#if XPCC__DISPATCHER_PRECISE_CLOCK
+		/// Timeout used for acknowledges and responses
+		using Timeout = PreciseTimeout;
+		/// Ticks of the timeout clock per millisecond
+		static const uint16_t timeoutTicksPerMillisecond = 1000;
+#else
+		/// Timeout used for acknowledges and responses
+		using Timeout = ShortTimeout;
+		/// Ticks of the timeout clock per millisecond
+		static const uint16_t timeoutTicksPerMillisecond = 1;
+#endif
+
 	public:
 		Dispatcher(BackendInterface *backend, Postman* postman);
 
@@ -142,7 +158,7 @@ namespace xpcc
 			const Header header;
 			const SmartPointer payload;
 			State state = State::TransmissionPending;
-			ShortTimeout time;
+			Timeout time;
 			uint8_t tries = 0;
 		private:
 			ResponseCallback callback;
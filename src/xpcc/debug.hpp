@@ -36,5 +36,7 @@
 
 #include "debug/logger.hpp"
 #include "debug/error_report.hpp"
+#include "debug/profiler.hpp"
+#include "debug/trace.hpp"
 
 #endif	// XPCC__DEBUG_HPP
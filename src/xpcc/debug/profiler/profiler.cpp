@@ -0,0 +1,196 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include <xpcc/architecture/detect.hpp>
+
+#include "profiler.hpp"
+
+#if defined(XPCC__CPU_CORTEX_M3) || defined(XPCC__CPU_CORTEX_M4)
+#	include <xpcc/architecture/platform.hpp>
+
+xpcc::profiler::Ticks
+xpcc::profiler::now()
+{
+	return DWT->CYCCNT;
+}
+
+uint32_t
+xpcc::profiler::getTicksPerSecond()
+{
+	return xpcc::clock::fcpu;
+}
+
+#elif defined(XPCC__OS_UNIX) || defined(XPCC__OS_OSX)
+#	include <time.h>
+
+xpcc::profiler::Ticks
+xpcc::profiler::now()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	// the overflow is intended, only differences are used
+	return Ticks(uint64_t(now.tv_sec) * 1000000000 + now.tv_nsec);
+}
+
+uint32_t
+xpcc::profiler::getTicksPerSecond()
+{
+	return 1000000000;
+}
+
+#else
+#	include <xpcc/architecture/driver/clock.hpp>
+
+xpcc::profiler::Ticks
+xpcc::profiler::now()
+{
+	return xpcc::PreciseClock::now().getTime();
+}
+
+uint32_t
+xpcc::profiler::getTicksPerSecond()
+{
+	return 1000000;
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+xpcc::profiler::Record *xpcc::profiler::Record::first = nullptr;
+
+xpcc::profiler::Record::Record(const char *name) :
+	name(name), next(first)
+{
+	reset();
+	first = this;
+}
+
+xpcc::profiler::Record::Record(const Record& other) :
+	Record(other.name)
+{
+}
+
+xpcc::profiler::Record::~Record()
+{
+	Record **record = &first;
+	while (*record != nullptr)
+	{
+		if (*record == this) {
+			*record = next;
+			break;
+		}
+		record = &(*record)->next;
+	}
+}
+
+void
+xpcc::profiler::Record::reset()
+{
+	total = 0;
+	count = 0;
+	maximum = 0;
+	last = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::profiler::reset()
+{
+	for (Record *record = Record::getFirst(); record; record = record->getNext()) {
+		record->reset();
+	}
+}
+
+// `ticks * 1000000 / getTicksPerSecond()` without overflow, saturated
+static uint32_t
+toMicroseconds(uint64_t ticks)
+{
+	const uint32_t ticksPerSecond = xpcc::profiler::getTicksPerSecond();
+	const uint64_t seconds = ticks / ticksPerSecond;
+	if (seconds > UINT32_MAX / 1000000) {
+		return UINT32_MAX;
+	}
+
+	const uint64_t microseconds = seconds * 1000000 +
+			(ticks % ticksPerSecond) * 1000000 / ticksPerSecond;
+	return (microseconds > UINT32_MAX) ? UINT32_MAX : uint32_t(microseconds);
+}
+
+uint64_t
+xpcc::profiler::toNanoseconds(uint64_t ticks)
+{
+	const uint32_t ticksPerSecond = getTicksPerSecond();
+	const uint64_t seconds = ticks / ticksPerSecond;
+	if (seconds >= UINT64_MAX / 1000000000) {
+		return UINT64_MAX;
+	}
+	return seconds * 1000000000 + (ticks % ticksPerSecond) * 1000000000 / ticksPerSecond;
+}
+
+void
+xpcc::profiler::dump(IOStream& stream)
+{
+	stream << "Profile [us]: count, total, max, last" << xpcc::endl;
+	for (Record *record = Record::getFirst(); record; record = record->getNext())
+	{
+		if (record->getName()) {
+			stream << record->getName();
+		} else {
+			stream << static_cast<const void*>(record);
+		}
+		stream << ": " << record->getCount()
+			   << ", " << toMicroseconds(record->getTotal())
+			   << ", " << toMicroseconds(record->getMaximum())
+			   << ", " << toMicroseconds(record->getLast()) << xpcc::endl;
+	}
+}
+
+// ----------------------------------------------------------------------------
+static void
+writeLittleEndian(xpcc::IODevice& device, uint64_t value, uint8_t size)
+{
+	for (uint8_t ii = 0; ii < size; ++ii)
+	{
+		device.write(char(value & 0xff));
+		value >>= 8;
+	}
+}
+
+void
+xpcc::profiler::writeSnapshot(IODevice& device)
+{
+	uint16_t count = 0;
+	for (Record *record = Record::getFirst(); record; record = record->getNext()) {
+		count++;
+	}
+
+	device.write('P');
+	device.write('R');
+	writeLittleEndian(device, 1, 1);	// version
+	writeLittleEndian(device, count, 2);
+	writeLittleEndian(device, getTicksPerSecond(), 4);
+
+	for (Record *record = Record::getFirst(); record; record = record->getNext())
+	{
+		writeLittleEndian(device, record->getCount(), 4);
+		writeLittleEndian(device, record->getTotal(), 8);
+		writeLittleEndian(device, record->getMaximum(), 4);
+		writeLittleEndian(device, record->getLast(), 4);
+
+		const char *name = record->getName();
+		const uint8_t length = name ? strnlen(name, 255) : 0;
+		writeLittleEndian(device, length, 1);
+		for (uint8_t ii = 0; ii < length; ++ii) {
+			device.write(name[ii]);
+		}
+	}
+}
@@ -0,0 +1,252 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_PROFILER_HPP
+#define XPCC_PROFILER_HPP
+
+#include <stdint.h>
+#include <xpcc/io/iostream.hpp>
+
+#include "xpcc_config.hpp"
+
+namespace xpcc
+{
+
+/**
+ * Execution time profiling.
+ *
+ * Every xpcc::profiler::Record accumulates the invocation count, the total,
+ * maximum and last execution time of a piece of code, measured in ticks of
+ * a high-resolution timebase:
+ *
+ * - Cortex-M3/M4: the DWT cycle counter (CPU cycles),
+ * - hosted: `clock_gettime(CLOCK_MONOTONIC)` (nanoseconds),
+ * - other targets: xpcc::PreciseClock (microseconds).
+ *
+ * Ticks are 32-bit wide, so the timebase wraps around every 2^32 ticks,
+ * e.g. every ~4.29 s on hosted and every ~25.6 s at 168 MHz.
+ * Durations are computed modulo 2^32 and stay correct across a wrap,
+ * but a single execution longer than one wrap period is recorded too short.
+ *
+ * When `XPCC__PROFILER` is set to 1, every xpcc::pt::Protothread and every
+ * task of the xpcc::Scheduler contains a record, which is updated on every
+ * call to `run()`.
+ * Note that the execution time of a protothread includes the time of all
+ * child protothreads and resumable functions it calls.
+ * Any other code can be profiled with the `XPCC_PROFILE_SCOPE()` macro:
+ *
+ * @code
+ * XPCC_PROFILE_RECORD(controlLoopProfile, "control");
+ *
+ * void
+ * ControlTask::update()
+ * {
+ *     XPCC_PROFILE_SCOPE(controlLoopProfile);
+ *     ...
+ * }
+ *
+ * // print all records
+ * xpcc::profiler::dump(XPCC_LOG_INFO);
+ * @endcode
+ *
+ * When `XPCC__PROFILER` is 0, these macros and all the instrumentation
+ * compile to nothing.
+ *
+ * @ingroup	debug
+ */
+namespace profiler
+{
+
+typedef uint32_t Ticks;
+
+/// @return the current time of the profiling timebase
+Ticks
+now();
+
+/// @return the number of ticks per second of the profiling timebase
+uint32_t
+getTicksPerSecond();
+
+/// Convert ticks of the profiling timebase into nanoseconds, saturates
+uint64_t
+toNanoseconds(uint64_t ticks);
+
+/**
+ * Execution time statistics of one piece of code.
+ *
+ * All records register themselves in a global list on construction, so
+ * that they can be reported by dump() and writeSnapshot().
+ *
+ * @ingroup	debug
+ */
+class Record
+{
+public:
+	Record(const char *name = nullptr);
+
+	/// Copies only the name, the statistics of the copy start empty.
+	Record(const Record& other);
+
+	~Record();
+
+	/// Keeps the name and statistics.
+	Record&
+	operator = (const Record&)
+	{
+		return *this;
+	}
+
+	inline void
+	setName(const char *name)
+	{
+		this->name = name;
+	}
+
+	/// @return the name or `nullptr` if none was set
+	inline const char*
+	getName() const
+	{
+		return name;
+	}
+
+	/// Add one execution with the given duration
+	inline void
+	add(Ticks duration)
+	{
+		last = duration;
+		if (duration > maximum) {
+			maximum = duration;
+		}
+		total += duration;
+		count++;
+	}
+
+	void
+	reset();
+
+	inline uint32_t
+	getCount() const
+	{
+		return count;
+	}
+
+	inline uint64_t
+	getTotal() const
+	{
+		return total;
+	}
+
+	inline Ticks
+	getMaximum() const
+	{
+		return maximum;
+	}
+
+	inline Ticks
+	getLast() const
+	{
+		return last;
+	}
+
+	/// @return the first record of the global list
+	static inline Record*
+	getFirst()
+	{
+		return first;
+	}
+
+	inline Record*
+	getNext() const
+	{
+		return next;
+	}
+
+private:
+	const char *name;
+	Record *next;
+
+	uint64_t total;
+	uint32_t count;
+	Ticks maximum;
+	Ticks last;
+
+	static Record *first;
+};
+
+/**
+ * Adds the execution time of its own lifetime to a record.
+ *
+ * @ingroup	debug
+ */
+class Scope
+{
+public:
+	inline
+	Scope(Record& record) :
+		record(record), start(now())
+	{
+	}
+
+	inline
+	~Scope()
+	{
+		record.add(now() - start);
+	}
+
+private:
+	Record& record;
+	const Ticks start;
+};
+
+/// Reset the statistics of all records
+void
+reset();
+
+/**
+ * Print a human readable table of all records.
+ *
+ * Times are converted into microseconds.
+ */
+void
+dump(IOStream& stream);
+
+/**
+ * Write a compact binary snapshot of all records.
+ *
+ * All values are little-endian:
+ *
+ * - header: `'P'`, `'R'`, version (uint8_t), record count (uint16_t),
+ *   ticks per second (uint32_t)
+ * - for each record: count (uint32_t), total (uint64_t), maximum (uint32_t),
+ *   last (uint32_t), name length (uint8_t) and name (without terminator)
+ *
+ * Use `tools/logger/profiler_snapshot.py` to decode the snapshot.
+ */
+void
+writeSnapshot(IODevice& device);
+
+}	// namespace profiler
+
+}	// namespace xpcc
+
+#if XPCC__PROFILER
+/// Profile the enclosing scope with the given xpcc::profiler::Record.
+/// @ingroup	debug
+#	define XPCC_PROFILE_SCOPE(record) \
+		::xpcc::profiler::Scope xpccProfileScope(record)
+/// Define a named xpcc::profiler::Record, which only exists when profiling.
+/// @ingroup	debug
+#	define XPCC_PROFILE_RECORD(variable, name) \
+		::xpcc::profiler::Record variable(name)
+#else
+#	define XPCC_PROFILE_SCOPE(record)
+#	define XPCC_PROFILE_RECORD(variable, name)
+#endif
+
+#endif	// XPCC_PROFILER_HPP
@@ -0,0 +1,83 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__UNITTEST_BENCHMARK_HPP
+#define XPCC__UNITTEST_BENCHMARK_HPP
+
+#include <xpcc/architecture/detect.hpp>
+
+// Benchmarks in the unittests only measure and print times on hosted
+// targets, elsewhere their test cases are left empty.
+#if defined(XPCC__OS_HOSTED)
+#	define XPCC__BENCHMARK 1
+#else
+#	define XPCC__BENCHMARK 0
+#endif
+
+#if XPCC__BENCHMARK
+
+#include <xpcc/debug/logger.hpp>
+#include <xpcc/debug/profiler/profiler.hpp>
+
+// the results are printed for every test run
+#undef	XPCC_LOG_LEVEL
+#define	XPCC_LOG_LEVEL xpcc::log::INFO
+
+namespace unittest
+{
+	/// Measures the profiler ticks since construction or restart()
+	class Stopwatch
+	{
+	public:
+		Stopwatch() :
+			start(xpcc::profiler::now())
+		{
+		}
+
+		void
+		restart()
+		{
+			start = xpcc::profiler::now();
+		}
+
+		xpcc::profiler::Ticks
+		getTicks() const
+		{
+			return xpcc::profiler::now() - start;
+		}
+
+	private:
+		xpcc::profiler::Ticks start;
+	};
+
+	/// @return the average nanoseconds of `count` operations taking `ticks`
+	inline uint32_t
+	getNanoseconds(uint64_t ticks, uint32_t count)
+	{
+		return uint32_t(xpcc::profiler::toNanoseconds(ticks) / count);
+	}
+
+	/**
+	 * Print `<name>: <nanoseconds> ns/<unit>` for the average of `count`
+	 * operations taking `ticks`.
+	 *
+	 * @return	the average nanoseconds per operation
+	 */
+	inline uint32_t
+	report(const char *name, uint64_t ticks, uint32_t count, const char *unit)
+	{
+		const uint32_t ns = getNanoseconds(ticks, count);
+		XPCC_LOG_INFO << name << ": " << ns << " ns/" << unit << xpcc::endl;
+		return ns;
+	}
+}
+
+#endif	// XPCC__BENCHMARK
+
+#endif	// XPCC__UNITTEST_BENCHMARK_HPP
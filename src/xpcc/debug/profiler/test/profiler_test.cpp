@@ -0,0 +1,191 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/debug/profiler.hpp>
+#include <xpcc/processing/protothread.hpp>
+
+#include "profiler_test.hpp"
+
+// ----------------------------------------------------------------------------
+namespace
+{
+	// simple IODevice which stores all data in a memory buffer
+	class MemoryWriter : public xpcc::IODevice
+	{
+	public:
+		MemoryWriter() :
+			bytesWritten(0) {}
+
+		virtual void
+		write(char c)
+		{
+			if (bytesWritten < sizeof(buffer)) {
+				buffer[bytesWritten++] = c;
+			}
+		}
+
+		using xpcc::IODevice::write;
+
+		virtual void
+		flush()
+		{
+		}
+
+		virtual bool
+		read(char& /*c*/)
+		{
+			return false;
+		}
+
+		uint8_t buffer[200];
+		std::size_t bytesWritten;
+	};
+}
+
+static uint16_t
+countRecords()
+{
+	uint16_t count = 0;
+	for (xpcc::profiler::Record *record = xpcc::profiler::Record::getFirst();
+		 record; record = record->getNext()) {
+		count++;
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+void
+ProfilerTest::testRecord()
+{
+	xpcc::profiler::Record record("test");
+
+	TEST_ASSERT_EQUALS(record.getCount(), 0u);
+	TEST_ASSERT_EQUALS(record.getTotal(), 0u);
+	TEST_ASSERT_EQUALS(record.getMaximum(), 0u);
+	TEST_ASSERT_EQUALS(record.getLast(), 0u);
+
+	record.add(10);
+	record.add(30);
+	record.add(20);
+
+	TEST_ASSERT_EQUALS(record.getCount(), 3u);
+	TEST_ASSERT_EQUALS(record.getTotal(), 60u);
+	TEST_ASSERT_EQUALS(record.getMaximum(), 30u);
+	TEST_ASSERT_EQUALS(record.getLast(), 20u);
+
+	record.reset();
+	TEST_ASSERT_EQUALS(record.getCount(), 0u);
+	TEST_ASSERT_EQUALS(record.getTotal(), 0u);
+	TEST_ASSERT_EQUALS(record.getMaximum(), 0u);
+}
+
+void
+ProfilerTest::testRegistration()
+{
+	const uint16_t initial = countRecords();
+	{
+		xpcc::profiler::Record record1("1");
+		TEST_ASSERT_EQUALS(countRecords(), initial + 1);
+		TEST_ASSERT_TRUE(xpcc::profiler::Record::getFirst() == &record1);
+		{
+			xpcc::profiler::Record record2(record1);
+			TEST_ASSERT_EQUALS(countRecords(), initial + 2);
+			TEST_ASSERT_EQUALS(record2.getName(), record1.getName());
+		}
+		TEST_ASSERT_EQUALS(countRecords(), initial + 1);
+
+		record1.add(5);
+		xpcc::profiler::reset();
+		TEST_ASSERT_EQUALS(record1.getCount(), 0u);
+	}
+	TEST_ASSERT_EQUALS(countRecords(), initial);
+}
+
+void
+ProfilerTest::testScope()
+{
+	xpcc::profiler::Record record;
+	TEST_ASSERT_TRUE(record.getName() == nullptr);
+
+	for (uint8_t ii = 0; ii < 5; ++ii)
+	{
+		xpcc::profiler::Scope scope(record);
+	}
+	TEST_ASSERT_EQUALS(record.getCount(), 5u);
+	TEST_ASSERT_TRUE(record.getTotal() >= record.getMaximum());
+	TEST_ASSERT_TRUE(record.getMaximum() >= record.getLast());
+}
+
+void
+ProfilerTest::testSnapshot()
+{
+	xpcc::profiler::Record record("abc");
+	record.add(0x01020304);
+	record.add(0x01020304);
+
+	MemoryWriter writer;
+	xpcc::profiler::writeSnapshot(writer);
+
+	TEST_ASSERT_EQUALS(writer.buffer[0], 'P');
+	TEST_ASSERT_EQUALS(writer.buffer[1], 'R');
+	TEST_ASSERT_EQUALS(writer.buffer[2], 1);
+	TEST_ASSERT_EQUALS(writer.buffer[3] | (writer.buffer[4] << 8), countRecords());
+	const uint32_t ticks = xpcc::profiler::getTicksPerSecond();
+	TEST_ASSERT_EQUALS(writer.buffer[5], ticks & 0xff);
+	TEST_ASSERT_EQUALS(writer.buffer[8], ticks >> 24);
+
+	// the newest record comes first
+	const uint8_t expected[] = {
+		2, 0, 0, 0,
+		0x08, 0x06, 0x04, 0x02, 0, 0, 0, 0,
+		0x04, 0x03, 0x02, 0x01,
+		0x04, 0x03, 0x02, 0x01,
+		3, 'a', 'b', 'c'
+	};
+	TEST_ASSERT_EQUALS_ARRAY(expected, writer.buffer + 9, sizeof(expected));
+}
+
+void
+ProfilerTest::testNanoseconds()
+{
+	const uint64_t ticks = xpcc::profiler::getTicksPerSecond();
+	TEST_ASSERT_EQUALS(xpcc::profiler::toNanoseconds(0), 0u);
+	TEST_ASSERT_EQUALS(xpcc::profiler::toNanoseconds(ticks), 1000000000u);
+	TEST_ASSERT_EQUALS(xpcc::profiler::toNanoseconds(ticks / 4), 250000000u);
+
+	// 28 hours would overflow `ticks * 1000000000`
+	TEST_ASSERT_EQUALS(xpcc::profiler::toNanoseconds(ticks * 100000), 100000000000000u);
+	TEST_ASSERT_EQUALS(xpcc::profiler::toNanoseconds(UINT64_MAX), UINT64_MAX);
+}
+
+// ----------------------------------------------------------------------------
+class ProfiledThread : public xpcc::pt::Protothread
+{
+public:
+	bool
+	run()
+	{
+		PT_BEGIN();
+		PT_YIELD();
+		PT_END();
+	}
+};
+
+void
+ProfilerTest::testProtothread()
+{
+	ProfiledThread thread;
+	TEST_ASSERT_TRUE(thread.run());
+	TEST_ASSERT_FALSE(thread.run());
+	TEST_ASSERT_FALSE(thread.run());
+
+#if XPCC__PROFILER
+	TEST_ASSERT_EQUALS(thread.ptProfile.getCount(), 3u);
+#endif
+}
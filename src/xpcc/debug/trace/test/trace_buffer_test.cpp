@@ -0,0 +1,249 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/debug/trace.hpp>
+
+#include "trace_buffer_test.hpp"
+
+using xpcc::trace::Category;
+using xpcc::trace::Type;
+using xpcc::trace::Event;
+
+namespace
+{
+	class TraceWriter : public xpcc::IODevice
+	{
+	public:
+		TraceWriter() :
+			bytesWritten(0) {}
+
+		virtual void
+		write(char c)
+		{
+			if (bytesWritten < sizeof(buffer)) {
+				buffer[bytesWritten++] = c;
+			}
+		}
+
+		using xpcc::IODevice::write;
+
+		virtual void
+		flush()
+		{
+		}
+
+		virtual bool
+		read(char& /*c*/)
+		{
+			return false;
+		}
+
+		uint32_t
+		get(std::size_t index, uint8_t size) const
+		{
+			uint32_t value = 0;
+			for (uint8_t ii = size; ii > 0; --ii) {
+				value = (value << 8) | buffer[index + ii - 1];
+			}
+			return value;
+		}
+
+		uint8_t buffer[200];
+		std::size_t bytesWritten;
+	};
+
+	static constexpr std::size_t headerSize = 13;
+	static constexpr std::size_t eventSize = 12;
+}
+
+// ----------------------------------------------------------------------------
+void
+TraceBufferTest::testRecord()
+{
+	xpcc::trace::TraceBuffer<8> buffer;
+	Event events[8];
+
+	TEST_ASSERT_EQUALS(buffer.getCount(), 0u);
+	TEST_ASSERT_EQUALS(buffer.copy(events), 0u);
+
+	buffer.record(100, Category::Interrupt, Type::Begin, 12);
+	buffer.record(110, Category::Interrupt, Type::End, 12);
+	buffer.record(120, Category::User, Type::Counter, 3, 0xdeadbeef);
+
+	TEST_ASSERT_EQUALS(buffer.getCount(), 3u);
+	TEST_ASSERT_EQUALS(buffer.copy(events), 3u);
+
+	TEST_ASSERT_EQUALS(events[0].timestamp, 100u);
+	TEST_ASSERT_TRUE(events[0].category == Category::Interrupt);
+	TEST_ASSERT_TRUE(events[0].type == Type::Begin);
+	TEST_ASSERT_EQUALS(events[0].id, 12);
+
+	TEST_ASSERT_EQUALS(events[1].timestamp, 110u);
+	TEST_ASSERT_TRUE(events[1].type == Type::End);
+
+	TEST_ASSERT_EQUALS(events[2].timestamp, 120u);
+	TEST_ASSERT_TRUE(events[2].category == Category::User);
+	TEST_ASSERT_TRUE(events[2].type == Type::Counter);
+	TEST_ASSERT_EQUALS(events[2].id, 3);
+	TEST_ASSERT_EQUALS(events[2].value, 0xdeadbeef);
+
+	// events with the current time
+	buffer.record(Category::Context, Type::Instant, 1);
+	TEST_ASSERT_EQUALS(buffer.getCount(), 4u);
+}
+
+void
+TraceBufferTest::testCategoryMask()
+{
+	xpcc::trace::TraceBuffer<8> buffer(0);
+	Event events[8];
+
+	TEST_ASSERT_FALSE(buffer.isEnabled(Category::Interrupt));
+	buffer.record(1, Category::Interrupt, Type::Instant, 0);
+	TEST_ASSERT_EQUALS(buffer.getCount(), 0u);
+
+	buffer.setEnabled((1 << uint8_t(Category::Dispatcher)) | (1 << 20));
+	TEST_ASSERT_FALSE(buffer.isEnabled(Category::Interrupt));
+	TEST_ASSERT_TRUE(buffer.isEnabled(Category::Dispatcher));
+	TEST_ASSERT_TRUE(buffer.isEnabled(Category(20)));
+
+	buffer.record(1, Category::Interrupt, Type::Instant, 0);
+	buffer.record(2, Category::Dispatcher, Type::Instant, 0);
+	buffer.record(3, Category(20), Type::Instant, 0);
+	buffer.record(4, Category::User, Type::Instant, 0);
+
+	TEST_ASSERT_EQUALS(buffer.copy(events), 2u);
+	TEST_ASSERT_EQUALS(events[0].timestamp, 2u);
+	TEST_ASSERT_EQUALS(events[1].timestamp, 3u);
+}
+
+void
+TraceBufferTest::testOverwrite()
+{
+	xpcc::trace::TraceBuffer<4> buffer;
+	Event events[4];
+
+	for (uint32_t ii = 0; ii < 10; ++ii) {
+		buffer.record(ii, Category::User, Type::Instant, ii);
+	}
+
+	TEST_ASSERT_EQUALS(buffer.getCount(), 10u);
+
+	// only the latest events are kept in chronological order
+	TEST_ASSERT_EQUALS(buffer.copy(events), 4u);
+	TEST_ASSERT_EQUALS(events[0].timestamp, 6u);
+	TEST_ASSERT_EQUALS(events[1].timestamp, 7u);
+	TEST_ASSERT_EQUALS(events[2].timestamp, 8u);
+	TEST_ASSERT_EQUALS(events[3].timestamp, 9u);
+}
+
+void
+TraceBufferTest::testCopyAfterClear()
+{
+	xpcc::trace::TraceBuffer<4> buffer;
+	Event events[4];
+	TraceWriter writer;
+
+	buffer.record(1, Category::User, Type::Instant, 0);
+	buffer.record(2, Category::User, Type::Instant, 0);
+	buffer.clear();
+	TEST_ASSERT_EQUALS(buffer.copy(events), 0u);
+
+	buffer.record(3, Category::User, Type::Instant, 0);
+	TEST_ASSERT_EQUALS(buffer.copy(events), 1u);
+	TEST_ASSERT_EQUALS(events[0].timestamp, 3u);
+
+	// events already sent are not copied again
+	buffer.writeEvents(writer);
+	TEST_ASSERT_EQUALS(buffer.copy(events), 0u);
+}
+
+void
+TraceBufferTest::testCopyWrap()
+{
+	xpcc::trace::TraceBuffer<4> buffer;
+	Event events[4];
+
+	// the event counter wraps around after 2^32 events
+	buffer.head = 0xfffffffe;
+	buffer.tail = 0xfffffffe;
+	for (uint32_t ii = 0; ii < 6; ++ii) {
+		buffer.record(ii, Category::User, Type::Instant, 0);
+	}
+	TEST_ASSERT_EQUALS(buffer.getCount(), 4u);
+
+	TEST_ASSERT_EQUALS(buffer.copy(events), 4u);
+	TEST_ASSERT_EQUALS(events[0].timestamp, 2u);
+	TEST_ASSERT_EQUALS(events[3].timestamp, 5u);
+
+	buffer.clear();
+	buffer.record(6, Category::User, Type::Instant, 0);
+	TEST_ASSERT_EQUALS(buffer.copy(events), 1u);
+	TEST_ASSERT_EQUALS(events[0].timestamp, 6u);
+}
+
+void
+TraceBufferTest::testWriteEvents()
+{
+	xpcc::trace::TraceBuffer<8> buffer;
+	TraceWriter writer;
+
+	buffer.record(0x01020304, Category::Dispatcher, Type::Instant, 0x1234, 0xa0b0c0d0);
+	buffer.record(0x01020305, Category::User, Type::Counter, 7, 42);
+
+	TEST_ASSERT_EQUALS(buffer.writeEvents(writer), 2u);
+	TEST_ASSERT_EQUALS(writer.bytesWritten, headerSize + 2 * eventSize);
+
+	TEST_ASSERT_EQUALS(writer.buffer[0], 'T');
+	TEST_ASSERT_EQUALS(writer.buffer[1], 'R');
+	TEST_ASSERT_EQUALS(writer.buffer[2], 1);
+	TEST_ASSERT_EQUALS(writer.get(3, 4), xpcc::profiler::getTicksPerSecond());
+	TEST_ASSERT_EQUALS(writer.get(7, 4), 0u);	// lost
+	TEST_ASSERT_EQUALS(writer.get(11, 2), 2u);	// count
+
+	TEST_ASSERT_EQUALS(writer.get(13, 4), 0x01020304u);
+	TEST_ASSERT_EQUALS(writer.get(17, 1), uint8_t(Category::Dispatcher));
+	TEST_ASSERT_EQUALS(writer.get(18, 1), uint8_t(Type::Instant));
+	TEST_ASSERT_EQUALS(writer.get(19, 2), 0x1234u);
+	TEST_ASSERT_EQUALS(writer.get(21, 4), 0xa0b0c0d0u);
+
+	TEST_ASSERT_EQUALS(writer.get(25, 4), 0x01020305u);
+	TEST_ASSERT_EQUALS(writer.get(33, 4), 42u);
+
+	// nothing new since the last call
+	writer.bytesWritten = 0;
+	TEST_ASSERT_EQUALS(buffer.writeEvents(writer), 0u);
+	TEST_ASSERT_EQUALS(writer.bytesWritten, headerSize);
+
+	writer.bytesWritten = 0;
+	buffer.record(5, Category::User, Type::Instant, 0);
+	TEST_ASSERT_EQUALS(buffer.writeEvents(writer), 1u);
+	TEST_ASSERT_EQUALS(writer.get(13, 4), 5u);
+}
+
+void
+TraceBufferTest::testWriteLostEvents()
+{
+	xpcc::trace::TraceBuffer<4> buffer;
+	TraceWriter writer;
+
+	for (uint32_t ii = 0; ii < 7; ++ii) {
+		buffer.record(ii, Category::User, Type::Instant, 0);
+	}
+
+	TEST_ASSERT_EQUALS(buffer.writeEvents(writer), 4u);
+	TEST_ASSERT_EQUALS(writer.get(7, 4), 3u);	// lost
+	TEST_ASSERT_EQUALS(writer.get(13, 4), 3u);	// oldest remaining event
+
+	// cleared events are not written
+	writer.bytesWritten = 0;
+	buffer.record(7, Category::User, Type::Instant, 0);
+	buffer.clear();
+	TEST_ASSERT_EQUALS(buffer.writeEvents(writer), 0u);
+}
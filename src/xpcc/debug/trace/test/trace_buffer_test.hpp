@@ -0,0 +1,35 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class TraceBufferTest : public unittest::TestSuite
+{
+public:
+	void
+	testRecord();
+
+	void
+	testCategoryMask();
+
+	void
+	testOverwrite();
+
+	void
+	testCopyAfterClear();
+
+	void
+	testCopyWrap();
+
+	void
+	testWriteEvents();
+
+	void
+	testWriteLostEvents();
+};
@@ -0,0 +1,14 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "trace.hpp"
+
+#if XPCC__TRACE
+xpcc::trace::TraceBuffer<XPCC__TRACE_BUFFER_SIZE> xpcc::trace::buffer;
+#endif
@@ -0,0 +1,74 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_TRACE_HPP
+#define XPCC_TRACE_HPP
+
+#include "trace_buffer.hpp"
+
+#include "xpcc_config.hpp"
+
+/**
+ * @ingroup	debug
+ * @defgroup	trace	Event Tracing
+ *
+ * Binary event tracing into the global `xpcc::trace::buffer`.
+ *
+ * When `XPCC__TRACE` is set to 1, the scheduler records the execution of its
+ * tasks and the dispatcher records all received and transmitted packets.
+ * The application can add its own events, for example for interrupts:
+ *
+ * @code
+ * extern "C" void
+ * USART2_IRQHandler()
+ * {
+ *     XPCC_TRACE_BEGIN(xpcc::trace::Category::Interrupt, USART2_IRQn);
+ *     ...
+ *     XPCC_TRACE_END(xpcc::trace::Category::Interrupt, USART2_IRQn);
+ * }
+ *
+ * // in the main loop, stream the new events to the host
+ * xpcc::trace::buffer.writeEvents(uartDevice);
+ * @endcode
+ *
+ * When `XPCC__TRACE` is 0, the macros compile to nothing.
+ */
+
+#if XPCC__TRACE
+
+namespace xpcc
+{
+
+namespace trace
+{
+
+/// Global trace buffer of size `XPCC__TRACE_BUFFER_SIZE`
+/// @ingroup	trace
+extern TraceBuffer<XPCC__TRACE_BUFFER_SIZE> buffer;
+
+}	// namespace trace
+
+}	// namespace xpcc
+
+#	define XPCC_TRACE_BEGIN(category, id) \
+		::xpcc::trace::buffer.record(category, ::xpcc::trace::Type::Begin, id)
+#	define XPCC_TRACE_END(category, id) \
+		::xpcc::trace::buffer.record(category, ::xpcc::trace::Type::End, id)
+#	define XPCC_TRACE_INSTANT(category, id, value) \
+		::xpcc::trace::buffer.record(category, ::xpcc::trace::Type::Instant, id, value)
+#	define XPCC_TRACE_COUNTER(category, id, value) \
+		::xpcc::trace::buffer.record(category, ::xpcc::trace::Type::Counter, id, value)
+#else
+#	define XPCC_TRACE_BEGIN(category, id)
+#	define XPCC_TRACE_END(category, id)
+#	define XPCC_TRACE_INSTANT(category, id, value)
+#	define XPCC_TRACE_COUNTER(category, id, value)
+#endif
+
+#endif	// XPCC_TRACE_HPP
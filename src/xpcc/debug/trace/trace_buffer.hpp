@@ -0,0 +1,185 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_TRACE_BUFFER_HPP
+#define XPCC_TRACE_BUFFER_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <xpcc/architecture/detect.hpp>
+#include <xpcc/architecture/driver/atomic/lock.hpp>
+#include <xpcc/io/iodevice.hpp>
+
+// Forward declaration the test class
+class TraceBufferTest;
+
+namespace xpcc
+{
+
+namespace trace
+{
+
+/// Event categories, which can be enabled individually
+/// @ingroup	debug
+enum class
+Category : uint8_t
+{
+	Interrupt = 0,
+	Context = 1,
+	Dispatcher = 2,
+	User = 3,
+	// categories up to 31 are available for the application
+};
+
+/// @ingroup	debug
+enum class
+Type : uint8_t
+{
+	Begin = 0,		///< start of a duration, must be matched by an End event
+	End = 1,		///< end of a duration
+	Instant = 2,	///< single point in time
+	Counter = 3,	///< value of a counter
+};
+
+/// Binary trace event of 12 bytes
+/// @ingroup	debug
+struct Event
+{
+	uint32_t timestamp;
+	Category category;
+	Type type;
+	uint16_t id;
+	uint32_t value;
+};
+
+/**
+ * Fixed-size ring buffer for timestamped binary trace events.
+ *
+ * Events can be recorded from interrupts and the main loop at the same time.
+ * Writers only reserve their slot with an atomic increment (lock-free on
+ * Cortex-M3/M4 and hosted, a very short critical section on other targets),
+ * so recording an event takes only a few dozen cycles.
+ * When the buffer is full, the oldest events are overwritten, so after a
+ * crash the buffer contains the latest history.
+ *
+ * Each category can be enabled and disabled at runtime via a bit mask,
+ * which is checked before an event is recorded.
+ *
+ * The events are read out by streaming them with writeEvents(), which sends
+ * all events recorded since the last call.
+ * Use `tools/logger/trace_to_json.py` to convert this stream into the Chrome
+ * trace format, which can be viewed in `chrome://tracing` or Perfetto.
+ *
+ * @warning	The reader cannot detect a slot which is being overwritten
+ * 			while it is copied. Events lost due to overruns are reported.
+ *
+ * @tparam	N	number of events, must be a power of two.
+ *
+ * @ingroup	debug
+ */
+template< size_t N >
+class TraceBuffer
+{
+	static_assert(N >= 2 and (N & (N - 1)) == 0, "N must be a power of two!");
+	static_assert(N <= 32768, "N must not be larger than 32768!");
+
+public:
+	TraceBuffer(uint32_t enabledCategories = 0xffffffff);
+
+	inline void
+	setEnabled(uint32_t categoryMask)
+	{
+		mask = categoryMask;
+	}
+
+	inline uint32_t
+	getEnabled() const
+	{
+		return mask;
+	}
+
+	inline bool
+	isEnabled(Category category) const
+	{
+		return mask & (uint32_t(1) << uint8_t(category));
+	}
+
+	/// Record an event with the current time, if its category is enabled.
+	inline void
+	record(Category category, Type type, uint16_t id, uint32_t value = 0);
+
+	/// Record an event with a given timestamp, if its category is enabled.
+	void
+	record(uint32_t timestamp, Category category, Type type, uint16_t id, uint32_t value = 0);
+
+	/// @return the total number of events ever recorded
+	inline uint32_t
+	getCount() const
+	{
+		return head;
+	}
+
+	/// @return the maximum number of stored events
+	static constexpr size_t
+	getSize()
+	{
+		return N;
+	}
+
+	/**
+	 * Copy the stored events in chronological order.
+	 *
+	 * Only events recorded since the last clear() or writeEvents() are
+	 * copied, the buffer itself is not changed.
+	 *
+	 * @param	events	buffer for up to `N` events
+	 * @return	number of events copied
+	 */
+	size_t
+	copy(Event *events) const;
+
+	/**
+	 * Stream all events recorded since the last call over a device.
+	 *
+	 * All values are little-endian:
+	 * - header: `'T'`, `'R'`, version (uint8_t), ticks per second (uint32_t),
+	 *   number of lost events (uint32_t), event count (uint16_t)
+	 * - events: timestamp (uint32_t), category (uint8_t), type (uint8_t),
+	 *   id (uint16_t), value (uint32_t)
+	 *
+	 * @return	number of events written
+	 */
+	uint16_t
+	writeEvents(IODevice& device);
+
+	/// Discard all events
+	void
+	clear();
+
+private:
+	// Grant unit test full access to private members.
+	friend class ::TraceBufferTest;
+
+	inline uint32_t
+	reserve();
+
+	Event events[N];
+	volatile uint32_t head;
+	uint32_t tail;
+	volatile uint32_t mask;
+};
+
+}	// namespace trace
+
+}	// namespace xpcc
+
+#include "trace_buffer_impl.hpp"
+
+#endif	// XPCC_TRACE_BUFFER_HPP
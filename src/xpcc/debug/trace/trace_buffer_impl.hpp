@@ -0,0 +1,137 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_TRACE_BUFFER_HPP
+#	error	"Don't include this file directly, use 'trace_buffer.hpp' instead!"
+#endif
+
+#include <xpcc/debug/profiler/profiler.hpp>
+
+template< size_t N >
+xpcc::trace::TraceBuffer<N>::TraceBuffer(uint32_t enabledCategories) :
+	head(0), tail(0), mask(enabledCategories)
+{
+}
+
+template< size_t N >
+uint32_t
+xpcc::trace::TraceBuffer<N>::reserve()
+{
+#if defined(XPCC__CPU_CORTEX_M3) || defined(XPCC__CPU_CORTEX_M4) || defined(XPCC__OS_HOSTED)
+	// LDREX/STREX on ARMv7-M, LOCK XADD on x86
+	return __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+#else
+	atomic::Lock lock;
+	return head++;
+#endif
+}
+
+template< size_t N >
+void
+xpcc::trace::TraceBuffer<N>::record(Category category, Type type, uint16_t id, uint32_t value)
+{
+	if (isEnabled(category)) {
+		record(xpcc::profiler::now(), category, type, id, value);
+	}
+}
+
+template< size_t N >
+void
+xpcc::trace::TraceBuffer<N>::record(uint32_t timestamp, Category category,
+		Type type, uint16_t id, uint32_t value)
+{
+	if (not isEnabled(category))
+		return;
+
+	Event& event = events[reserve() & (N - 1)];
+	event.timestamp = timestamp;
+	event.category = category;
+	event.type = type;
+	event.id = id;
+	event.value = value;
+}
+
+template< size_t N >
+size_t
+xpcc::trace::TraceBuffer<N>::copy(Event *destination) const
+{
+	const uint32_t end = head;
+	uint32_t start = tail;
+	if (end - start > N) {
+		// the oldest events were already overwritten
+		start = end - N;
+	}
+	for (uint32_t index = start; index != end; ++index) {
+		*destination++ = events[index & (N - 1)];
+	}
+	return end - start;
+}
+
+template< size_t N >
+void
+xpcc::trace::TraceBuffer<N>::clear()
+{
+	tail = head;
+}
+
+// ----------------------------------------------------------------------------
+namespace xpcc
+{
+
+namespace trace
+{
+
+/// @cond
+inline void
+writeLittleEndian(IODevice& device, uint32_t value, uint8_t size)
+{
+	for (uint8_t ii = 0; ii < size; ++ii)
+	{
+		device.write(char(value & 0xff));
+		value >>= 8;
+	}
+}
+/// @endcond
+
+}	// namespace trace
+
+}	// namespace xpcc
+
+template< size_t N >
+uint16_t
+xpcc::trace::TraceBuffer<N>::writeEvents(IODevice& device)
+{
+	const uint32_t end = head;
+	uint32_t lost = 0;
+	if (end - tail > N)
+	{
+		// the oldest events were already overwritten
+		lost = end - tail - N;
+		tail = end - N;
+	}
+	const uint16_t count = end - tail;
+
+	device.write('T');
+	device.write('R');
+	writeLittleEndian(device, 1, 1);	// version
+	writeLittleEndian(device, xpcc::profiler::getTicksPerSecond(), 4);
+	writeLittleEndian(device, lost, 4);
+	writeLittleEndian(device, count, 2);
+
+	for (; tail != end; ++tail)
+	{
+		const Event event = events[tail & (N - 1)];
+		writeLittleEndian(device, event.timestamp, 4);
+		writeLittleEndian(device, uint8_t(event.category), 1);
+		writeLittleEndian(device, uint8_t(event.type), 1);
+		writeLittleEndian(device, event.id, 2);
+		writeLittleEndian(device, event.value, 4);
+	}
+	return count;
+}
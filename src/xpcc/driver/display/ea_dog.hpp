@@ -51,8 +51,9 @@ namespace xpcc
 	 * \see		<a href="http://www.lcd-module.de/eng/pdf/grafik/dogs102-6e.pdf">Datasheet</a>
 	 * \ingroup	driver_display
 	 */
-	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false>
-	class DogS102 : public St7565<SPI, CS, A0, Reset, 102, 64, TopView>
+	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false,
+			  bool DoubleBuffered = false>
+	class DogS102 : public St7565<SPI, CS, A0, Reset, 102, 64, TopView, DoubleBuffered>
 	{
 	public:
 		/**
@@ -64,7 +65,7 @@ namespace xpcc
 		void
 		initialize()
 		{
-			St7565<SPI, CS, A0, Reset, 102, 64, TopView>::initialize(
+			St7565<SPI, CS, A0, Reset, 102, 64, TopView, DoubleBuffered>::initialize(
 					xpcc::accessor::asFlash(st7565::configuration_dogs102),
 					sizeof(st7565::configuration_dogs102));
 		}
@@ -76,8 +77,9 @@ namespace xpcc
 	 * \see		<a href="http://www.lcd-module.de/eng/pdf/grafik/dogm132-5e.pdf">Datasheet</a>
 	 * \ingroup	lcd
 	 */
-	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false>
-	class DogM132 : public St7565<SPI, CS, A0, Reset, 132, 32, TopView>
+	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false,
+			  bool DoubleBuffered = false>
+	class DogM132 : public St7565<SPI, CS, A0, Reset, 132, 32, TopView, DoubleBuffered>
 	{
 	public:
 		/**
@@ -89,7 +91,7 @@ namespace xpcc
 		void
 		initialize()
 		{
-			St7565<SPI, CS, A0, Reset, 132, 32, TopView>::initialize(
+			St7565<SPI, CS, A0, Reset, 132, 32, TopView, DoubleBuffered>::initialize(
 					xpcc::accessor::asFlash(st7565::configuration_dogm132),
 					sizeof(st7565::configuration_dogm132));
 		}
@@ -101,8 +103,9 @@ namespace xpcc
 	 * \see		<a href="http://www.lcd-module.de/pdf/grafik/dogm128.pdf">Datasheet</a>
 	 * \ingroup	lcd
 	 */
-	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false>
-	class DogM128 : public St7565<SPI, CS, A0, Reset, 128, 64, TopView>
+	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false,
+			  bool DoubleBuffered = false>
+	class DogM128 : public St7565<SPI, CS, A0, Reset, 128, 64, TopView, DoubleBuffered>
 	{
 	public:
 		/**
@@ -114,7 +117,7 @@ namespace xpcc
 		void
 		initialize()
 		{
-			St7565<SPI, CS, A0, Reset, 128, 64, TopView>::initialize(
+			St7565<SPI, CS, A0, Reset, 128, 64, TopView, DoubleBuffered>::initialize(
 					xpcc::accessor::asFlash(st7565::configuration_dogx128),
 					sizeof(st7565::configuration_dogx128));
 		}
@@ -126,8 +129,9 @@ namespace xpcc
 	 * \see		<a href="http://www.lcd-module.de/pdf/grafik/dogl128-6.pdf">Datasheet</a>
 	 * \ingroup	lcd
 	 */
-	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false>
-	class DogL128 : public St7565<SPI, CS, A0, Reset, 128, 64, TopView>
+	template <typename SPI, typename CS, typename A0, typename Reset, bool TopView = false,
+			  bool DoubleBuffered = false>
+	class DogL128 : public St7565<SPI, CS, A0, Reset, 128, 64, TopView, DoubleBuffered>
 	{
 	public:
 		/**
@@ -139,7 +143,7 @@ namespace xpcc
 		void
 		initialize()
 		{
-			St7565<SPI, CS, A0, Reset, 128, 64, TopView>::initialize(
+			St7565<SPI, CS, A0, Reset, 128, 64, TopView, DoubleBuffered>::initialize(
 					xpcc::accessor::asFlash(st7565::configuration_dogx128),
 					sizeof(st7565::configuration_dogx128));
 		}
@@ -64,6 +64,10 @@ public:
 	void
 	clear();
 
+	/// Reads the busy flag, needs the RW pin
+	virtual bool
+	isBusy();
+
 protected:
 	typedef Hd44780Base<DATA, RW, RS, E> driver;
 
@@ -124,6 +128,10 @@ public:
 	void
 	clear();
 
+	/// Reads the busy flags of both controllers, needs the RW pin
+	virtual bool
+	isBusy();
+
 protected:
 	typedef Hd44780Base<DATA, RW, RS, E1> driver1;
 	typedef Hd44780Base<DATA, RW, RS, E2> driver2;
@@ -80,6 +80,13 @@ xpcc::Hd44780<DATA, RW, RS, E>::clear()
 		;
 }
 
+template <typename DATA, typename RW, typename RS, typename E>
+bool
+xpcc::Hd44780<DATA, RW, RS, E>::isBusy()
+{
+	return driver::isBusy();
+}
+
 
 // ----------------------------------------------------------------------------
 template <typename DATA, typename RW, typename RS, typename E1, typename E2>
@@ -153,3 +160,10 @@ xpcc::Hd44780Dual<DATA, RW, RS, E1, E2>::clear()
 	while(!driver2::resetCursor())
 		;
 }
+
+template <typename DATA, typename RW, typename RS, typename E1, typename E2>
+bool
+xpcc::Hd44780Dual<DATA, RW, RS, E1, E2>::isBusy()
+{
+	return driver1::isBusy() or driver2::isBusy();
+}
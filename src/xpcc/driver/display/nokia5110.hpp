@@ -10,7 +10,7 @@
 #ifndef XPCC_NOKIA5110_HPP
 #define XPCC_NOKIA5110_HPP
 
-#include <xpcc/ui/display/buffered_graphic_display.hpp>
+#include <xpcc/ui/display/asynchronous_graphic_display.hpp>
 
 namespace xpcc
 {
@@ -23,20 +23,30 @@ namespace xpcc
  * Cheap, monochrome graphical display with SPI interface.
  * Maximum SPI frequency is 4 MHz.
  *
+ * The changed part of every page is sent with one `Spi::transfer()`,
+ * so the display can be updated in the background with startUpdate()
+ * and transmit(), see xpcc::AsynchronousGraphicDisplay. The SPI master
+ * is acquired for every page, so other devices on the same bus can
+ * transfer between two pages.
+ *
  * \ingroup driver_display
  */
-template < typename Spi, typename Ce, typename Dc, typename Reset >
-class Nokia5110 : public BufferedGraphicDisplay< 84, 48 >
+template < typename Spi, typename Ce, typename Dc, typename Reset,
+		   bool DoubleBuffered = false >
+class Nokia5110 : public AsynchronousGraphicDisplay< 84, 48, DoubleBuffered >
 {
 public:
 	void
 	initialize();
 
-	virtual void
-	update();
-
 protected:
 	void writeCommand(uint8_t data);
+
+	virtual xpcc::ResumableResult<void>
+	writePage(uint16_t page, uint16_t column, uint8_t *data, uint16_t length);
+
+	// column and row address
+	uint8_t commandBuffer[2];
 };
 
 } // xpcc namespace
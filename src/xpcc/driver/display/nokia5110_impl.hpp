@@ -14,9 +14,9 @@
 namespace xpcc
 {
 
-template< typename Spi, typename Ce, typename Dc, typename Reset >
+template< typename Spi, typename Ce, typename Dc, typename Reset, bool DoubleBuffered >
 void
-Nokia5110< Spi, Ce, Dc, Reset >::initialize()
+Nokia5110< Spi, Ce, Dc, Reset, DoubleBuffered >::initialize()
 {
 	Reset::set();
 
@@ -26,9 +26,9 @@ Nokia5110< Spi, Ce, Dc, Reset >::initialize()
 
 	writeCommand(0xc2); // Set Vop
 
-	// Basic instruction set, vertical addressing
-	// Matches well with xpcc's BufferedGraphicDisplay memory layout
-	writeCommand(0x20 | (1 << 1));
+	// Basic instruction set, horizontal addressing
+	// The changed columns of one page are written in a single transfer
+	writeCommand(0x20);
 
 	// writeCommand(0x08); // display blank
 	// writeCommand(0x09); // all on
@@ -36,27 +36,34 @@ Nokia5110< Spi, Ce, Dc, Reset >::initialize()
 	// writeCommand(0x0d); // inverse
 }
 
-template< typename Spi, typename Ce, typename Dc, typename Reset >
-void
-Nokia5110< Spi, Ce, Dc, Reset >::update()
+template< typename Spi, typename Ce, typename Dc, typename Reset, bool DoubleBuffered >
+xpcc::ResumableResult<void>
+Nokia5110< Spi, Ce, Dc, Reset, DoubleBuffered >::writePage(
+		uint16_t page, uint16_t column, uint8_t *data, uint16_t length)
 {
-	// goto 0, 0
-	writeCommand(0x80); // Column
-	writeCommand(0x40); // Row
+	RF_BEGIN();
+
+	// other devices may use the bus between two pages
+	RF_WAIT_UNTIL(Spi::acquire(this));
+
+	commandBuffer[0] = 0x80 | column; // Column
+	commandBuffer[1] = 0x40 | page; // Row
 
 	Ce::reset();
+	Dc::reset(); // low = command
+	RF_CALL(Spi::transfer(commandBuffer, nullptr, 2));
+
 	Dc::set(); // high = data
-	for (uint8_t xx = 0; xx < this->getWidth(); ++xx) {
-		for (uint8_t yy = 0; yy < this->getHeight() / 8; ++yy) {
-			Spi::transferBlocking(this->display_buffer[xx][yy]);
-		}
-	}
+	RF_CALL(Spi::transfer(data, nullptr, length));
 	Ce::set();
+	Spi::release(this);
+
+	RF_END();
 }
 
-template< typename Spi, typename Ce, typename Dc, typename Reset >
+template< typename Spi, typename Ce, typename Dc, typename Reset, bool DoubleBuffered >
 void
-Nokia5110< Spi, Ce, Dc, Reset >::writeCommand(uint8_t data)
+Nokia5110< Spi, Ce, Dc, Reset, DoubleBuffered >::writeCommand(uint8_t data)
 {
 	Dc::reset(); // low = command
 	Ce::reset();
@@ -123,8 +123,12 @@ public:
 		setCommandBuffer(uint8_t *buffer)
 		{ commands = buffer; }
 
+		/// Writes the columns [firstColumn, lastColumn] of the pages
+		/// [firstPage, lastPage] of the buffer
 		bool
-		configureDisplayWrite(uint8_t (*buffer)[Height / 8], std::size_t size);
+		configureDisplayWrite(uint8_t (*buffer)[Height / 8],
+				uint8_t firstColumn, uint8_t lastColumn,
+				uint8_t firstPage, uint8_t lastPage);
 
 	protected:
 		virtual Writing
@@ -135,6 +139,12 @@ public:
 
 	private:
 		uint8_t *commands;
+		uint8_t (*frame)[Height / 8];
+		uint8_t firstColumn;
+		uint8_t lastColumn;
+		uint8_t firstPage;
+		uint8_t lastPage;
+		uint8_t column;
 	public:
 		bool writeable;
 	};
@@ -173,6 +183,7 @@ public:
 	}
 
 	/// Update the display with the content of the RAM buffer.
+	/// Only the smallest rectangle containing all changes is transmitted.
 	void
 	update() override
 	{
@@ -239,6 +250,9 @@ private:
 	xpcc::ResumableResult<void>
 	startWriteDisplay();
 
+	bool
+	startDisplayTransfer();
+
 	bool
 	startTransactionWithLength(uint8_t length);
 
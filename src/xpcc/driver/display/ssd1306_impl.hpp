@@ -57,11 +57,34 @@ xpcc::Ssd1306<I2cMaster, Height>::startWriteDisplay()
 {
 	RF_BEGIN();
 
-	RF_WAIT_UNTIL( this->transaction.configureDisplayWrite(this->display_buffer, (this->DisplayBufferWidth * this->DisplayBufferHeight)) and this->startTransaction() );
+	RF_WAIT_UNTIL( startDisplayTransfer() );
 
 	RF_END();
 }
 
+template < class I2cMaster, uint8_t Height >
+bool
+xpcc::Ssd1306<I2cMaster, Height>::startDisplayTransfer()
+{
+	typename BufferedGraphicDisplay<128, Height>::Window window;
+	if (not this->getDirtyWindow(window))
+	{
+		// nothing changed, nothing to transmit
+		this->markClean(0);
+		return true;
+	}
+
+	if (this->transaction.configureDisplayWrite(this->display_buffer,
+			window.firstColumn, window.lastColumn, window.firstPage, window.lastPage)
+		and this->startTransaction())
+	{
+		this->markClean((window.lastColumn - window.firstColumn + 1) *
+				(window.lastPage - window.firstPage + 1));
+		return true;
+	}
+	return false;
+}
+
 template < class I2cMaster, uint8_t Height >
 xpcc::ResumableResult<bool>
 xpcc::Ssd1306<I2cMaster, Height>::writeDisplay()
@@ -14,15 +14,26 @@
 // ----------------------------------------------------------------------------
 template < uint8_t Height >
 xpcc::ssd1306::DataTransmissionAdapter<Height>::DataTransmissionAdapter(uint8_t address) :
-	I2cWriteTransaction(address), writeable(true)
+	I2cWriteTransaction(address), commands(nullptr), frame(nullptr),
+	firstColumn(0), lastColumn(0), firstPage(0), lastPage(0), column(0),
+	writeable(true)
 {}
 
 template < uint8_t Height >
 bool
-xpcc::ssd1306::DataTransmissionAdapter<Height>::configureDisplayWrite(uint8_t (*buffer)[Height / 8], std::size_t size)
+xpcc::ssd1306::DataTransmissionAdapter<Height>::configureDisplayWrite(uint8_t (*buffer)[Height / 8],
+		uint8_t firstColumn, uint8_t lastColumn,
+		uint8_t firstPage, uint8_t lastPage)
 {
-	if (I2cWriteTransaction::configureWrite(&buffer[0][0], size))
+	const std::size_t size = (lastColumn - firstColumn + 1) * (lastPage - firstPage + 1);
+	if (I2cWriteTransaction::configureWrite(&buffer[firstColumn][firstPage], size))
 	{
+		this->frame = buffer;
+		this->firstColumn = firstColumn;
+		this->lastColumn = lastColumn;
+		this->firstPage = firstPage;
+		this->lastPage = lastPage;
+		this->column = firstColumn;
 		commands[13] = 0xfe;
 		writeable = false;
 		return true;
@@ -38,8 +49,8 @@ xpcc::ssd1306::DataTransmissionAdapter<Height>::writing()
 	if (commands[13] == 0xfe)
 	{
 		commands[1] = Command::SetColumnAddress;
-		commands[3] = 0;
-		commands[5] = 127;
+		commands[3] = firstColumn;
+		commands[5] = lastColumn;
 		commands[13] = 0xfd;
 		return Writing(commands, 6, OperationAfterWrite::Restart);
 	}
@@ -47,8 +58,8 @@ xpcc::ssd1306::DataTransmissionAdapter<Height>::writing()
 	if (commands[13] == 0xfd)
 	{
 		commands[1] = Command::SetPageAddress;
-		commands[3] = (Height == 64 ? 0 : 4);
-		commands[5] = 7;
+		commands[3] = (Height == 64 ? 0 : 4) + firstPage;
+		commands[5] = (Height == 64 ? 0 : 4) + lastPage;
 		commands[13] = 0xfc;
 		return Writing(commands, 6, OperationAfterWrite::Restart);
 	}
@@ -59,8 +70,17 @@ xpcc::ssd1306::DataTransmissionAdapter<Height>::writing()
 		return Writing(&commands[13], 1, OperationAfterWrite::Write);
 	}
 
-	// now we write the entire frame buffer into it.
-	return Writing(buffer, size, OperationAfterWrite::Stop);
+	// now we write the window of the frame buffer into it.
+	// with vertical addressing the columns of the buffer are contiguous,
+	// so complete columns are written at once.
+	if (firstPage == 0 and lastPage == (Height / 8 - 1)) {
+		return Writing(buffer, size, OperationAfterWrite::Stop);
+	}
+
+	// otherwise every column is a separate chunk
+	const uint8_t current = column++;
+	return Writing(&frame[current][firstPage], lastPage - firstPage + 1,
+			(current == lastColumn) ? OperationAfterWrite::Stop : OperationAfterWrite::Write);
 }
 
 template < uint8_t Height >
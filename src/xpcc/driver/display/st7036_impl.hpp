@@ -81,13 +81,12 @@ xpcc::St7036<SPI, CS, RS, Width, Heigth>::execute(Command command)
 
 template <typename SPI, typename CS, typename RS, unsigned int Width, unsigned int Heigth>
 void
-xpcc::St7036<SPI, CS, RS, Width, Heigth>::setCursor(uint8_t newLine, uint8_t newColumn)
+xpcc::St7036<SPI, CS, RS, Width, Heigth>::setCursor(uint8_t column, uint8_t line)
 {
-	this->column = newColumn;
-	this->line = newLine;
+	this->column = column;
+	this->line = line;
 
-	newColumn += 0x40 * newLine;
-	writeCommand(0x80 | newColumn);
+	writeCommand(0x80 | (column + 0x40 * line));
 }
 
 // ----------------------------------------------------------------------------
@@ -34,32 +34,33 @@
 #include <xpcc/architecture/driver/accessor/flash.hpp>
 #include <xpcc/architecture/driver/delay.hpp>
 
-#include <xpcc/ui/display/buffered_graphic_display.hpp>
+#include <xpcc/ui/display/asynchronous_graphic_display.hpp>
 
 namespace xpcc
 {
 	/**
 	 * \brief	Driver for ST7565 based LC-displays
 	 *
+	 * Every changed page is sent with one `SPI::transfer()`, so the
+	 * display can be updated in the background with startUpdate() and
+	 * transmit(), see xpcc::AsynchronousGraphicDisplay. The SPI master is
+	 * acquired for every page, so other devices on the same bus can
+	 * transfer between two pages.
+	 *
 	 * \author	Fabian Greif
 	 * \ingroup	driver_display
 	 */
 	template <typename SPI, typename CS, typename A0, typename Reset,
-			  unsigned int Width, unsigned int Height, bool TopView>
-	class St7565 : public BufferedGraphicDisplay<Width, Height>
+			  unsigned int Width, unsigned int Height, bool TopView,
+			  bool DoubleBuffered = false>
+	class St7565 : public AsynchronousGraphicDisplay<Width, Height, DoubleBuffered>
 	{
 	public:
 		virtual ~St7565()
 		{
 		}
 
-		/**
-		 * \brief	Update the display with the content of the RAM buffer
-		 */
-		virtual void
-		update();
-
-		/// Invert the display content
+		/// Invert the display content, waits for a running update
 		void
 		setInvert(bool invert);
 
@@ -67,6 +68,12 @@ namespace xpcc
 		xpcc_always_inline void
 		initialize(xpcc::accessor::Flash<uint8_t> configuration, uint8_t size);
 
+		virtual xpcc::ResumableResult<void>
+		writePage(uint16_t page, uint16_t column, uint8_t *data, uint16_t length);
+
+		// page and column address
+		uint8_t commandBuffer[3];
+
 		SPI spi;
 		CS cs;
 		A0 a0;
@@ -35,38 +35,45 @@
 #include "st7565_defines.hpp"
 
 // ----------------------------------------------------------------------------
-template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView>
-void
-xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::update()
+template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView, bool DoubleBuffered>
+xpcc::ResumableResult<void>
+xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView, DoubleBuffered>::writePage(
+		uint16_t page, uint16_t column, uint8_t *data, uint16_t length)
 {
+	RF_BEGIN();
+
+	// other devices may use the bus between two pages
+	RF_WAIT_UNTIL(SPI::acquire(this));
+
+	// the RAM of the controller is 132 columns wide
+	column += (TopView ? 4 : 0);
+	commandBuffer[0] = ST7565_PAGE_ADDRESS | page;						// Row select
+	commandBuffer[1] = ST7565_COL_ADDRESS_MSB | (column >> 4);			// Column select high
+	commandBuffer[2] = ST7565_COL_ADDRESS_LSB | (column & 0x0f);		// Column select low
+
 	cs.reset();
-	for(uint8_t y = 0; y < (Height / 8); ++y)
-	{
-		// command mode
-		a0.reset();
-		spi.transferBlocking(ST7565_PAGE_ADDRESS | y);		// Row select
-		spi.transferBlocking(ST7565_COL_ADDRESS_MSB);		// Column select high
-
-		if (TopView) {
-			spi.transferBlocking(ST7565_COL_ADDRESS_LSB | 4);	// Column select low
-		}
-		else {
-			spi.transferBlocking(ST7565_COL_ADDRESS_LSB);	// Column select low
-		}
-
-		// switch to data mode
-		a0.set();
-		for(uint8_t x = 0; x < Width; ++x) {
-			spi.transferBlocking(this->display_buffer[x][y]);
-		}
-	}
+
+	// command mode
+	a0.reset();
+	RF_CALL(SPI::transfer(commandBuffer, nullptr, 3));
+
+	// switch to data mode
+	a0.set();
+	RF_CALL(SPI::transfer(data, nullptr, length));
+
 	cs.set();
+	SPI::release(this);
+
+	RF_END();
 }
 
-template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView>
+template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView, bool DoubleBuffered>
 void
-xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::setInvert(bool invert)
+xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView, DoubleBuffered>::setInvert(bool invert)
 {
+	// do not interrupt the transmission of a page
+	RF_CALL_BLOCKING(this->transmit());
+
 	cs.reset();
 	a0.reset();
 
@@ -80,9 +87,9 @@ xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::setInvert(bool invert)
 }
 
 // ----------------------------------------------------------------------------
-template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView>
+template <typename SPI, typename CS, typename A0, typename Reset, unsigned int Width, unsigned int Height, bool TopView, bool DoubleBuffered>
 void
-xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView>::initialize(
+xpcc::St7565<SPI, CS, A0, Reset, Width, Height, TopView, DoubleBuffered>::initialize(
 		xpcc::accessor::Flash<uint8_t> configuration, uint8_t size)
 {
 	//spi.initialize();
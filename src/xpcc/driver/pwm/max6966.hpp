@@ -215,6 +215,24 @@ namespace xpcc
 			setChannels(intensity);
 		}
 
+		/**
+		 * \brief	Set the 8bit values of consecutive channels
+		 *
+		 * The same port of all drivers is written in one frame, so at
+		 * most 10 frames are needed, independent of the number of
+		 * channels. Ports outside of the range are skipped.
+		 *
+		 * \param first	first channel
+		 * \param values	pwm values, one for each channel
+		 * \param count	number of channels
+		 */
+		static void
+		setChannels(uint16_t first, const uint8_t * values, uint16_t count);
+
+		/// Same as setChannels(), but converts every value with intensityToPwm()
+		static void
+		setChannelsIntensity(uint16_t first, const uint8_t * intensity, uint16_t count);
+
 		/// \param value	the 8bit value of all channels (same value for all channels)
 		static void
 		setAllChannels(uint8_t value);
@@ -244,6 +262,9 @@ namespace xpcc
 		setAllCurrent(max6966::Current current);
 
 	protected:
+		static void
+		writeChannels(uint16_t first, const uint8_t * values, uint16_t count, bool intensity);
+
 		static void
 		writeToDriver(uint8_t driver, max6966::Register reg, uint8_t data);
 
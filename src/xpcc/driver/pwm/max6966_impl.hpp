@@ -89,6 +89,20 @@ xpcc::MAX6966<Spi, Cs, DRIVERS>::setChannels(uint8_t * values)
 	}
 }
 
+template<typename Spi, typename Cs, uint8_t DRIVERS>
+void
+xpcc::MAX6966<Spi, Cs, DRIVERS>::setChannels(uint16_t first, const uint8_t * values, uint16_t count)
+{
+	writeChannels(first, values, count, false);
+}
+
+template<typename Spi, typename Cs, uint8_t DRIVERS>
+void
+xpcc::MAX6966<Spi, Cs, DRIVERS>::setChannelsIntensity(uint16_t first, const uint8_t * intensity, uint16_t count)
+{
+	writeChannels(first, intensity, count, true);
+}
+
 template<typename Spi, typename Cs, uint8_t DRIVERS>
 void
 xpcc::MAX6966<Spi, Cs, DRIVERS>::setAllChannels(uint8_t value)
@@ -155,6 +169,49 @@ xpcc::MAX6966<Spi, Cs, DRIVERS>::setAllCurrent(max6966::Current current)
 }
 
 // MARK: protected
+template<typename Spi, typename Cs, uint8_t DRIVERS>
+void
+xpcc::MAX6966<Spi, Cs, DRIVERS>::writeChannels(uint16_t first, const uint8_t * values, uint16_t count, bool intensity)
+{
+	if (first >= DRIVERS*10)
+		return;
+	if (count > DRIVERS*10 - first)
+		count = DRIVERS*10 - first;
+
+	const uint16_t end = first + count;
+	// for all ports
+	for (uint_fast8_t ch = 0; ch < 10; ++ch)
+	{
+		// skip ports without any channel in the range
+		bool used = false;
+		for (uint_fast8_t dr = 0; dr < DRIVERS and not used; ++dr)
+		{
+			const uint16_t channel = ch + dr * 10;
+			used = (channel >= first and channel < end);
+		}
+		if (not used)
+			continue;
+
+		Cs::reset();
+		// for all drivers, the others get a NO_OP
+		for (uint_fast8_t dr = 0; dr < DRIVERS; ++dr)
+		{
+			const uint16_t channel = ch + dr * 10;
+			if (channel >= first and channel < end)
+			{
+				const uint8_t value = values[channel - first];
+				Spi::transferBlocking(max6966::REGISTER_PORT0 + ch);
+				Spi::transferBlocking(intensity ? intensityToPwm(value) : value);
+			}
+			else {
+				Spi::transferBlocking(max6966::REGISTER_NO_OP);
+				Spi::transferBlocking(0xff);
+			}
+		}
+		Cs::set();
+	}
+}
+
 template<typename Spi, typename Cs, uint8_t DRIVERS>
 void
 xpcc::MAX6966<Spi, Cs, DRIVERS>::writeToDriver(uint8_t driver, max6966::Register reg, uint8_t data)
@@ -143,6 +143,82 @@ struct pca9685
 		MODE2_OUTNE1  = 0x02,
 		MODE2_OUTNE0  = 0x01,
 	};
+
+protected:
+	/// @cond
+	/// Streams the registers of consecutive channels channel by channel,
+	/// so that no buffer for all 16 channels is needed.
+	class DataTransmissionAdapter : public xpcc::I2cWriteTransaction
+	{
+	public:
+		DataTransmissionAdapter(uint8_t address) :
+			I2cWriteTransaction(address), values(nullptr), count(0), channel(0)
+		{}
+
+		bool
+		configureWrite(const uint8_t *buffer, std::size_t size)
+		{
+			if (I2cWriteTransaction::configureWrite(buffer, size))
+			{
+				count = 0;
+				return true;
+			}
+			return false;
+		}
+
+		bool
+		configureChannelsWrite(uint8_t first, const uint16_t *values, uint8_t count)
+		{
+			registerAddress = REG_LED0_ON_L + 4 * first;
+			if (I2cWriteTransaction::configureWrite(&registerAddress, 1))
+			{
+				this->values = values;
+				this->count = count;
+				return true;
+			}
+			return false;
+		}
+
+	protected:
+		Starting
+		starting() override
+		{
+			channel = 0xff;
+			return I2cWriteTransaction::starting();
+		}
+
+		Writing
+		writing() override
+		{
+			if (count == 0) {
+				return I2cWriteTransaction::writing();
+			}
+
+			// the auto increment continues with the following channels
+			if (channel == 0xff)
+			{
+				channel = 0;
+				return Writing(&registerAddress, 1, OperationAfterWrite::Write);
+			}
+
+			// all LEDs are turned on at tick 0
+			const uint16_t value = values[channel];
+			registers[0] = 0x00;
+			registers[1] = 0x00;
+			registers[2] = uint8_t(value);
+			registers[3] = uint8_t(value >> 8) & 0x0f;
+			return Writing(registers, 4,
+					(++channel < count) ? OperationAfterWrite::Write : OperationAfterWrite::Stop);
+		}
+
+	private:
+		const uint16_t *values;
+		uint8_t count;
+		uint8_t channel;
+		uint8_t registerAddress;
+		uint8_t registers[4];
+	};
+	/// @endcond
 };	// struct pca9685
 
 /**
@@ -165,7 +241,7 @@ struct pca9685
  * @ingroup driver_pwm
  */
 template<typename I2cMaster>
-class Pca9685 : public pca9685, public xpcc::I2cDevice< I2cMaster, 1, I2cWriteTransaction >
+class Pca9685 : public pca9685, public xpcc::I2cDevice< I2cMaster, 1, pca9685::DataTransmissionAdapter >
 {
 	uint8_t buffer[3];
 
@@ -212,6 +288,21 @@ public:
 	 */
 	xpcc::ResumableResult<bool>
 	setAllChannels(uint16_t value);
+
+	/**
+	 * Set the 12-bit PWM values of consecutive channels.
+	 *
+	 * All channels are written with a single I2C transaction using the
+	 * auto increment of the register address, instead of one
+	 * transaction per channel. The registers are streamed channel by
+	 * channel, so `values` must stay valid until the call returns.
+	 *
+	 * @param first  first channel (0-15)
+	 * @param values 12-bit PWM values, one for each channel
+	 * @param count  number of channels, `first + count` must not exceed 16
+	 */
+	xpcc::ResumableResult<bool>
+	setChannels(uint8_t first, const uint16_t *values, uint8_t count);
 };
 
 }	// namespace xpcc
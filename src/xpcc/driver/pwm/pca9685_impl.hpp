@@ -37,7 +37,7 @@
 // ----------------------------------------------------------------------------
 template<typename I2cMaster>
 xpcc::Pca9685<I2cMaster>::Pca9685(uint8_t address) :
-	I2cDevice<I2cMaster, 1, I2cWriteTransaction>(address)
+	I2cDevice<I2cMaster, 1, pca9685::DataTransmissionAdapter>(address)
 {}
 
 template<typename I2cMaster>
@@ -109,3 +109,18 @@ xpcc::Pca9685<I2cMaster>::setAllChannels(uint16_t value)
 
 	RF_END_RETURN_CALL( this->runTransaction() );
 }
+
+template<typename I2cMaster>
+xpcc::ResumableResult<bool>
+xpcc::Pca9685<I2cMaster>::setChannels(uint8_t first, const uint16_t *values, uint8_t count)
+{
+	RF_BEGIN();
+
+	if (count == 0 or first >= 16 or count > 16 - first)
+		RF_RETURN(false);
+
+	// start with the ON register of the first channel
+	this->transaction.configureChannelsWrite(first, values, count);
+
+	RF_END_RETURN_CALL( this->runTransaction() );
+}
@@ -87,6 +87,14 @@ public:
 	static void
 	setAllChannels(uint16_t value, bool update=false);
 
+	/// set the 12bit values of consecutive channels
+	/// The chips are a shift register, so writeChannels() always
+	/// transfers all channels. Collect the changes first and write
+	/// them with a single transfer.
+	/// @param update	write data to chip
+	static void
+	setChannels(uint16_t first, const uint16_t *values, uint16_t count, bool update=false);
+
 	/// get the stored 12bit value of a channel
 	/// this does reflect the actual value in the chip
 	static uint16_t
@@ -90,6 +90,19 @@ xpcc::TLC594X<CHANNELS, Spi, Xlat, Vprog, Xerr>::setAllChannels(uint16_t value,
 	if (update) writeChannels(true);
 }
 
+template<uint16_t CHANNELS, typename Spi, typename Xlat, typename Vprog, typename Xerr>
+void
+xpcc::TLC594X<CHANNELS, Spi, Xlat, Vprog, Xerr>::setChannels(uint16_t first, const uint16_t *values, uint16_t count, bool update)
+{
+	if (first > CHANNELS-1) return;
+	if (count > CHANNELS - first) count = CHANNELS - first;
+
+	for (uint_fast16_t i=0; i < count; ++i) {
+		setChannel(first + i, values[i]);
+	}
+	if (update) writeChannels(true);
+}
+
 template<uint16_t CHANNELS, typename Spi, typename Xlat, typename Vprog, typename Xerr>
 uint16_t
 xpcc::TLC594X<CHANNELS, Spi, Xlat, Vprog, Xerr>::getChannel(uint16_t channel)
@@ -37,9 +37,12 @@
 #define XPCC__MATH_HPP
 
 #include "math/filter.hpp"
+#include "math/fixed.hpp"
 #include "math/geometry.hpp"
 #include "math/matrix.hpp"
 #include "math/lu_decomposition.hpp"
+#include "math/cholesky_decomposition.hpp"
+#include "math/qr_decomposition.hpp"
 #include "math/interpolation.hpp"
 #include "math/tolerance.hpp"
 #include "math/utils.hpp"
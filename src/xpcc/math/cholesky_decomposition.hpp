@@ -0,0 +1,106 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CHOLESKY_DECOMPOSITION_HPP
+#define XPCC__CHOLESKY_DECOMPOSITION_HPP
+
+#include "matrix.hpp"
+#include "triangular_solver.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Decomposition of symmetric positive-definite matrices
+	 *
+	 * Factorises A = L*L^T or A = L*D*L^T in place. Only the lower triangle
+	 * of A is read. This takes about half the operations of a LU
+	 * decomposition and needs no pivoting for positive-definite matrices,
+	 * which makes it the right tool for covariance matrices.
+	 *
+	 * The update functions modify an existing factor instead of
+	 * decomposing again, and solveRight() computes B*A^-1 (e.g. a Kalman
+	 * gain P*H^T*S^-1) without forming the inverse.
+	 *
+	 * \code
+	 * xpcc::Matrix<float, 3, 3> s = ...;
+	 * if (xpcc::CholeskyDecomposition::decompose(s)) {
+	 *     xpcc::CholeskyDecomposition::solveRight(s, &gain);
+	 * }
+	 * \endcode
+	 *
+	 * \ingroup	matrix
+	 */
+	class CholeskyDecomposition
+	{
+	public:
+		/**
+		 * Replace A with its lower triangular factor L (A = L*L^T).
+		 *
+		 * The upper triangle is set to zero.
+		 * \return	`false` if A is not positive-definite
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decompose(Matrix<T, N, N> &a);
+
+		/**
+		 * Replace A with L and D (A = L*D*L^T).
+		 *
+		 * D is stored on the diagonal, the strictly lower triangle holds L
+		 * with an implicit unit diagonal and the upper triangle is set to
+		 * zero. Needs no square roots and also works for symmetric
+		 * indefinite matrices, as long as no pivot becomes zero.
+		 *
+		 * \return	`false` if a pivot is zero
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decomposeLdlt(Matrix<T, N, N> &a);
+
+		/// Solve A*X = B with the factor from decompose(), B is overwritten
+		template <typename T, uint8_t N, uint8_t COLUMNS>
+		static bool
+		solve(const Matrix<T, N, N> &l, Matrix<T, N, COLUMNS> *bx);
+
+		/// Solve A*X = B with the factors from decomposeLdlt(), B is overwritten
+		template <typename T, uint8_t N, uint8_t COLUMNS>
+		static bool
+		solveLdlt(const Matrix<T, N, N> &ld, Matrix<T, N, COLUMNS> *bx);
+
+		/// Calculate X = B*A^-1 with the factor from decompose(), B is overwritten
+		template <typename T, uint8_t N, uint8_t ROWS>
+		static bool
+		solveRight(const Matrix<T, N, N> &l, Matrix<T, ROWS, N> *bx);
+
+		/**
+		 * Rank-one update: replace L with the factor of L*L^T + x*x^T.
+		 *
+		 * Costs O(N^2) instead of O(N^3) for a new decomposition.
+		 * \p x is used as scratch space and destroyed.
+		 */
+		template <typename T, uint8_t N>
+		static void
+		update(Matrix<T, N, N> &l, Matrix<T, N, 1> *x);
+
+		/**
+		 * Rank-one downdate: replace L with the factor of L*L^T - x*x^T.
+		 *
+		 * \p x is used as scratch space and destroyed.
+		 * \return	`false` if the result would not be positive-definite,
+		 *			L is undefined in this case.
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		downdate(Matrix<T, N, N> &l, Matrix<T, N, 1> *x);
+	};
+}
+
+#include "cholesky_decomposition_impl.hpp"
+
+#endif // XPCC__CHOLESKY_DECOMPOSITION_HPP
@@ -0,0 +1,198 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CHOLESKY_DECOMPOSITION_HPP
+	#error	"Don't include this file directly, use 'cholesky_decomposition.hpp' instead!"
+#endif
+
+#include <cmath>
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+bool
+xpcc::CholeskyDecomposition::decompose(xpcc::Matrix<T, N, N> &a)
+{
+	for (uint_fast8_t j = 0; j < N; ++j)
+	{
+		T d = a[j][j];
+		for (uint_fast8_t k = 0; k < j; ++k) {
+			d -= a[j][k] * a[j][k];
+		}
+		// also catches NaN
+		if (!(d > T(0))) {
+			return false;
+		}
+		d = std::sqrt(d);
+		a[j][j] = d;
+
+		const T inverse = T(1) / d;
+		for (uint_fast8_t i = j + 1; i < N; ++i)
+		{
+			T s = a[i][j];
+			for (uint_fast8_t k = 0; k < j; ++k) {
+				s -= a[i][k] * a[j][k];
+			}
+			a[i][j] = s * inverse;
+			a[j][i] = T(0);
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+bool
+xpcc::CholeskyDecomposition::decomposeLdlt(xpcc::Matrix<T, N, N> &a)
+{
+	for (uint_fast8_t j = 0; j < N; ++j)
+	{
+		// row j of L scaled by D is kept in the upper part of column j
+		T d = a[j][j];
+		for (uint_fast8_t k = 0; k < j; ++k)
+		{
+			a[k][j] = a[j][k] * a[k][k];
+			d -= a[j][k] * a[k][j];
+		}
+		if (d == T(0)) {
+			return false;
+		}
+		a[j][j] = d;
+
+		const T inverse = T(1) / d;
+		for (uint_fast8_t i = j + 1; i < N; ++i)
+		{
+			T s = a[i][j];
+			for (uint_fast8_t k = 0; k < j; ++k) {
+				s -= a[i][k] * a[k][j];
+			}
+			a[i][j] = s * inverse;
+		}
+		for (uint_fast8_t k = 0; k < j; ++k) {
+			a[k][j] = T(0);
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N, uint8_t COLUMNS>
+bool
+xpcc::CholeskyDecomposition::solve(
+		const xpcc::Matrix<T, N, N> &l,
+		xpcc::Matrix<T, N, COLUMNS> *bx)
+{
+	return TriangularSolver::solveLower(l, bx) and
+			TriangularSolver::solveLowerTransposed(l, bx);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N, uint8_t COLUMNS>
+bool
+xpcc::CholeskyDecomposition::solveLdlt(
+		const xpcc::Matrix<T, N, N> &ld,
+		xpcc::Matrix<T, N, COLUMNS> *bx)
+{
+	TriangularSolver::solveLower(ld, bx, true);
+	for (uint_fast8_t i = 0; i < N; ++i)
+	{
+		if (ld[i][i] == T(0)) {
+			return false;
+		}
+		const T inverse = T(1) / ld[i][i];
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			(*bx)[i][j] *= inverse;
+		}
+	}
+	return TriangularSolver::solveLowerTransposed(ld, bx, true);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N, uint8_t ROWS>
+bool
+xpcc::CholeskyDecomposition::solveRight(
+		const xpcc::Matrix<T, N, N> &l,
+		xpcc::Matrix<T, ROWS, N> *bx)
+{
+	// X*L*L^T = B is solved row by row, as A is symmetric each row x of X
+	// satisfies L*L^T*x^T = b^T.
+	for (uint_fast8_t r = 0; r < ROWS; ++r)
+	{
+		T *x = (*bx)[r];
+		for (uint_fast8_t i = 0; i < N; ++i)
+		{
+			if (l[i][i] == T(0)) {
+				return false;
+			}
+			T s = x[i];
+			for (uint_fast8_t k = 0; k < i; ++k) {
+				s -= l[i][k] * x[k];
+			}
+			x[i] = s / l[i][i];
+		}
+		for (uint_fast8_t i = N; i-- > 0; )
+		{
+			T s = x[i];
+			for (uint_fast8_t k = i + 1; k < N; ++k) {
+				s -= l[k][i] * x[k];
+			}
+			x[i] = s / l[i][i];
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+void
+xpcc::CholeskyDecomposition::update(
+		xpcc::Matrix<T, N, N> &l,
+		xpcc::Matrix<T, N, 1> *x)
+{
+	// sequence of Givens rotations, see Golub/Van Loan, section 6.5.4
+	for (uint_fast8_t k = 0; k < N; ++k)
+	{
+		const T xk = x->element[k];
+		const T r = std::sqrt(l[k][k] * l[k][k] + xk * xk);
+		const T c = r / l[k][k];
+		const T s = xk / l[k][k];
+		l[k][k] = r;
+		for (uint_fast8_t i = k + 1; i < N; ++i)
+		{
+			l[i][k] = (l[i][k] + s * x->element[i]) / c;
+			x->element[i] = c * x->element[i] - s * l[i][k];
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N>
+bool
+xpcc::CholeskyDecomposition::downdate(
+		xpcc::Matrix<T, N, N> &l,
+		xpcc::Matrix<T, N, 1> *x)
+{
+	for (uint_fast8_t k = 0; k < N; ++k)
+	{
+		const T xk = x->element[k];
+		const T r2 = l[k][k] * l[k][k] - xk * xk;
+		if (!(r2 > T(0))) {
+			return false;
+		}
+		const T r = std::sqrt(r2);
+		const T c = r / l[k][k];
+		const T s = xk / l[k][k];
+		l[k][k] = r;
+		for (uint_fast8_t i = k + 1; i < N; ++i)
+		{
+			l[i][k] = (l[i][k] - s * x->element[i]) / c;
+			x->element[i] = c * x->element[i] - s * l[i][k];
+		}
+	}
+	return true;
+}
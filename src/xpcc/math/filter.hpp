@@ -34,8 +34,10 @@
  *
  */
 
+#include "filter/ahrs.hpp"
 #include "filter/debounce.hpp"
 #include "filter/fir.hpp"
+#include "filter/fir_polyphase.hpp"
 #include "filter/median.hpp"
 #include "filter/moving_average.hpp"
 #include "filter/pid.hpp"
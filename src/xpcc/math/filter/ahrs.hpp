@@ -0,0 +1,247 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__AHRS_HPP
+#define XPCC__AHRS_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <xpcc/math/geometry/quaternion.hpp>
+#include <xpcc/math/geometry/vector3.hpp>
+#include <xpcc/math/utils/operator.hpp>
+#include <xpcc/math/fixed/fixed_math.hpp>
+
+namespace xpcc
+{
+	namespace filter
+	{
+		/**
+		 * \brief	Common part of the attitude filters
+		 *
+		 * Holds the orientation as unit quaternion, which rotates vectors
+		 * from the sensor frame into the earth frame (z-axis up).
+		 *
+		 * `T` is either `float` or a xpcc::fixed type. For fixed-point
+		 * use enough integer bits for the angular rates in rad/s and
+		 * for the squared length of the accelerometer and magnetometer
+		 * vectors, e.g. `xpcc::fixed<int32_t, 24>` with the acceleration
+		 * in g and the magnetic field in Gauss.
+		 *
+		 * \see		xpcc::filter::Madgwick
+		 * \see		xpcc::filter::Mahony
+		 * \ingroup	filter
+		 */
+		template<typename T>
+		class Ahrs
+		{
+		public:
+			typedef Quaternion<T> QuaternionType;
+			typedef Vector<T, 3> VectorType;
+
+		public:
+			/// Current orientation
+			inline const QuaternionType&
+			getQuaternion() const
+			{
+				return this->quaternion;
+			}
+
+			/// Start from a known orientation, must have the length 1
+			inline void
+			setQuaternion(const QuaternionType& quaternion)
+			{
+				this->quaternion = quaternion;
+			}
+
+			inline const T&
+			getSamplePeriod() const
+			{
+				return this->samplePeriod;
+			}
+
+			/// Rotate a vector from the sensor frame into the earth frame
+			VectorType
+			toEarthFrame(const VectorType& vector) const;
+
+		protected:
+			Ahrs(const T& samplePeriod);
+
+			/// Normalize the vector, returns `false` for the zero vector
+			static bool
+			normalize(VectorType& vector);
+
+			static void
+			normalize(QuaternionType& q);
+
+			/// q += 1/2 q * (0, rate) * samplePeriod
+			static void
+			integrate(QuaternionType& q, const VectorType& rate, const T& halfPeriod);
+
+			/// Direction of the earth magnetic field (bx, 0, bz) seen from q
+			static void
+			getMagneticReference(const QuaternionType& q, const VectorType& magnetometer,
+					T& bx, T& bz);
+
+		protected:
+			QuaternionType quaternion;
+			T samplePeriod;
+			T halfPeriod;
+		};
+
+		/**
+		 * \brief	Madgwick attitude filter
+		 *
+		 * Integrates the angular rate and corrects the drift with a
+		 * gradient descent step towards the orientation measured by the
+		 * accelerometer and, optionally, the magnetometer. Only
+		 * multiplications, additions and one inverse square root per
+		 * normalized vector are needed, see
+		 * xpcc::math::fastInverseSqrt().
+		 *
+		 * \code
+		 * xpcc::filter::Madgwick<float> filter(1.f / 400, 0.05f);
+		 *
+		 * // gyroscope in rad/s, accelerometer in any unit
+		 * filter.update(gyroscope, accelerometer);
+		 *
+		 * // or a complete FIFO burst at once
+		 * filter.update(gyroscopeSamples, accelerometerSamples, count);
+		 * \endcode
+		 *
+		 * \see	S. Madgwick, "An efficient orientation filter for inertial
+		 * 		and inertial/magnetic sensor arrays", 2010
+		 * \ingroup	filter
+		 */
+		template<typename T>
+		class Madgwick : public Ahrs<T>
+		{
+		public:
+			typedef Quaternion<T> QuaternionType;
+			typedef Vector<T, 3> VectorType;
+
+		public:
+			/**
+			 * \param	samplePeriod	time between two updates in seconds
+			 * \param	beta			gain of the correction in rad/s,
+			 * 							about sqrt(3/4) times the gyroscope
+			 * 							noise.
+			 */
+			Madgwick(const T& samplePeriod, const T& beta = T(0.1f));
+
+			inline void
+			setBeta(const T& beta)
+			{
+				this->betaPeriod = beta * this->samplePeriod;
+			}
+
+			/// Gyroscope and accelerometer
+			void
+			update(const VectorType& gyroscope, const VectorType& accelerometer);
+
+			/// Gyroscope, accelerometer and magnetometer
+			void
+			update(const VectorType& gyroscope, const VectorType& accelerometer,
+					const VectorType& magnetometer);
+
+			/**
+			 * \brief	Process a burst of samples from a sensor FIFO
+			 *
+			 * Same result as calling update() for every sample, but the
+			 * state stays in registers for the whole burst.
+			 */
+			void
+			update(const VectorType* gyroscope, const VectorType* accelerometer,
+					size_t count);
+
+		private:
+			inline void
+			step(QuaternionType& q, const VectorType& gyroscope,
+					VectorType accelerometer) const;
+
+			// beta * samplePeriod
+			T betaPeriod;
+		};
+
+		/**
+		 * \brief	Mahony attitude filter
+		 *
+		 * Nonlinear complementary filter: the cross product between the
+		 * measured and the estimated direction of gravity (and of the
+		 * magnetic field) is fed back to the angular rate by a PI
+		 * controller. The integral part estimates the gyroscope bias.
+		 *
+		 * \see	R. Mahony et al., "Nonlinear Complementary Filters on the
+		 * 		Special Orthogonal Group", 2008
+		 * \ingroup	filter
+		 */
+		template<typename T>
+		class Mahony : public Ahrs<T>
+		{
+		public:
+			typedef Quaternion<T> QuaternionType;
+			typedef Vector<T, 3> VectorType;
+
+		public:
+			/**
+			 * \param	samplePeriod	time between two updates in seconds
+			 * \param	kp				proportional gain in 1/s
+			 * \param	ki				integral gain in 1/s², 0 disables
+			 * 							the bias estimation
+			 */
+			Mahony(const T& samplePeriod, const T& kp = T(1), const T& ki = T(0));
+
+			inline void
+			setGains(const T& kp, const T& ki)
+			{
+				this->kp = kp;
+				this->kiPeriod = ki * this->samplePeriod;
+			}
+
+			/// Estimated gyroscope bias in rad/s, subtracted from the rate
+			inline VectorType
+			getBias() const
+			{
+				return VectorType(-this->integral.x, -this->integral.y, -this->integral.z);
+			}
+
+			/// Gyroscope and accelerometer
+			void
+			update(const VectorType& gyroscope, const VectorType& accelerometer);
+
+			/// Gyroscope, accelerometer and magnetometer
+			void
+			update(const VectorType& gyroscope, const VectorType& accelerometer,
+					const VectorType& magnetometer);
+
+			/// Process a burst of samples from a sensor FIFO
+			void
+			update(const VectorType* gyroscope, const VectorType* accelerometer,
+					size_t count);
+
+		private:
+			inline void
+			step(QuaternionType& q, VectorType& integral,
+					VectorType gyroscope, VectorType error) const;
+
+			// error between the measured and the estimated direction of gravity
+			static bool
+			getGravityError(const QuaternionType& q, VectorType accelerometer,
+					VectorType& error);
+
+			T kp;
+			T kiPeriod;
+			VectorType integral;
+		};
+	}
+}
+
+#include "ahrs_impl.hpp"
+
+#endif // XPCC__AHRS_HPP
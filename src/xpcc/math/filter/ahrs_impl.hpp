@@ -0,0 +1,320 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__AHRS_HPP
+#	error	"Don't include this file directly, use 'ahrs.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::filter::Ahrs<T>::Ahrs(const T& samplePeriod) :
+	quaternion(T(1), T(0), T(0), T(0)),
+	samplePeriod(samplePeriod), halfPeriod(samplePeriod / 2)
+{
+}
+
+template<typename T>
+typename xpcc::filter::Ahrs<T>::VectorType
+xpcc::filter::Ahrs<T>::toEarthFrame(const VectorType& v) const
+{
+	const QuaternionType& q = this->quaternion;
+	return VectorType(
+		v.x * (T(1) - 2 * (q.y * q.y + q.z * q.z)) +
+			2 * (v.y * (q.x * q.y - q.w * q.z) + v.z * (q.x * q.z + q.w * q.y)),
+		v.y * (T(1) - 2 * (q.x * q.x + q.z * q.z)) +
+			2 * (v.x * (q.x * q.y + q.w * q.z) + v.z * (q.y * q.z - q.w * q.x)),
+		v.z * (T(1) - 2 * (q.x * q.x + q.y * q.y)) +
+			2 * (v.x * (q.x * q.z - q.w * q.y) + v.y * (q.y * q.z + q.w * q.x)));
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+bool
+xpcc::filter::Ahrs<T>::normalize(VectorType& v)
+{
+	const T lengthSquared = v.x * v.x + v.y * v.y + v.z * v.z;
+	if (!(lengthSquared > T(0))) {
+		return false;
+	}
+
+	const T factor = xpcc::math::fastInverseSqrt(lengthSquared);
+	v.x = v.x * factor;
+	v.y = v.y * factor;
+	v.z = v.z * factor;
+	return true;
+}
+
+template<typename T>
+void
+xpcc::filter::Ahrs<T>::normalize(QuaternionType& q)
+{
+	const T lengthSquared = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+	if (lengthSquared > T(0))
+	{
+		const T factor = xpcc::math::fastInverseSqrt(lengthSquared);
+		q.w = q.w * factor;
+		q.x = q.x * factor;
+		q.y = q.y * factor;
+		q.z = q.z * factor;
+	}
+}
+
+template<typename T>
+void
+xpcc::filter::Ahrs<T>::integrate(QuaternionType& q, const VectorType& r, const T& halfPeriod)
+{
+	const T dw = -q.x * r.x - q.y * r.y - q.z * r.z;
+	const T dx =  q.w * r.x + q.y * r.z - q.z * r.y;
+	const T dy =  q.w * r.y - q.x * r.z + q.z * r.x;
+	const T dz =  q.w * r.z + q.x * r.y - q.y * r.x;
+
+	q.w = q.w + dw * halfPeriod;
+	q.x = q.x + dx * halfPeriod;
+	q.y = q.y + dy * halfPeriod;
+	q.z = q.z + dz * halfPeriod;
+}
+
+template<typename T>
+void
+xpcc::filter::Ahrs<T>::getMagneticReference(const QuaternionType& q,
+		const VectorType& m, T& bx, T& bz)
+{
+	// magnetic field in the earth frame
+	const T hx = m.x * (T(1) - 2 * (q.y * q.y + q.z * q.z)) +
+			2 * (m.y * (q.x * q.y - q.w * q.z) + m.z * (q.x * q.z + q.w * q.y));
+	const T hy = m.y * (T(1) - 2 * (q.x * q.x + q.z * q.z)) +
+			2 * (m.x * (q.x * q.y + q.w * q.z) + m.z * (q.y * q.z - q.w * q.x));
+	const T hz = m.z * (T(1) - 2 * (q.x * q.x + q.y * q.y)) +
+			2 * (m.x * (q.x * q.z - q.w * q.y) + m.y * (q.y * q.z + q.w * q.x));
+
+	// only the inclination is used, not the heading
+	const T horizontal = hx * hx + hy * hy;
+	bx = (horizontal > T(0)) ? horizontal * xpcc::math::fastInverseSqrt(horizontal) : T(0);
+	bz = hz;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::filter::Madgwick<T>::Madgwick(const T& samplePeriod, const T& beta) :
+	Ahrs<T>(samplePeriod), betaPeriod(beta * samplePeriod)
+{
+}
+
+template<typename T>
+void
+xpcc::filter::Madgwick<T>::step(QuaternionType& q, const VectorType& g,
+		VectorType a) const
+{
+	if (this->normalize(a))
+	{
+		// objective function of gravity multiplied with its Jacobian
+		const T fx = 2 * (q.x * q.z - q.w * q.y) - a.x;
+		const T fy = 2 * (q.w * q.x + q.y * q.z) - a.y;
+		const T fz = T(1) - 2 * (q.x * q.x + q.y * q.y) - a.z;
+
+		QuaternionType s(
+			2 * (q.x * fy - q.y * fx),
+			2 * (q.z * fx + q.w * fy) - 4 * q.x * fz,
+			2 * (q.z * fy - q.w * fx) - 4 * q.y * fz,
+			2 * (q.x * fx + q.y * fy));
+		this->normalize(s);
+
+		this->integrate(q, g, this->halfPeriod);
+		q.w = q.w - s.w * this->betaPeriod;
+		q.x = q.x - s.x * this->betaPeriod;
+		q.y = q.y - s.y * this->betaPeriod;
+		q.z = q.z - s.z * this->betaPeriod;
+	}
+	else {
+		this->integrate(q, g, this->halfPeriod);
+	}
+	this->normalize(q);
+}
+
+template<typename T>
+void
+xpcc::filter::Madgwick<T>::update(const VectorType& gyroscope,
+		const VectorType& accelerometer)
+{
+	this->step(this->quaternion, gyroscope, accelerometer);
+}
+
+template<typename T>
+void
+xpcc::filter::Madgwick<T>::update(const VectorType* gyroscope,
+		const VectorType* accelerometer, size_t count)
+{
+	QuaternionType q = this->quaternion;
+	for (size_t i = 0; i < count; ++i) {
+		this->step(q, gyroscope[i], accelerometer[i]);
+	}
+	this->quaternion = q;
+}
+
+template<typename T>
+void
+xpcc::filter::Madgwick<T>::update(const VectorType& gyroscope,
+		const VectorType& accelerometer, const VectorType& magnetometer)
+{
+	VectorType a(accelerometer);
+	VectorType m(magnetometer);
+	if (!this->normalize(m) || !this->normalize(a)) {
+		this->step(this->quaternion, gyroscope, accelerometer);
+		return;
+	}
+
+	QuaternionType& q = this->quaternion;
+
+	T bx, bz;
+	this->getMagneticReference(q, m, bx, bz);
+	const T tbx = 2 * bx;
+	const T tbz = 2 * bz;
+
+	const T fx = 2 * (q.x * q.z - q.w * q.y) - a.x;
+	const T fy = 2 * (q.w * q.x + q.y * q.z) - a.y;
+	const T fz = T(1) - 2 * (q.x * q.x + q.y * q.y) - a.z;
+
+	const T mx = tbx * (T(0.5f) - q.y * q.y - q.z * q.z) + tbz * (q.x * q.z - q.w * q.y) - m.x;
+	const T my = tbx * (q.x * q.y - q.w * q.z) + tbz * (q.w * q.x + q.y * q.z) - m.y;
+	const T mz = tbx * (q.w * q.y + q.x * q.z) + tbz * (T(0.5f) - q.x * q.x - q.y * q.y) - m.z;
+
+	QuaternionType s(
+		2 * (q.x * fy - q.y * fx)
+			- tbz * q.y * mx
+			+ (tbz * q.x - tbx * q.z) * my
+			+ tbx * q.y * mz,
+		2 * (q.z * fx + q.w * fy) - 4 * q.x * fz
+			+ tbz * q.z * mx
+			+ (tbx * q.y + tbz * q.w) * my
+			+ (tbx * q.z - 2 * tbz * q.x) * mz,
+		2 * (q.z * fy - q.w * fx) - 4 * q.y * fz
+			- (2 * tbx * q.y + tbz * q.w) * mx
+			+ (tbx * q.x + tbz * q.z) * my
+			+ (tbx * q.w - 2 * tbz * q.y) * mz,
+		2 * (q.x * fx + q.y * fy)
+			+ (tbz * q.x - 2 * tbx * q.z) * mx
+			+ (tbz * q.y - tbx * q.w) * my
+			+ tbx * q.x * mz);
+	this->normalize(s);
+
+	this->integrate(q, gyroscope, this->halfPeriod);
+	q.w = q.w - s.w * this->betaPeriod;
+	q.x = q.x - s.x * this->betaPeriod;
+	q.y = q.y - s.y * this->betaPeriod;
+	q.z = q.z - s.z * this->betaPeriod;
+	this->normalize(q);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T>
+xpcc::filter::Mahony<T>::Mahony(const T& samplePeriod, const T& kp, const T& ki) :
+	Ahrs<T>(samplePeriod), kp(kp), kiPeriod(ki * samplePeriod),
+	integral(T(0), T(0), T(0))
+{
+}
+
+template<typename T>
+bool
+xpcc::filter::Mahony<T>::getGravityError(const QuaternionType& q,
+		VectorType a, VectorType& error)
+{
+	if (!Ahrs<T>::normalize(a)) {
+		return false;
+	}
+
+	// estimated direction of gravity in the sensor frame
+	const T vx = 2 * (q.x * q.z - q.w * q.y);
+	const T vy = 2 * (q.w * q.x + q.y * q.z);
+	const T vz = q.w * q.w - q.x * q.x - q.y * q.y + q.z * q.z;
+
+	error.x = a.y * vz - a.z * vy;
+	error.y = a.z * vx - a.x * vz;
+	error.z = a.x * vy - a.y * vx;
+	return true;
+}
+
+template<typename T>
+void
+xpcc::filter::Mahony<T>::step(QuaternionType& q, VectorType& integral,
+		VectorType g, VectorType e) const
+{
+	if (this->kiPeriod > T(0))
+	{
+		integral.x = integral.x + e.x * this->kiPeriod;
+		integral.y = integral.y + e.y * this->kiPeriod;
+		integral.z = integral.z + e.z * this->kiPeriod;
+
+		g.x = g.x + integral.x;
+		g.y = g.y + integral.y;
+		g.z = g.z + integral.z;
+	}
+
+	g.x = g.x + e.x * this->kp;
+	g.y = g.y + e.y * this->kp;
+	g.z = g.z + e.z * this->kp;
+
+	this->integrate(q, g, this->halfPeriod);
+	this->normalize(q);
+}
+
+template<typename T>
+void
+xpcc::filter::Mahony<T>::update(const VectorType& gyroscope,
+		const VectorType& accelerometer)
+{
+	VectorType error(T(0), T(0), T(0));
+	getGravityError(this->quaternion, accelerometer, error);
+	this->step(this->quaternion, this->integral, gyroscope, error);
+}
+
+template<typename T>
+void
+xpcc::filter::Mahony<T>::update(const VectorType* gyroscope,
+		const VectorType* accelerometer, size_t count)
+{
+	QuaternionType q = this->quaternion;
+	VectorType i = this->integral;
+	for (size_t k = 0; k < count; ++k)
+	{
+		VectorType error(T(0), T(0), T(0));
+		getGravityError(q, accelerometer[k], error);
+		this->step(q, i, gyroscope[k], error);
+	}
+	this->quaternion = q;
+	this->integral = i;
+}
+
+template<typename T>
+void
+xpcc::filter::Mahony<T>::update(const VectorType& gyroscope,
+		const VectorType& accelerometer, const VectorType& magnetometer)
+{
+	const QuaternionType& q = this->quaternion;
+
+	VectorType error(T(0), T(0), T(0));
+	getGravityError(q, accelerometer, error);
+
+	VectorType m(magnetometer);
+	if (this->normalize(m))
+	{
+		T bx, bz;
+		this->getMagneticReference(q, m, bx, bz);
+
+		// estimated direction of the magnetic field in the sensor frame
+		const T wx = 2 * (bx * (T(0.5f) - q.y * q.y - q.z * q.z) + bz * (q.x * q.z - q.w * q.y));
+		const T wy = 2 * (bx * (q.x * q.y - q.w * q.z) + bz * (q.w * q.x + q.y * q.z));
+		const T wz = 2 * (bx * (q.w * q.y + q.x * q.z) + bz * (T(0.5f) - q.x * q.x - q.y * q.y));
+
+		error.x = error.x + (m.y * wz - m.z * wy);
+		error.y = error.y + (m.z * wx - m.x * wz);
+		error.z = error.z + (m.x * wy - m.y * wx);
+	}
+
+	this->step(this->quaternion, this->integral, gyroscope, error);
+}
@@ -32,6 +32,9 @@
 #define XPCC__FIR_HPP
 
 #include <stdint.h>
+#include <stddef.h>
+
+#include "fir_kernel.hpp"
 
 namespace xpcc
 {
@@ -40,16 +43,33 @@ namespace xpcc
 	 *
 	 * g[n] = SUM(h[k]x[n-k])
 	 * 
-	 * \todo	
+	 * The last N samples are kept in a circular delay line, in which every
+	 * sample is stored twice. This way the samples are always contiguous
+	 * in memory and no samples have to be moved when appending.
+	 * The multiply-accumulate loop is done by xpcc::filter::FirKernel,
+	 * which uses SIMD instructions where available.
+	 * 
+	 * For fixed-point filters use an integer type for `T` and
+	 * scale the coefficients with `ScaleFactor`, for example
+	 * `Fir<int16_t, 32, 1, 32768>` for Q15 samples and coefficients.
+	 * All coefficients must then be smaller than 1.
+	 * 
+	 * \tparam	T			type of the samples
+	 * \tparam	N			number of coefficients
+	 * \tparam	BLOCK_SIZE	unused, only kept for compatibility
+	 * \tparam	ScaleFactor	the coefficients are multiplied with this
+	 * 						factor and the result is divided by it
 	 * 
 	 * \author	Kevin Laeufer
 	 * \ingroup	filter
 	 */
 	namespace filter
 	{
-		template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor = 1>
+		template<typename T, int N, int BLOCK_SIZE = 1, signed int ScaleFactor = 1>
 		class Fir
 		{
+		public:
+			typedef typename FirKernel<T>::Accumulator Accumulator;
 
 		public:
 			/**
@@ -74,7 +94,7 @@ namespace xpcc
 			/**
 			 * \brief	Appends new tap
 			 */
-			void
+			inline void
 			append(const T& input);
 		
 			/**
@@ -92,10 +112,26 @@ namespace xpcc
 			{
 				return output;
 			}
-		
+
+			/**
+			 * \brief	Filters a block of samples
+			 *
+			 * Equivalent to calling append() and update() for every sample,
+			 * but without the call overhead. `input` and `output` may
+			 * point to the same buffer.
+			 *
+			 * \param	input	`n` input samples
+			 * \param	output	buffer for `n` output samples
+			 */
+			void
+			process(const T *input, T *output, size_t n);
+
 		private:
-			T output;	
-			T taps[N+BLOCK_SIZE];
+			inline T
+			calculate() const;
+
+			T output;
+			T taps[2 * N];
 			T coefficients[N];
 			int taps_index;
 		};
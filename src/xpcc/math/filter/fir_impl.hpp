@@ -31,27 +31,6 @@
 #ifndef XPCC__FIR_IMPL_HPP
 #define XPCC__FIR_IMPL_HPP
 
-#include <xpcc/architecture/utils.hpp>
-
-//#define FIR_DEBUG
-
-#ifdef FIR_DEBUG
-	#include <stdio.h>
-
-	//#define FIR_DEBUG_APPEND
-	#define FIR_DEBUG_UPDATE
-
-	#ifdef FIR_DEBUG_UPDATE
-	#define FIR_DEBUG_SUM(tap, coeff) printf("sum += %.3f * %.3f;\n", tap, coeff)
-	#else
-	#define FIR_DEBUG_SUM(tap, coeff)
-	#endif /*FIR_DEBUG_UPDATE*/
-#else
-	#define FIR_DEBUG_SUM(tap, coeff)
-#endif /*FIR_DEBUG*/
-
-
-
 template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::Fir(const float (&coeff)[N])
 {
@@ -74,11 +53,11 @@ template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 void
 xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::reset()
 {
-	// reset all to make debugging easier
-	for(int i = 0; i < N + BLOCK_SIZE; i++){
+	for(int i = 0; i < 2 * N; i++){
 		taps[i] = (T)0;
 	}
-	taps_index = BLOCK_SIZE;
+	taps_index = 0;
+	output = (T)0;
 }
 
 // -----------------------------------------------------------------------------
@@ -86,65 +65,44 @@ template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 void
 xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::append(const T& input)
 {
-#ifdef FIR_DEBUG_APPEND
-	printf("append(%f);\ttaps_index=%d\n", input, taps_index);
-	printf("BEFORE: ");
-	for(int i = 0; i < N + BLOCK_SIZE; i++)
-		if(i >= taps_index && i-taps_index < N) printf("n-%d:%.3f; ", i-taps_index, taps[i]);
-		else printf("(%.3f)    ", taps[i]);
-	printf("\n");
-#endif // FIR_DEBUG_APPEND
-	if(xpcc_likely(taps_index > 0)){
-		taps_index--;
-	}
-	else{
-		for(int i = N + BLOCK_SIZE - 1; i > BLOCK_SIZE; i--)
-			taps[i] = taps[i - BLOCK_SIZE - 1];
-		taps_index = BLOCK_SIZE;
+	// the newest sample is at taps[taps_index], the older ones follow
+	if(taps_index == 0){
+		taps_index = N;
 	}
+	taps_index--;
 	taps[taps_index] = input;
-
-#ifdef FIR_DEBUG_APPEND
-	printf(" AFTER: ");
-	for(int i = 0; i < N + BLOCK_SIZE; i++)
-		if(i >= taps_index && i-taps_index < N) printf("n-%d:%.3f; ", i-taps_index, taps[i]);
-		else printf("(%.3f)    ", taps[i]);
-	printf("\n\n");
-#endif // FIR_DEBUG_APPEND
+	taps[taps_index + N] = input;
 }
 
 // -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+T
+xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::calculate() const
+{
+	Accumulator sum = FirKernel<T>::dot(taps + taps_index, coefficients, N);
+	return static_cast<T>(sum / ScaleFactor);
+}
+
 template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
 void
 xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::update()
 {
-#ifdef FIR_DEBUG_UPDATE
-	printf("update();\ttaps_index=%d\n", taps_index);
-	for(int i = 0; i < N + BLOCK_SIZE; i++)
-		if(i >= taps_index && i-taps_index < N) printf("n-%d:%.3f; ", i-taps_index, taps[i]);
-		else printf("(%.3f)    ", taps[i]);
-	printf("\n");
-#endif // FIR_DEBUG_UPDATE
+	output = calculate();
+}
 
-	T sum = (T)0;
-	T *tap = taps + taps_index;
-	for(int i = 0; i < (N - (N%4)); i++){
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i]; i++;
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i];
+// -----------------------------------------------------------------------------
+template<typename T, int N, int BLOCK_SIZE, signed int ScaleFactor>
+void
+xpcc::filter::Fir<T, N, BLOCK_SIZE, ScaleFactor>::process(
+		const T *input, T *output, size_t n)
+{
+	for(size_t i = 0; i < n; i++){
+		append(input[i]);
+		output[i] = calculate();
 	}
-	for(int i = (N - (N%4)); i < N; i++){
-		FIR_DEBUG_SUM(tap[i], coefficients[i]);
-		sum += tap[i]*coefficients[i];
+	if(n > 0){
+		this->output = output[n - 1];
 	}
-	output = sum / ScaleFactor;
-#ifdef FIR_DEBUG_UPDATE
-	printf("sum=%.3f\n", output);
-#endif // FIR_DEBUG_UPDATE
 }
+
 #endif // XPCC__FIR_IMPL_HPP
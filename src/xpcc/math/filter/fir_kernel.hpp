@@ -0,0 +1,77 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIR_KERNEL_HPP
+#define XPCC__FIR_KERNEL_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+
+namespace xpcc
+{
+	namespace filter
+	{
+		/**
+		 * \brief	Multiply-accumulate kernel of the FIR filters
+		 *
+		 * The generic implementation accumulates in the `WideType` of `T`
+		 * (see xpcc::ArithmeticTraits), so Q31 samples are accumulated in
+		 * 64 bits, which the compiler translates to `SMLAL` on Cortex-M3/M4.
+		 *
+		 * Specialized implementations are selected at compile time:
+		 * - `float` with SSE or AVX on x86 hosts,
+		 * - `float` with NEON on ARM hosts,
+		 * - `int16_t` (Q15) with the dual 16-bit `SMLAD` instruction on
+		 *   cores with the DSP extension (Cortex-M4/M7).
+		 *
+		 * All implementations give the same results for integer types.
+		 * Floating point results may differ in the last bits due to the
+		 * different order of summation.
+		 *
+		 * \ingroup	filter
+		 */
+		template<typename T>
+		struct FirKernel
+		{
+			typedef typename ArithmeticTraits<T>::WideType Accumulator;
+
+			/// \return	SUM(x[k] * h[k]) for k = 0 ... n-1
+			static inline Accumulator
+			dot(const T *x, const T *h, size_t n)
+			{
+				Accumulator sum = 0;
+				size_t i = 0;
+				for(; i + 4 <= n; i += 4){
+					sum += Accumulator(x[i    ]) * h[i    ];
+					sum += Accumulator(x[i + 1]) * h[i + 1];
+					sum += Accumulator(x[i + 2]) * h[i + 2];
+					sum += Accumulator(x[i + 3]) * h[i + 3];
+				}
+				for(; i < n; i++){
+					sum += Accumulator(x[i]) * h[i];
+				}
+				return sum;
+			}
+		};
+	}
+}
+
+#if defined(__SSE__)
+#	include "fir_kernel__x86_impl.hpp"
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	include "fir_kernel__neon_impl.hpp"
+#endif
+
+#if defined(__ARM_FEATURE_DSP)
+#	include "fir_kernel__cortex_dsp_impl.hpp"
+#endif
+
+#endif // XPCC__FIR_KERNEL_HPP
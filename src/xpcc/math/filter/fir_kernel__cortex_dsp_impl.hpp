@@ -0,0 +1,47 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIR_KERNEL_HPP
+#	error	"Don't include this file directly, use 'fir_kernel.hpp' instead!"
+#endif
+
+#include <string.h>
+
+namespace xpcc
+{
+	namespace filter
+	{
+		// Q15 with two 16x16 bit multiplications per SMLAD instruction
+		template<>
+		struct FirKernel<int16_t>
+		{
+			typedef int32_t Accumulator;
+
+			static inline int32_t
+			dot(const int16_t *x, const int16_t *h, size_t n)
+			{
+				int32_t sum = 0;
+				size_t i = 0;
+				for(; i + 2 <= n; i += 2){
+					// unaligned 32 bit accesses are allowed on ARMv7E-M
+					uint32_t xx, hh;
+					memcpy(&xx, x + i, 4);
+					memcpy(&hh, h + i, 4);
+					asm ("smlad %[sum], %[x], %[h], %[sum]"
+						: [sum] "+r" (sum)
+						: [x] "r" (xx), [h] "r" (hh));
+				}
+				if(i < n){
+					sum += int32_t(x[i]) * h[i];
+				}
+				return sum;
+			}
+		};
+	}
+}
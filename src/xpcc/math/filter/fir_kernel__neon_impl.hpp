@@ -0,0 +1,44 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIR_KERNEL_HPP
+#	error	"Don't include this file directly, use 'fir_kernel.hpp' instead!"
+#endif
+
+#include <arm_neon.h>
+
+namespace xpcc
+{
+	namespace filter
+	{
+		template<>
+		struct FirKernel<float>
+		{
+			typedef float Accumulator;
+
+			static inline float
+			dot(const float *x, const float *h, size_t n)
+			{
+				size_t i = 0;
+				float32x4_t acc = vdupq_n_f32(0.f);
+				for(; i + 4 <= n; i += 4){
+					acc = vmlaq_f32(acc, vld1q_f32(x + i), vld1q_f32(h + i));
+				}
+
+				float32x2_t pair = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+				float sum = vget_lane_f32(vpadd_f32(pair, pair), 0);
+
+				for(; i < n; i++){
+					sum += x[i] * h[i];
+				}
+				return sum;
+			}
+		};
+	}
+}
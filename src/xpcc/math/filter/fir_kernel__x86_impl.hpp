@@ -0,0 +1,60 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIR_KERNEL_HPP
+#	error	"Don't include this file directly, use 'fir_kernel.hpp' instead!"
+#endif
+
+#if defined(__AVX__)
+#	include <immintrin.h>
+#else
+#	include <xmmintrin.h>
+#endif
+
+namespace xpcc
+{
+	namespace filter
+	{
+		template<>
+		struct FirKernel<float>
+		{
+			typedef float Accumulator;
+
+			static inline float
+			dot(const float *x, const float *h, size_t n)
+			{
+				size_t i = 0;
+				__m128 acc = _mm_setzero_ps();
+#if defined(__AVX__)
+				__m256 acc8 = _mm256_setzero_ps();
+				for(; i + 8 <= n; i += 8){
+					acc8 = _mm256_add_ps(acc8,
+							_mm256_mul_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(h + i)));
+				}
+				acc = _mm_add_ps(_mm256_castps256_ps128(acc8),
+						_mm256_extractf128_ps(acc8, 1));
+#endif
+				for(; i + 4 <= n; i += 4){
+					acc = _mm_add_ps(acc,
+							_mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(h + i)));
+				}
+
+				// horizontal sum of the four lanes
+				acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+				acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+				float sum = _mm_cvtss_f32(acc);
+
+				for(; i < n; i++){
+					sum += x[i] * h[i];
+				}
+				return sum;
+			}
+		};
+	}
+}
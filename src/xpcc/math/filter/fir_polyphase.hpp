@@ -0,0 +1,140 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIR_POLYPHASE_HPP
+#define XPCC__FIR_POLYPHASE_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fir.hpp"
+
+namespace xpcc
+{
+	namespace filter
+	{
+		/**
+		 * \brief	Decimating FIR filter
+		 *
+		 * Low-pass filters the input and keeps only every M-th sample.
+		 * The filter is split into M sub-filters of N/M coefficients
+		 * (rounded up, the missing coefficients are zero). A commutator
+		 * distributes the input samples over the sub-filters, and the
+		 * sum of all sub-filters is calculated once per output sample,
+		 * so filtering costs N/M multiply-accumulates per input sample.
+		 *
+		 * \tparam	T			type of the samples
+		 * \tparam	N			number of coefficients
+		 * \tparam	M			decimation factor
+		 * \tparam	ScaleFactor	see xpcc::filter::Fir
+		 *
+		 * \ingroup	filter
+		 */
+		template<typename T, int N, int M, signed int ScaleFactor = 1>
+		class FirDecimator
+		{
+			static_assert(M > 0, "The decimation factor must be positive!");
+
+		public:
+			typedef typename FirKernel<T>::Accumulator Accumulator;
+
+		public:
+			FirDecimator(const float (&coeff)[N]);
+
+			void
+			setCoefficients(const float (&coeff)[N]);
+
+			/// Resets the delay lines and the decimation phase
+			void
+			reset();
+
+			/**
+			 * \brief	Filters and decimates a block of samples
+			 *
+			 * The decimation phase is kept between calls, so the
+			 * block size does not need to be a multiple of M.
+			 *
+			 * \param	input	`n` input samples
+			 * \param	output	buffer for up to `(n + M - 1) / M` output samples
+			 * \return	number of output samples written
+			 */
+			size_t
+			process(const T *input, T *output, size_t n);
+
+		private:
+			static constexpr int P = (N + M - 1) / M;
+
+			// one delay line per sub-filter, see xpcc::filter::Fir
+			T taps[M][2 * P];
+			// coefficients sorted by phase: [p][k] = h[k * M + p]
+			T coefficients[M][P];
+			int taps_index;
+			// index of the next input sample modulo M
+			int phase;
+		};
+
+		/**
+		 * \brief	Interpolating FIR filter
+		 *
+		 * Inserts L-1 zeros after every input sample and low-pass
+		 * filters the result. The filter is split into L sub-filters of
+		 * N/L coefficients, so that the zeros are never multiplied.
+		 *
+		 * The coefficients should have a DC gain of L to keep the
+		 * amplitude of the signal.
+		 *
+		 * \tparam	T			type of the samples
+		 * \tparam	N			number of coefficients, must be a multiple of L
+		 * \tparam	L			interpolation factor
+		 * \tparam	ScaleFactor	see xpcc::filter::Fir
+		 *
+		 * \ingroup	filter
+		 */
+		template<typename T, int N, int L, signed int ScaleFactor = 1>
+		class FirInterpolator
+		{
+			static_assert(L > 0, "The interpolation factor must be positive!");
+			static_assert(N % L == 0, "N must be a multiple of L!");
+
+		public:
+			typedef typename FirKernel<T>::Accumulator Accumulator;
+
+		public:
+			FirInterpolator(const float (&coeff)[N]);
+
+			void
+			setCoefficients(const float (&coeff)[N]);
+
+			/// Resets the delay line
+			void
+			reset();
+
+			/**
+			 * \brief	Interpolates a block of samples
+			 *
+			 * \param	input	`n` input samples
+			 * \param	output	buffer for `n * L` output samples
+			 */
+			void
+			process(const T *input, T *output, size_t n);
+
+		private:
+			static constexpr int P = N / L;
+
+			T taps[2 * P];
+			// coefficients sorted by phase: [p][k] = h[k * L + p]
+			T coefficients[L][P];
+			int taps_index;
+		};
+	}
+}
+
+#include "fir_polyphase_impl.hpp"
+
+#endif // XPCC__FIR_POLYPHASE_HPP
@@ -0,0 +1,135 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIR_POLYPHASE_HPP
+#	error	"Don't include this file directly, use 'fir_polyphase.hpp' instead!"
+#endif
+
+template<typename T, int N, int M, signed int ScaleFactor>
+constexpr int xpcc::filter::FirDecimator<T, N, M, ScaleFactor>::P;
+
+template<typename T, int N, int M, signed int ScaleFactor>
+xpcc::filter::FirDecimator<T, N, M, ScaleFactor>::FirDecimator(const float (&coeff)[N])
+{
+	setCoefficients(coeff);
+	reset();
+}
+
+template<typename T, int N, int M, signed int ScaleFactor>
+void
+xpcc::filter::FirDecimator<T, N, M, ScaleFactor>::setCoefficients(const float (&coeff)[N])
+{
+	for(int p = 0; p < M; p++){
+		for(int k = 0; k < P; k++){
+			const int i = k * M + p;
+			coefficients[p][k] = (i < N) ? static_cast<T>(coeff[i] * ScaleFactor) : (T)0;
+		}
+	}
+}
+
+template<typename T, int N, int M, signed int ScaleFactor>
+void
+xpcc::filter::FirDecimator<T, N, M, ScaleFactor>::reset()
+{
+	for(int p = 0; p < M; p++){
+		for(int i = 0; i < 2 * P; i++){
+			taps[p][i] = (T)0;
+		}
+	}
+	taps_index = 0;
+	phase = 0;
+}
+
+template<typename T, int N, int M, signed int ScaleFactor>
+size_t
+xpcc::filter::FirDecimator<T, N, M, ScaleFactor>::process(
+		const T *input, T *output, size_t n)
+{
+	size_t count = 0;
+	for(size_t i = 0; i < n; i++)
+	{
+		// Output m is sum(h[k * M + p] * x[(m - k) * M - p]), so the
+		// sample x[n] belongs to the sub-filter p = -n mod M. All
+		// sub-filters write to the same slot in their delay line, the
+		// slot is moved when sub-filter 0 has got its sample.
+		const int p = (phase == 0) ? 0 : M - phase;
+		const int slot = ((taps_index == 0) ? P : taps_index) - 1;
+		taps[p][slot] = input[i];
+		taps[p][slot + P] = input[i];
+
+		if(p == 0)
+		{
+			taps_index = slot;
+
+			Accumulator sum = 0;
+			for(int q = 0; q < M; q++){
+				sum += FirKernel<T>::dot(taps[q] + taps_index, coefficients[q], P);
+			}
+			output[count++] = static_cast<T>(sum / ScaleFactor);
+		}
+		if(++phase >= M){
+			phase = 0;
+		}
+	}
+	return count;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, int N, int L, signed int ScaleFactor>
+constexpr int xpcc::filter::FirInterpolator<T, N, L, ScaleFactor>::P;
+
+template<typename T, int N, int L, signed int ScaleFactor>
+xpcc::filter::FirInterpolator<T, N, L, ScaleFactor>::FirInterpolator(const float (&coeff)[N])
+{
+	setCoefficients(coeff);
+	reset();
+}
+
+template<typename T, int N, int L, signed int ScaleFactor>
+void
+xpcc::filter::FirInterpolator<T, N, L, ScaleFactor>::setCoefficients(const float (&coeff)[N])
+{
+	for(int p = 0; p < L; p++){
+		for(int k = 0; k < P; k++){
+			coefficients[p][k] = static_cast<T>(coeff[k * L + p] * ScaleFactor);
+		}
+	}
+}
+
+template<typename T, int N, int L, signed int ScaleFactor>
+void
+xpcc::filter::FirInterpolator<T, N, L, ScaleFactor>::reset()
+{
+	for(int i = 0; i < 2 * P; i++){
+		taps[i] = (T)0;
+	}
+	taps_index = 0;
+}
+
+template<typename T, int N, int L, signed int ScaleFactor>
+void
+xpcc::filter::FirInterpolator<T, N, L, ScaleFactor>::process(
+		const T *input, T *output, size_t n)
+{
+	for(size_t i = 0; i < n; i++)
+	{
+		// same circular delay line as in xpcc::filter::Fir
+		if(taps_index == 0){
+			taps_index = P;
+		}
+		taps_index--;
+		taps[taps_index] = input[i];
+		taps[taps_index + P] = input[i];
+
+		for(int p = 0; p < L; p++){
+			Accumulator sum = FirKernel<T>::dot(taps + taps_index, coefficients[p], P);
+			*output++ = static_cast<T>(sum / ScaleFactor);
+		}
+	}
+}
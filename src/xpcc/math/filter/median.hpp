@@ -43,9 +43,16 @@ namespace xpcc
 		 * Calculates the median of a input set. Useful for eliminating spikes
 		 * from the input. Adds a group delay of N/2 ticks for the signal.
 		 * 
-		 * Implementation are available for N = 3, 5, 7 and 9. To find
-		 * the median the signal values will be partly sorted, but only as much
-		 * as needed to find the median.
+		 * Optimized implementations are available for N = 1, 3, 5, 7 and 9. To
+		 * find the median the signal values will be partly sorted, but only as
+		 * much as needed to find the median.
+		 * 
+		 * For all other window sizes the samples are kept sorted in a
+		 * balanced search tree (a treap with subtree sizes), which needs
+		 * O(log N) operations per appended sample and per order statistic.
+		 * The median is calculated by update() and then available in O(1).
+		 * These implementations additionally allow to query any other order
+		 * statistic with getOrderStatistic() and getPercentile().
 		 * 
 		 * \code
 		 * // create a new filter for five samples
@@ -70,6 +77,8 @@ namespace xpcc
 		template<typename T, int N>
 		class Median
 		{
+			static_assert(N > 0 and N < 0xffff, "N must be between 1 and 65534!");
+
 		public:
 			/**
 			 * \brief	Constructor
@@ -85,11 +94,74 @@ namespace xpcc
 			
 			/// calculate median
 			void
-			udpate();
+			update();
 			
 			/// Get median value
 			const T
 			getValue() const;
+
+			/**
+			 * \brief	Get the k-th smallest value of the input buffer
+			 *
+			 * \param	k	0 for the minimum, N-1 for the maximum
+			 */
+			const T
+			getOrderStatistic(uint16_t k) const;
+
+			/**
+			 * \brief	Get a percentile of the input buffer
+			 *
+			 * Uses the nearest lower rank, i.e. 0 returns the minimum,
+			 * 50 the median (the lower one for even N) and 100 the maximum.
+			 */
+			const T
+			getPercentile(uint8_t percent) const;
+
+		private:
+			/// @cond
+			template<bool Small, typename Dummy = void>
+			struct IndexType { typedef uint16_t Type; };
+			template<typename Dummy>
+			struct IndexType<true, Dummy> { typedef uint8_t Type; };
+			/// @endcond
+
+			typedef typename IndexType<(N < 0xff)>::Type Index;
+
+			// index of an empty subtree
+			static constexpr Index nil = N;
+
+			static inline uint16_t
+			priority(Index node);
+
+			inline Index
+			size(Index node) const;
+
+			inline bool
+			less(Index a, Index b) const;
+
+			inline void
+			updateSize(Index node);
+
+			void
+			split(Index tree, Index key, Index& left, Index& right);
+
+			Index
+			merge(Index left, Index right);
+
+			Index
+			insert(Index tree, Index node);
+
+			Index
+			remove(Index tree, Index node);
+
+			// the ring buffer with the samples, node i contains value i
+			T values[N];
+			Index left[N];
+			Index right[N];
+			Index sizes[N];
+			Index root;
+			Index index;
+			T median;
 		};
 	}
 }
@@ -0,0 +1,64 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_FILTER__MEDIAN_HPP
+	#error	"Don't include this file directly, use 'median.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+namespace xpcc
+{
+	namespace filter
+	{
+		// a single sample is its own median and every order statistic
+		template <typename T>
+		class Median<T, 1>
+		{
+		public:
+			Median(const T& initialValue = 0) :
+				sample(initialValue), median(initialValue)
+			{
+			}
+			
+			void
+			append(const T& input)
+			{
+				sample = input;
+			}
+			
+			void
+			update()
+			{
+				median = sample;
+			}
+			
+			const T
+			getValue() const
+			{
+				return median;
+			}
+			
+			const T
+			getOrderStatistic(uint16_t /* k */) const
+			{
+				return sample;
+			}
+			
+			const T
+			getPercentile(uint8_t /* percent */) const
+			{
+				return sample;
+			}
+		
+		private:
+			T sample;
+			T median;
+		};
+	}
+}
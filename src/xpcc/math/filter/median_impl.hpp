@@ -36,6 +36,7 @@
 #define XPCC_MEDIAN__SORT(a,b) do { if (a > b) { XPCC_MEDIAN__SWAP(a, b); } } while (0);
 #define XPCC_MEDIAN__SWAP(a,b) do { T temp = a; a = b; b = temp; } while (0);
 
+#include "median_1_impl.hpp"
 #include "median_3_impl.hpp"
 #include "median_5_impl.hpp"
 #include "median_7_impl.hpp"
@@ -45,4 +46,199 @@
 #undef XPCC_MEDIAN__SWAP
 
 // ----------------------------------------------------------------------------
-// TODO General implementation
+// General implementation for arbitrary window sizes
+
+template <typename T, int N>
+constexpr typename xpcc::filter::Median<T, N>::Index xpcc::filter::Median<T, N>::nil;
+
+template <typename T, int N>
+xpcc::filter::Median<T, N>::Median(const T& initialValue) :
+	root(nil), index(0), median(initialValue)
+{
+	for (Index i = 0; i < N; ++i)
+	{
+		values[i] = initialValue;
+		left[i] = nil;
+		right[i] = nil;
+		sizes[i] = 1;
+		root = insert(root, i);
+	}
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::append(const T& input)
+{
+	// replace the oldest sample
+	root = remove(root, index);
+	values[index] = input;
+	left[index] = nil;
+	right[index] = nil;
+	sizes[index] = 1;
+	root = insert(root, index);
+
+	if (++index >= N) {
+		index = 0;
+	}
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::update()
+{
+	median = getOrderStatistic((N - 1) / 2);
+}
+
+template <typename T, int N>
+const T
+xpcc::filter::Median<T, N>::getValue() const
+{
+	return median;
+}
+
+template <typename T, int N>
+const T
+xpcc::filter::Median<T, N>::getOrderStatistic(uint16_t k) const
+{
+	if (k >= N) {
+		k = N - 1;
+	}
+
+	Index node = root;
+	while (true)
+	{
+		const Index leftSize = size(left[node]);
+		if (k < leftSize) {
+			node = left[node];
+		}
+		else if (k == leftSize) {
+			return values[node];
+		}
+		else {
+			k -= leftSize + 1;
+			node = right[node];
+		}
+	}
+}
+
+template <typename T, int N>
+const T
+xpcc::filter::Median<T, N>::getPercentile(uint8_t percent) const
+{
+	if (percent > 100) {
+		percent = 100;
+	}
+	return getOrderStatistic(uint32_t(percent) * (N - 1) / 100);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, int N>
+uint16_t
+xpcc::filter::Median<T, N>::priority(Index node)
+{
+	// fixed pseudo-random priority for every node, which keeps the
+	// tree balanced independent of the order of the values
+	return uint16_t((node + 1) * 40503u);
+}
+
+template <typename T, int N>
+typename xpcc::filter::Median<T, N>::Index
+xpcc::filter::Median<T, N>::size(Index node) const
+{
+	return (node == nil) ? 0 : sizes[node];
+}
+
+template <typename T, int N>
+bool
+xpcc::filter::Median<T, N>::less(Index a, Index b) const
+{
+	// equal values are ordered by their index to make all keys unique
+	return (values[a] < values[b]) or
+			(not (values[b] < values[a]) and (a < b));
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::updateSize(Index node)
+{
+	sizes[node] = size(left[node]) + size(right[node]) + 1;
+}
+
+template <typename T, int N>
+void
+xpcc::filter::Median<T, N>::split(Index tree, Index key, Index& leftTree, Index& rightTree)
+{
+	if (tree == nil) {
+		leftTree = nil;
+		rightTree = nil;
+	}
+	else if (less(tree, key)) {
+		split(right[tree], key, right[tree], rightTree);
+		leftTree = tree;
+		updateSize(tree);
+	}
+	else {
+		split(left[tree], key, leftTree, left[tree]);
+		rightTree = tree;
+		updateSize(tree);
+	}
+}
+
+template <typename T, int N>
+typename xpcc::filter::Median<T, N>::Index
+xpcc::filter::Median<T, N>::merge(Index leftTree, Index rightTree)
+{
+	if (leftTree == nil) {
+		return rightTree;
+	}
+	if (rightTree == nil) {
+		return leftTree;
+	}
+	if (priority(leftTree) > priority(rightTree)) {
+		right[leftTree] = merge(right[leftTree], rightTree);
+		updateSize(leftTree);
+		return leftTree;
+	}
+	left[rightTree] = merge(leftTree, left[rightTree]);
+	updateSize(rightTree);
+	return rightTree;
+}
+
+template <typename T, int N>
+typename xpcc::filter::Median<T, N>::Index
+xpcc::filter::Median<T, N>::insert(Index tree, Index node)
+{
+	if (tree == nil) {
+		return node;
+	}
+	if (priority(node) > priority(tree)) {
+		split(tree, node, left[node], right[node]);
+		updateSize(node);
+		return node;
+	}
+	if (less(node, tree)) {
+		left[tree] = insert(left[tree], node);
+	}
+	else {
+		right[tree] = insert(right[tree], node);
+	}
+	updateSize(tree);
+	return tree;
+}
+
+template <typename T, int N>
+typename xpcc::filter::Median<T, N>::Index
+xpcc::filter::Median<T, N>::remove(Index tree, Index node)
+{
+	if (tree == node) {
+		return merge(left[node], right[node]);
+	}
+	if (less(node, tree)) {
+		left[tree] = remove(left[tree], node);
+	}
+	else {
+		right[tree] = remove(right[tree], node);
+	}
+	updateSize(tree);
+	return tree;
+}
@@ -0,0 +1,173 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/filter/ahrs.hpp>
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "ahrs_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+#include <cmath>
+
+namespace
+{
+	typedef xpcc::Vector3f Vector;
+	typedef xpcc::Quaternion<float> Quaternion;
+
+	typedef xpcc::fixed<int32_t, 24> Fixed;
+	typedef xpcc::Vector<Fixed, 3> FixedVector;
+
+	// 10 seconds at 400 Hz, processed in bursts like read from a FIFO
+	const uint32_t samples = 4000;
+	const float period = 1.f / 400;
+	const uint32_t burst = 32;
+
+	/*
+	 * Synthetic motion: the orientation follows a smooth angular rate made
+	 * of sine waves, the sensor samples are computed from it and get the
+	 * gyroscope bias and white noise of a typical MEMS IMU. The sequence
+	 * is generated deterministically in the test.
+	 */
+	struct SyntheticMotion
+	{
+		SyntheticMotion()
+		{
+			uint32_t state = 1;
+			Quaternion q(1, 0, 0, 0);
+			for (uint32_t i = 0; i < samples; ++i)
+			{
+				const float t = i * period;
+				const Vector rate(2.f * std::sin(t * 1.3f), 1.5f * std::cos(t * 0.7f),
+						0.8f * std::sin(t * 0.4f + 1));
+
+				// true orientation, integrated in small steps
+				for (uint8_t k = 0; k < 10; ++k)
+				{
+					const float h = period / 20;
+					q = Quaternion(
+						q.w + h * (-q.x * rate.x - q.y * rate.y - q.z * rate.z),
+						q.x + h * ( q.w * rate.x + q.y * rate.z - q.z * rate.y),
+						q.y + h * ( q.w * rate.y - q.x * rate.z + q.z * rate.x),
+						q.z + h * ( q.w * rate.z + q.x * rate.y - q.y * rate.x));
+					q.normalize();
+				}
+				truth[i] = q;
+
+				gyroscope[i] = Vector(rate.x + 0.01f + noise(state, 0.005f),
+						rate.y - 0.005f + noise(state, 0.005f), rate.z + noise(state, 0.005f));
+
+				// gravity in g, magnetic field in Gauss
+				accelerometer[i] = toSensorFrame(q, Vector(0, 0, 1));
+				accelerometer[i] = Vector(accelerometer[i].x + noise(state, 0.01f),
+						accelerometer[i].y + noise(state, 0.01f), accelerometer[i].z + noise(state, 0.01f));
+				magnetometer[i] = toSensorFrame(q, Vector(0.2f, 0, -0.45f));
+
+				fixedGyroscope[i] = FixedVector(Fixed(gyroscope[i].x), Fixed(gyroscope[i].y), Fixed(gyroscope[i].z));
+				fixedAccelerometer[i] = FixedVector(Fixed(accelerometer[i].x), Fixed(accelerometer[i].y), Fixed(accelerometer[i].z));
+			}
+		}
+
+		static float
+		noise(uint32_t& state, float amplitude)
+		{
+			state = state * 1103515245 + 12345;
+			return amplitude * (int32_t((state >> 8) & 0xffff) - 0x8000) / 0x8000;
+		}
+
+		static Vector
+		toSensorFrame(const Quaternion& q, const Vector& v)
+		{
+			xpcc::filter::Madgwick<float> rotation(1.f);
+			rotation.setQuaternion(Quaternion(q.w, -q.x, -q.y, -q.z));
+			return rotation.toEarthFrame(v);
+		}
+
+		Quaternion truth[samples];
+		Vector gyroscope[samples];
+		Vector accelerometer[samples];
+		Vector magnetometer[samples];
+		FixedVector fixedGyroscope[samples];
+		FixedVector fixedAccelerometer[samples];
+	};
+
+	// angle between the true and the estimated direction of gravity in degree
+	float
+	getTiltError(const Quaternion& q, const Quaternion& truth)
+	{
+		xpcc::filter::Madgwick<float> estimate(1.f);
+		estimate.setQuaternion(q);
+		const Vector up = estimate.toEarthFrame(SyntheticMotion::toSensorFrame(truth, Vector(0, 0, 1)));
+		return std::acos((up.z < 1.f) ? up.z : 1.f) * 180 / M_PI;
+	}
+}
+
+void
+AhrsBenchmarkTest::testReplay()
+{
+	static SyntheticMotion motion;
+	const Quaternion& truth = motion.truth[samples - 1];
+
+	xpcc::filter::Madgwick<float> madgwick(period, 0.05f);
+	unittest::Stopwatch stopwatch;
+	for (uint32_t i = 0; i < samples; ++i) {
+		madgwick.update(motion.gyroscope[i], motion.accelerometer[i]);
+	}
+	unittest::report("Madgwick<float>::update(gyro, accel)",
+			stopwatch.getTicks(), samples, "update");
+	TEST_ASSERT_TRUE(getTiltError(madgwick.getQuaternion(), truth) < 2.f);
+
+	xpcc::filter::Madgwick<float> batch(period, 0.05f);
+	stopwatch.restart();
+	for (uint32_t i = 0; i < samples; i += burst) {
+		batch.update(motion.gyroscope + i, motion.accelerometer + i, burst);
+	}
+	unittest::report("Madgwick<float>::update(gyro[], accel[], 32)",
+			stopwatch.getTicks(), samples, "update");
+	TEST_ASSERT_TRUE(batch.getQuaternion() == madgwick.getQuaternion());
+
+	xpcc::filter::Madgwick<float> marg(period, 0.05f);
+	stopwatch.restart();
+	for (uint32_t i = 0; i < samples; ++i) {
+		marg.update(motion.gyroscope[i], motion.accelerometer[i], motion.magnetometer[i]);
+	}
+	unittest::report("Madgwick<float>::update(gyro, accel, mag)",
+			stopwatch.getTicks(), samples, "update");
+	TEST_ASSERT_TRUE(getTiltError(marg.getQuaternion(), truth) < 2.f);
+
+	xpcc::filter::Mahony<float> mahony(period, 2.f, 0.05f);
+	stopwatch.restart();
+	for (uint32_t i = 0; i < samples; i += burst) {
+		mahony.update(motion.gyroscope + i, motion.accelerometer + i, burst);
+	}
+	unittest::report("Mahony<float>::update(gyro[], accel[], 32)",
+			stopwatch.getTicks(), samples, "update");
+	TEST_ASSERT_TRUE(getTiltError(mahony.getQuaternion(), truth) < 2.f);
+
+	xpcc::filter::Madgwick<Fixed> fixed(Fixed(period), Fixed(0.05f));
+	stopwatch.restart();
+	for (uint32_t i = 0; i < samples; i += burst) {
+		fixed.update(motion.fixedGyroscope + i, motion.fixedAccelerometer + i, burst);
+	}
+	unittest::report("Madgwick<fixed<int32_t, 24>>::update(gyro[], accel[], 32)",
+			stopwatch.getTicks(), samples, "update");
+
+	const xpcc::Quaternion<Fixed>& q = fixed.getQuaternion();
+	const Quaternion estimate(float(q.w), float(q.x), float(q.y), float(q.z));
+	TEST_ASSERT_TRUE(getTiltError(estimate, truth) < 2.f);
+}
+
+#else
+
+void
+AhrsBenchmarkTest::testReplay()
+{
+}
+
+#endif
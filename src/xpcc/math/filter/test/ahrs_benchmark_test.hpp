@@ -0,0 +1,20 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Replays a recorded IMU sequence through the attitude filters and
+/// reports the time per update. Only runs on hosted targets, the results
+/// are printed to the info log.
+class AhrsBenchmarkTest : public unittest::TestSuite
+{
+public:
+	void
+	testReplay();
+};
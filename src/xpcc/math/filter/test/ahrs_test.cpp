@@ -0,0 +1,228 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include <xpcc/math/filter/ahrs.hpp>
+#include <xpcc/math/fixed/fixed.hpp>
+
+#include "ahrs_test.hpp"
+
+typedef xpcc::Vector3f Vector;
+typedef xpcc::Quaternion<float> Quaternion;
+
+namespace
+{
+	// sensor frame vector of an earth frame vector for the orientation q
+	Vector
+	toSensorFrame(const Quaternion& q, const Vector& v)
+	{
+		const Quaternion c(q.w, -q.x, -q.y, -q.z);
+		xpcc::filter::Madgwick<float> filter(1.f);
+		filter.setQuaternion(c);
+		return filter.toEarthFrame(v);
+	}
+
+	Quaternion
+	rotation(float x, float y, float z, float angle)
+	{
+		const float s = std::sin(angle / 2);
+		return Quaternion(std::cos(angle / 2), x * s, y * s, z * s);
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+AhrsTest::testAtRest()
+{
+	xpcc::filter::Madgwick<float> madgwick(0.01f);
+	xpcc::filter::Mahony<float> mahony(0.01f, 2.f, 0.1f);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		madgwick.update(Vector(0, 0, 0), Vector(0, 0, 1));
+		mahony.update(Vector(0, 0, 0), Vector(0, 0, 9.81f));
+	}
+
+	TEST_ASSERT_EQUALS_DELTA(madgwick.getQuaternion().w, 1.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(madgwick.getQuaternion().x, 0.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(mahony.getQuaternion().w, 1.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(mahony.getQuaternion().z, 0.f, 1e-5f);
+
+	// a missing accelerometer sample only integrates the gyroscope
+	madgwick.update(Vector(0, 0, 0), Vector(0, 0, 0));
+	TEST_ASSERT_EQUALS_DELTA(madgwick.getQuaternion().w, 1.f, 1e-5f);
+}
+
+void
+AhrsTest::testGyroscopeIntegration()
+{
+	xpcc::filter::Madgwick<float> filter(0.001f, 0.f);
+
+	// 1 rad/s around z for one second, the accelerometer can't see this
+	for (int i = 0; i < 1000; ++i) {
+		filter.update(Vector(0, 0, 1.f), Vector(0, 0, 1.f));
+	}
+
+	const Quaternion& q = filter.getQuaternion();
+	TEST_ASSERT_EQUALS_DELTA(q.w, std::cos(0.5f), 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(q.x, 0.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(q.y, 0.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(q.z, std::sin(0.5f), 1e-4f);
+
+	const Vector east = filter.toEarthFrame(Vector(1, 0, 0));
+	TEST_ASSERT_EQUALS_DELTA(east.x, std::cos(1.f), 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(east.y, std::sin(1.f), 1e-3f);
+}
+
+void
+AhrsTest::testTiltConvergence()
+{
+	const Quaternion truth = rotation(1, 0, 0, 0.5f);
+	const Vector gravity = toSensorFrame(truth, Vector(0, 0, 1));
+
+	xpcc::filter::Madgwick<float> madgwick(0.01f, 0.5f);
+	xpcc::filter::Mahony<float> mahony(0.01f, 2.f);
+	for (int i = 0; i < 500; ++i)
+	{
+		madgwick.update(Vector(0, 0, 0), gravity);
+		mahony.update(Vector(0, 0, 0), gravity);
+	}
+
+	Vector up = madgwick.toEarthFrame(gravity);
+	TEST_ASSERT_EQUALS_DELTA(up.x, 0.f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(up.y, 0.f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(up.z, 1.f, 1e-3f);
+
+	up = mahony.toEarthFrame(gravity);
+	TEST_ASSERT_EQUALS_DELTA(up.x, 0.f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(up.y, 0.f, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(up.z, 1.f, 1e-3f);
+}
+
+void
+AhrsTest::testHeadingConvergence()
+{
+	// tilted and rotated by 60 degree around z
+	const Quaternion truth = rotation(0, 0, 1, 1.047f) * rotation(0, 1, 0, 0.3f);
+	const Vector gravity = toSensorFrame(truth, Vector(0, 0, 1));
+	const Vector field = toSensorFrame(truth, Vector(0.4f, 0, -0.9f));
+
+	xpcc::filter::Madgwick<float> madgwick(0.01f, 0.5f);
+	xpcc::filter::Mahony<float> mahony(0.01f, 2.f);
+	for (int i = 0; i < 3000; ++i)
+	{
+		madgwick.update(Vector(0, 0, 0), gravity, field);
+		mahony.update(Vector(0, 0, 0), gravity, field);
+	}
+
+	for (int k = 0; k < 2; ++k)
+	{
+		const Quaternion& q = (k == 0) ? madgwick.getQuaternion() : mahony.getQuaternion();
+
+		// same rotation up to the sign
+		const float dot = q.w * truth.w + q.x * truth.x + q.y * truth.y + q.z * truth.z;
+		TEST_ASSERT_EQUALS_DELTA(std::abs(dot), 1.f, 1e-4f);
+	}
+}
+
+void
+AhrsTest::testMahonyBias()
+{
+	// gyroscope with an offset, the integral part must remove it
+	xpcc::filter::Mahony<float> filter(0.01f, 1.f, 0.3f);
+	const Vector bias(0.02f, -0.01f, 0);
+
+	for (int i = 0; i < 5000; ++i) {
+		filter.update(bias, Vector(0, 0, 1));
+	}
+
+	TEST_ASSERT_EQUALS_DELTA(filter.getBias().x, bias.x, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(filter.getBias().y, bias.y, 1e-4f);
+
+	const Vector up = filter.toEarthFrame(Vector(0, 0, 1));
+	TEST_ASSERT_EQUALS_DELTA(up.z, 1.f, 1e-5f);
+}
+
+void
+AhrsTest::testBatchUpdate()
+{
+	Vector gyroscope[32];
+	Vector accelerometer[32];
+	for (int i = 0; i < 32; ++i)
+	{
+		gyroscope[i] = Vector(0.1f * std::sin(i * 0.3f), 0.5f, -0.2f);
+		accelerometer[i] = Vector(0.1f, 0.05f * i, 0.98f);
+	}
+
+	xpcc::filter::Madgwick<float> single(0.0025f, 0.1f);
+	xpcc::filter::Madgwick<float> batch(0.0025f, 0.1f);
+	xpcc::filter::Mahony<float> singleMahony(0.0025f, 1.f, 0.1f);
+	xpcc::filter::Mahony<float> batchMahony(0.0025f, 1.f, 0.1f);
+
+	for (int i = 0; i < 32; ++i)
+	{
+		single.update(gyroscope[i], accelerometer[i]);
+		singleMahony.update(gyroscope[i], accelerometer[i]);
+	}
+	batch.update(gyroscope, accelerometer, 20);
+	batch.update(gyroscope + 20, accelerometer + 20, 12);
+	batchMahony.update(gyroscope, accelerometer, 32);
+
+	TEST_ASSERT_TRUE(single.getQuaternion() == batch.getQuaternion());
+	TEST_ASSERT_TRUE(singleMahony.getQuaternion() == batchMahony.getQuaternion());
+	TEST_ASSERT_TRUE(singleMahony.getBias() == batchMahony.getBias());
+}
+
+// ----------------------------------------------------------------------------
+void
+AhrsTest::testFixedPoint()
+{
+	typedef xpcc::fixed<int32_t, 24> Q;
+	typedef xpcc::Vector<Q, 3> FixedVector;
+
+	xpcc::filter::Madgwick<float> reference(0.0025f, 0.2f);
+	xpcc::filter::Madgwick<Q> filter(Q(0.0025f), Q(0.2f));
+	xpcc::filter::Mahony<Q> mahony(Q(0.0025f), Q(2.f));
+
+	Quaternion truth(1, 0, 0, 0);
+	Vector gravity;
+	for (int i = 0; i < 2000; ++i)
+	{
+		const float t = i * 0.0025f;
+		const Vector rate(0.8f * std::sin(t * 3), 0.5f * std::cos(t * 2), 0.3f);
+
+		// the true orientation follows the rate exactly
+		xpcc::filter::Madgwick<float> integrator(0.0025f, 0.f);
+		integrator.setQuaternion(truth);
+		integrator.update(rate, Vector(0, 0, 0));
+		truth = integrator.getQuaternion();
+
+		gravity = toSensorFrame(truth, Vector(0, 0, 1));
+
+		reference.update(rate, gravity);
+		filter.update(FixedVector(Q(rate.x), Q(rate.y), Q(rate.z)),
+				FixedVector(Q(gravity.x), Q(gravity.y), Q(gravity.z)));
+		mahony.update(FixedVector(Q(rate.x), Q(rate.y), Q(rate.z)),
+				FixedVector(Q(gravity.x), Q(gravity.y), Q(gravity.z)));
+	}
+
+	const xpcc::Quaternion<Q>& q = filter.getQuaternion();
+	TEST_ASSERT_EQUALS_DELTA(float(q.w), reference.getQuaternion().w, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(float(q.x), reference.getQuaternion().x, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(float(q.y), reference.getQuaternion().y, 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(float(q.z), reference.getQuaternion().z, 1e-3f);
+
+	// the tilt follows the truth, the heading is not observable
+	const FixedVector up = mahony.toEarthFrame(
+			FixedVector(Q(gravity.x), Q(gravity.y), Q(gravity.z)));
+	TEST_ASSERT_EQUALS_DELTA(float(up.x), 0.f, 1e-2f);
+	TEST_ASSERT_EQUALS_DELTA(float(up.y), 0.f, 1e-2f);
+	TEST_ASSERT_EQUALS_DELTA(float(up.z), 1.f, 1e-2f);
+}
@@ -29,6 +29,7 @@
 // ----------------------------------------------------------------------------
 
 #include <xpcc/math/filter/fir.hpp>
+#include <xpcc/math/filter/fir_polyphase.hpp>
 
 #include "fir_test.hpp"
 
@@ -75,3 +76,149 @@ void FirTest::testFilter(const float (&coeff)[N],
 		TEST_ASSERT_EQUALS(filter.getValue(), results[i]);
 	} 
 }
+
+// ----------------------------------------------------------------------------
+static const float lowpass[7] = {0.05f, 0.1f, 0.2f, 0.3f, 0.2f, 0.1f, 0.05f};
+
+void
+FirTest::testBlock()
+{
+	xpcc::filter::Fir<int32_t, 7, 1, 100> single(lowpass);
+	xpcc::filter::Fir<int32_t, 7, 1, 100> block(lowpass);
+
+	int32_t input[40];
+	int32_t output[40];
+	for(int i = 0; i < 40; i++){
+		input[i] = (i * 37) % 101 - 50;
+	}
+
+	// split into uneven blocks
+	block.process(input, output, 13);
+	block.process(input + 13, output + 13, 27);
+
+	for(int i = 0; i < 40; i++){
+		single.append(input[i]);
+		single.update();
+		TEST_ASSERT_EQUALS(output[i], single.getValue());
+	}
+	TEST_ASSERT_EQUALS(block.getValue(), single.getValue());
+
+	// in place
+	block.reset();
+	block.process(input, input, 40);
+	TEST_ASSERT_EQUALS_ARRAY(input, output, 40);
+}
+
+void
+FirTest::testFloat()
+{
+	// enough coefficients to use all vector lanes and a scalar tail
+	float coeff[19];
+	for(int i = 0; i < 19; i++){
+		coeff[i] = (i + 1) * 0.01f;
+	}
+	xpcc::filter::Fir<float, 19> filter(coeff);
+
+	float input[50];
+	float output[50];
+	for(int i = 0; i < 50; i++){
+		input[i] = (i % 7) - 3.f;
+	}
+	filter.process(input, output, 50);
+
+	for(int n = 0; n < 50; n++)
+	{
+		float expected = 0;
+		for(int k = 0; k < 19 and k <= n; k++){
+			expected += coeff[k] * input[n - k];
+		}
+		TEST_ASSERT_EQUALS_DELTA(output[n], expected, 1e-5f);
+	}
+}
+
+void
+FirTest::testQ15()
+{
+	xpcc::filter::Fir<int16_t, 7, 1, 32768> filter(lowpass);
+
+	// a constant signal is passed with a gain of 1
+	int16_t input[20];
+	int16_t output[20];
+	for(int i = 0; i < 20; i++){
+		input[i] = 10000;
+	}
+	filter.process(input, output, 20);
+
+	TEST_ASSERT_EQUALS_DELTA(output[19], 10000, 2);
+	// the step response after the first sample
+	TEST_ASSERT_EQUALS_DELTA(output[0], 500, 1);
+}
+
+void
+FirTest::testDecimator()
+{
+	xpcc::filter::Fir<int32_t, 7, 1, 100> fir(lowpass);
+	xpcc::filter::FirDecimator<int32_t, 7, 3, 100> decimator(lowpass);
+
+	int32_t input[20];
+	int32_t reference[20];
+	int32_t output[7];
+	for(int i = 0; i < 20; i++){
+		input[i] = (i * 53) % 97;
+	}
+	fir.process(input, reference, 20);
+
+	// the phase is kept across blocks
+	size_t count = decimator.process(input, output, 5);
+	TEST_ASSERT_EQUALS(count, 2u);
+	count += decimator.process(input + 5, output + count, 15);
+	TEST_ASSERT_EQUALS(count, 7u);
+
+	for(int i = 0; i < 7; i++){
+		TEST_ASSERT_EQUALS(output[i], reference[i * 3]);
+	}
+
+	// starts again like a new filter
+	decimator.reset();
+	TEST_ASSERT_EQUALS(decimator.process(input, output, 20), 7u);
+	for(int i = 0; i < 7; i++){
+		TEST_ASSERT_EQUALS(output[i], reference[i * 3]);
+	}
+
+	// N is a multiple of M, every sub-filter has two coefficients
+	const float coeff[8] = {0.5f, -1, 2, 0.25f, 3, -0.5f, 1, 0.125f};
+	xpcc::filter::Fir<float, 8> fir2(coeff);
+	xpcc::filter::FirDecimator<float, 8, 4> decimator2(coeff);
+
+	float input2[16];
+	float reference2[16];
+	float output2[4];
+	for(int i = 0; i < 16; i++){
+		input2[i] = float((i * 7) % 11) - 5;
+	}
+	fir2.process(input2, reference2, 16);
+	TEST_ASSERT_EQUALS(decimator2.process(input2, output2, 16), 4u);
+	for(int i = 0; i < 4; i++){
+		TEST_ASSERT_EQUALS_FLOAT(output2[i], reference2[i * 4]);
+	}
+}
+
+void
+FirTest::testInterpolator()
+{
+	const float coeff[6] = {1, 2, 3, 4, 5, 6};
+	xpcc::filter::Fir<int32_t, 6> fir(coeff);
+	xpcc::filter::FirInterpolator<int32_t, 6, 3> interpolator(coeff);
+
+	const int32_t input[4] = {1, -2, 3, 7};
+	int32_t output[12];
+	interpolator.process(input, output, 4);
+
+	// equal to the full filter applied to the zero-stuffed input
+	for(int i = 0; i < 12; i++)
+	{
+		fir.append((i % 3) ? 0 : input[i / 3]);
+		fir.update();
+		TEST_ASSERT_EQUALS(output[i], fir.getValue());
+	}
+}
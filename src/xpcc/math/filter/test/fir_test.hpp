@@ -37,6 +37,21 @@ public:
 	void
 	testFir();
 
+	void
+	testBlock();
+
+	void
+	testFloat();
+
+	void
+	testQ15();
+
+	void
+	testDecimator();
+
+	void
+	testInterpolator();
+
 private:
 	/* Length of results array needs to be len(taps) + len(coeff) */
 	template<typename T, int N, int BLOCK_SIZE, unsigned int ScaleFactor>
@@ -0,0 +1,90 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/filter/median.hpp>
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "median_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+#include <algorithm>
+
+namespace
+{
+	const uint32_t samples = 20000;
+
+	inline uint16_t
+	sample(uint32_t& state)
+	{
+		state = state * 1103515245 + 12345;
+		return state >> 20;
+	}
+
+	template <int N>
+	void
+	benchmark()
+	{
+		uint32_t state = 1;
+		uint32_t checksumStreaming = 0;
+		uint32_t checksumSorting = 0;
+
+		xpcc::filter::Median<uint16_t, N> filter;
+		unittest::Stopwatch stopwatch;
+		for (uint32_t i = 0; i < samples; ++i)
+		{
+			filter.append(sample(state));
+			filter.update();
+			checksumStreaming += filter.getValue();
+		}
+		const uint32_t streaming = stopwatch.getTicks();
+
+		// reference: sort a copy of the window for every sample
+		state = 1;
+		uint16_t window[N] = {0};
+		uint16_t sorted[N];
+		stopwatch.restart();
+		for (uint32_t i = 0; i < samples; ++i)
+		{
+			window[i % N] = sample(state);
+			std::copy(window, window + N, sorted);
+			std::sort(sorted, sorted + N);
+			checksumSorting += sorted[(N - 1) / 2];
+		}
+		const uint32_t sorting = stopwatch.getTicks();
+
+		TEST_ASSERT_EQUALS(checksumStreaming, checksumSorting);
+
+		XPCC_LOG_INFO << "Median<uint16_t, " << N << ">: "
+				<< unittest::getNanoseconds(streaming, samples)
+				<< " ns/sample, sorting: "
+				<< unittest::getNanoseconds(sorting, samples)
+				<< " ns/sample" << xpcc::endl;
+	}
+}
+
+void
+MedianBenchmarkTest::testWindowSizes()
+{
+	benchmark<9>();
+	benchmark<15>();
+	benchmark<31>();
+	benchmark<63>();
+	benchmark<127>();
+	benchmark<255>();
+}
+
+#else
+
+void
+MedianBenchmarkTest::testWindowSizes()
+{
+}
+
+#endif
@@ -0,0 +1,19 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Compares the streaming median with sorting the window for every sample.
+/// Only runs on hosted targets, the results are printed to the info log.
+class MedianBenchmarkTest : public unittest::TestSuite
+{
+public:
+	void
+	testWindowSizes();
+};
@@ -32,6 +32,8 @@
 
 #include "median_test.hpp"
 
+#include <algorithm>
+
 namespace
 {
 	struct TestData
@@ -117,3 +119,88 @@ MedianTest::testMedian()
 		TEST_ASSERT_EQUALS(filter9.getValue(), testData[i].median9);
 	}
 }
+
+// ----------------------------------------------------------------------------
+namespace
+{
+	// simple linear congruential generator for reproducible test data
+	uint16_t
+	nextRandom(uint32_t& state)
+	{
+		state = state * 1103515245 + 12345;
+		return (state >> 16) % 1000;
+	}
+
+	template <int N>
+	void
+	compareWithSorting(unsigned int samples)
+	{
+		xpcc::filter::Median<int16_t, N> filter(500);
+		int16_t window[N];
+		int16_t sorted[N];
+		for (int i = 0; i < N; ++i) {
+			window[i] = 500;
+		}
+
+		uint32_t state = N;
+		for (unsigned int i = 0; i < samples; ++i)
+		{
+			// many duplicates to check the ordering of equal values
+			const int16_t value = (i % 3) ? nextRandom(state) : 42;
+			window[i % N] = value;
+			filter.append(value);
+			filter.update();
+
+			std::copy(window, window + N, sorted);
+			std::sort(sorted, sorted + N);
+			TEST_ASSERT_EQUALS(filter.getValue(), sorted[(N - 1) / 2]);
+			TEST_ASSERT_EQUALS(filter.getOrderStatistic(0), sorted[0]);
+			TEST_ASSERT_EQUALS(filter.getOrderStatistic(N / 3), sorted[N / 3]);
+			TEST_ASSERT_EQUALS(filter.getOrderStatistic(N - 1), sorted[N - 1]);
+		}
+	}
+}
+
+void
+MedianTest::testGeneric()
+{
+	xpcc::filter::Median<uint8_t, 11> filter(7);
+	TEST_ASSERT_EQUALS(filter.getValue(), 7);
+	TEST_ASSERT_EQUALS(filter.getOrderStatistic(0), 7);
+	TEST_ASSERT_EQUALS(filter.getOrderStatistic(10), 7);
+
+	compareWithSorting<1>(10);
+	compareWithSorting<4>(50);
+	compareWithSorting<31>(200);
+	compareWithSorting<255>(600);
+	compareWithSorting<300>(700);
+}
+
+void
+MedianTest::testPercentile()
+{
+	xpcc::filter::Median<int32_t, 101> filter;
+
+	// append 0 ... 100 in a scrambled order
+	for (int32_t i = 0; i < 101; ++i) {
+		filter.append((i * 37) % 101);
+	}
+	filter.update();
+
+	TEST_ASSERT_EQUALS(filter.getValue(), 50);
+	TEST_ASSERT_EQUALS(filter.getPercentile(0), 0);
+	TEST_ASSERT_EQUALS(filter.getPercentile(10), 10);
+	TEST_ASSERT_EQUALS(filter.getPercentile(95), 95);
+	TEST_ASSERT_EQUALS(filter.getPercentile(100), 100);
+	TEST_ASSERT_EQUALS(filter.getPercentile(200), 100);
+	TEST_ASSERT_EQUALS(filter.getOrderStatistic(1000), 100);
+
+	// the median is only updated by update()
+	// replaces 0, 37 and 74
+	filter.append(-100);
+	filter.append(-100);
+	filter.append(-100);
+	TEST_ASSERT_EQUALS(filter.getValue(), 50);
+	filter.update();
+	TEST_ASSERT_EQUALS(filter.getValue(), 49);
+}
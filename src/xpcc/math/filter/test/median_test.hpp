@@ -38,4 +38,10 @@ public:
 	
 	void
 	testMedian();
+
+	void
+	testGeneric();
+
+	void
+	testPercentile();
 };
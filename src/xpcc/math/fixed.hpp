@@ -0,0 +1,17 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_MATH__FIXED_HPP
+#define XPCC_MATH__FIXED_HPP
+
+#include "fixed/fixed.hpp"
+#include "fixed/fixed_math.hpp"
+#include "fixed/cordic.hpp"
+
+#endif // XPCC_MATH__FIXED_HPP
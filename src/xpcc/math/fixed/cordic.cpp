@@ -0,0 +1,148 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/accessor/flash.hpp>
+
+#include "cordic.hpp"
+
+namespace
+{
+	// atan(2^-i) with 29 fractional bits
+	FLASH_STORAGE(int32_t atanTable[30]) =
+	{
+		421657428, 248918915, 131521918, 66762579, 33510843, 16771758,
+		8387925, 4194219, 2097141, 1048575, 524288, 262144, 131072, 65536,
+		32768, 16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8,
+		4, 2, 1
+	};
+
+	// 1 / prod(sqrt(1 + 2^-2i))
+	const int32_t gainQ29 = 326016437L;
+	const int64_t gainQ30 = 652032874LL;
+}
+
+// ----------------------------------------------------------------------------
+constexpr int32_t xpcc::Cordic::halfPi;
+constexpr int32_t xpcc::Cordic::pi;
+constexpr int64_t xpcc::Cordic::twoPi;
+
+// ----------------------------------------------------------------------------
+void
+xpcc::Cordic::rotate(int32_t angle, int32_t *sin, int32_t *cos, uint8_t iterations)
+{
+	xpcc::accessor::Flash<int32_t> table(atanTable);
+
+	// the algorithm converges for angles in [-pi/2, pi/2]
+	bool negate = false;
+	if (angle > halfPi) {
+		angle -= pi;
+		negate = true;
+	}
+	else if (angle < -halfPi) {
+		angle += pi;
+		negate = true;
+	}
+
+	// start with the gain applied, so no multiplication is needed
+	int32_t x = gainQ29;
+	int32_t y = 0;
+	for (uint_fast8_t i = 0; i < iterations; ++i)
+	{
+		const int32_t dx = x >> i;
+		const int32_t dy = y >> i;
+		if (angle >= 0) {
+			x -= dy;
+			y += dx;
+			angle -= table[i];
+		}
+		else {
+			x += dy;
+			y -= dx;
+			angle += table[i];
+		}
+	}
+
+	*sin = negate ? -y : y;
+	*cos = negate ? -x : x;
+}
+
+// ----------------------------------------------------------------------------
+int32_t
+xpcc::Cordic::vector(int32_t x, int32_t y, uint32_t *magnitude, uint8_t iterations)
+{
+	xpcc::accessor::Flash<int32_t> table(atanTable);
+
+	const uint32_t ax = (x < 0) ? -uint32_t(x) : uint32_t(x);
+	const uint32_t ay = (y < 0) ? -uint32_t(y) : uint32_t(y);
+	const uint32_t max = (ax > ay) ? ax : ay;
+	if (max == 0) {
+		*magnitude = 0;
+		return 0;
+	}
+
+	// normalize to [2^28, 2^29), this leaves enough headroom for the
+	// CORDIC gain of ~1.65 and keeps the full precision for small inputs
+	const int8_t msb = (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(max);
+	const int8_t shift = 28 - msb;
+	int32_t vx, vy;
+	if (shift >= 0) {
+		vx = x * (int32_t(1) << shift);
+		vy = y * (int32_t(1) << shift);
+	}
+	else {
+		vx = x >> -shift;
+		vy = y >> -shift;
+	}
+
+	// rotate into the right half plane
+	int32_t offset = 0;
+	if (vx < 0) {
+		offset = (vy >= 0) ? pi : -pi;
+		vx = -vx;
+		vy = -vy;
+	}
+
+	int32_t angle = 0;
+	for (uint_fast8_t i = 0; i < iterations; ++i)
+	{
+		const int32_t dx = vx >> i;
+		const int32_t dy = vy >> i;
+		if (vy >= 0) {
+			vx += dy;
+			vy -= dx;
+			angle += table[i];
+		}
+		else {
+			vx -= dy;
+			vy += dx;
+			angle -= table[i];
+		}
+	}
+
+	// the offset was chosen from the half plane, so only rounding errors
+	// can push the result out of [-pi, pi]. The sum needs 33 bits.
+	int64_t result = int64_t(angle) + offset;
+	if (result > pi) {
+		result = pi;
+	}
+	else if (result < -pi) {
+		result = -pi;
+	}
+
+	uint64_t length = (uint64_t(vx) * gainQ30) >> 30;
+	if (shift >= 0) {
+		length = (length + ((uint64_t(1) << shift) >> 1)) >> shift;
+	}
+	else {
+		length <<= -shift;
+	}
+	*magnitude = (length > 0xffffffffUL) ? 0xffffffffUL : uint32_t(length);
+
+	return int32_t(result);
+}
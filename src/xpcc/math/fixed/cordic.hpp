@@ -0,0 +1,103 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CORDIC_HPP
+#define XPCC__CORDIC_HPP
+
+#include <stdint.h>
+#include "fixed.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Trigonometric functions without multiplications
+	 *
+	 * CORDIC computes sine, cosine, arc tangent and magnitude with only
+	 * shifts and additions, which makes it a good fit for controllers
+	 * without a FPU or even a hardware multiplier. Every iteration adds
+	 * roughly one bit of precision. The number of iterations is chosen
+	 * from the fractional bits of the fixed-point type, up to 29.
+	 *
+	 * Angles are in radians. Functions returning an angle need at least
+	 * two integer bits to represent +-pi, otherwise the result saturates.
+	 *
+	 * The algorithm itself works on 32-bit values with 29 fractional bits
+	 * and is not a template, so all Q-formats share the same code.
+	 *
+	 * \see		xpcc::math::sin() for a faster, table-driven alternative
+	 * \ingroup	math
+	 */
+	class Cordic
+	{
+	public:
+		/// pi/2, pi and 2*pi with 29 fractional bits
+		static constexpr int32_t halfPi = 843314857L;
+		static constexpr int32_t pi = 1686629713L;
+		static constexpr int64_t twoPi = 3373259426LL;
+
+		template<typename I, uint8_t F>
+		static void
+		sinCos(const fixed<I, F>& angle, fixed<I, F>* sin, fixed<I, F>* cos);
+
+		template<typename I, uint8_t F>
+		static fixed<I, F>
+		sin(const fixed<I, F>& angle);
+
+		template<typename I, uint8_t F>
+		static fixed<I, F>
+		cos(const fixed<I, F>& angle);
+
+		/// Angle of the vector (x, y) in the range [-pi, pi]
+		template<typename I, uint8_t F>
+		static fixed<I, F>
+		atan2(const fixed<I, F>& y, const fixed<I, F>& x);
+
+		/// Length of the vector (x, y) without overflow of x*x + y*y
+		template<typename I, uint8_t F>
+		static fixed<I, F>
+		hypot(const fixed<I, F>& x, const fixed<I, F>& y);
+
+	public:
+		/**
+		 * Rotation mode
+		 *
+		 * \param	angle	in the range [-pi, pi] with 29 fractional bits
+		 * \param	sin		sine with 29 fractional bits
+		 * \param	cos		cosine with 29 fractional bits
+		 */
+		static void
+		rotate(int32_t angle, int32_t *sin, int32_t *cos, uint8_t iterations);
+
+		/**
+		 * Vectoring mode
+		 *
+		 * \param	magnitude	length of (x, y) in the units of x and y
+		 * \return	angle of (x, y) with 29 fractional bits
+		 */
+		static int32_t
+		vector(int32_t x, int32_t y, uint32_t *magnitude, uint8_t iterations);
+
+	private:
+		template<uint8_t F>
+		static constexpr uint8_t
+		getIterations()
+		{
+			return (F + 2 < 29) ? (F + 2) : 29;
+		}
+
+		/// Convert an angle to 29 fractional bits in the range [-pi, pi]
+		template<typename I, uint8_t F>
+		static int32_t
+		toInternalAngle(const fixed<I, F>& angle);
+	};
+}
+
+#include "cordic_impl.hpp"
+
+#endif	// XPCC__CORDIC_HPP
@@ -0,0 +1,86 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__CORDIC_HPP
+	#error	"Don't include this file directly, use 'cordic.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F>
+int32_t
+xpcc::Cordic::toInternalAngle(const fixed<I, F>& angle)
+{
+	int64_t a = angle.getRaw();
+	if (F <= 29) {
+		a *= int64_t(1) << (F <= 29 ? (29 - F) : 0);
+	}
+	else {
+		a >>= (F > 29 ? (F - 29) : 0);
+	}
+
+	if (a > pi or a < -pi)
+	{
+		a %= twoPi;
+		if (a > pi) {
+			a -= twoPi;
+		}
+		else if (a < -pi) {
+			a += twoPi;
+		}
+	}
+	return int32_t(a);
+}
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F>
+void
+xpcc::Cordic::sinCos(const fixed<I, F>& angle, fixed<I, F>* sin, fixed<I, F>* cos)
+{
+	int32_t s, c;
+	rotate(toInternalAngle(angle), &s, &c, getIterations<F>());
+	*sin = fixed<I, F>::fromScaled(s, F - 29);
+	*cos = fixed<I, F>::fromScaled(c, F - 29);
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::Cordic::sin(const fixed<I, F>& angle)
+{
+	fixed<I, F> s, c;
+	sinCos(angle, &s, &c);
+	return s;
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::Cordic::cos(const fixed<I, F>& angle)
+{
+	fixed<I, F> s, c;
+	sinCos(angle, &s, &c);
+	return c;
+}
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::Cordic::atan2(const fixed<I, F>& y, const fixed<I, F>& x)
+{
+	uint32_t magnitude;
+	const int32_t angle = vector(x.getRaw(), y.getRaw(), &magnitude, getIterations<F>());
+	return fixed<I, F>::fromScaled(angle, F - 29);
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::Cordic::hypot(const fixed<I, F>& x, const fixed<I, F>& y)
+{
+	uint32_t magnitude;
+	vector(x.getRaw(), y.getRaw(), &magnitude, getIterations<F>());
+	return fixed<I, F>::fromScaled(magnitude, 0);
+}
@@ -0,0 +1,345 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIXED_HPP
+#define XPCC__FIXED_HPP
+
+#include <stdint.h>
+
+#include <xpcc/io/iostream.hpp>
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/utils/template_metaprogramming.hpp>
+#include <xpcc/math/saturated/saturated.hpp>
+#include <xpcc/math/geometry/geometric_traits.hpp>
+
+namespace xpcc
+{
+	/**
+	 * \brief	Integer type which holds the full product of two values
+	 *
+	 * Unlike ArithmeticTraits::WideType this is always an integer type,
+	 * even for 32-bit values on the AVR.
+	 *
+	 * \ingroup	math
+	 */
+	template<typename Int>
+	struct FixedTraits
+	{
+	};
+
+	template<> struct FixedTraits<int8_t>   { typedef int16_t  WideType; };
+	template<> struct FixedTraits<uint8_t>  { typedef uint16_t WideType; };
+	template<> struct FixedTraits<int16_t>  { typedef int32_t  WideType; };
+	template<> struct FixedTraits<uint16_t> { typedef uint32_t WideType; };
+	template<> struct FixedTraits<int32_t>  { typedef int64_t  WideType; };
+	template<> struct FixedTraits<uint32_t> { typedef uint64_t WideType; };
+
+	/**
+	 * \brief	Fixed-point number in Q-format
+	 *
+	 * Stores a value `x` as the integer `x * 2^FracBits` of type \p Int,
+	 * e.g. `fixed<int16_t, 15>` is the Q15 format with a range of [-1, 1)
+	 * and `fixed<int32_t, 16>` is Q16.16 with a range of [-32768, 32768).
+	 *
+	 * All arithmetic operations saturate at the limits of the format
+	 * instead of wrapping around. All operations are calculated in the
+	 * next wider integer type (see xpcc::FixedTraits), multiplication and
+	 * division are rounded to the nearest value. Division by zero
+	 * saturates.
+	 *
+	 * Construction from `float` is `constexpr`, so constants do not need
+	 * floating point support at runtime:
+	 * \code
+	 * constexpr xpcc::q16_16 gain(0.25f);
+	 * xpcc::q16_16 y = gain * x + offset;
+	 * \endcode
+	 *
+	 * Values convert implicitly to `float`, which allows using them with
+	 * the generic geometry classes like xpcc::Vector2 and
+	 * xpcc::Location2D. Be aware that mixed expressions like `q * 1.5f`
+	 * are therefore calculated in floating point. For trigonometric and
+	 * other functions without floating point see xpcc::Cordic and
+	 * xpcc/math/fixed/fixed_math.hpp.
+	 *
+	 * \ingroup	math
+	 */
+	template<typename Int, uint8_t FracBits>
+	class fixed
+	{
+		static_assert(FracBits < sizeof(Int) * 8, "Too many fractional bits for the integer type!");
+
+	public:
+		typedef Int RawType;
+		typedef typename FixedTraits<Int>::WideType WideType;
+
+		static constexpr uint8_t fractionalBits = FracBits;
+
+	public:
+		constexpr
+		fixed() :
+			value(0)
+		{
+		}
+
+		/// Convert from an integer or floating point value, saturates
+		template<typename U>
+		explicit constexpr
+		fixed(U initialValue) :
+			value(Conversion<U, ArithmeticTraits<U>::isInteger>::convert(initialValue))
+		{
+		}
+
+		/// Convert from another Q-format, rounds and saturates
+		template<typename I, uint8_t F>
+		explicit
+		fixed(const fixed<I, F>& other);
+
+		/// Construct from the raw integer representation
+		static constexpr fixed
+		fromRaw(Int raw)
+		{
+			return fixed(raw, RawTag());
+		}
+
+		/// Construct from the raw integer representation
+		static inline fixed
+		fromSaturated(const Saturated<Int>& raw)
+		{
+			return fixed(raw.getValue(), RawTag());
+		}
+
+		/// Construct from `mantissa * 2^exponent` raw units, rounds and saturates
+		static fixed
+		fromScaled(int64_t mantissa, int8_t exponent);
+
+		static constexpr fixed
+		min()
+		{
+			return fixed(ArithmeticTraits<Int>::min, RawTag());
+		}
+
+		static constexpr fixed
+		max()
+		{
+			return fixed(ArithmeticTraits<Int>::max, RawTag());
+		}
+
+		inline constexpr Int
+		getRaw() const
+		{
+			return value;
+		}
+
+		inline Saturated<Int>
+		toSaturated() const
+		{
+			return Saturated<Int>(value);
+		}
+
+		/// Integer part, rounded towards negative infinity
+		inline constexpr Int
+		toInteger() const
+		{
+			return value >> FracBits;
+		}
+
+		inline constexpr float
+		toFloat() const
+		{
+			return float(value) / float(WideType(1) << FracBits);
+		}
+
+		inline constexpr
+		operator float() const
+		{
+			return toFloat();
+		}
+
+		fixed&
+		operator += (const fixed& other);
+
+		fixed&
+		operator -= (const fixed& other);
+
+		fixed&
+		operator *= (const fixed& other);
+
+		fixed&
+		operator /= (const fixed& other);
+
+	private:
+		struct RawTag {};
+
+		constexpr
+		fixed(Int raw, RawTag) :
+			value(raw)
+		{
+		}
+
+		/// Clamp an integer value to the range of Int
+		template<typename W>
+		static constexpr Int
+		saturate(W v)
+		{
+			return (v > W(ArithmeticTraits<Int>::max)) ? ArithmeticTraits<Int>::max :
+				   (v < W(ArithmeticTraits<Int>::min)) ? ArithmeticTraits<Int>::min : Int(v);
+		}
+
+		/// Clamp a floating point value to the range of Int
+		template<typename U>
+		static constexpr Int
+		saturateFloat(U v)
+		{
+			// float(INT32_MAX) is rounded up to 2^31, so the exact bound
+			// max + 1 = 2^N is used, which every floating point type holds
+			return (v >= U(ArithmeticTraits<Int>::max) + U(1)) ? ArithmeticTraits<Int>::max :
+				   (v < U(ArithmeticTraits<Int>::min)) ? ArithmeticTraits<Int>::min : Int(v);
+		}
+
+		template<typename U, bool isInteger>
+		struct Conversion
+		{
+			static constexpr Int
+			convert(U v)
+			{
+				return (v >= U(0)) ?
+						saturateFloat(v * U(WideType(1) << FracBits) + U(0.5)) :
+						saturateFloat(v * U(WideType(1) << FracBits) - U(0.5));
+			}
+		};
+
+		template<typename U>
+		struct Conversion<U, true>
+		{
+			// compared in the wide type to avoid the overflow of v << FracBits
+			static constexpr Int
+			convert(U v)
+			{
+				return (WideType(v) > WideType(ArithmeticTraits<Int>::max >> FracBits)) ? ArithmeticTraits<Int>::max :
+					   (WideType(v) < WideType(ArithmeticTraits<Int>::min >> FracBits)) ? ArithmeticTraits<Int>::min :
+					   Int(WideType(v) * (WideType(1) << FracBits));
+			}
+		};
+
+		Int value;
+	};
+
+	typedef fixed<int8_t, 7>	q7;
+	typedef fixed<int16_t, 15>	q15;
+	typedef fixed<int32_t, 31>	q31;
+	typedef fixed<int16_t, 8>	q8_8;
+	typedef fixed<int32_t, 16>	q16_16;
+
+	// ------------------------------------------------------------------------
+	template<typename I, uint8_t F>
+	fixed<I, F>
+	operator + (const fixed<I, F>& a, const fixed<I, F>& b);
+
+	template<typename I, uint8_t F>
+	fixed<I, F>
+	operator - (const fixed<I, F>& a, const fixed<I, F>& b);
+
+	template<typename I, uint8_t F>
+	fixed<I, F>
+	operator * (const fixed<I, F>& a, const fixed<I, F>& b);
+
+	template<typename I, uint8_t F>
+	fixed<I, F>
+	operator / (const fixed<I, F>& a, const fixed<I, F>& b);
+
+	/// Saturating negation, `-min()` results in `max()`
+	template<typename I, uint8_t F>
+	fixed<I, F>
+	operator - (const fixed<I, F>& a);
+
+	/// Exact multiplication with an integer
+	template<typename I, uint8_t F, typename U>
+	typename tmp::EnableIfCondition<ArithmeticTraits<U>::isInteger, fixed<I, F> >::type
+	operator * (const fixed<I, F>& a, U b);
+
+	/// Exact multiplication with an integer
+	template<typename I, uint8_t F, typename U>
+	typename tmp::EnableIfCondition<ArithmeticTraits<U>::isInteger, fixed<I, F> >::type
+	operator * (U a, const fixed<I, F>& b);
+
+	/// Division by an integer, rounded to the nearest value
+	template<typename I, uint8_t F, typename U>
+	typename tmp::EnableIfCondition<ArithmeticTraits<U>::isInteger, fixed<I, F> >::type
+	operator / (const fixed<I, F>& a, U b);
+
+	template<typename I, uint8_t F>
+	fixed<I, F>
+	abs(const fixed<I, F>& a);
+
+	template<typename I, uint8_t F>
+	inline constexpr bool
+	operator == (const fixed<I, F>& a, const fixed<I, F>& b)
+	{
+		return a.getRaw() == b.getRaw();
+	}
+
+	template<typename I, uint8_t F>
+	inline constexpr bool
+	operator != (const fixed<I, F>& a, const fixed<I, F>& b)
+	{
+		return a.getRaw() != b.getRaw();
+	}
+
+	template<typename I, uint8_t F>
+	inline constexpr bool
+	operator < (const fixed<I, F>& a, const fixed<I, F>& b)
+	{
+		return a.getRaw() < b.getRaw();
+	}
+
+	template<typename I, uint8_t F>
+	inline constexpr bool
+	operator <= (const fixed<I, F>& a, const fixed<I, F>& b)
+	{
+		return a.getRaw() <= b.getRaw();
+	}
+
+	template<typename I, uint8_t F>
+	inline constexpr bool
+	operator > (const fixed<I, F>& a, const fixed<I, F>& b)
+	{
+		return a.getRaw() > b.getRaw();
+	}
+
+	template<typename I, uint8_t F>
+	inline constexpr bool
+	operator >= (const fixed<I, F>& a, const fixed<I, F>& b)
+	{
+		return a.getRaw() >= b.getRaw();
+	}
+
+	template<typename I, uint8_t F>
+	IOStream&
+	operator << (IOStream& os, const fixed<I, F>& a);
+
+	/// Allows using fixed-point types with xpcc::Vector2 and xpcc::Location2D
+	template <typename I, uint8_t F>
+	struct GeometricTraits< fixed<I, F> >
+	{
+		static const bool isValidType = true;
+
+		typedef float FloatType;
+		typedef fixed<I, F> WideType;
+
+		static inline fixed<I, F>
+		round(float value)
+		{
+			return fixed<I, F>(value);
+		}
+	};
+}
+
+#include "fixed_impl.hpp"
+
+#endif	// XPCC__FIXED_HPP
@@ -0,0 +1,231 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIXED_HPP
+	#error	"Don't include this file directly, use 'fixed.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename Int, uint8_t FracBits> template<typename I, uint8_t F>
+xpcc::fixed<Int, FracBits>::fixed(const fixed<I, F>& other)
+{
+	typedef typename FixedTraits<I>::WideType OtherWideType;
+	if (F > FracBits)
+	{
+		// round to nearest
+		const uint8_t shift = (F > FracBits) ? (F - FracBits) : 0;
+		const OtherWideType v = OtherWideType(other.getRaw()) + (OtherWideType(1) << (shift ? (shift - 1) : 0));
+		value = saturate(v >> shift);
+	}
+	else
+	{
+		const uint8_t shift = (FracBits > F) ? (FracBits - F) : 0;
+		const WideType v = WideType(other.getRaw());
+		if (v > (WideType(ArithmeticTraits<Int>::max) >> shift)) {
+			value = ArithmeticTraits<Int>::max;
+		}
+		else if (v < (WideType(ArithmeticTraits<Int>::min) >> shift)) {
+			value = ArithmeticTraits<Int>::min;
+		}
+		else {
+			value = Int(v * (WideType(1) << shift));
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename Int, uint8_t FracBits>
+xpcc::fixed<Int, FracBits>
+xpcc::fixed<Int, FracBits>::fromScaled(int64_t mantissa, int8_t exponent)
+{
+	if (exponent >= 0)
+	{
+		if (exponent > 62 or
+			mantissa > (int64_t(ArithmeticTraits<Int>::max) >> exponent)) {
+			return (mantissa == 0) ? fixed() : (mantissa > 0) ? max() : min();
+		}
+		if (mantissa < -((-int64_t(ArithmeticTraits<Int>::min)) >> exponent)) {
+			return min();
+		}
+		return fromRaw(Int(mantissa * (int64_t(1) << exponent)));
+	}
+
+	const uint8_t shift = -exponent;
+	if (shift > 62) {
+		return fixed();
+	}
+	mantissa = (mantissa + (int64_t(1) << (shift - 1))) >> shift;
+	return fixed(saturate(mantissa), RawTag());
+}
+
+// ----------------------------------------------------------------------------
+template<typename Int, uint8_t FracBits>
+xpcc::fixed<Int, FracBits>&
+xpcc::fixed<Int, FracBits>::operator += (const fixed& other)
+{
+	value = saturate(WideType(value) + WideType(other.value));
+	return *this;
+}
+
+template<typename Int, uint8_t FracBits>
+xpcc::fixed<Int, FracBits>&
+xpcc::fixed<Int, FracBits>::operator -= (const fixed& other)
+{
+	value = saturate(WideType(value) - WideType(other.value));
+	return *this;
+}
+
+template<typename Int, uint8_t FracBits>
+xpcc::fixed<Int, FracBits>&
+xpcc::fixed<Int, FracBits>::operator *= (const fixed& other)
+{
+	*this = *this * other;
+	return *this;
+}
+
+template<typename Int, uint8_t FracBits>
+xpcc::fixed<Int, FracBits>&
+xpcc::fixed<Int, FracBits>::operator /= (const fixed& other)
+{
+	*this = *this / other;
+	return *this;
+}
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::operator + (const fixed<I, F>& a, const fixed<I, F>& b)
+{
+	fixed<I, F> result(a);
+	result += b;
+	return result;
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::operator - (const fixed<I, F>& a, const fixed<I, F>& b)
+{
+	fixed<I, F> result(a);
+	result -= b;
+	return result;
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::operator * (const fixed<I, F>& a, const fixed<I, F>& b)
+{
+	typedef typename fixed<I, F>::WideType WideType;
+
+	WideType product = WideType(a.getRaw()) * WideType(b.getRaw());
+	if (F > 0) {
+		product += WideType(1) << (F ? (F - 1) : 0);
+	}
+	product >>= F;
+
+	if (product > WideType(ArithmeticTraits<I>::max)) {
+		return fixed<I, F>::max();
+	}
+	if (product < WideType(ArithmeticTraits<I>::min)) {
+		return fixed<I, F>::min();
+	}
+	return fixed<I, F>::fromRaw(I(product));
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::operator / (const fixed<I, F>& a, const fixed<I, F>& b)
+{
+	typedef typename fixed<I, F>::WideType WideType;
+
+	if (b.getRaw() == 0) {
+		return (a.getRaw() < 0) ? fixed<I, F>::min() : fixed<I, F>::max();
+	}
+
+	const WideType numerator = WideType(a.getRaw()) * (WideType(1) << F);
+	const WideType divisor = WideType(b.getRaw());
+
+	// round to nearest, the quotient is truncated towards zero
+	const WideType half = ((numerator < 0) != (divisor < 0)) ? -divisor / 2 : divisor / 2;
+	const WideType quotient = (numerator + half) / divisor;
+
+	if (quotient > WideType(ArithmeticTraits<I>::max)) {
+		return fixed<I, F>::max();
+	}
+	if (quotient < WideType(ArithmeticTraits<I>::min)) {
+		return fixed<I, F>::min();
+	}
+	return fixed<I, F>::fromRaw(I(quotient));
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::operator - (const fixed<I, F>& a)
+{
+	return fixed<I, F>::fromSaturated(-a.toSaturated());
+}
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F, typename U>
+typename xpcc::tmp::EnableIfCondition<xpcc::ArithmeticTraits<U>::isInteger, xpcc::fixed<I, F> >::type
+xpcc::operator * (const fixed<I, F>& a, U b)
+{
+	typedef typename fixed<I, F>::WideType WideType;
+
+	const WideType product = WideType(a.getRaw()) * WideType(b);
+	if (product > WideType(ArithmeticTraits<I>::max)) {
+		return fixed<I, F>::max();
+	}
+	if (product < WideType(ArithmeticTraits<I>::min)) {
+		return fixed<I, F>::min();
+	}
+	return fixed<I, F>::fromRaw(I(product));
+}
+
+template<typename I, uint8_t F, typename U>
+typename xpcc::tmp::EnableIfCondition<xpcc::ArithmeticTraits<U>::isInteger, xpcc::fixed<I, F> >::type
+xpcc::operator * (U a, const fixed<I, F>& b)
+{
+	return b * a;
+}
+
+template<typename I, uint8_t F, typename U>
+typename xpcc::tmp::EnableIfCondition<xpcc::ArithmeticTraits<U>::isInteger, xpcc::fixed<I, F> >::type
+xpcc::operator / (const fixed<I, F>& a, U b)
+{
+	typedef typename fixed<I, F>::WideType WideType;
+
+	if (b == 0) {
+		return (a.getRaw() < 0) ? fixed<I, F>::min() : fixed<I, F>::max();
+	}
+	const WideType numerator = WideType(a.getRaw());
+	const WideType divisor = WideType(b);
+	const WideType half = ((numerator < 0) != (divisor < 0)) ? -divisor / 2 : divisor / 2;
+	// the result can only overflow for min() / -1
+	const WideType quotient = (numerator + half) / divisor;
+	if (quotient > WideType(ArithmeticTraits<I>::max)) {
+		return fixed<I, F>::max();
+	}
+	return fixed<I, F>::fromRaw(I(quotient));
+}
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::abs(const fixed<I, F>& a)
+{
+	return (a.getRaw() < 0) ? -a : a;
+}
+
+template<typename I, uint8_t F>
+xpcc::IOStream&
+xpcc::operator << (IOStream& os, const fixed<I, F>& a)
+{
+	os << a.toFloat();
+	return os;
+}
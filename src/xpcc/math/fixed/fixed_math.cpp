@@ -0,0 +1,100 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/architecture/driver/accessor/flash.hpp>
+
+#include "fixed_math.hpp"
+
+namespace
+{
+	// sin(i * pi / 256) * 2^15 for i = 0..128
+	FLASH_STORAGE(uint16_t sineTable[129]) =
+	{
+		0, 402, 804, 1206, 1608, 2009, 2411, 2811, 3212, 3612, 4011, 4410,
+		4808, 5205, 5602, 5998, 6393, 6787, 7180, 7571, 7962, 8351, 8740, 9127,
+		9512, 9896, 10279, 10660, 11039, 11417, 11793, 12167, 12540, 12910, 13279, 13646,
+		14010, 14373, 14733, 15091, 15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869,
+		18205, 18538, 18868, 19195, 19520, 19841, 20160, 20475, 20788, 21097, 21403, 21706,
+		22006, 22302, 22595, 22884, 23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073,
+		25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020, 27246, 27467, 27684, 27897,
+		28106, 28311, 28511, 28707, 28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118,
+		30274, 30425, 30572, 30715, 30853, 30986, 31114, 31238, 31357, 31471, 31581, 31686,
+		31786, 31881, 31972, 32058, 32138, 32214, 32286, 32352, 32413, 32470, 32522, 32568,
+		32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766, 32768
+	};
+}
+
+// ----------------------------------------------------------------------------
+int32_t
+xpcc::math::sinPhase(uint32_t phase)
+{
+	xpcc::accessor::Flash<uint16_t> table(sineTable);
+
+	const uint8_t quadrant = phase >> 30;
+	uint32_t p = phase & 0x3fffffffUL;
+	if (quadrant & 1) {
+		// mirror, p is in (0, 2^30]
+		p = 0x40000000UL - p;
+	}
+
+	// 7 bits for the table index, 16 bits to interpolate
+	const uint8_t index = p >> 23;
+	int32_t value;
+	if (index >= 128) {
+		value = table[128];
+	}
+	else
+	{
+		const int32_t a = table[index];
+		const int32_t b = table[index + 1];
+		const int32_t fraction = (p >> 7) & 0xffff;
+		value = a + (((b - a) * fraction + 0x8000) >> 16);
+	}
+
+	return (quadrant & 2) ? -value : value;
+}
+
+// ----------------------------------------------------------------------------
+uint32_t
+xpcc::math::reciprocalNormalized(uint32_t d)
+{
+	// linear approximation 48/17 - 32/17 * d, maximum error 1/17
+	uint32_t y = 3031741621UL - uint32_t((uint64_t(2021161080UL) * d) >> 30);
+
+	// Newton-Raphson: y = y * (2 - d * y)
+	for (uint_fast8_t i = 0; i < 3; ++i)
+	{
+		const uint64_t e = (uint64_t(d) * y) >> 30;
+		y = (uint64_t(y) * ((uint64_t(2) << 30) - e)) >> 30;
+	}
+	return y;
+}
+
+// ----------------------------------------------------------------------------
+uint32_t
+xpcc::math::inverseSqrtNormalized(uint32_t d)
+{
+	// chords through the ends of [0.25, 0.5) and [0.5, 1), error < 5%
+	uint32_t y;
+	if (d < (1UL << 29)) {
+		y = 2776467046UL - uint32_t((uint64_t(2515933592UL) * d) >> 30);
+	}
+	else {
+		y = 1963258676UL - uint32_t((uint64_t(889516852UL) * d) >> 30);
+	}
+
+	// Newton-Raphson: y = y * (3 - d * y^2) / 2
+	for (uint_fast8_t i = 0; i < 3; ++i)
+	{
+		uint64_t t = (uint64_t(y) * y) >> 30;
+		t = (t * d) >> 30;
+		y = (uint64_t(y) * ((uint64_t(3) << 30) - t)) >> 31;
+	}
+	return y;
+}
@@ -0,0 +1,117 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIXED_MATH_HPP
+#define XPCC__FIXED_MATH_HPP
+
+#include <stdint.h>
+#include "fixed.hpp"
+
+namespace xpcc
+{
+	namespace math
+	{
+		/**
+		 * \brief	Sine from an interpolated quarter-wave table
+		 *
+		 * Uses a table of 129 values (258 bytes of Flash) with linear
+		 * interpolation, the error is below 1 LSB of the Q15 format.
+		 * Considerably faster than xpcc::Cordic, but less precise for
+		 * formats with more than 15 fractional bits.
+		 *
+		 * \param	angle	in radians, any value is allowed
+		 * \ingroup	math
+		 */
+		template<typename I, uint8_t F>
+		fixed<I, F>
+		sin(const fixed<I, F>& angle);
+
+		/// \brief	Cosine from an interpolated table, see sin()
+		/// \ingroup	math
+		template<typename I, uint8_t F>
+		fixed<I, F>
+		cos(const fixed<I, F>& angle);
+
+		/**
+		 * \brief	Reciprocal 1/x without a division
+		 *
+		 * Normalizes the value and uses three Newton-Raphson iterations
+		 * instead of the 64-bit division of `fixed(1) / x`. Saturates
+		 * for x = 0.
+		 *
+		 * This is not a faster replacement for the division: on the hosted
+		 * benchmark it takes about twice as long. It may only pay off on
+		 * controllers without a hardware divider, so measure on the target
+		 * before using it for speed.
+		 *
+		 * \ingroup	math
+		 */
+		template<typename I, uint8_t F>
+		fixed<I, F>
+		reciprocal(const fixed<I, F>& x);
+
+		/**
+		 * \brief	Inverse square root 1/sqrt(x)
+		 *
+		 * Newton-Raphson iterations without a division. About as fast as
+		 * sqrt() on the hosted benchmark, it is no fast path for
+		 * `1 / sqrt(x)` unless measured so on the target.
+		 * Saturates for x <= 0.
+		 * \ingroup	math
+		 */
+		template<typename I, uint8_t F>
+		fixed<I, F>
+		inverseSqrt(const fixed<I, F>& x);
+
+		/**
+		 * \brief	Same as inverseSqrt(), for code generic over float and fixed
+		 *
+		 * Only named after the float version, it is not faster than
+		 * inverseSqrt().
+		 *
+		 * \see		xpcc::math::fastInverseSqrt(float)
+		 * \ingroup	math
+		 */
+		template<typename I, uint8_t F>
+		inline fixed<I, F>
+		fastInverseSqrt(const fixed<I, F>& x)
+		{
+			return inverseSqrt(x);
+		}
+
+		/**
+		 * \brief	Square root
+		 *
+		 * Calculated as x * 1/sqrt(x), returns 0 for x <= 0.
+		 * \ingroup	math
+		 */
+		template<typename I, uint8_t F>
+		fixed<I, F>
+		sqrt(const fixed<I, F>& x);
+
+		// --------------------------------------------------------------------
+		// Format independent building blocks
+
+		/// Sine with 15 fractional bits, a full turn equals 2^32
+		int32_t
+		sinPhase(uint32_t phase);
+
+		/// 1/d for d in [0.5, 1), input and output with 30 fractional bits
+		uint32_t
+		reciprocalNormalized(uint32_t d);
+
+		/// 1/sqrt(d) for d in [0.25, 1), input and output with 30 fractional bits
+		uint32_t
+		inverseSqrtNormalized(uint32_t d);
+	}
+}
+
+#include "fixed_math_impl.hpp"
+
+#endif	// XPCC__FIXED_MATH_HPP
@@ -0,0 +1,121 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FIXED_MATH_HPP
+	#error	"Don't include this file directly, use 'fixed_math.hpp' instead!"
+#endif
+
+namespace xpcc
+{
+	namespace math
+	{
+		/// Position of the most significant bit, value must not be zero
+		inline uint8_t
+		mostSignificantBit(uint32_t value)
+		{
+			return (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(value);
+		}
+
+		/// Phase of an angle in radians, a full turn equals 2^32
+		template<typename I, uint8_t F>
+		inline uint32_t
+		toPhase(const fixed<I, F>& angle)
+		{
+			// 2^32 / (2 * pi), the cast wraps the phase to one turn
+			return uint32_t((int64_t(angle.getRaw()) * 683565276LL) >> F);
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::math::sin(const fixed<I, F>& angle)
+{
+	return fixed<I, F>::fromScaled(sinPhase(toPhase(angle)), F - 15);
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::math::cos(const fixed<I, F>& angle)
+{
+	// cos(x) = sin(x + pi/2)
+	return fixed<I, F>::fromScaled(sinPhase(toPhase(angle) + 0x40000000UL), F - 15);
+}
+
+// ----------------------------------------------------------------------------
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::math::reciprocal(const fixed<I, F>& x)
+{
+	const int32_t raw = x.getRaw();
+	if (raw == 0) {
+		return fixed<I, F>::max();
+	}
+	const uint32_t u = (raw < 0) ? -uint32_t(raw) : uint32_t(raw);
+
+	// scale to [0.5, 1) with 30 fractional bits
+	const uint8_t msb = mostSignificantBit(u);
+	const uint32_t d = (msb <= 29) ? (u << (29 - msb)) : (u >> (msb - 29));
+
+	const int64_t y = reciprocalNormalized(d);
+	return fixed<I, F>::fromScaled((raw < 0) ? -y : y, 2 * F - msb - 31);
+}
+
+// ----------------------------------------------------------------------------
+namespace xpcc
+{
+	namespace math
+	{
+		/**
+		 * Scale x to d in [0.25, 1) with 30 fractional bits so that
+		 * x = d * 2^(30 - shift - F) and (shift + F) is even.
+		 */
+		inline uint32_t
+		normalizeSqrt(uint32_t x, uint8_t fractionalBits, int8_t *shift)
+		{
+			const uint8_t msb = mostSignificantBit(x);
+			int8_t s = 29 - msb;
+			if ((s + fractionalBits) & 1) {
+				s -= 1;
+			}
+			*shift = s;
+			return (s >= 0) ? (x << s) : (x >> -s);
+		}
+	}
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::math::inverseSqrt(const fixed<I, F>& x)
+{
+	if (x.getRaw() <= 0) {
+		return fixed<I, F>::max();
+	}
+	int8_t shift;
+	const uint32_t d = normalizeSqrt(x.getRaw(), F, &shift);
+	const uint32_t y = inverseSqrtNormalized(d);
+	return fixed<I, F>::fromScaled(y, (shift + F - 30) / 2 + F - 30);
+}
+
+template<typename I, uint8_t F>
+xpcc::fixed<I, F>
+xpcc::math::sqrt(const fixed<I, F>& x)
+{
+	if (x.getRaw() <= 0) {
+		return fixed<I, F>();
+	}
+	int8_t shift;
+	const uint32_t d = normalizeSqrt(x.getRaw(), F, &shift);
+	const uint32_t y = inverseSqrtNormalized(d);
+
+	// sqrt(d) = d * 1/sqrt(d)
+	const uint32_t s = (uint64_t(d) * y) >> 30;
+	return fixed<I, F>::fromScaled(s, (30 - shift - F) / 2 + F - 30);
+}
@@ -0,0 +1,112 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <xpcc/math/fixed/fixed_math.hpp>
+#include <xpcc/math/fixed/cordic.hpp>
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "fixed_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+namespace
+{
+	const uint32_t iterations = 100000;
+
+	// every function is run on the same sequence of inputs in [-4, 4)
+	template<typename Function>
+	uint32_t
+	measure(const char *name, Function function, float& checksum)
+	{
+		unittest::Stopwatch stopwatch;
+		for (uint32_t i = 0; i < iterations; ++i) {
+			checksum += function((uint32_t(i * 2654435761UL) >> 16) / 8192.f - 4.f);
+		}
+		return unittest::report(name, stopwatch.getTicks(), iterations, "call");
+	}
+
+	// the conversion is done outside of the measured function on a target,
+	// but is negligible compared to the float functions measured here
+	typedef xpcc::q16_16 q;
+}
+
+void
+FixedBenchmarkTest::testTrigonometry()
+{
+	float reference = 0;
+	float cordic = 0;
+	float table = 0;
+
+	measure("sin(float)", [](float x) { return std::sin(x); }, reference);
+	measure("Cordic::sin(q16_16)",
+			[](float x) { return float(xpcc::Cordic::sin(q(x))); }, cordic);
+	measure("math::sin(q16_16)",
+			[](float x) { return float(xpcc::math::sin(q(x))); }, table);
+	TEST_ASSERT_EQUALS_DELTA(cordic, reference, iterations * 5e-5f);
+	TEST_ASSERT_EQUALS_DELTA(table, reference, iterations * 5e-5f);
+
+	reference = 0;
+	cordic = 0;
+	measure("atan2(float)", [](float x) { return std::atan2(x, 1.5f); }, reference);
+	measure("Cordic::atan2(q16_16)",
+			[](float x) { return float(xpcc::Cordic::atan2(q(x), q(1.5f))); }, cordic);
+	TEST_ASSERT_EQUALS_DELTA(cordic, reference, iterations * 5e-5f);
+
+	reference = 0;
+	cordic = 0;
+	measure("hypot(float)", [](float x) { return std::hypot(x, 1.5f); }, reference);
+	measure("Cordic::hypot(q16_16)",
+			[](float x) { return float(xpcc::Cordic::hypot(q(x), q(1.5f))); }, cordic);
+	TEST_ASSERT_EQUALS_DELTA(cordic, reference, iterations * 5e-5f);
+}
+
+void
+FixedBenchmarkTest::testDivisionAndRoot()
+{
+	float reference = 0;
+	float division = 0;
+	float newton = 0;
+
+	measure("1/x (float)", [](float x) { return 1.f / (x + 4.5f); }, reference);
+	measure("1/x (q16_16 division)",
+			[](float x) { return float(q(1) / q(x + 4.5f)); }, division);
+	measure("math::reciprocal(q16_16)",
+			[](float x) { return float(xpcc::math::reciprocal(q(x + 4.5f))); }, newton);
+	TEST_ASSERT_EQUALS_DELTA(division, reference, iterations * 2e-5f);
+	TEST_ASSERT_EQUALS_DELTA(newton, reference, iterations * 2e-5f);
+
+	reference = 0;
+	newton = 0;
+	measure("sqrt(float)", [](float x) { return std::sqrt(x + 4.f); }, reference);
+	measure("math::sqrt(q16_16)",
+			[](float x) { return float(xpcc::math::sqrt(q(x + 4.f))); }, newton);
+	TEST_ASSERT_EQUALS_DELTA(newton, reference, iterations * 2e-5f);
+
+	reference = 0;
+	newton = 0;
+	measure("1/sqrt(float)", [](float x) { return 1.f / std::sqrt(x + 4.5f); }, reference);
+	measure("math::inverseSqrt(q16_16)",
+			[](float x) { return float(xpcc::math::inverseSqrt(q(x + 4.5f))); }, newton);
+	TEST_ASSERT_EQUALS_DELTA(newton, reference, iterations * 2e-5f);
+}
+
+#else
+
+void
+FixedBenchmarkTest::testTrigonometry()
+{
+}
+
+void
+FixedBenchmarkTest::testDivisionAndRoot()
+{
+}
+
+#endif
@@ -0,0 +1,23 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Only runs on hosted targets, the results are printed to the info log.
+/// Note that the host has a FPU, on controllers without one the libm
+/// functions are emulated in software and considerably slower.
+class FixedBenchmarkTest : public unittest::TestSuite
+{
+public:
+	void
+	testTrigonometry();
+
+	void
+	testDivisionAndRoot();
+};
@@ -0,0 +1,156 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <xpcc/math/fixed/fixed_math.hpp>
+#include <xpcc/math/fixed/cordic.hpp>
+
+#include "fixed_math_test.hpp"
+
+namespace
+{
+	template<typename T>
+	float
+	maxSineError(T (*sin)(const T&), T (*cos)(const T&))
+	{
+		float max = 0;
+		for (int16_t i = -400; i <= 400; ++i)
+		{
+			const float angle = i * 0.0251f;
+			const T a(angle);
+			const float es = std::fabs(float(sin(a)) - std::sin(float(a)));
+			const float ec = std::fabs(float(cos(a)) - std::cos(float(a)));
+			if (es > max) { max = es; }
+			if (ec > max) { max = ec; }
+		}
+		return max;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+FixedMathTest::testCordicSinCos()
+{
+	TEST_ASSERT_EQUALS_DELTA(maxSineError<xpcc::q16_16>(
+			xpcc::Cordic::sin, xpcc::Cordic::cos), 0.f, 5e-5f);
+
+	// large angles are reduced to [-pi, pi]
+	xpcc::q16_16 s, c;
+	xpcc::Cordic::sinCos(xpcc::q16_16(1000.f), &s, &c);
+	TEST_ASSERT_EQUALS_DELTA(float(s), std::sin(1000.f), 1e-3f);
+	TEST_ASSERT_EQUALS_DELTA(float(c), std::cos(1000.f), 1e-3f);
+
+	// Q15 saturates cos(0) to the largest value below one
+	TEST_ASSERT_EQUALS(xpcc::Cordic::cos(xpcc::q15()).getRaw(), 32767);
+	TEST_ASSERT_EQUALS_DELTA(xpcc::Cordic::sin(xpcc::q15(0.5f)).getRaw(), 15710, 2);
+}
+
+void
+FixedMathTest::testCordicAtan2()
+{
+	for (int16_t i = -16; i <= 16; ++i)
+	{
+		const float angle = i * 0.19f;
+		const xpcc::q16_16 x(3.f * std::cos(angle));
+		const xpcc::q16_16 y(3.f * std::sin(angle));
+		TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::atan2(y, x)),
+				std::atan2(float(y), float(x)), 1e-4f);
+	}
+
+	// on the axes
+	const xpcc::q16_16 zero;
+	const xpcc::q16_16 one(1);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::atan2(zero, one)), 0.f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::atan2(one, zero)), float(M_PI_2), 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::atan2(zero, -one)), float(M_PI), 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::atan2(-one, zero)), float(-M_PI_2), 1e-4f);
+	TEST_ASSERT_EQUALS(xpcc::Cordic::atan2(zero, zero).getRaw(), 0);
+
+	// small values keep their precision
+	const xpcc::q16_16 tiny = xpcc::q16_16::fromRaw(3);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::atan2(tiny, tiny)), float(M_PI_4), 1e-4f);
+}
+
+void
+FixedMathTest::testCordicHypot()
+{
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::hypot(xpcc::q16_16(3), xpcc::q16_16(-4))), 5.f, 1e-4f);
+
+	// x*x would overflow
+	const xpcc::q16_16 big(20000);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::Cordic::hypot(big, big)), 28284.27f, 0.1f);
+
+	// result saturates
+	TEST_ASSERT_EQUALS(xpcc::Cordic::hypot(xpcc::q16_16(30000), big), xpcc::q16_16::max());
+
+	const xpcc::q15 a(0.3f);
+	const xpcc::q15 b(0.4f);
+	TEST_ASSERT_EQUALS_DELTA(xpcc::Cordic::hypot(a, b).getRaw(), 16384, 2);
+}
+
+// ----------------------------------------------------------------------------
+void
+FixedMathTest::testTableSinCos()
+{
+	TEST_ASSERT_EQUALS_DELTA(maxSineError<xpcc::q16_16>(
+			xpcc::math::sin, xpcc::math::cos), 0.f, 5e-5f);
+
+	// less than 1 LSB in Q15, the input is quantized as well
+	TEST_ASSERT_EQUALS_DELTA(maxSineError<xpcc::q15>(
+			xpcc::math::sin, xpcc::math::cos), 0.f, 7e-5f);
+
+	TEST_ASSERT_EQUALS(xpcc::math::cos(xpcc::q16_16()).getRaw(), 65536);
+	TEST_ASSERT_EQUALS(xpcc::math::sin(xpcc::q16_16()).getRaw(), 0);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::math::sin(xpcc::q16_16(float(M_PI_2)))), 1.f, 2e-5f);
+	TEST_ASSERT_EQUALS_DELTA(float(xpcc::math::sin(xpcc::q16_16(-100.f))), std::sin(-100.f), 1e-4f);
+}
+
+// ----------------------------------------------------------------------------
+void
+FixedMathTest::testReciprocal()
+{
+	const float values[] = { 1.f, 0.3f, -2.5f, 100.f, 0.001f, -7777.f };
+	for (uint_fast8_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+	{
+		const xpcc::q16_16 x(values[i]);
+		const xpcc::q16_16 expected = xpcc::q16_16(1) / x;
+		TEST_ASSERT_EQUALS_DELTA(xpcc::math::reciprocal(x).getRaw(), expected.getRaw(), 1);
+	}
+
+	TEST_ASSERT_EQUALS(xpcc::math::reciprocal(xpcc::q16_16()), xpcc::q16_16::max());
+	TEST_ASSERT_EQUALS(xpcc::math::reciprocal(xpcc::q16_16::fromRaw(1)), xpcc::q16_16::max());
+
+	TEST_ASSERT_EQUALS(xpcc::math::reciprocal(xpcc::q8_8(4)).getRaw(), 64);
+	TEST_ASSERT_EQUALS(xpcc::math::reciprocal(xpcc::q15(0.5f)).getRaw(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::math::reciprocal(xpcc::q15(-0.5f)).getRaw(), -32768);
+}
+
+void
+FixedMathTest::testSqrt()
+{
+	const float values[] = { 1.f, 0.3f, 2.f, 100.f, 0.001f, 30000.f, 4.f };
+	for (uint_fast8_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+	{
+		const xpcc::q16_16 x(values[i]);
+		TEST_ASSERT_EQUALS_DELTA(float(xpcc::math::sqrt(x)), std::sqrt(float(x)),
+				std::sqrt(float(x)) * 2e-5f + 2e-5f);
+		TEST_ASSERT_EQUALS_DELTA(float(xpcc::math::inverseSqrt(x)), 1.f / std::sqrt(float(x)),
+				1.f / std::sqrt(float(x)) * 2e-5f + 2e-5f);
+	}
+
+	TEST_ASSERT_EQUALS(xpcc::math::sqrt(xpcc::q16_16(-1)).getRaw(), 0);
+	TEST_ASSERT_EQUALS(xpcc::math::inverseSqrt(xpcc::q16_16()), xpcc::q16_16::max());
+
+	// odd and even number of fractional bits
+	TEST_ASSERT_EQUALS(xpcc::math::sqrt(xpcc::q15(0.25f)).getRaw(), 16384);
+	TEST_ASSERT_EQUALS(xpcc::math::sqrt(xpcc::q8_8(9)).getRaw(), 768);
+	TEST_ASSERT_EQUALS(xpcc::math::inverseSqrt(xpcc::q8_8(4)).getRaw(), 128);
+	typedef xpcc::fixed<int16_t, 7> q9_7;
+	TEST_ASSERT_EQUALS(xpcc::math::sqrt(q9_7(2)).getRaw(), 181);
+}
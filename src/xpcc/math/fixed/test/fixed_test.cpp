@@ -0,0 +1,208 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/fixed/fixed.hpp>
+
+#include "fixed_test.hpp"
+
+// evaluated at compile time
+static constexpr xpcc::q16_16 half(0.5f);
+static_assert(half.getRaw() == 0x8000, "constexpr construction failed");
+static constexpr xpcc::q31 one(1.0f);
+static_assert(one.getRaw() == 0x7fffffff, "constexpr saturation failed");
+
+// ----------------------------------------------------------------------------
+void
+FixedTest::testConstruction()
+{
+	xpcc::q16_16 a;
+	TEST_ASSERT_EQUALS(a.getRaw(), 0);
+
+	xpcc::q16_16 b(1.5f);
+	TEST_ASSERT_EQUALS(b.getRaw(), 0x18000);
+	TEST_ASSERT_EQUALS_FLOAT(b.toFloat(), 1.5f);
+
+	xpcc::q16_16 c(-3);
+	TEST_ASSERT_EQUALS(c.getRaw(), -0x30000);
+	TEST_ASSERT_EQUALS(c.toInteger(), -3);
+
+	// rounded to the nearest value
+	xpcc::q15 d(0.1f);
+	TEST_ASSERT_EQUALS(d.getRaw(), 3277);
+	xpcc::q15 e(-0.1f);
+	TEST_ASSERT_EQUALS(e.getRaw(), -3277);
+
+	// saturated
+	TEST_ASSERT_EQUALS(xpcc::q15(1.f).getRaw(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::q15(-2.f).getRaw(), -32768);
+	TEST_ASSERT_EQUALS(xpcc::q15(5).getRaw(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::q8_8(200).getRaw(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::q8_8(-200).getRaw(), -32768);
+	TEST_ASSERT_EQUALS(xpcc::q8_8(100.0).getRaw(), 25600);
+
+	// float(INT32_MAX) is 2^31, which must not wrap to the minimum
+	TEST_ASSERT_EQUALS(xpcc::q31(1.0f).getRaw(), INT32_MAX);
+	TEST_ASSERT_EQUALS(xpcc::q31(-1.0f).getRaw(), INT32_MIN);
+	TEST_ASSERT_EQUALS(xpcc::q16_16(32768.0f).getRaw(), INT32_MAX);
+	TEST_ASSERT_EQUALS(xpcc::q16_16(-32768.0f).getRaw(), INT32_MIN);
+	TEST_ASSERT_EQUALS(xpcc::q15(1.0f).getRaw(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::q31(0.5).getRaw(), 0x40000000);
+
+	TEST_ASSERT_EQUALS(xpcc::q7::fromRaw(-5).getRaw(), -5);
+	TEST_ASSERT_EQUALS(xpcc::q7::max().getRaw(), 127);
+	TEST_ASSERT_EQUALS(xpcc::q7::min().getRaw(), -128);
+
+	TEST_ASSERT_EQUALS(xpcc::q16_16::fromScaled(3, 4).getRaw(), 48);
+	TEST_ASSERT_EQUALS(xpcc::q16_16::fromScaled(40, -4).getRaw(), 3);
+	TEST_ASSERT_EQUALS(xpcc::q16_16::fromScaled(-40, -4).getRaw(), -2);
+	TEST_ASSERT_EQUALS(xpcc::q15::fromScaled(1, 20).getRaw(), 32767);
+	TEST_ASSERT_EQUALS(xpcc::q15::fromScaled(-1, 20).getRaw(), -32768);
+}
+
+void
+FixedTest::testConversion()
+{
+	const xpcc::q16_16 a(1.25f);
+
+	// fewer fractional bits
+	const xpcc::q8_8 b(a);
+	TEST_ASSERT_EQUALS(b.getRaw(), 320);
+
+	// more fractional bits, saturated
+	const xpcc::q15 c(a);
+	TEST_ASSERT_EQUALS(c.getRaw(), 32767);
+
+	const xpcc::q15 d(xpcc::q16_16(-0.75f));
+	TEST_ASSERT_EQUALS(d.getRaw(), -24576);
+
+	const xpcc::q31 e(d);
+	TEST_ASSERT_EQUALS(e.getRaw(), -24576L * 65536L);
+
+	// implicit conversion to float
+	const float f = a;
+	TEST_ASSERT_EQUALS_FLOAT(f, 1.25f);
+
+	// Saturated integration
+	xpcc::Saturated<int16_t> raw = xpcc::q15(0.5f).toSaturated();
+	raw += xpcc::Saturated<int16_t>(20000);
+	TEST_ASSERT_EQUALS(xpcc::q15::fromSaturated(raw).getRaw(), 32767);
+}
+
+// ----------------------------------------------------------------------------
+void
+FixedTest::testAddition()
+{
+	xpcc::q16_16 a(1.5f);
+	xpcc::q16_16 b(-2.25f);
+	TEST_ASSERT_EQUALS_FLOAT((a + b).toFloat(), -0.75f);
+	TEST_ASSERT_EQUALS_FLOAT((a - b).toFloat(), 3.75f);
+
+	a += b;
+	TEST_ASSERT_EQUALS_FLOAT(a.toFloat(), -0.75f);
+	a -= b;
+	TEST_ASSERT_EQUALS_FLOAT(a.toFloat(), 1.5f);
+
+	// saturation instead of overflow
+	xpcc::q15 c(0.75f);
+	TEST_ASSERT_EQUALS((c + c).getRaw(), 32767);
+	TEST_ASSERT_EQUALS((-c - c).getRaw(), -32768);
+
+	// exact in the low bits for 32-bit values
+	xpcc::q16_16 e = xpcc::q16_16::fromRaw(0x12345671);
+	e += xpcc::q16_16::fromRaw(0x00000003);
+	TEST_ASSERT_EQUALS(e.getRaw(), 0x12345674);
+	e -= xpcc::q16_16::fromRaw(0x12345675);
+	TEST_ASSERT_EQUALS(e.getRaw(), -1);
+	TEST_ASSERT_EQUALS((xpcc::q31::max() + xpcc::q31::fromRaw(1)).getRaw(), INT32_MAX);
+	TEST_ASSERT_EQUALS((xpcc::q31::min() - xpcc::q31::fromRaw(1)).getRaw(), INT32_MIN);
+
+	xpcc::q7 d = xpcc::q7::min();
+	TEST_ASSERT_EQUALS((-d).getRaw(), 127);
+	TEST_ASSERT_EQUALS(xpcc::abs(d).getRaw(), 127);
+	TEST_ASSERT_EQUALS(xpcc::abs(xpcc::q7(-0.5f)).getRaw(), 64);
+}
+
+void
+FixedTest::testMultiplication()
+{
+	xpcc::q16_16 a(1.5f);
+	xpcc::q16_16 b(-2.25f);
+	TEST_ASSERT_EQUALS_FLOAT((a * b).toFloat(), -3.375f);
+
+	a *= a;
+	TEST_ASSERT_EQUALS_FLOAT(a.toFloat(), 2.25f);
+
+	// Q15 rounding: 0.5 * 2^-15 is rounded up
+	xpcc::q15 c = xpcc::q15::fromRaw(1);
+	xpcc::q15 half(0.5f);
+	TEST_ASSERT_EQUALS((c * half).getRaw(), 1);
+	TEST_ASSERT_EQUALS((xpcc::q15(-0.5f) * xpcc::q15(-0.5f)).getRaw(), 8192);
+
+	// -1 * -1 does not fit into Q15
+	xpcc::q15 m = xpcc::q15::min();
+	TEST_ASSERT_EQUALS((m * m).getRaw(), 32767);
+
+	xpcc::q8_8 d(100);
+	TEST_ASSERT_EQUALS((d * d).getRaw(), 32767);
+	TEST_ASSERT_EQUALS((d * -d).getRaw(), -32768);
+}
+
+void
+FixedTest::testDivision()
+{
+	xpcc::q16_16 a(3.375f);
+	xpcc::q16_16 b(-1.5f);
+	TEST_ASSERT_EQUALS_FLOAT((a / b).toFloat(), -2.25f);
+
+	a /= xpcc::q16_16(0.5f);
+	TEST_ASSERT_EQUALS_FLOAT(a.toFloat(), 6.75f);
+
+	// rounded to nearest
+	xpcc::q8_8 one(1);
+	xpcc::q8_8 three(3);
+	TEST_ASSERT_EQUALS((one / three).getRaw(), 85);
+	TEST_ASSERT_EQUALS((xpcc::q8_8(2) / three).getRaw(), 171);
+	TEST_ASSERT_EQUALS((-xpcc::q8_8(2) / three).getRaw(), -171);
+
+	// division by zero and overflow saturate
+	TEST_ASSERT_EQUALS((one / xpcc::q8_8()).getRaw(), 32767);
+	TEST_ASSERT_EQUALS((-one / xpcc::q8_8()).getRaw(), -32768);
+	TEST_ASSERT_EQUALS((xpcc::q8_8(100) / xpcc::q8_8(0.25f)).getRaw(), 32767);
+}
+
+// ----------------------------------------------------------------------------
+void
+FixedTest::testIntegerOperators()
+{
+	xpcc::q16_16 a(1.25f);
+	TEST_ASSERT_EQUALS((a * 3).getRaw(), 0x3c000);
+	TEST_ASSERT_EQUALS((-2 * a).getRaw(), -0x28000);
+	TEST_ASSERT_EQUALS((a / 2).getRaw(), 0xa000);
+	TEST_ASSERT_EQUALS((a / 0).getRaw(), xpcc::q16_16::max().getRaw());
+
+	xpcc::q15 b(0.5f);
+	TEST_ASSERT_EQUALS((b * 4).getRaw(), 32767);
+	TEST_ASSERT_EQUALS((xpcc::q15::min() / -1).getRaw(), 32767);
+}
+
+void
+FixedTest::testComparison()
+{
+	xpcc::q16_16 a(1.25f);
+	xpcc::q16_16 b(-1.25f);
+
+	TEST_ASSERT_TRUE(a == a);
+	TEST_ASSERT_TRUE(a != b);
+	TEST_ASSERT_TRUE(b < a);
+	TEST_ASSERT_TRUE(b <= a);
+	TEST_ASSERT_TRUE(a > b);
+	TEST_ASSERT_TRUE(a >= a);
+	TEST_ASSERT_FALSE(a < b);
+	TEST_ASSERT_TRUE(a == -b);
+}
@@ -38,13 +38,16 @@
 #define	XPCC__GEOMETRY_HPP
 
 #include "geometry/angle.hpp"
+#include "geometry/bounding_box_2d.hpp"
 #include "geometry/circle_2d.hpp"
 #include "geometry/line_2d.hpp"
 #include "geometry/line_segment_2d.hpp"
 #include "geometry/location_2d.hpp"
+#include "geometry/point_buffer.hpp"
 #include "geometry/point_set_2d.hpp"
 #include "geometry/polygon_2d.hpp"
 #include "geometry/quaternion.hpp"
+#include "geometry/spatial_index_2d.hpp"
 #include "geometry/vector.hpp"
 
 #endif	// XPCC__GEOMETRY_HPP
@@ -0,0 +1,115 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BOUNDING_BOX_2D_HPP
+#define XPCC__BOUNDING_BOX_2D_HPP
+
+#include "geometric_traits.hpp"
+#include "vector2.hpp"
+#include "point_set_2d.hpp"
+
+namespace xpcc
+{
+	// forward declarations
+	template <typename T>
+	class Circle2D;
+
+	template <typename T>
+	class LineSegment2D;
+
+	template <typename T>
+	class Polygon2D;
+
+	template <typename T>
+	class Ray2D;
+
+	/**
+	 * \brief	Axis-aligned bounding box
+	 *
+	 * Used to reject intersection tests early, before the exact and more
+	 * expensive test of the enclosed shapes is done. All tests include
+	 * the border of the box.
+	 *
+	 * The tests against line segments, rays and circles are exact for the
+	 * box itself, they never reject a shape that touches the box.
+	 *
+	 * \see		xpcc::SpatialIndex2D
+	 * \ingroup	geometry
+	 */
+	template <typename T>
+	class BoundingBox2D
+	{
+	public:
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef typename GeometricTraits<T>::FloatType FloatType;
+
+	public:
+		/// Empty box, which contains nothing and intersects nothing
+		BoundingBox2D();
+
+		BoundingBox2D(const Vector<T, 2>& min, const Vector<T, 2>& max);
+
+		explicit
+		BoundingBox2D(const LineSegment2D<T>& segment);
+
+		explicit
+		BoundingBox2D(const Circle2D<T>& circle);
+
+		explicit
+		BoundingBox2D(const PointSet2D<T>& points);
+
+		inline const Vector<T, 2>&
+		getMin() const;
+
+		inline const Vector<T, 2>&
+		getMax() const;
+
+		inline bool
+		isEmpty() const;
+
+		/// Center of the box, used to sort boxes
+		inline Vector<T, 2>
+		getCenter() const;
+
+		/// Enlarge the box to include the point
+		void
+		expand(const Vector<T, 2>& point);
+
+		/// Enlarge the box to include the other box
+		void
+		expand(const BoundingBox2D& other);
+
+		bool
+		contains(const Vector<T, 2>& point) const;
+
+		bool
+		intersects(const BoundingBox2D& other) const;
+
+		bool
+		intersects(const LineSegment2D<T>& segment) const;
+
+		bool
+		intersects(const Ray2D<T>& ray) const;
+
+		bool
+		intersects(const Circle2D<T>& circle) const;
+
+	protected:
+		Vector<T, 2> min;
+		Vector<T, 2> max;
+	};
+}
+
+#include "circle_2d.hpp"
+#include "line_segment_2d.hpp"
+#include "ray_2d.hpp"
+
+#include "bounding_box_2d_impl.hpp"
+
+#endif // XPCC__BOUNDING_BOX_2D_HPP
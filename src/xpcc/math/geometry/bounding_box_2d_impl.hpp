@@ -0,0 +1,252 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__BOUNDING_BOX_2D_HPP
+#	error	"Don't include this file directly, use 'bounding_box_2d.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+// An empty box is marked by min > max
+template <typename T>
+xpcc::BoundingBox2D<T>::BoundingBox2D() :
+	min(1, 1), max(0, 0)
+{
+}
+
+template <typename T>
+xpcc::BoundingBox2D<T>::BoundingBox2D(const Vector<T, 2>& min, const Vector<T, 2>& max) :
+	min(min), max(max)
+{
+}
+
+template <typename T>
+xpcc::BoundingBox2D<T>::BoundingBox2D(const LineSegment2D<T>& segment) :
+	min(segment.getStartPoint()), max(segment.getStartPoint())
+{
+	expand(segment.getEndPoint());
+}
+
+template <typename T>
+xpcc::BoundingBox2D<T>::BoundingBox2D(const Circle2D<T>& circle) :
+	min(circle.getCenter().x - circle.getRadius(),
+		circle.getCenter().y - circle.getRadius()),
+	max(circle.getCenter().x + circle.getRadius(),
+		circle.getCenter().y + circle.getRadius())
+{
+}
+
+template <typename T>
+xpcc::BoundingBox2D<T>::BoundingBox2D(const PointSet2D<T>& points) :
+	min(1, 1), max(0, 0)
+{
+	for (const Vector<T, 2>& point : points) {
+		expand(point);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T>
+const xpcc::Vector<T, 2>&
+xpcc::BoundingBox2D<T>::getMin() const
+{
+	return this->min;
+}
+
+template <typename T>
+const xpcc::Vector<T, 2>&
+xpcc::BoundingBox2D<T>::getMax() const
+{
+	return this->max;
+}
+
+template <typename T>
+bool
+xpcc::BoundingBox2D<T>::isEmpty() const
+{
+	return (this->min.x > this->max.x);
+}
+
+template <typename T>
+xpcc::Vector<T, 2>
+xpcc::BoundingBox2D<T>::getCenter() const
+{
+	return Vector<T, 2>(
+			this->min.x + (this->max.x - this->min.x) / 2,
+			this->min.y + (this->max.y - this->min.y) / 2);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T>
+void
+xpcc::BoundingBox2D<T>::expand(const Vector<T, 2>& point)
+{
+	if (this->isEmpty()) {
+		this->min = point;
+		this->max = point;
+		return;
+	}
+
+	if (point.x < this->min.x) { this->min.x = point.x; }
+	if (point.y < this->min.y) { this->min.y = point.y; }
+	if (point.x > this->max.x) { this->max.x = point.x; }
+	if (point.y > this->max.y) { this->max.y = point.y; }
+}
+
+template <typename T>
+void
+xpcc::BoundingBox2D<T>::expand(const BoundingBox2D& other)
+{
+	if (!other.isEmpty()) {
+		this->expand(other.min);
+		this->expand(other.max);
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T>
+bool
+xpcc::BoundingBox2D<T>::contains(const Vector<T, 2>& point) const
+{
+	return (this->min.x <= point.x && point.x <= this->max.x &&
+			this->min.y <= point.y && point.y <= this->max.y);
+}
+
+template <typename T>
+bool
+xpcc::BoundingBox2D<T>::intersects(const BoundingBox2D& other) const
+{
+	if (this->isEmpty() || other.isEmpty()) {
+		return false;
+	}
+	return (this->min.x <= other.max.x && other.min.x <= this->max.x &&
+			this->min.y <= other.max.y && other.min.y <= this->max.y);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T>
+bool
+xpcc::BoundingBox2D<T>::intersects(const LineSegment2D<T>& segment) const
+{
+	if (!this->intersects(BoundingBox2D(segment))) {
+		return false;
+	}
+
+	// The boxes overlap, the segment misses the box only if all four
+	// corners lie strictly on the same side of the line through it.
+	const Vector<T, 2>& start = segment.getStartPoint();
+	const FloatType dx = FloatType(segment.getEndPoint().x) - FloatType(start.x);
+	const FloatType dy = FloatType(segment.getEndPoint().y) - FloatType(start.y);
+
+	const FloatType x0 = FloatType(this->min.x) - FloatType(start.x);
+	const FloatType x1 = FloatType(this->max.x) - FloatType(start.x);
+	const FloatType y0 = FloatType(this->min.y) - FloatType(start.y);
+	const FloatType y1 = FloatType(this->max.y) - FloatType(start.y);
+
+	const FloatType c[4] = {
+		dx * y0 - dy * x0,
+		dx * y0 - dy * x1,
+		dx * y1 - dy * x0,
+		dx * y1 - dy * x1
+	};
+
+	bool positive = false;
+	bool negative = false;
+	for (uint_fast8_t i = 0; i < 4; ++i)
+	{
+		if (c[i] >= 0) { positive = true; }
+		if (c[i] <= 0) { negative = true; }
+	}
+	return (positive && negative);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T>
+bool
+xpcc::BoundingBox2D<T>::intersects(const Ray2D<T>& ray) const
+{
+	if (this->isEmpty()) {
+		return false;
+	}
+
+	// slab test, the ray starts at t = 0 and is not limited in length
+	const Vector<T, 2>& start = ray.getStartPoint();
+	const Vector<T, 2>& direction = ray.getDirectionVector();
+
+	FloatType tMin = 0;
+	bool bounded = false;
+	FloatType tMax = 0;
+
+	for (uint_fast8_t axis = 0; axis < 2; ++axis)
+	{
+		const FloatType s = (axis == 0) ? start.x : start.y;
+		const FloatType d = (axis == 0) ? direction.x : direction.y;
+		const FloatType low = (axis == 0) ? this->min.x : this->min.y;
+		const FloatType high = (axis == 0) ? this->max.x : this->max.y;
+
+		if (d == 0)
+		{
+			// parallel to this slab
+			if (s < low || s > high) {
+				return false;
+			}
+			continue;
+		}
+
+		FloatType t0 = (low - s) / d;
+		FloatType t1 = (high - s) / d;
+		if (t0 > t1) {
+			FloatType t = t0;
+			t0 = t1;
+			t1 = t;
+		}
+
+		if (t0 > tMin) {
+			tMin = t0;
+		}
+		if (!bounded || t1 < tMax) {
+			tMax = t1;
+			bounded = true;
+		}
+		if (tMin > tMax) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T>
+bool
+xpcc::BoundingBox2D<T>::intersects(const Circle2D<T>& circle) const
+{
+	if (this->isEmpty()) {
+		return false;
+	}
+
+	// distance from the center to the closest point inside the box
+	const Vector<T, 2>& center = circle.getCenter();
+	FloatType dx = 0;
+	if (center.x < this->min.x) {
+		dx = FloatType(this->min.x) - FloatType(center.x);
+	}
+	else if (center.x > this->max.x) {
+		dx = FloatType(center.x) - FloatType(this->max.x);
+	}
+
+	FloatType dy = 0;
+	if (center.y < this->min.y) {
+		dy = FloatType(this->min.y) - FloatType(center.y);
+	}
+	else if (center.y > this->max.y) {
+		dy = FloatType(center.y) - FloatType(this->max.y);
+	}
+
+	const FloatType radius = circle.getRadius();
+	return (dx * dx + dy * dy <= radius * radius);
+}
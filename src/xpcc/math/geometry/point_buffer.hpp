@@ -0,0 +1,246 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__POINT_BUFFER_HPP
+#define XPCC__POINT_BUFFER_HPP
+
+#include <stddef.h>
+
+#include "vector.hpp"
+#include "location_2d.hpp"
+#include "point_set_2d.hpp"
+#include "point_kernel.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Fixed-capacity buffer of 2D points stored as structure of arrays
+	 *
+	 * The x and y coordinates are kept in two separate arrays, so batch
+	 * operations can be processed by xpcc::PointKernel with SIMD
+	 * instructions and the sine and cosine of a rotation are computed
+	 * only once for all points.
+	 *
+	 * \code
+	 * xpcc::PointBuffer2D<float, 720> scan;
+	 * scan.fromPointSet(points);
+	 *
+	 * // transform all points from the robot into the world frame
+	 * scan.transform(robotLocation);
+	 * \endcode
+	 *
+	 * Use xpcc::PointSet2D for sets that must grow dynamically.
+	 *
+	 * \tparam	T	type of the coordinates
+	 * \tparam	N	maximum number of points
+	 *
+	 * \ingroup	geometry
+	 */
+	template<typename T, size_t N>
+	class PointBuffer2D
+	{
+	public:
+		typedef size_t SizeType;
+		typedef Vector<T, 2> PointType;
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef PointKernel<T> Kernel;
+
+	public:
+		PointBuffer2D();
+
+		/// Copies the first N points of the set
+		explicit
+		PointBuffer2D(const PointSet2D<T>& set);
+
+		inline SizeType
+		getSize() const;
+
+		static constexpr SizeType
+		getCapacity()
+		{
+			return N;
+		}
+
+		inline bool
+		isFull() const;
+
+		/// \return	`false` if the buffer is full
+		bool
+		append(const PointType& point);
+
+		inline PointType
+		operator [](SizeType index) const;
+
+		inline void
+		set(SizeType index, const PointType& point);
+
+		inline void
+		removeAll();
+
+		/// Coordinate arrays for direct use with xpcc::PointKernel
+		inline T*
+		getX();
+
+		inline const T*
+		getX() const;
+
+		inline T*
+		getY();
+
+		inline const T*
+		getY() const;
+
+		/**
+		 * \brief	Replace the content by the points of the set
+		 *
+		 * \return	Number of points copied, at most N
+		 */
+		SizeType
+		fromPointSet(const PointSet2D<T>& set);
+
+		/// Append all points of this buffer to the set
+		void
+		toPointSet(PointSet2D<T>& set) const;
+
+	public:
+		void
+		translate(const PointType& vector);
+
+		/// Rotate all points by `phi` around the origin
+		void
+		rotate(float phi);
+
+		/**
+		 * \brief	Transform all points from the local frame of `location`
+		 *
+		 * Same as calling `location.translated(point)` for every point.
+		 */
+		void
+		transform(const Location2D<T>& location);
+
+		/// Scale all points to unit length, zero points are unchanged
+		void
+		normalize();
+
+		/// Write the length of every point to `out`, which needs getSize() elements
+		void
+		getLength(T *out) const;
+
+		/**
+		 * \brief	Dot product with the corresponding points of `other`
+		 *
+		 * `out` needs as many elements as the smaller of both buffers.
+		 */
+		template<size_t M>
+		void
+		dot(const PointBuffer2D<T, M>& other, WideType *out) const;
+
+	protected:
+		T x[N];
+		T y[N];
+		SizeType size;
+	};
+
+	/**
+	 * \brief	Fixed-capacity buffer of 3D points stored as structure of arrays
+	 *
+	 * \see		xpcc::PointBuffer2D
+	 * \ingroup	geometry
+	 */
+	template<typename T, size_t N>
+	class PointBuffer3D
+	{
+	public:
+		typedef size_t SizeType;
+		typedef Vector<T, 3> PointType;
+		typedef typename GeometricTraits<T>::WideType WideType;
+		typedef PointKernel<T> Kernel;
+
+	public:
+		PointBuffer3D();
+
+		inline SizeType
+		getSize() const;
+
+		static constexpr SizeType
+		getCapacity()
+		{
+			return N;
+		}
+
+		inline bool
+		isFull() const;
+
+		/// \return	`false` if the buffer is full
+		bool
+		append(const PointType& point);
+
+		inline PointType
+		operator [](SizeType index) const;
+
+		inline void
+		set(SizeType index, const PointType& point);
+
+		inline void
+		removeAll();
+
+		inline T*
+		getX();
+
+		inline const T*
+		getX() const;
+
+		inline T*
+		getY();
+
+		inline const T*
+		getY() const;
+
+		inline T*
+		getZ();
+
+		inline const T*
+		getZ() const;
+
+	public:
+		void
+		translate(const PointType& vector);
+
+		/**
+		 * \brief	Rotate all points by `rotation`, then add `translation`
+		 *
+		 * A rotation matrix can be obtained from a quaternion with
+		 * xpcc::Quaternion::to3x3Matrix().
+		 */
+		template<typename U>
+		void
+		transform(const Matrix<U, 3, 3>& rotation,
+				const PointType& translation = PointType());
+
+		void
+		normalize();
+
+		void
+		getLength(T *out) const;
+
+		template<size_t M>
+		void
+		dot(const PointBuffer3D<T, M>& other, WideType *out) const;
+
+	protected:
+		T x[N];
+		T y[N];
+		T z[N];
+		SizeType size;
+	};
+}
+
+#include "point_buffer_impl.hpp"
+
+#endif // XPCC__POINT_BUFFER_HPP
@@ -0,0 +1,320 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__POINT_BUFFER_HPP
+#	error	"Don't include this file directly, use 'point_buffer.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+xpcc::PointBuffer2D<T, N>::PointBuffer2D() :
+	size(0)
+{
+}
+
+template<typename T, size_t N>
+xpcc::PointBuffer2D<T, N>::PointBuffer2D(const PointSet2D<T>& set) :
+	size(0)
+{
+	fromPointSet(set);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+typename xpcc::PointBuffer2D<T, N>::SizeType
+xpcc::PointBuffer2D<T, N>::getSize() const
+{
+	return size;
+}
+
+template<typename T, size_t N>
+bool
+xpcc::PointBuffer2D<T, N>::isFull() const
+{
+	return (size >= N);
+}
+
+template<typename T, size_t N>
+bool
+xpcc::PointBuffer2D<T, N>::append(const PointType& point)
+{
+	if (isFull()) {
+		return false;
+	}
+	x[size] = point.x;
+	y[size] = point.y;
+	size++;
+	return true;
+}
+
+template<typename T, size_t N>
+typename xpcc::PointBuffer2D<T, N>::PointType
+xpcc::PointBuffer2D<T, N>::operator [](SizeType index) const
+{
+	return PointType(x[index], y[index]);
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::set(SizeType index, const PointType& point)
+{
+	x[index] = point.x;
+	y[index] = point.y;
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::removeAll()
+{
+	size = 0;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+T*
+xpcc::PointBuffer2D<T, N>::getX()
+{
+	return x;
+}
+
+template<typename T, size_t N>
+const T*
+xpcc::PointBuffer2D<T, N>::getX() const
+{
+	return x;
+}
+
+template<typename T, size_t N>
+T*
+xpcc::PointBuffer2D<T, N>::getY()
+{
+	return y;
+}
+
+template<typename T, size_t N>
+const T*
+xpcc::PointBuffer2D<T, N>::getY() const
+{
+	return y;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+typename xpcc::PointBuffer2D<T, N>::SizeType
+xpcc::PointBuffer2D<T, N>::fromPointSet(const PointSet2D<T>& set)
+{
+	size = 0;
+	for (const PointType& point : set)
+	{
+		if (!append(point)) {
+			break;
+		}
+	}
+	return size;
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::toPointSet(PointSet2D<T>& set) const
+{
+	for (SizeType i = 0; i < size; ++i) {
+		set.append(PointType(x[i], y[i]));
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::translate(const PointType& vector)
+{
+	Kernel::translate(x, y, size, vector.x, vector.y);
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::rotate(float phi)
+{
+	Kernel::rotate(x, y, size, std::cos(phi), std::sin(phi));
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::transform(const Location2D<T>& location)
+{
+	const float phi = location.getOrientation();
+	const PointType& position = location.getPosition();
+	Kernel::transform(x, y, size, std::cos(phi), std::sin(phi),
+			position.x, position.y);
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::normalize()
+{
+	Kernel::normalize(x, y, size);
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer2D<T, N>::getLength(T *out) const
+{
+	Kernel::length(x, y, out, size);
+}
+
+template<typename T, size_t N> template<size_t M>
+void
+xpcc::PointBuffer2D<T, N>::dot(const PointBuffer2D<T, M>& other, WideType *out) const
+{
+	const SizeType n = (size < other.getSize()) ? size : other.getSize();
+	Kernel::dot(x, y, other.getX(), other.getY(), out, n);
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+xpcc::PointBuffer3D<T, N>::PointBuffer3D() :
+	size(0)
+{
+}
+
+template<typename T, size_t N>
+typename xpcc::PointBuffer3D<T, N>::SizeType
+xpcc::PointBuffer3D<T, N>::getSize() const
+{
+	return size;
+}
+
+template<typename T, size_t N>
+bool
+xpcc::PointBuffer3D<T, N>::isFull() const
+{
+	return (size >= N);
+}
+
+template<typename T, size_t N>
+bool
+xpcc::PointBuffer3D<T, N>::append(const PointType& point)
+{
+	if (isFull()) {
+		return false;
+	}
+	x[size] = point.x;
+	y[size] = point.y;
+	z[size] = point.z;
+	size++;
+	return true;
+}
+
+template<typename T, size_t N>
+typename xpcc::PointBuffer3D<T, N>::PointType
+xpcc::PointBuffer3D<T, N>::operator [](SizeType index) const
+{
+	return PointType(x[index], y[index], z[index]);
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer3D<T, N>::set(SizeType index, const PointType& point)
+{
+	x[index] = point.x;
+	y[index] = point.y;
+	z[index] = point.z;
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer3D<T, N>::removeAll()
+{
+	size = 0;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+T*
+xpcc::PointBuffer3D<T, N>::getX()
+{
+	return x;
+}
+
+template<typename T, size_t N>
+const T*
+xpcc::PointBuffer3D<T, N>::getX() const
+{
+	return x;
+}
+
+template<typename T, size_t N>
+T*
+xpcc::PointBuffer3D<T, N>::getY()
+{
+	return y;
+}
+
+template<typename T, size_t N>
+const T*
+xpcc::PointBuffer3D<T, N>::getY() const
+{
+	return y;
+}
+
+template<typename T, size_t N>
+T*
+xpcc::PointBuffer3D<T, N>::getZ()
+{
+	return z;
+}
+
+template<typename T, size_t N>
+const T*
+xpcc::PointBuffer3D<T, N>::getZ() const
+{
+	return z;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, size_t N>
+void
+xpcc::PointBuffer3D<T, N>::translate(const PointType& vector)
+{
+	Kernel::translate(x, y, z, size, vector.x, vector.y, vector.z);
+}
+
+template<typename T, size_t N> template<typename U>
+void
+xpcc::PointBuffer3D<T, N>::transform(const Matrix<U, 3, 3>& rotation,
+		const PointType& translation)
+{
+	float m[9];
+	for (uint_fast8_t i = 0; i < 9; ++i) {
+		m[i] = rotation.element[i];
+	}
+	Kernel::transform(x, y, z, size, m,
+			translation.x, translation.y, translation.z);
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer3D<T, N>::normalize()
+{
+	Kernel::normalize(x, y, z, size);
+}
+
+template<typename T, size_t N>
+void
+xpcc::PointBuffer3D<T, N>::getLength(T *out) const
+{
+	Kernel::length(x, y, z, out, size);
+}
+
+template<typename T, size_t N> template<size_t M>
+void
+xpcc::PointBuffer3D<T, N>::dot(const PointBuffer3D<T, M>& other, WideType *out) const
+{
+	const SizeType n = (size < other.getSize()) ? size : other.getSize();
+	Kernel::dot(x, y, z, other.getX(), other.getY(), other.getZ(), out, n);
+}
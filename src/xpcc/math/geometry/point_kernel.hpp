@@ -0,0 +1,206 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__POINT_KERNEL_HPP
+#define XPCC__POINT_KERNEL_HPP
+
+#include <cmath>
+#include <stddef.h>
+
+#include "geometric_traits.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Scalar implementation of the point batch kernels
+	 *
+	 * All functions work on structure-of-arrays data, i.e. the x, y
+	 * (and z) coordinates of `n` points are stored in separate arrays.
+	 * Rotations are applied with the same rounding as
+	 * xpcc::Vector<T, 2>::rotate(), so integer results are identical to
+	 * the per-point operations.
+	 *
+	 * Use xpcc::PointKernel, which may replace some of these functions by
+	 * vectorized versions.
+	 *
+	 * \ingroup	geometry
+	 */
+	template<typename T>
+	struct PointKernelBase
+	{
+		typedef typename GeometricTraits<T>::WideType WideType;
+
+		/// Add (dx, dy) to every point
+		static void
+		translate(T *x, T *y, size_t n, T dx, T dy)
+		{
+			for (size_t i = 0; i < n; ++i) {
+				x[i] += dx;
+				y[i] += dy;
+			}
+		}
+
+		/// Rotate every point by the angle with the given cosine and sine
+		static void
+		rotate(T *x, T *y, size_t n, float c, float s)
+		{
+			transform(x, y, n, c, s, T(), T());
+		}
+
+		/// Rotate every point, then add (dx, dy)
+		static void
+		transform(T *x, T *y, size_t n, float c, float s, T dx, T dy)
+		{
+			for (size_t i = 0; i < n; ++i)
+			{
+				const float fx = x[i];
+				const float fy = y[i];
+				x[i] = GeometricTraits<T>::round(c * fx - s * fy) + dx;
+				y[i] = GeometricTraits<T>::round(s * fx + c * fy) + dy;
+			}
+		}
+
+		/// out[i] = a[i] * b[i]
+		static void
+		dot(const T *ax, const T *ay, const T *bx, const T *by,
+			WideType *out, size_t n)
+		{
+			for (size_t i = 0; i < n; ++i) {
+				out[i] = WideType(ax[i]) * WideType(bx[i]) +
+						 WideType(ay[i]) * WideType(by[i]);
+			}
+		}
+
+		/// out[i] = |p[i]|
+		static void
+		length(const T *x, const T *y, T *out, size_t n)
+		{
+			for (size_t i = 0; i < n; ++i)
+			{
+				const float fx = x[i];
+				const float fy = y[i];
+				out[i] = GeometricTraits<T>::round(std::sqrt(fx * fx + fy * fy));
+			}
+		}
+
+		/// Scale every point to unit length, points of length zero are unchanged
+		static void
+		normalize(T *x, T *y, size_t n)
+		{
+			for (size_t i = 0; i < n; ++i)
+			{
+				const float fx = x[i];
+				const float fy = y[i];
+				const float l = std::sqrt(fx * fx + fy * fy);
+				if (l > 0.0f) {
+					x[i] = GeometricTraits<T>::round(fx / l);
+					y[i] = GeometricTraits<T>::round(fy / l);
+				}
+			}
+		}
+
+		// --------------------------------------------------------------------
+		/// Add (dx, dy, dz) to every point
+		static void
+		translate(T *x, T *y, T *z, size_t n, T dx, T dy, T dz)
+		{
+			for (size_t i = 0; i < n; ++i) {
+				x[i] += dx;
+				y[i] += dy;
+				z[i] += dz;
+			}
+		}
+
+		/**
+		 * \brief	Multiply every point with the row-major 3x3 matrix `m`,
+		 * 			then add (dx, dy, dz)
+		 */
+		static void
+		transform(T *x, T *y, T *z, size_t n, const float *m, T dx, T dy, T dz)
+		{
+			for (size_t i = 0; i < n; ++i)
+			{
+				const float fx = x[i];
+				const float fy = y[i];
+				const float fz = z[i];
+				x[i] = GeometricTraits<T>::round(m[0] * fx + m[1] * fy + m[2] * fz) + dx;
+				y[i] = GeometricTraits<T>::round(m[3] * fx + m[4] * fy + m[5] * fz) + dy;
+				z[i] = GeometricTraits<T>::round(m[6] * fx + m[7] * fy + m[8] * fz) + dz;
+			}
+		}
+
+		static void
+		dot(const T *ax, const T *ay, const T *az,
+			const T *bx, const T *by, const T *bz,
+			WideType *out, size_t n)
+		{
+			for (size_t i = 0; i < n; ++i) {
+				out[i] = WideType(ax[i]) * WideType(bx[i]) +
+						 WideType(ay[i]) * WideType(by[i]) +
+						 WideType(az[i]) * WideType(bz[i]);
+			}
+		}
+
+		static void
+		length(const T *x, const T *y, const T *z, T *out, size_t n)
+		{
+			for (size_t i = 0; i < n; ++i)
+			{
+				const float fx = x[i];
+				const float fy = y[i];
+				const float fz = z[i];
+				out[i] = GeometricTraits<T>::round(
+						std::sqrt(fx * fx + fy * fy + fz * fz));
+			}
+		}
+
+		static void
+		normalize(T *x, T *y, T *z, size_t n)
+		{
+			for (size_t i = 0; i < n; ++i)
+			{
+				const float fx = x[i];
+				const float fy = y[i];
+				const float fz = z[i];
+				const float l = std::sqrt(fx * fx + fy * fy + fz * fz);
+				if (l > 0.0f) {
+					x[i] = GeometricTraits<T>::round(fx / l);
+					y[i] = GeometricTraits<T>::round(fy / l);
+					z[i] = GeometricTraits<T>::round(fz / l);
+				}
+			}
+		}
+	};
+
+	/**
+	 * \brief	Batch kernels for structure-of-arrays point data
+	 *
+	 * Specialized implementations are selected at compile time:
+	 * - `float` with SSE or AVX on x86 hosts.
+	 *
+	 * All other types use the scalar implementation of
+	 * xpcc::PointKernelBase. Floating point results of the vectorized
+	 * versions may differ in the last bit, because the compiler is free to
+	 * contract the scalar code into fused multiply-adds.
+	 *
+	 * \see		xpcc::PointBuffer2D
+	 * \see		xpcc::PointBuffer3D
+	 * \ingroup	geometry
+	 */
+	template<typename T>
+	struct PointKernel : public PointKernelBase<T>
+	{
+	};
+}
+
+#if defined(__SSE__)
+#	include "point_kernel__x86_impl.hpp"
+#endif
+
+#endif // XPCC__POINT_KERNEL_HPP
@@ -0,0 +1,242 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__POINT_KERNEL_HPP
+#	error	"Don't include this file directly, use 'point_kernel.hpp' instead!"
+#endif
+
+#if defined(__AVX__)
+#	include <immintrin.h>
+#else
+#	include <xmmintrin.h>
+#endif
+
+namespace xpcc
+{
+	/*
+	 * The vector loops process as many points as possible, the remaining
+	 * points are handed over to the scalar implementation.
+	 */
+	template<>
+	struct PointKernel<float> : public PointKernelBase<float>
+	{
+		typedef PointKernelBase<float> Base;
+
+		static inline void
+		translate(float *x, float *y, size_t n, float dx, float dy)
+		{
+			const __m128 vdx = _mm_set1_ps(dx);
+			const __m128 vdy = _mm_set1_ps(dy);
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), vdx));
+				_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), vdy));
+			}
+			Base::translate(x + i, y + i, n - i, dx, dy);
+		}
+
+		static inline void
+		rotate(float *x, float *y, size_t n, float c, float s)
+		{
+			transform(x, y, n, c, s, 0.0f, 0.0f);
+		}
+
+		static inline void
+		transform(float *x, float *y, size_t n, float c, float s, float dx, float dy)
+		{
+			size_t i = 0;
+#if defined(__AVX__)
+			{
+				const __m256 vc = _mm256_set1_ps(c);
+				const __m256 vs = _mm256_set1_ps(s);
+				const __m256 vdx = _mm256_set1_ps(dx);
+				const __m256 vdy = _mm256_set1_ps(dy);
+				for (; i + 8 <= n; i += 8)
+				{
+					const __m256 px = _mm256_loadu_ps(x + i);
+					const __m256 py = _mm256_loadu_ps(y + i);
+					_mm256_storeu_ps(x + i, _mm256_add_ps(vdx,
+							_mm256_sub_ps(_mm256_mul_ps(vc, px), _mm256_mul_ps(vs, py))));
+					_mm256_storeu_ps(y + i, _mm256_add_ps(vdy,
+							_mm256_add_ps(_mm256_mul_ps(vs, px), _mm256_mul_ps(vc, py))));
+				}
+			}
+#endif
+			const __m128 vc = _mm_set1_ps(c);
+			const __m128 vs = _mm_set1_ps(s);
+			const __m128 vdx = _mm_set1_ps(dx);
+			const __m128 vdy = _mm_set1_ps(dy);
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128 px = _mm_loadu_ps(x + i);
+				const __m128 py = _mm_loadu_ps(y + i);
+				_mm_storeu_ps(x + i, _mm_add_ps(vdx,
+						_mm_sub_ps(_mm_mul_ps(vc, px), _mm_mul_ps(vs, py))));
+				_mm_storeu_ps(y + i, _mm_add_ps(vdy,
+						_mm_add_ps(_mm_mul_ps(vs, px), _mm_mul_ps(vc, py))));
+			}
+			Base::transform(x + i, y + i, n - i, c, s, dx, dy);
+		}
+
+		static inline void
+		dot(const float *ax, const float *ay, const float *bx, const float *by,
+			float *out, size_t n)
+		{
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				_mm_storeu_ps(out + i, _mm_add_ps(
+						_mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)),
+						_mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i))));
+			}
+			Base::dot(ax + i, ay + i, bx + i, by + i, out + i, n - i);
+		}
+
+		static inline void
+		length(const float *x, const float *y, float *out, size_t n)
+		{
+			size_t i = 0;
+#if defined(__AVX__)
+			for (; i + 8 <= n; i += 8)
+			{
+				const __m256 px = _mm256_loadu_ps(x + i);
+				const __m256 py = _mm256_loadu_ps(y + i);
+				_mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(
+						_mm256_mul_ps(px, px), _mm256_mul_ps(py, py))));
+			}
+#endif
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128 px = _mm_loadu_ps(x + i);
+				const __m128 py = _mm_loadu_ps(y + i);
+				_mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(
+						_mm_mul_ps(px, px), _mm_mul_ps(py, py))));
+			}
+			Base::length(x + i, y + i, out + i, n - i);
+		}
+
+		static inline void
+		normalize(float *x, float *y, size_t n)
+		{
+			const __m128 zero = _mm_setzero_ps();
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128 px = _mm_loadu_ps(x + i);
+				const __m128 py = _mm_loadu_ps(y + i);
+				const __m128 l = _mm_sqrt_ps(_mm_add_ps(
+						_mm_mul_ps(px, px), _mm_mul_ps(py, py)));
+
+				// points of length zero stay zero
+				const __m128 mask = _mm_cmpgt_ps(l, zero);
+				_mm_storeu_ps(x + i, _mm_and_ps(mask, _mm_div_ps(px, l)));
+				_mm_storeu_ps(y + i, _mm_and_ps(mask, _mm_div_ps(py, l)));
+			}
+			Base::normalize(x + i, y + i, n - i);
+		}
+
+		// --------------------------------------------------------------------
+		static inline void
+		translate(float *x, float *y, float *z, size_t n,
+				  float dx, float dy, float dz)
+		{
+			const __m128 vdx = _mm_set1_ps(dx);
+			const __m128 vdy = _mm_set1_ps(dy);
+			const __m128 vdz = _mm_set1_ps(dz);
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				_mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), vdx));
+				_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), vdy));
+				_mm_storeu_ps(z + i, _mm_add_ps(_mm_loadu_ps(z + i), vdz));
+			}
+			Base::translate(x + i, y + i, z + i, n - i, dx, dy, dz);
+		}
+
+		static inline void
+		transform(float *x, float *y, float *z, size_t n, const float *m,
+				  float dx, float dy, float dz)
+		{
+			const __m128 m0 = _mm_set1_ps(m[0]);
+			const __m128 m1 = _mm_set1_ps(m[1]);
+			const __m128 m2 = _mm_set1_ps(m[2]);
+			const __m128 m3 = _mm_set1_ps(m[3]);
+			const __m128 m4 = _mm_set1_ps(m[4]);
+			const __m128 m5 = _mm_set1_ps(m[5]);
+			const __m128 m6 = _mm_set1_ps(m[6]);
+			const __m128 m7 = _mm_set1_ps(m[7]);
+			const __m128 m8 = _mm_set1_ps(m[8]);
+			const __m128 vdx = _mm_set1_ps(dx);
+			const __m128 vdy = _mm_set1_ps(dy);
+			const __m128 vdz = _mm_set1_ps(dz);
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128 px = _mm_loadu_ps(x + i);
+				const __m128 py = _mm_loadu_ps(y + i);
+				const __m128 pz = _mm_loadu_ps(z + i);
+				_mm_storeu_ps(x + i, _mm_add_ps(vdx, _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(m0, px), _mm_mul_ps(m1, py)), _mm_mul_ps(m2, pz))));
+				_mm_storeu_ps(y + i, _mm_add_ps(vdy, _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(m3, px), _mm_mul_ps(m4, py)), _mm_mul_ps(m5, pz))));
+				_mm_storeu_ps(z + i, _mm_add_ps(vdz, _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(m6, px), _mm_mul_ps(m7, py)), _mm_mul_ps(m8, pz))));
+			}
+			Base::transform(x + i, y + i, z + i, n - i, m, dx, dy, dz);
+		}
+
+		static inline void
+		dot(const float *ax, const float *ay, const float *az,
+			const float *bx, const float *by, const float *bz,
+			float *out, size_t n)
+		{
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)),
+						_mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i))),
+						_mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i))));
+			}
+			Base::dot(ax + i, ay + i, az + i, bx + i, by + i, bz + i, out + i, n - i);
+		}
+
+		static inline void
+		length(const float *x, const float *y, const float *z, float *out, size_t n)
+		{
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128 px = _mm_loadu_ps(x + i);
+				const __m128 py = _mm_loadu_ps(y + i);
+				const __m128 pz = _mm_loadu_ps(z + i);
+				_mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(px, px), _mm_mul_ps(py, py)), _mm_mul_ps(pz, pz))));
+			}
+			Base::length(x + i, y + i, z + i, out + i, n - i);
+		}
+
+		static inline void
+		normalize(float *x, float *y, float *z, size_t n)
+		{
+			const __m128 zero = _mm_setzero_ps();
+			size_t i = 0;
+			for (; i + 4 <= n; i += 4)
+			{
+				const __m128 px = _mm_loadu_ps(x + i);
+				const __m128 py = _mm_loadu_ps(y + i);
+				const __m128 pz = _mm_loadu_ps(z + i);
+				const __m128 l = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(px, px), _mm_mul_ps(py, py)), _mm_mul_ps(pz, pz)));
+				const __m128 mask = _mm_cmpgt_ps(l, zero);
+				_mm_storeu_ps(x + i, _mm_and_ps(mask, _mm_div_ps(px, l)));
+				_mm_storeu_ps(y + i, _mm_and_ps(mask, _mm_div_ps(py, l)));
+				_mm_storeu_ps(z + i, _mm_and_ps(mask, _mm_div_ps(pz, l)));
+			}
+			Base::normalize(x + i, y + i, z + i, n - i);
+		}
+	};
+}
@@ -37,6 +37,9 @@
 namespace xpcc
 {
 	// forward declaration
+	template <typename T>
+	class BoundingBox2D;
+	
 	template <typename T>
 	class Circle2D;
 	
@@ -80,8 +83,9 @@ namespace xpcc
 		/**
 		 * \brief	Check if a intersection exists
 		 * 
-		 * \todo	Currently a brute force approach is used here,
-		 * 			needs to be optimized
+		 * Polygons with disjoint bounding boxes are rejected early,
+		 * otherwise every edge is tested against every other edge.
+		 * Use xpcc::SpatialIndex2D to test against many polygons.
 		 */
 		bool
 		intersects(const Polygon2D& other) const;
@@ -123,6 +127,7 @@ namespace xpcc
 #include "circle_2d.hpp"
 #include "line_segment_2d.hpp"
 #include "ray_2d.hpp"
+#include "bounding_box_2d.hpp"
 
 #include "polygon_2d_impl.hpp"
 
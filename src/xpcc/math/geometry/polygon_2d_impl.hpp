@@ -73,6 +73,10 @@ template <typename T>
 bool
 xpcc::Polygon2D<T>::intersects(const Polygon2D& other) const
 {
+	if (!BoundingBox2D<T>(*this).intersects(BoundingBox2D<T>(other))) {
+		return false;
+	}
+	
 	SizeType n = this->points.getSize();
 	SizeType m = other.points.getSize();
 	
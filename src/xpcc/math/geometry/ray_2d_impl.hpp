@@ -168,13 +168,19 @@ xpcc::Ray2D<T>::intersects(const LineSegment2D<T>& line) const
 	Vector<T, 2> endToPoint = line.getEndPoint() - this->basePoint;
 	Vector<T, 2> dt = this->direction.toOrthogonalVector();
 	
-	if ((startToPoint.dot(dt) * endToPoint.dot(dt)) < 0) {
+	// the signs are compared instead of the sign of the product, which
+	// would overflow the WideType
+	WideType s1 = startToPoint.dot(dt);
+	WideType s2 = endToPoint.dot(dt);
+	if ((s1 < 0 && s2 > 0) || (s1 > 0 && s2 < 0)) {
 		// Points are on different sides of the ray (interpreted as
 		// continuous line)
 		
 		Vector<T, 2> pointToStart = this->basePoint - line.getStartPoint();
 		Vector<T, 2> lt = line.getDirectionVector().toOrthogonalVector();
-		if ((pointToStart.dot(lt) * this->direction.dot(lt)) < 0) {
+		WideType d1 = pointToStart.dot(lt);
+		WideType d2 = this->direction.dot(lt);
+		if ((d1 < 0 && d2 > 0) || (d1 > 0 && d2 < 0)) {
 			// Point and 
 			return true;
 		}
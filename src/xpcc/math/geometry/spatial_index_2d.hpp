@@ -0,0 +1,225 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SPATIAL_INDEX_2D_HPP
+#define XPCC__SPATIAL_INDEX_2D_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bounding_box_2d.hpp"
+#include "circle_2d.hpp"
+#include "line_segment_2d.hpp"
+#include "polygon_2d.hpp"
+#include "ray_2d.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Static bounding volume hierarchy over 2D shapes
+	 *
+	 * Holds references to up to CAPACITY polygons, circles and line
+	 * segments and answers intersection queries with line segments, rays
+	 * and circles without testing every shape. Intended for maps which
+	 * change rarely compared to the number of queries:
+	 *
+	 * \code
+	 * xpcc::SpatialIndex2D<int16_t, 64> index;
+	 *
+	 * // once per map update
+	 * index.clear();
+	 * for (const auto& obstacle : obstacles) {
+	 *     index.add(obstacle);
+	 * }
+	 * index.build();
+	 *
+	 * // every cycle
+	 * if (index.intersects(xpcc::LineSegment2D<int16_t>(position, target))) {
+	 *     ...
+	 * }
+	 * \endcode
+	 *
+	 * The shapes are not copied, they must not be changed or destroyed
+	 * while the index is in use. After a shape was changed build() must
+	 * be called again.
+	 *
+	 * All nodes are stored in a single array in depth-first order, so the
+	 * left child of a node is its direct successor. The hierarchy is
+	 * built by splitting the shapes at the median of their centers along
+	 * the longer axis, which limits the depth to log2(CAPACITY).
+	 *
+	 * The exact tests are the ones of the shapes themselves, so
+	 * `index.intersects(segment)` gives the same result as calling
+	 * `shape.intersects(segment)` for every shape. Note that polygons are
+	 * only tested against their edges, a query completely inside a
+	 * polygon does not intersect it.
+	 *
+	 * \tparam	T			type of the coordinates
+	 * \tparam	CAPACITY	maximum number of shapes, at most 65534
+	 *
+	 * \ingroup	geometry
+	 */
+	template <typename T, size_t CAPACITY>
+	class SpatialIndex2D
+	{
+	public:
+		typedef size_t SizeType;
+		typedef uint16_t IndexType;
+
+		/// Returned by add() if the index is full
+		static constexpr IndexType invalidIndex = 0xffff;
+
+		/// Maximum number of shapes in a leaf node
+		static constexpr IndexType leafSize = 4;
+
+		static_assert(CAPACITY < invalidIndex, "CAPACITY is too large!");
+
+	public:
+		SpatialIndex2D();
+
+		/// Remove all shapes
+		void
+		clear();
+
+		/**
+		 * \brief	Add a shape
+		 *
+		 * \return	Index of the shape, counted in the order the shapes
+		 * 			were added, or `invalidIndex` if the index is full.
+		 */
+		IndexType
+		add(const Polygon2D<T>& polygon);
+
+		IndexType
+		add(const Circle2D<T>& circle);
+
+		IndexType
+		add(const LineSegment2D<T>& segment);
+
+		/// Build the hierarchy, must be called after adding shapes
+		void
+		build();
+
+		inline SizeType
+		getNumberOfShapes() const;
+
+		/// Bounding box of all shapes, valid after build()
+		inline const BoundingBox2D<T>&
+		getBoundingBox() const;
+
+		/// Check if any shape intersects the segment
+		bool
+		intersects(const LineSegment2D<T>& segment) const;
+
+		bool
+		intersects(const Ray2D<T>& ray) const;
+
+		bool
+		intersects(const Circle2D<T>& circle) const;
+
+		/**
+		 * \brief	Find all shapes intersecting the segment
+		 *
+		 * Writes the indices of up to `maxCount` intersecting shapes to
+		 * `indices`, in no particular order.
+		 *
+		 * \return	Number of indices written
+		 */
+		SizeType
+		getIntersecting(const LineSegment2D<T>& segment,
+				IndexType *indices, SizeType maxCount) const;
+
+		SizeType
+		getIntersecting(const Ray2D<T>& ray,
+				IndexType *indices, SizeType maxCount) const;
+
+		SizeType
+		getIntersecting(const Circle2D<T>& circle,
+				IndexType *indices, SizeType maxCount) const;
+
+	protected:
+		enum class
+		ShapeType : uint8_t
+		{
+			Polygon,
+			Circle,
+			LineSegment,
+		};
+
+		struct Shape
+		{
+			BoundingBox2D<T> box;
+			const void *shape;
+			IndexType index;
+			ShapeType type;
+		};
+
+		/// Leaf nodes have `count > 0` and contain the shapes
+		/// [first, first + count), inner nodes have their left child
+		/// at the next position and the right child at `first`.
+		struct Node
+		{
+			BoundingBox2D<T> box;
+			IndexType first;
+			IndexType count;
+		};
+
+		IndexType
+		addShape(const BoundingBox2D<T>& box, const void *shape, ShapeType type);
+
+		IndexType
+		buildNode(IndexType first, IndexType count);
+
+		/// Coordinate of the center used to sort the shapes
+		static inline T
+		getKey(const Shape& shape, bool y);
+
+		template <typename Query>
+		SizeType
+		traverse(const Query& query, IndexType *indices, SizeType maxCount) const;
+
+		template <typename Query>
+		static bool
+		matches(const Shape& shape, const Query& query);
+
+		// exact tests
+		static bool
+		test(const Circle2D<T>& circle, const LineSegment2D<T>& segment);
+
+		static bool
+		test(const Circle2D<T>& circle, const Ray2D<T>& ray);
+
+		static bool
+		test(const Circle2D<T>& circle, const Circle2D<T>& other);
+
+		template <typename Query>
+		static bool
+		test(const Polygon2D<T>& polygon, const Query& query);
+
+		static bool
+		test(const LineSegment2D<T>& segment, const LineSegment2D<T>& other);
+
+		static bool
+		test(const LineSegment2D<T>& segment, const Ray2D<T>& ray);
+
+		static bool
+		test(const LineSegment2D<T>& segment, const Circle2D<T>& circle);
+
+	protected:
+		Shape shapes[CAPACITY];
+		Node nodes[2 * CAPACITY];
+
+		IndexType numberOfShapes;
+		IndexType numberOfNodes;
+	};
+}
+
+#include "spatial_index_2d_impl.hpp"
+
+#endif // XPCC__SPATIAL_INDEX_2D_HPP
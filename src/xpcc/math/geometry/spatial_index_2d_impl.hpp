@@ -0,0 +1,379 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__SPATIAL_INDEX_2D_HPP
+#	error	"Don't include this file directly, use 'spatial_index_2d.hpp' instead!"
+#endif
+
+template <typename T, size_t CAPACITY>
+constexpr typename xpcc::SpatialIndex2D<T, CAPACITY>::IndexType
+xpcc::SpatialIndex2D<T, CAPACITY>::invalidIndex;
+
+template <typename T, size_t CAPACITY>
+constexpr typename xpcc::SpatialIndex2D<T, CAPACITY>::IndexType
+xpcc::SpatialIndex2D<T, CAPACITY>::leafSize;
+
+// ----------------------------------------------------------------------------
+template <typename T, size_t CAPACITY>
+xpcc::SpatialIndex2D<T, CAPACITY>::SpatialIndex2D() :
+	numberOfShapes(0), numberOfNodes(0)
+{
+}
+
+template <typename T, size_t CAPACITY>
+void
+xpcc::SpatialIndex2D<T, CAPACITY>::clear()
+{
+	this->numberOfShapes = 0;
+	this->numberOfNodes = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::IndexType
+xpcc::SpatialIndex2D<T, CAPACITY>::add(const Polygon2D<T>& polygon)
+{
+	return addShape(BoundingBox2D<T>(polygon), &polygon, ShapeType::Polygon);
+}
+
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::IndexType
+xpcc::SpatialIndex2D<T, CAPACITY>::add(const Circle2D<T>& circle)
+{
+	return addShape(BoundingBox2D<T>(circle), &circle, ShapeType::Circle);
+}
+
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::IndexType
+xpcc::SpatialIndex2D<T, CAPACITY>::add(const LineSegment2D<T>& segment)
+{
+	return addShape(BoundingBox2D<T>(segment), &segment, ShapeType::LineSegment);
+}
+
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::IndexType
+xpcc::SpatialIndex2D<T, CAPACITY>::addShape(const BoundingBox2D<T>& box,
+		const void *shape, ShapeType type)
+{
+	if (this->numberOfShapes >= CAPACITY) {
+		return invalidIndex;
+	}
+
+	Shape& entry = this->shapes[this->numberOfShapes];
+	entry.box = box;
+	entry.shape = shape;
+	entry.index = this->numberOfShapes;
+	entry.type = type;
+
+	// the hierarchy is invalid until build() is called again
+	this->numberOfNodes = 0;
+	return this->numberOfShapes++;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, size_t CAPACITY>
+void
+xpcc::SpatialIndex2D<T, CAPACITY>::build()
+{
+	this->numberOfNodes = 0;
+	if (this->numberOfShapes > 0) {
+		buildNode(0, this->numberOfShapes);
+	}
+}
+
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::IndexType
+xpcc::SpatialIndex2D<T, CAPACITY>::buildNode(IndexType first, IndexType count)
+{
+	const IndexType index = this->numberOfNodes++;
+	Node& node = this->nodes[index];
+
+	node.box = BoundingBox2D<T>();
+	BoundingBox2D<T> centers;
+	for (IndexType i = first; i < first + count; ++i)
+	{
+		node.box.expand(this->shapes[i].box);
+		centers.expand(this->shapes[i].box.getCenter());
+	}
+
+	if (count <= leafSize)
+	{
+		node.first = first;
+		node.count = count;
+		return index;
+	}
+
+	// Split at the median of the centers along the longer axis. The
+	// shapes are partially sorted in place (quickselect), so that all
+	// shapes left of the median have a smaller or equal center.
+	const bool splitY = (centers.getMax().y - centers.getMin().y) >
+						(centers.getMax().x - centers.getMin().x);
+	const int_fast32_t middle = first + count / 2;
+
+	int_fast32_t low = first;
+	int_fast32_t high = first + count - 1;
+	while (low < high)
+	{
+		const T pivot = getKey(this->shapes[middle], splitY);
+		int_fast32_t i = low;
+		int_fast32_t k = high;
+		do {
+			while (getKey(this->shapes[i], splitY) < pivot) {
+				++i;
+			}
+			while (pivot < getKey(this->shapes[k], splitY)) {
+				--k;
+			}
+			if (i <= k)
+			{
+				const Shape tmp = this->shapes[i];
+				this->shapes[i] = this->shapes[k];
+				this->shapes[k] = tmp;
+				++i;
+				--k;
+			}
+		}
+		while (i <= k);
+
+		if (k < middle) {
+			low = i;
+		}
+		if (middle < i) {
+			high = k;
+		}
+	}
+
+	node.count = 0;
+	buildNode(first, middle - first);
+	node.first = buildNode(middle, first + count - middle);
+	return index;
+}
+
+template <typename T, size_t CAPACITY>
+T
+xpcc::SpatialIndex2D<T, CAPACITY>::getKey(const Shape& shape, bool y)
+{
+	const Vector<T, 2> center = shape.box.getCenter();
+	return y ? center.y : center.x;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::SizeType
+xpcc::SpatialIndex2D<T, CAPACITY>::getNumberOfShapes() const
+{
+	return this->numberOfShapes;
+}
+
+template <typename T, size_t CAPACITY>
+const xpcc::BoundingBox2D<T>&
+xpcc::SpatialIndex2D<T, CAPACITY>::getBoundingBox() const
+{
+	return this->nodes[0].box;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::intersects(const LineSegment2D<T>& segment) const
+{
+	return (traverse(segment, 0, 0) > 0);
+}
+
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::intersects(const Ray2D<T>& ray) const
+{
+	return (traverse(ray, 0, 0) > 0);
+}
+
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::intersects(const Circle2D<T>& circle) const
+{
+	return (traverse(circle, 0, 0) > 0);
+}
+
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::SizeType
+xpcc::SpatialIndex2D<T, CAPACITY>::getIntersecting(const LineSegment2D<T>& segment,
+		IndexType *indices, SizeType maxCount) const
+{
+	return traverse(segment, indices, maxCount);
+}
+
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::SizeType
+xpcc::SpatialIndex2D<T, CAPACITY>::getIntersecting(const Ray2D<T>& ray,
+		IndexType *indices, SizeType maxCount) const
+{
+	return traverse(ray, indices, maxCount);
+}
+
+template <typename T, size_t CAPACITY>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::SizeType
+xpcc::SpatialIndex2D<T, CAPACITY>::getIntersecting(const Circle2D<T>& circle,
+		IndexType *indices, SizeType maxCount) const
+{
+	return traverse(circle, indices, maxCount);
+}
+
+// ----------------------------------------------------------------------------
+/*
+ * Without an output array the traversal stops at the first intersecting
+ * shape and returns 1.
+ */
+template <typename T, size_t CAPACITY> template <typename Query>
+typename xpcc::SpatialIndex2D<T, CAPACITY>::SizeType
+xpcc::SpatialIndex2D<T, CAPACITY>::traverse(const Query& query,
+		IndexType *indices, SizeType maxCount) const
+{
+	if (this->numberOfNodes == 0 || (indices != 0 && maxCount == 0)) {
+		return 0;
+	}
+
+	// the depth is limited by the median split to log2(CAPACITY) < 16
+	IndexType stack[20];
+	uint_fast8_t stackSize = 0;
+	SizeType found = 0;
+
+	IndexType current = 0;
+	while (true)
+	{
+		const Node& node = this->nodes[current];
+		if (node.box.intersects(query))
+		{
+			if (node.count == 0)
+			{
+				// visit the left child next, remember the right one
+				stack[stackSize++] = node.first;
+				current++;
+				continue;
+			}
+
+			for (IndexType i = node.first; i < node.first + node.count; ++i)
+			{
+				const Shape& shape = this->shapes[i];
+				if (shape.box.intersects(query) && matches(shape, query))
+				{
+					if (indices == 0) {
+						return 1;
+					}
+					indices[found++] = shape.index;
+					if (found >= maxCount) {
+						return found;
+					}
+				}
+			}
+		}
+
+		if (stackSize == 0) {
+			return found;
+		}
+		current = stack[--stackSize];
+	}
+}
+
+template <typename T, size_t CAPACITY> template <typename Query>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::matches(const Shape& shape, const Query& query)
+{
+	switch (shape.type)
+	{
+		case ShapeType::Polygon:
+			return test(*static_cast<const Polygon2D<T> *>(shape.shape), query);
+		case ShapeType::Circle:
+			return test(*static_cast<const Circle2D<T> *>(shape.shape), query);
+		case ShapeType::LineSegment:
+			return test(*static_cast<const LineSegment2D<T> *>(shape.shape), query);
+	}
+	return false;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::test(const Circle2D<T>& circle,
+		const LineSegment2D<T>& segment)
+{
+	return (segment.getDistanceTo(circle.getCenter()) <= circle.getRadius());
+}
+
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::test(const Circle2D<T>& circle,
+		const Ray2D<T>& ray)
+{
+	typedef typename GeometricTraits<T>::FloatType FloatType;
+
+	const FloatType vx = FloatType(circle.getCenter().x) - FloatType(ray.getStartPoint().x);
+	const FloatType vy = FloatType(circle.getCenter().y) - FloatType(ray.getStartPoint().y);
+	const FloatType dx = ray.getDirectionVector().x;
+	const FloatType dy = ray.getDirectionVector().y;
+
+	// closest point on the ray, which starts at t = 0
+	const FloatType dd = dx * dx + dy * dy;
+	FloatType t = 0;
+	if (dd > 0) {
+		t = (vx * dx + vy * dy) / dd;
+		if (t < 0) {
+			t = 0;
+		}
+	}
+
+	const FloatType ex = vx - t * dx;
+	const FloatType ey = vy - t * dy;
+	const FloatType radius = circle.getRadius();
+	return (ex * ex + ey * ey <= radius * radius);
+}
+
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::test(const Circle2D<T>& circle,
+		const Circle2D<T>& other)
+{
+	typedef typename GeometricTraits<T>::FloatType FloatType;
+
+	const FloatType dx = FloatType(circle.getCenter().x) - FloatType(other.getCenter().x);
+	const FloatType dy = FloatType(circle.getCenter().y) - FloatType(other.getCenter().y);
+	const FloatType radius = FloatType(circle.getRadius()) + FloatType(other.getRadius());
+	return (dx * dx + dy * dy <= radius * radius);
+}
+
+template <typename T, size_t CAPACITY> template <typename Query>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::test(const Polygon2D<T>& polygon,
+		const Query& query)
+{
+	return polygon.intersects(query);
+}
+
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::test(const LineSegment2D<T>& segment,
+		const LineSegment2D<T>& other)
+{
+	return segment.intersects(other);
+}
+
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::test(const LineSegment2D<T>& segment,
+		const Ray2D<T>& ray)
+{
+	return ray.intersects(segment);
+}
+
+template <typename T, size_t CAPACITY>
+bool
+xpcc::SpatialIndex2D<T, CAPACITY>::test(const LineSegment2D<T>& segment,
+		const Circle2D<T>& circle)
+{
+	return test(circle, segment);
+}
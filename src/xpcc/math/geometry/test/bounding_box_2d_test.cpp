@@ -0,0 +1,139 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/bounding_box_2d.hpp>
+#include <xpcc/math/geometry/polygon_2d.hpp>
+
+#include "bounding_box_2d_test.hpp"
+
+typedef xpcc::BoundingBox2D<int16_t> Box;
+
+void
+BoundingBox2DTest::testConstruction()
+{
+	Box empty;
+	TEST_ASSERT_TRUE(empty.isEmpty());
+	TEST_ASSERT_FALSE(empty.contains(xpcc::Vector2i(0, 0)));
+
+	Box segment(xpcc::LineSegment2D<int16_t>(xpcc::Vector2i(10, -5), xpcc::Vector2i(-20, 30)));
+	TEST_ASSERT_FALSE(segment.isEmpty());
+	TEST_ASSERT_EQUALS(segment.getMin(), xpcc::Vector2i(-20, -5));
+	TEST_ASSERT_EQUALS(segment.getMax(), xpcc::Vector2i(10, 30));
+
+	Box circle(xpcc::Circle2D<int16_t>(xpcc::Vector2i(5, 7), 3));
+	TEST_ASSERT_EQUALS(circle.getMin(), xpcc::Vector2i(2, 4));
+	TEST_ASSERT_EQUALS(circle.getMax(), xpcc::Vector2i(8, 10));
+	TEST_ASSERT_EQUALS(circle.getCenter(), xpcc::Vector2i(5, 7));
+
+	xpcc::Polygon2D<int16_t> polygon = {
+		xpcc::Vector2i(0, 0), xpcc::Vector2i(50, -10), xpcc::Vector2i(20, 40)
+	};
+	Box box(polygon);
+	TEST_ASSERT_EQUALS(box.getMin(), xpcc::Vector2i(0, -10));
+	TEST_ASSERT_EQUALS(box.getMax(), xpcc::Vector2i(50, 40));
+}
+
+void
+BoundingBox2DTest::testExpand()
+{
+	Box box;
+	box.expand(xpcc::Vector2i(3, 4));
+	TEST_ASSERT_FALSE(box.isEmpty());
+	TEST_ASSERT_EQUALS(box.getMin(), xpcc::Vector2i(3, 4));
+	TEST_ASSERT_EQUALS(box.getMax(), xpcc::Vector2i(3, 4));
+
+	box.expand(xpcc::Vector2i(-1, 10));
+	TEST_ASSERT_EQUALS(box.getMin(), xpcc::Vector2i(-1, 4));
+	TEST_ASSERT_EQUALS(box.getMax(), xpcc::Vector2i(3, 10));
+
+	// empty boxes are ignored
+	box.expand(Box());
+	TEST_ASSERT_EQUALS(box.getMin(), xpcc::Vector2i(-1, 4));
+
+	box.expand(Box(xpcc::Vector2i(0, 0), xpcc::Vector2i(20, 5)));
+	TEST_ASSERT_EQUALS(box.getMin(), xpcc::Vector2i(-1, 0));
+	TEST_ASSERT_EQUALS(box.getMax(), xpcc::Vector2i(20, 10));
+
+	TEST_ASSERT_TRUE(box.contains(xpcc::Vector2i(20, 10)));
+	TEST_ASSERT_TRUE(box.contains(xpcc::Vector2i(0, 5)));
+	TEST_ASSERT_FALSE(box.contains(xpcc::Vector2i(21, 5)));
+}
+
+void
+BoundingBox2DTest::testBoxIntersection()
+{
+	Box a(xpcc::Vector2i(0, 0), xpcc::Vector2i(10, 10));
+
+	TEST_ASSERT_TRUE(a.intersects(Box(xpcc::Vector2i(5, 5), xpcc::Vector2i(20, 20))));
+	TEST_ASSERT_TRUE(a.intersects(Box(xpcc::Vector2i(10, -5), xpcc::Vector2i(20, 0))));
+	TEST_ASSERT_TRUE(a.intersects(Box(xpcc::Vector2i(2, 2), xpcc::Vector2i(3, 3))));
+	TEST_ASSERT_FALSE(a.intersects(Box(xpcc::Vector2i(11, 0), xpcc::Vector2i(20, 10))));
+	TEST_ASSERT_FALSE(a.intersects(Box(xpcc::Vector2i(0, -10), xpcc::Vector2i(10, -1))));
+	TEST_ASSERT_FALSE(a.intersects(Box()));
+}
+
+// ----------------------------------------------------------------------------
+void
+BoundingBox2DTest::testSegmentIntersection()
+{
+	Box box(xpcc::Vector2i(0, 0), xpcc::Vector2i(10, 10));
+	typedef xpcc::LineSegment2D<int16_t> Segment;
+
+	// crossing and inside
+	TEST_ASSERT_TRUE(box.intersects(Segment(xpcc::Vector2i(-5, 5), xpcc::Vector2i(15, 5))));
+	TEST_ASSERT_TRUE(box.intersects(Segment(xpcc::Vector2i(2, 2), xpcc::Vector2i(3, 8))));
+
+	// touching a corner
+	TEST_ASSERT_TRUE(box.intersects(Segment(xpcc::Vector2i(-5, 15), xpcc::Vector2i(5, 5))));
+	TEST_ASSERT_TRUE(box.intersects(Segment(xpcc::Vector2i(5, 15), xpcc::Vector2i(15, 5))));
+
+	// the boxes overlap, but the diagonal segment passes the corner
+	TEST_ASSERT_FALSE(box.intersects(Segment(xpcc::Vector2i(6, 15), xpcc::Vector2i(15, 6))));
+	TEST_ASSERT_FALSE(box.intersects(Segment(xpcc::Vector2i(-10, 5), xpcc::Vector2i(-5, 0))));
+
+	TEST_ASSERT_FALSE(box.intersects(Segment(xpcc::Vector2i(11, 0), xpcc::Vector2i(11, 10))));
+}
+
+void
+BoundingBox2DTest::testRayIntersection()
+{
+	Box box(xpcc::Vector2i(0, 0), xpcc::Vector2i(10, 10));
+	typedef xpcc::Ray2D<int16_t> Ray;
+
+	TEST_ASSERT_TRUE(box.intersects(Ray(xpcc::Vector2i(-50, 5), xpcc::Vector2i(1, 0))));
+	TEST_ASSERT_TRUE(box.intersects(Ray(xpcc::Vector2i(5, 5), xpcc::Vector2i(-3, 7))));
+	TEST_ASSERT_TRUE(box.intersects(Ray(xpcc::Vector2i(-10, -20), xpcc::Vector2i(1, 2))));
+
+	// pointing away
+	TEST_ASSERT_FALSE(box.intersects(Ray(xpcc::Vector2i(-50, 5), xpcc::Vector2i(-1, 0))));
+	TEST_ASSERT_FALSE(box.intersects(Ray(xpcc::Vector2i(20, 20), xpcc::Vector2i(1, 1))));
+
+	// parallel to one axis, outside of the slab
+	TEST_ASSERT_FALSE(box.intersects(Ray(xpcc::Vector2i(-50, 11), xpcc::Vector2i(1, 0))));
+	TEST_ASSERT_FALSE(box.intersects(Ray(xpcc::Vector2i(12, -5), xpcc::Vector2i(0, 1))));
+
+	// passing the corner
+	TEST_ASSERT_FALSE(box.intersects(Ray(xpcc::Vector2i(-20, 0), xpcc::Vector2i(1, 2))));
+}
+
+void
+BoundingBox2DTest::testCircleIntersection()
+{
+	Box box(xpcc::Vector2i(0, 0), xpcc::Vector2i(10, 10));
+	typedef xpcc::Circle2D<int16_t> Circle;
+
+	TEST_ASSERT_TRUE(box.intersects(Circle(xpcc::Vector2i(5, 5), 1)));
+	TEST_ASSERT_TRUE(box.intersects(Circle(xpcc::Vector2i(15, 5), 5)));
+	TEST_ASSERT_TRUE(box.intersects(Circle(xpcc::Vector2i(13, 14), 5)));
+
+	TEST_ASSERT_FALSE(box.intersects(Circle(xpcc::Vector2i(15, 5), 4)));
+
+	// inside the bounding box of the circle, but outside the circle
+	TEST_ASSERT_FALSE(box.intersects(Circle(xpcc::Vector2i(14, 14), 5)));
+}
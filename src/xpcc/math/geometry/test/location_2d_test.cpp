@@ -29,6 +29,7 @@
 // ----------------------------------------------------------------------------
 
 #include <xpcc/math/geometry/location_2d.hpp>
+#include <xpcc/math/fixed/fixed.hpp>
 
 #include "location_2d_test.hpp"
 
@@ -104,3 +105,23 @@ Location2DTest::testConvert()
 	TEST_ASSERT_EQUALS(b.getX(), -11);
 	TEST_ASSERT_EQUALS(b.getY(), 20);
 }
+
+void
+Location2DTest::testFixedPoint()
+{
+	typedef xpcc::q16_16 q;
+
+	xpcc::Location2D<q> a(q(10), q(20), M_PI_2);
+
+	a.move(q(5), 0);
+	TEST_ASSERT_EQUALS_DELTA(float(a.getX()), 10.f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(float(a.getY()), 25.f, 1e-4f);
+
+	a.move(xpcc::Vector<q, 2>(q(1), q(-2)));
+	TEST_ASSERT_EQUALS_DELTA(float(a.getX()), 12.f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(float(a.getY()), 26.f, 1e-4f);
+
+	xpcc::Location2D<float> b = a.convert<float>();
+	TEST_ASSERT_EQUALS_DELTA(b.getX(), 12.f, 1e-4f);
+	TEST_ASSERT_EQUALS_FLOAT(b.getOrientation(), float(M_PI_2));
+}
@@ -47,4 +47,7 @@ public:
 	
 	void
 	testConvert();
+
+	void
+	testFixedPoint();
 };
@@ -0,0 +1,117 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/point_buffer.hpp>
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "point_buffer_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+namespace
+{
+	// one scan of a lidar with 0.5 degree resolution
+	const size_t points = 720;
+	const uint32_t scans = 200;
+
+	typedef xpcc::PointBuffer2D<float, points> Scan;
+
+	void
+	fill(Scan& scan)
+	{
+		scan.removeAll();
+		for (size_t i = 0; i < points; ++i)
+		{
+			const float range = 500.f + (uint32_t(i * 2654435761UL) >> 20);
+			scan.append(xpcc::Vector2f(range, 0).rotate(i * float(M_PI) / 360));
+		}
+	}
+}
+
+void
+PointBufferBenchmarkTest::testTransform()
+{
+	Scan scan;
+	fill(scan);
+	xpcc::Vector2f single[points];
+	for (size_t i = 0; i < points; ++i) {
+		single[i] = scan[i];
+	}
+
+	// every scan is moved by the same small step
+	const xpcc::Location2D<float> step(xpcc::Vector2f(0.1f, -0.05f), 0.001f);
+
+	unittest::Stopwatch stopwatch;
+	for (uint32_t k = 0; k < scans; ++k) {
+		for (size_t i = 0; i < points; ++i) {
+			single[i] = step.translated(single[i]);
+		}
+	}
+	unittest::report("Location2D::translated()",
+			stopwatch.getTicks(), scans * points, "point");
+
+	stopwatch.restart();
+	for (uint32_t k = 0; k < scans; ++k) {
+		scan.transform(step);
+	}
+	unittest::report("PointBuffer2D::transform()",
+			stopwatch.getTicks(), scans * points, "point");
+
+	float difference = 0;
+	for (size_t i = 0; i < points; ++i) {
+		difference += (scan[i] - single[i]).getLength();
+	}
+	TEST_ASSERT_EQUALS_DELTA(difference / points, 0.f, 1e-2f);
+}
+
+void
+PointBufferBenchmarkTest::testLength()
+{
+	Scan scan;
+	fill(scan);
+
+	float reference = 0;
+	unittest::Stopwatch stopwatch;
+	for (uint32_t k = 0; k < scans; ++k) {
+		for (size_t i = 0; i < points; ++i) {
+			reference += scan[i].getLength();
+		}
+	}
+	unittest::report("Vector2f::getLength()",
+			stopwatch.getTicks(), scans * points, "point");
+
+	float batch = 0;
+	float length[points];
+	stopwatch.restart();
+	for (uint32_t k = 0; k < scans; ++k)
+	{
+		scan.getLength(length);
+		for (size_t i = 0; i < points; ++i) {
+			batch += length[i];
+		}
+	}
+	unittest::report("PointBuffer2D::getLength()",
+			stopwatch.getTicks(), scans * points, "point");
+
+	TEST_ASSERT_EQUALS_DELTA(batch / reference, 1.f, 1e-4f);
+}
+
+#else
+
+void
+PointBufferBenchmarkTest::testTransform()
+{
+}
+
+void
+PointBufferBenchmarkTest::testLength()
+{
+}
+
+#endif
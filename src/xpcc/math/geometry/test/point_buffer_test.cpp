@@ -0,0 +1,238 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/point_buffer.hpp>
+
+#include "point_buffer_test.hpp"
+
+// 11 points, so both the vector loops and the scalar remainder are used
+static const int16_t coordinates[11][2] =
+{
+	{ 10,   0}, {  0, -20}, {-35,  12}, { 100, 100}, { 7, -3},
+	{  0,   0}, {-50, -60}, { 23,  45}, {-12,  90}, {64, 64},
+	{  1,  -1},
+};
+
+template<typename T, size_t N>
+static void
+fill(xpcc::PointBuffer2D<T, N>& buffer)
+{
+	buffer.removeAll();
+	for (const int16_t *point : coordinates) {
+		buffer.append(xpcc::Vector<T, 2>(point[0], point[1]));
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+PointBufferTest::testAppendAndAccess()
+{
+	xpcc::PointBuffer2D<int16_t, 3> buffer;
+	TEST_ASSERT_EQUALS(buffer.getSize(), 0U);
+	TEST_ASSERT_EQUALS(buffer.getCapacity(), 3U);
+
+	TEST_ASSERT_TRUE(buffer.append(xpcc::Vector2i(1, 2)));
+	TEST_ASSERT_TRUE(buffer.append(xpcc::Vector2i(3, 4)));
+	TEST_ASSERT_TRUE(buffer.append(xpcc::Vector2i(5, 6)));
+	TEST_ASSERT_TRUE(buffer.isFull());
+	TEST_ASSERT_FALSE(buffer.append(xpcc::Vector2i(7, 8)));
+
+	TEST_ASSERT_EQUALS(buffer.getSize(), 3U);
+	TEST_ASSERT_EQUALS(buffer[0], xpcc::Vector2i(1, 2));
+	TEST_ASSERT_EQUALS(buffer[2], xpcc::Vector2i(5, 6));
+	TEST_ASSERT_EQUALS(buffer.getX()[1], 3);
+	TEST_ASSERT_EQUALS(buffer.getY()[1], 4);
+
+	buffer.set(1, xpcc::Vector2i(-3, -4));
+	TEST_ASSERT_EQUALS(buffer[1], xpcc::Vector2i(-3, -4));
+
+	buffer.removeAll();
+	TEST_ASSERT_EQUALS(buffer.getSize(), 0U);
+}
+
+void
+PointBufferTest::testPointSetConversion()
+{
+	xpcc::PointSet2D<int16_t> set = {
+		xpcc::Vector2i(1, 2), xpcc::Vector2i(3, 4), xpcc::Vector2i(5, 6)
+	};
+
+	xpcc::PointBuffer2D<int16_t, 8> buffer(set);
+	TEST_ASSERT_EQUALS(buffer.getSize(), 3U);
+	TEST_ASSERT_EQUALS(buffer[2], xpcc::Vector2i(5, 6));
+
+	// only as many points as fit into the buffer are copied
+	xpcc::PointBuffer2D<int16_t, 2> small;
+	TEST_ASSERT_EQUALS(small.fromPointSet(set), 2U);
+	TEST_ASSERT_EQUALS(small[1], xpcc::Vector2i(3, 4));
+
+	buffer.translate(xpcc::Vector2i(10, 20));
+
+	xpcc::PointSet2D<int16_t> result(0);
+	buffer.toPointSet(result);
+	TEST_ASSERT_EQUALS(result.getNumberOfPoints(), 3U);
+	TEST_ASSERT_EQUALS(result[0], xpcc::Vector2i(11, 22));
+	TEST_ASSERT_EQUALS(result[2], xpcc::Vector2i(15, 26));
+}
+
+// ----------------------------------------------------------------------------
+void
+PointBufferTest::testTransform()
+{
+	const xpcc::Location2D<float> location(xpcc::Vector2f(12.5f, -7.f), 0.7f);
+
+	xpcc::PointBuffer2D<float, 16> buffer;
+	fill(buffer);
+	buffer.transform(location);
+
+	for (uint_fast8_t i = 0; i < 11; ++i)
+	{
+		xpcc::Vector2f expected = location.translated(
+				xpcc::Vector2f(coordinates[i][0], coordinates[i][1]));
+		TEST_ASSERT_EQUALS_DELTA(buffer[i].x, expected.x, 1e-4f);
+		TEST_ASSERT_EQUALS_DELTA(buffer[i].y, expected.y, 1e-4f);
+	}
+
+	fill(buffer);
+	buffer.rotate(-2.1f);
+	buffer.translate(xpcc::Vector2f(0.5f, 1.5f));
+	for (uint_fast8_t i = 0; i < 11; ++i)
+	{
+		xpcc::Vector2f expected(coordinates[i][0], coordinates[i][1]);
+		expected.rotate(-2.1f);
+		expected.translate(xpcc::Vector2f(0.5f, 1.5f));
+		TEST_ASSERT_EQUALS_DELTA(buffer[i].x, expected.x, 1e-4f);
+		TEST_ASSERT_EQUALS_DELTA(buffer[i].y, expected.y, 1e-4f);
+	}
+}
+
+void
+PointBufferTest::testTransformInteger()
+{
+	// integer results are rounded exactly like Location2D::translated()
+	const xpcc::Location2D<int16_t> location(xpcc::Vector2i(-300, 25), 2.3f);
+
+	xpcc::PointBuffer2D<int16_t, 16> buffer;
+	fill(buffer);
+	buffer.transform(location);
+
+	for (uint_fast8_t i = 0; i < 11; ++i)
+	{
+		xpcc::Vector2i expected = location.translated(
+				xpcc::Vector2i(coordinates[i][0], coordinates[i][1]));
+		TEST_ASSERT_EQUALS(buffer[i], expected);
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+PointBufferTest::testLengthAndNormalize()
+{
+	xpcc::PointBuffer2D<float, 16> buffer;
+	fill(buffer);
+
+	float length[11];
+	buffer.getLength(length);
+	for (uint_fast8_t i = 0; i < 11; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(length[i],
+				xpcc::Vector2f(coordinates[i][0], coordinates[i][1]).getLength(), 1e-4f);
+	}
+
+	buffer.normalize();
+	buffer.getLength(length);
+	for (uint_fast8_t i = 0; i < 11; ++i)
+	{
+		if (i == 5) {
+			// the zero point is not changed
+			TEST_ASSERT_EQUALS(buffer[i], xpcc::Vector2f(0, 0));
+		}
+		else {
+			TEST_ASSERT_EQUALS_DELTA(length[i], 1.f, 1e-6f);
+		}
+	}
+	TEST_ASSERT_EQUALS_DELTA(buffer[3].x, 0.70710678f, 1e-6f);
+	TEST_ASSERT_EQUALS_DELTA(buffer[3].y, 0.70710678f, 1e-6f);
+
+	xpcc::PointBuffer2D<int16_t, 16> integer;
+	fill(integer);
+	int16_t integerLength[11];
+	integer.getLength(integerLength);
+	for (uint_fast8_t i = 0; i < 11; ++i) {
+		TEST_ASSERT_EQUALS(integerLength[i],
+				xpcc::Vector2i(coordinates[i][0], coordinates[i][1]).getLength());
+	}
+}
+
+void
+PointBufferTest::testDot()
+{
+	xpcc::PointBuffer2D<float, 16> a;
+	fill(a);
+	xpcc::PointBuffer2D<float, 16> b;
+	fill(b);
+	b.rotate(0.4f);
+
+	float dot[11];
+	a.dot(b, dot);
+	for (uint_fast8_t i = 0; i < 11; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(dot[i], a[i] * b[i], 1e-3f);
+	}
+
+	// the result of the 16-bit version is calculated in 32 bits
+	xpcc::PointBuffer2D<int16_t, 16> c;
+	fill(c);
+	xpcc::PointBuffer2D<int16_t, 4> d;
+	d.append(xpcc::Vector2i(1000, 1000));
+	d.append(xpcc::Vector2i(-1000, 200));
+
+	int32_t integerDot[2];
+	c.dot(d, integerDot);
+	TEST_ASSERT_EQUALS(integerDot[0], 10000L);
+	TEST_ASSERT_EQUALS(integerDot[1], -4000L);
+}
+
+// ----------------------------------------------------------------------------
+void
+PointBufferTest::testPointBuffer3D()
+{
+	xpcc::PointBuffer3D<float, 8> buffer;
+	for (uint_fast8_t i = 0; i < 7; ++i) {
+		buffer.append(xpcc::Vector3f(i, 2 * i - 3, 5 - i));
+	}
+	TEST_ASSERT_EQUALS(buffer.getSize(), 7U);
+	TEST_ASSERT_TRUE(buffer[2] == xpcc::Vector3f(2, 1, 3));
+
+	// rotate by 90 degrees around z
+	const float r[9] = { 0, -1, 0,  1, 0, 0,  0, 0, 1 };
+	const xpcc::Matrix<float, 3, 3> rotation(r);
+
+	buffer.transform(rotation, xpcc::Vector3f(1, 2, 3));
+	for (uint_fast8_t i = 0; i < 7; ++i)
+	{
+		TEST_ASSERT_EQUALS_FLOAT(buffer[i].x, -(2.f * i - 3) + 1);
+		TEST_ASSERT_EQUALS_FLOAT(buffer[i].y, float(i) + 2);
+		TEST_ASSERT_EQUALS_FLOAT(buffer[i].z, (5.f - i) + 3);
+	}
+
+	buffer.translate(xpcc::Vector3f(-1, -2, -3));
+	float length[7];
+	buffer.getLength(length);
+	float dot[7];
+	buffer.dot(buffer, dot);
+	for (uint_fast8_t i = 0; i < 7; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(length[i], buffer[i].getLength(), 1e-5f);
+		TEST_ASSERT_EQUALS_DELTA(dot[i], length[i] * length[i], 1e-3f);
+	}
+
+	buffer.normalize();
+	buffer.getLength(length);
+	for (uint_fast8_t i = 0; i < 7; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(length[i], 1.f, 1e-6f);
+	}
+}
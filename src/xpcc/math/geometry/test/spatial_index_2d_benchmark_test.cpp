@@ -0,0 +1,142 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/spatial_index_2d.hpp>
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "spatial_index_2d_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+namespace
+{
+	typedef xpcc::Vector2i Point;
+	typedef xpcc::Polygon2D<int16_t> Polygon;
+
+	// 300 obstacles with six edges on a 3000 x 2000 field
+	const size_t obstacles = 300;
+	const uint32_t queries = 2000;
+
+	uint32_t state = 1;
+
+	int16_t
+	random(int16_t range)
+	{
+		state = state * 1103515245UL + 12345;
+		return (state >> 16) % range;
+	}
+
+	struct Map
+	{
+		Map()
+		{
+			state = 1;
+			for (size_t i = 0; i < obstacles; ++i)
+			{
+				const Point p(random(3000), random(2000));
+				polygons[i] = new Polygon(6);
+				*polygons[i] << p << (p + Point(20, -20)) << (p + Point(40, 0))
+						<< (p + Point(40, 30)) << (p + Point(20, 50)) << (p + Point(0, 30));
+				index.add(*polygons[i]);
+			}
+			index.build();
+		}
+
+		~Map()
+		{
+			for (size_t i = 0; i < obstacles; ++i) {
+				delete polygons[i];
+			}
+		}
+
+		Polygon *polygons[obstacles];
+		xpcc::SpatialIndex2D<int16_t, obstacles> index;
+	};
+}
+
+void
+SpatialIndex2DBenchmarkTest::testSegmentQueries()
+{
+	static Map map;
+
+	// short path segments as used by the obstacle avoidance
+	xpcc::LineSegment2D<int16_t> paths[queries];
+	for (uint32_t i = 0; i < queries; ++i)
+	{
+		const Point p(random(3000), random(2000));
+		paths[i] = xpcc::LineSegment2D<int16_t>(p, p + Point(random(400) - 200, random(400) - 200));
+	}
+
+	uint32_t bruteForce = 0;
+	unittest::Stopwatch stopwatch;
+	for (uint32_t i = 0; i < queries; ++i) {
+		for (size_t k = 0; k < obstacles; ++k) {
+			bruteForce += map.polygons[k]->intersects(paths[i]);
+		}
+	}
+	unittest::report("Polygon2D::intersects(LineSegment2D)",
+			stopwatch.getTicks(), queries, "query");
+
+	uint32_t indexed = 0;
+	uint16_t indices[obstacles];
+	stopwatch.restart();
+	for (uint32_t i = 0; i < queries; ++i) {
+		indexed += map.index.getIntersecting(paths[i], indices, obstacles);
+	}
+	unittest::report("SpatialIndex2D::getIntersecting(LineSegment2D)",
+			stopwatch.getTicks(), queries, "query");
+
+	TEST_ASSERT_EQUALS(indexed, bruteForce);
+}
+
+void
+SpatialIndex2DBenchmarkTest::testCircleQueries()
+{
+	static Map map;
+
+	xpcc::Circle2D<int16_t> robots[queries];
+	for (uint32_t i = 0; i < queries; ++i) {
+		robots[i] = xpcc::Circle2D<int16_t>(Point(random(3000), random(2000)), 150);
+	}
+
+	uint32_t bruteForce = 0;
+	unittest::Stopwatch stopwatch;
+	for (uint32_t i = 0; i < queries; ++i) {
+		for (size_t k = 0; k < obstacles; ++k) {
+			bruteForce += map.polygons[k]->intersects(robots[i]);
+		}
+	}
+	unittest::report("Polygon2D::intersects(Circle2D)",
+			stopwatch.getTicks(), queries, "query");
+
+	uint32_t indexed = 0;
+	uint16_t indices[obstacles];
+	stopwatch.restart();
+	for (uint32_t i = 0; i < queries; ++i) {
+		indexed += map.index.getIntersecting(robots[i], indices, obstacles);
+	}
+	unittest::report("SpatialIndex2D::getIntersecting(Circle2D)",
+			stopwatch.getTicks(), queries, "query");
+
+	TEST_ASSERT_EQUALS(indexed, bruteForce);
+}
+
+#else
+
+void
+SpatialIndex2DBenchmarkTest::testSegmentQueries()
+{
+}
+
+void
+SpatialIndex2DBenchmarkTest::testCircleQueries()
+{
+}
+
+#endif
@@ -0,0 +1,22 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Only runs on hosted targets, compares the brute force tests against
+/// all obstacles with the queries of xpcc::SpatialIndex2D.
+class SpatialIndex2DBenchmarkTest : public unittest::TestSuite
+{
+public:
+	void
+	testSegmentQueries();
+
+	void
+	testCircleQueries();
+};
@@ -0,0 +1,256 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/geometry/spatial_index_2d.hpp>
+
+#include "spatial_index_2d_test.hpp"
+
+typedef xpcc::Vector2i Point;
+typedef xpcc::LineSegment2D<int16_t> Segment;
+typedef xpcc::Circle2D<int16_t> Circle;
+typedef xpcc::Ray2D<int16_t> Ray;
+typedef xpcc::Polygon2D<int16_t> Polygon;
+
+namespace
+{
+	// deterministic pseudo random numbers in [0, range)
+	struct Random
+	{
+		uint32_t state = 12345;
+
+		int16_t
+		operator () (int16_t range)
+		{
+			state = state * 1103515245UL + 12345;
+			return (state >> 16) % range;
+		}
+	};
+
+	bool
+	contains(const uint16_t *indices, size_t count, uint16_t index)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			if (indices[i] == index) {
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+SpatialIndex2DTest::testEmpty()
+{
+	xpcc::SpatialIndex2D<int16_t, 8> index;
+	TEST_ASSERT_EQUALS(index.getNumberOfShapes(), 0U);
+
+	index.build();
+	TEST_ASSERT_FALSE(index.intersects(Segment(Point(0, 0), Point(100, 100))));
+	TEST_ASSERT_FALSE(index.intersects(Circle(Point(0, 0), 100)));
+
+	// shapes are not found before build() was called
+	Circle circle(Point(10, 10), 5);
+	TEST_ASSERT_EQUALS(index.add(circle), 0);
+	TEST_ASSERT_FALSE(index.intersects(Circle(Point(0, 0), 100)));
+
+	index.build();
+	TEST_ASSERT_TRUE(index.intersects(Circle(Point(0, 0), 100)));
+	TEST_ASSERT_EQUALS(index.getBoundingBox().getMin(), Point(5, 5));
+
+	index.clear();
+	index.build();
+	TEST_ASSERT_FALSE(index.intersects(Circle(Point(0, 0), 100)));
+}
+
+void
+SpatialIndex2DTest::testCapacity()
+{
+	typedef xpcc::SpatialIndex2D<int16_t, 2> Index;
+	Index index;
+
+	Segment a(Point(0, 0), Point(10, 0));
+	Segment b(Point(0, 5), Point(10, 5));
+	TEST_ASSERT_EQUALS(index.add(a), 0);
+	TEST_ASSERT_EQUALS(index.add(b), 1);
+	TEST_ASSERT_EQUALS(index.add(a), Index::invalidIndex);
+	TEST_ASSERT_EQUALS(index.getNumberOfShapes(), 2U);
+
+	index.build();
+	uint16_t indices[2];
+	TEST_ASSERT_EQUALS(index.getIntersecting(Segment(Point(5, -5), Point(5, 10)), indices, 2), 2U);
+
+	// the output is limited
+	TEST_ASSERT_EQUALS(index.getIntersecting(Segment(Point(5, -5), Point(5, 10)), indices, 1), 1U);
+	TEST_ASSERT_EQUALS(index.getIntersecting(Segment(Point(5, -5), Point(5, 10)), indices, 0), 0U);
+}
+
+// ----------------------------------------------------------------------------
+void
+SpatialIndex2DTest::testSegmentQuery()
+{
+	Polygon square = { Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10) };
+	Circle circle(Point(50, 50), 10);
+	Segment wall(Point(100, 0), Point(100, 200));
+
+	xpcc::SpatialIndex2D<int16_t, 4> index;
+	TEST_ASSERT_EQUALS(index.add(square), 0);
+	TEST_ASSERT_EQUALS(index.add(circle), 1);
+	TEST_ASSERT_EQUALS(index.add(wall), 2);
+	index.build();
+
+	uint16_t indices[3];
+	Segment path(Point(-10, 5), Point(120, 5));
+	TEST_ASSERT_TRUE(index.intersects(path));
+	TEST_ASSERT_EQUALS(index.getIntersecting(path, indices, 3), 2U);
+	TEST_ASSERT_TRUE(contains(indices, 2, 0));
+	TEST_ASSERT_TRUE(contains(indices, 2, 2));
+
+	path = Segment(Point(45, 30), Point(45, 90));
+	TEST_ASSERT_EQUALS(index.getIntersecting(path, indices, 3), 1U);
+	TEST_ASSERT_EQUALS(indices[0], 1);
+
+	// passes all bounding boxes except the one of the circle
+	path = Segment(Point(58, 42), Point(70, 30));
+	TEST_ASSERT_FALSE(index.intersects(path));
+
+	// inside the square, polygons are only tested against their edges
+	path = Segment(Point(2, 2), Point(8, 8));
+	TEST_ASSERT_FALSE(index.intersects(path));
+}
+
+void
+SpatialIndex2DTest::testRayQuery()
+{
+	Polygon square = { Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10) };
+	Circle circle(Point(50, 50), 10);
+	Segment wall(Point(100, 0), Point(100, 200));
+
+	xpcc::SpatialIndex2D<int16_t, 4> index;
+	index.add(square);
+	index.add(circle);
+	index.add(wall);
+	index.build();
+
+	uint16_t indices[3];
+	TEST_ASSERT_EQUALS(index.getIntersecting(Ray(Point(-20, -18), Point(1, 1)), indices, 3), 3U);
+
+	TEST_ASSERT_EQUALS(index.getIntersecting(Ray(Point(20, 5), Point(1, 0)), indices, 3), 1U);
+	TEST_ASSERT_EQUALS(indices[0], 2);
+
+	TEST_ASSERT_EQUALS(index.getIntersecting(Ray(Point(50, 0), Point(0, 1)), indices, 3), 1U);
+	TEST_ASSERT_EQUALS(indices[0], 1);
+
+	TEST_ASSERT_FALSE(index.intersects(Ray(Point(50, 0), Point(0, -1))));
+}
+
+void
+SpatialIndex2DTest::testCircleQuery()
+{
+	Polygon square = { Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10) };
+	Circle circle(Point(50, 50), 10);
+	Segment wall(Point(100, 0), Point(100, 200));
+
+	xpcc::SpatialIndex2D<int16_t, 4> index;
+	index.add(square);
+	index.add(circle);
+	index.add(wall);
+	index.build();
+
+	uint16_t indices[3];
+	TEST_ASSERT_EQUALS(index.getIntersecting(Circle(Point(80, 50), 20), indices, 3), 2U);
+	TEST_ASSERT_TRUE(contains(indices, 2, 1));
+	TEST_ASSERT_TRUE(contains(indices, 2, 2));
+
+	TEST_ASSERT_TRUE(index.intersects(Circle(Point(15, 5), 5)));
+	TEST_ASSERT_FALSE(index.intersects(Circle(Point(15, 5), 4)));
+	TEST_ASSERT_FALSE(index.intersects(Circle(Point(72, 72), 20)));
+}
+
+// ----------------------------------------------------------------------------
+/*
+ * Compares the index with the brute force tests of the shapes themselves
+ * for a larger number of randomly placed shapes.
+ */
+void
+SpatialIndex2DTest::testRandomShapes()
+{
+	Random random;
+
+	Polygon polygons[30] = {
+		Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4),
+		Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4),
+		Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4),
+		Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4),
+		Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4), Polygon(4),
+	};
+	Circle circles[30];
+	Segment segments[30];
+
+	xpcc::SpatialIndex2D<int16_t, 90> index;
+	for (uint_fast8_t i = 0; i < 30; ++i)
+	{
+		const Point p(random(1000), random(1000));
+		polygons[i] << p << (p + Point(random(50), random(10)))
+				<< (p + Point(random(50), 10 + random(50)))
+				<< (p + Point(-random(20), random(30)));
+		circles[i] = Circle(Point(random(1000), random(1000)), 1 + random(40));
+		segments[i] = Segment(Point(random(1000), random(1000)),
+				Point(random(1000), random(1000)));
+
+		TEST_ASSERT_EQUALS(index.add(polygons[i]), 3 * i);
+		TEST_ASSERT_EQUALS(index.add(circles[i]), 3 * i + 1);
+		TEST_ASSERT_EQUALS(index.add(segments[i]), 3 * i + 2);
+	}
+	index.build();
+
+	uint16_t indices[90];
+	for (uint_fast8_t k = 0; k < 100; ++k)
+	{
+		const Segment segment(Point(random(1000), random(1000)),
+				Point(random(1000), random(1000)));
+		const Circle circle(Point(random(1000), random(1000)), 1 + random(100));
+		const Ray ray(Point(random(1000), random(1000)),
+				Point(random(200) - 100, random(200) - 100));
+
+		size_t count = index.getIntersecting(segment, indices, 90);
+		size_t expected = 0;
+		for (uint_fast8_t i = 0; i < 30; ++i)
+		{
+			const bool p = polygons[i].intersects(segment);
+			const bool c = segment.getDistanceTo(circles[i].getCenter()) <= circles[i].getRadius();
+			const bool s = segments[i].intersects(segment);
+			TEST_ASSERT_EQUALS(contains(indices, count, 3 * i), p);
+			TEST_ASSERT_EQUALS(contains(indices, count, 3 * i + 1), c);
+			TEST_ASSERT_EQUALS(contains(indices, count, 3 * i + 2), s);
+			expected += p + c + s;
+		}
+		TEST_ASSERT_EQUALS(count, expected);
+		TEST_ASSERT_EQUALS(index.intersects(segment), (expected > 0));
+
+		count = index.getIntersecting(circle, indices, 90);
+		expected = 0;
+		for (uint_fast8_t i = 0; i < 30; ++i)
+		{
+			const bool p = polygons[i].intersects(circle);
+			const bool s = segments[i].getDistanceTo(circle.getCenter()) <= circle.getRadius();
+			TEST_ASSERT_EQUALS(contains(indices, count, 3 * i), p);
+			TEST_ASSERT_EQUALS(contains(indices, count, 3 * i + 2), s);
+			expected += p + s + contains(indices, count, 3 * i + 1);
+		}
+		TEST_ASSERT_EQUALS(count, expected);
+
+		count = index.getIntersecting(ray, indices, 90);
+		for (uint_fast8_t i = 0; i < 30; ++i)
+		{
+			TEST_ASSERT_EQUALS(contains(indices, count, 3 * i), polygons[i].intersects(ray));
+			TEST_ASSERT_EQUALS(contains(indices, count, 3 * i + 2), ray.intersects(segments[i]));
+		}
+	}
+}
@@ -29,6 +29,7 @@
 // ----------------------------------------------------------------------------
 
 #include <xpcc/math/geometry/vector.hpp>
+#include <xpcc/math/fixed/fixed.hpp>
 #include "vector2_test.hpp"
 
 void
@@ -432,3 +433,35 @@ Vector2Test::testCCW()
 	TEST_ASSERT_EQUALS(xpcc::Vector2i::ccw(b, c, a), -1);
 }
 
+
+void
+Vector2Test::testFixedPoint()
+{
+	typedef xpcc::Vector<xpcc::q16_16, 2> Vector2q;
+
+	Vector2q a(xpcc::q16_16(3), xpcc::q16_16(-4));
+	Vector2q b(xpcc::q16_16(0.5f), xpcc::q16_16(2));
+
+	TEST_ASSERT_EQUALS_FLOAT(float(a.getLength()), 5.f);
+	TEST_ASSERT_EQUALS_FLOAT(float(a.getLengthSquared()), 25.f);
+	TEST_ASSERT_EQUALS_FLOAT(float(a.dot(b)), -6.5f);
+	TEST_ASSERT_EQUALS_FLOAT(float(a.cross(b)), 8.f);
+
+	Vector2q c = a + b;
+	TEST_ASSERT_EQUALS_FLOAT(float(c.x), 3.5f);
+	TEST_ASSERT_EQUALS_FLOAT(float(c.y), -2.f);
+
+	c = a * 0.5f;
+	TEST_ASSERT_EQUALS_FLOAT(float(c.x), 1.5f);
+	TEST_ASSERT_EQUALS_FLOAT(float(c.y), -2.f);
+
+	c.rotate(M_PI_2);
+	TEST_ASSERT_EQUALS_DELTA(float(c.x), 2.f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(float(c.y), 1.5f, 1e-4f);
+
+	TEST_ASSERT_EQUALS_DELTA(b.getAngle(), std::atan2(2.f, 0.5f), 1e-5f);
+	TEST_ASSERT_EQUALS_FLOAT(float(a.normalized().getLength()), 1.f);
+
+	TEST_ASSERT_EQUALS(Vector2q::ccw(Vector2q(), a, b), 1);
+	TEST_ASSERT_TRUE(a == Vector2q(xpcc::q16_16(3), xpcc::q16_16(-4)));
+}
@@ -89,4 +89,7 @@ public:
 	
 	void
 	testCCW();
+
+	void
+	testFixedPoint();
 };
@@ -48,6 +48,10 @@ namespace xpcc
 }
 
 #include "interpolation/linear.hpp"
+#include "interpolation/uniform_linear.hpp"
 #include "interpolation/lagrange.hpp"
+#include "interpolation/barycentric.hpp"
+#include "interpolation/cubic_spline.hpp"
+#include "interpolation/pchip.hpp"
 
 #endif	// XPCC__INTERPOLATION_HPP
@@ -0,0 +1,108 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__BARYCENTRIC_HPP
+#define	XPCC_INTERPOLATION__BARYCENTRIC_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/container/pair.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Lagrange interpolation with precomputed barycentric weights
+		 * 
+		 * Delivers the same polynomial as xpcc::interpolation::Lagrange,
+		 * but the weights
+		 * \f$ w_j = 1 / \prod_{k \neq j} (x_j - x_k) \f$ are calculated
+		 * once in the constructor. Every call of interpolate() then needs
+		 * O(n) instead of O(n²) operations:
+		 * 
+		 * \f[
+		 * 	p(x) = \frac{\sum_j \frac{w_j}{x - x_j} y_j}{\sum_j \frac{w_j}{x - x_j}}
+		 * \f]
+		 * 
+		 * Example:
+		 * \code
+		 * typedef xpcc::Pair<float, float> Point;
+		 * 
+		 * Point points[3] = { { 1, 1 }, { 2, 4 }, { 3, 9 } };
+		 * 
+		 * xpcc::interpolation::Barycentric<Point, 3> value(points);
+		 * float output = value.interpolate(1.5f);
+		 * // output => 2.25;
+		 * \endcode
+		 * 
+		 * \see http://en.wikipedia.org/wiki/Lagrange_polynomial#Barycentric_form
+		 * 
+		 * \tparam	T	Any specialization of xpcc::Pair<> with a floating
+		 * 				point type as second template argument.
+		 * \tparam	N	Number of supporting points
+		 * \tparam	Accessor	Accessor class. Can be xpcc::accessor::Ram,
+		 * 						xpcc::accessor::Flash or any self defined
+		 * 						accessor class.
+		 * 						Default is xpcc::accessor::Ram.
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename T,
+				  std::size_t N,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+		class Barycentric
+		{
+		public:
+			typedef typename T::FirstType InputType;
+			typedef typename T::SecondType OutputType;
+			
+			static_assert(xpcc::ArithmeticTraits<OutputType>::isFloatingPoint, 
+					"Only floating point types are allowed as second type of xpcc::Pair");
+			static_assert(N >= 1, "At least one supporting point is needed!");
+			
+		public:
+			/**
+			 * \brief	Constructor
+			 * 
+			 * \param	supportingPoints	Array of \p N xpcc::Pair<> with
+			 * 								distinct input values. Must stay
+			 * 								valid as long as this object.
+			 */
+			Barycentric(Accessor<T> supportingPoints);
+			
+			/**
+			 * \brief	Perform a Lagrange-interpolation
+			 * 
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType 
+			interpolate(const InputType& value) const;
+			
+			/// Barycentric weight of the supporting point
+			inline OutputType
+			getWeight(std::size_t index) const
+			{
+				return this->weights[index];
+			}
+			
+		private:
+			const Accessor<T> supportingPoints;
+			OutputType weights[N];
+		};
+	}
+}
+
+#include "barycentric_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__BARYCENTRIC_HPP
@@ -0,0 +1,64 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__BARYCENTRIC_HPP
+	#error	"Don't include this file directly. Use 'xpcc/math/interpolation/barycentric.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  std::size_t N,
+		  template <typename> class Accessor>
+xpcc::interpolation::Barycentric<T, N, Accessor>::Barycentric(
+		Accessor<T> supportingPoints) :
+	supportingPoints(supportingPoints)
+{
+	for (std::size_t j = 0; j < N; ++j)
+	{
+		const OutputType xj = static_cast<OutputType>(T(supportingPoints[j]).getFirst());
+		
+		OutputType product = 1;
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			if (k != j) {
+				product *= xj - static_cast<OutputType>(T(supportingPoints[k]).getFirst());
+			}
+		}
+		this->weights[j] = 1 / product;
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename T,
+		  std::size_t N,
+		  template <typename> class Accessor>
+typename xpcc::interpolation::Barycentric<T, N, Accessor>::OutputType
+xpcc::interpolation::Barycentric<T, N, Accessor>::interpolate(const InputType& value) const
+{
+	const OutputType x = static_cast<OutputType>(value);
+	
+	OutputType numerator = 0;
+	OutputType denominator = 0;
+	for (std::size_t j = 0; j < N; ++j)
+	{
+		const T point(this->supportingPoints[j]);
+		const OutputType difference = x - static_cast<OutputType>(point.getFirst());
+		
+		// the formula is undefined at the supporting points themselves
+		if (difference == 0) {
+			return point.getSecond();
+		}
+		
+		const OutputType term = this->weights[j] / difference;
+		numerator += term * point.getSecond();
+		denominator += term;
+	}
+	
+	return numerator / denominator;
+}
@@ -0,0 +1,102 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__CUBIC_SPLINE_HPP
+#define	XPCC_INTERPOLATION__CUBIC_SPLINE_HPP
+
+#include "piecewise_cubic.hpp"
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Cubic spline interpolation
+		 * 
+		 * The curve and its first and second derivative are continuous.
+		 * The coefficients are calculated once in the constructor by
+		 * solving a tridiagonal system in O(n), the evaluation is
+		 * O(log n) (see xpcc::interpolation::PiecewiseCubic).
+		 * 
+		 * The spline may overshoot between the supporting points, use
+		 * xpcc::interpolation::Pchip if the curve must stay monotone.
+		 * 
+		 * Example:
+		 * \code
+		 * typedef xpcc::Pair<float, float> Point;
+		 * 
+		 * // position over time for a motion profile
+		 * Point points[5] =
+		 * {
+		 *     { 0.0f,   0.f },
+		 *     { 0.5f,  20.f },
+		 *     { 1.0f,  80.f },
+		 *     { 1.5f, 140.f },
+		 *     { 2.0f, 160.f }
+		 * };
+		 * 
+		 * // start and end at rest
+		 * xpcc::interpolation::CubicSpline<Point, 5> position(points, 0.f, 0.f);
+		 * 
+		 * float output = position.interpolate(0.8f);
+		 * \endcode
+		 * 
+		 * \see http://en.wikipedia.org/wiki/Spline_interpolation
+		 * 
+		 * \tparam	T			Any specialization of xpcc::Pair<> with a
+		 * 						floating point type as second template argument.
+		 * \tparam	N			Number of supporting points, 2..255
+		 * \tparam	Accessor	Accessor class, default is xpcc::accessor::Ram.
+		 * \tparam	Lookup		Search strategy, default is
+		 * 						xpcc::interpolation::lookup::Binary.
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename T,
+				  std::size_t N,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram,
+				  typename Lookup = lookup::Binary>
+		class CubicSpline : public PiecewiseCubic<T, N, Accessor, Lookup>
+		{
+		public:
+			typedef typename T::FirstType InputType;
+			typedef typename T::SecondType OutputType;
+			
+		public:
+			/**
+			 * \brief	Natural spline
+			 * 
+			 * The second derivative is zero at both ends.
+			 * 
+			 * \param	supportingPoints	Array of \p N xpcc::Pair<> sorted
+			 * 								by strictly increasing input values.
+			 */
+			CubicSpline(Accessor<T> supportingPoints);
+			
+			/**
+			 * \brief	Clamped spline
+			 * 
+			 * \param	supportingPoints	Array of \p N xpcc::Pair<> sorted
+			 * 								by strictly increasing input values.
+			 * \param	startSlope			First derivative at the first point
+			 * \param	endSlope			First derivative at the last point
+			 */
+			CubicSpline(Accessor<T> supportingPoints,
+					OutputType startSlope, OutputType endSlope);
+			
+		private:
+			void
+			solve(bool clamped, OutputType startSlope, OutputType endSlope);
+		};
+	}
+}
+
+#include "cubic_spline_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__CUBIC_SPLINE_HPP
@@ -0,0 +1,91 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__CUBIC_SPLINE_HPP
+	#error	"Don't include this file directly. Use 'xpcc/math/interpolation/cubic_spline.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+xpcc::interpolation::CubicSpline<T, N, Accessor, Lookup>::CubicSpline(
+		Accessor<T> supportingPoints) :
+	PiecewiseCubic<T, N, Accessor, Lookup>(supportingPoints)
+{
+	this->solve(false, 0, 0);
+}
+
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+xpcc::interpolation::CubicSpline<T, N, Accessor, Lookup>::CubicSpline(
+		Accessor<T> supportingPoints, OutputType startSlope, OutputType endSlope) :
+	PiecewiseCubic<T, N, Accessor, Lookup>(supportingPoints)
+{
+	this->solve(true, startSlope, endSlope);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+void
+xpcc::interpolation::CubicSpline<T, N, Accessor, Lookup>::solve(
+		bool clamped, OutputType startSlope, OutputType endSlope)
+{
+	// Solves the tridiagonal system for the slopes m[i] with the
+	// Thomas algorithm:
+	//   h[i] m[i-1] + 2 (h[i-1] + h[i]) m[i] + h[i-1] m[i+1] =
+	//       3 (h[i] s[i-1] + h[i-1] s[i])
+	// The natural end conditions are 2 m[0] + m[1] = 3 s[0] and
+	// m[n-2] + 2 m[n-1] = 3 s[n-2].
+	// c holds the modified upper diagonal, d the modified right side.
+	OutputType* upper = this->c;
+	OutputType* right = this->d;
+	
+	if (clamped) {
+		upper[0] = 0;
+		right[0] = startSlope;
+	}
+	else {
+		upper[0] = 0.5f;
+		right[0] = 1.5f * this->getSecant(0);
+	}
+	
+	OutputType previousStep = this->getStep(0);
+	OutputType previousSecant = this->getSecant(0);
+	for (std::size_t i = 1; i < N - 1; ++i)
+	{
+		const OutputType step = this->getStep(i);
+		const OutputType secant = this->getSecant(i);
+		
+		const OutputType lower = step;
+		const OutputType denominator = 2 * (previousStep + step) - lower * upper[i - 1];
+		
+		upper[i] = previousStep / denominator;
+		right[i] = (3 * (step * previousSecant + previousStep * secant) -
+				lower * right[i - 1]) / denominator;
+		
+		previousStep = step;
+		previousSecant = secant;
+	}
+	
+	if (clamped) {
+		right[N - 1] = endSlope;
+	}
+	else {
+		right[N - 1] = (3 * previousSecant - right[N - 2]) / (2 - upper[N - 2]);
+	}
+	
+	// back substitution
+	this->b[N - 1] = right[N - 1];
+	for (std::size_t i = N - 1; i > 0; --i) {
+		this->b[i - 1] = right[i - 1] - upper[i - 1] * this->b[i];
+	}
+	
+	this->computeCoefficients();
+}
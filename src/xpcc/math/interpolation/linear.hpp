@@ -37,6 +37,8 @@
 #include <xpcc/container/pair.hpp>
 #include <xpcc/architecture/driver/accessor.hpp>
 
+#include "lookup.hpp"
+
 namespace xpcc
 {
 	namespace interpolation
@@ -97,16 +99,31 @@ namespace xpcc
 		 * int16_t b = value.interpolate(a);
 		 * \endcode
 		 * 
+		 * The segment containing the input value is found by a linear
+		 * scan by default. For larger tables use a binary search or, for
+		 * slowly changing inputs, start at the segment of the last call:
+		 * \code
+		 * xpcc::interpolation::Linear<Point, xpcc::accessor::Flash,
+		 *         xpcc::interpolation::lookup::Binary> value(...);
+		 * \endcode
+		 * 
+		 * The input values of the supporting points must be strictly
+		 * increasing, this can be checked at compile time with
+		 * xpcc::interpolation::isStrictlyIncreasing().
+		 * 
 		 * \tparam	T			Any specialization of xpcc::Pair<>
 		 * \tparam	Accessor	Accessor class. Can be xpcc::accessor::Ram,
 		 * 						xpcc::accessor::Flash or any self defined
 		 * 						accessor class.
 		 * 						Default is xpcc::accessor::Ram.
+		 * \tparam	Lookup		Search strategy, see xpcc::interpolation::lookup.
+		 * 						Default is xpcc::interpolation::lookup::Sequential.
 		 * 
 		 * \ingroup	interpolation
 		 */
 		template <typename T,
-				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+				  template <typename> class Accessor = ::xpcc::accessor::Ram,
+				  typename Lookup = lookup::Sequential>
 		class Linear
 		{
 		public:
@@ -138,7 +155,31 @@ namespace xpcc
 		private:
 			const Accessor<T> supportingPoints;
 			const uint8_t numberOfPoints; 
+			
+			// may store the last segment
+			mutable Lookup lookup;
 		};
+		
+		/**
+		 * \brief	Check if the input values are strictly increasing
+		 * 
+		 * Evaluated at compile time for `constexpr` tables:
+		 * \code
+		 * constexpr Point points[] = { ... };
+		 * static_assert(xpcc::interpolation::isStrictlyIncreasing(points),
+		 *         "Supporting points must be sorted!");
+		 * \endcode
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename T, std::size_t N>
+		constexpr bool
+		isStrictlyIncreasing(const T (&points)[N], std::size_t index = 1)
+		{
+			return (index >= N) ? true :
+					((points[index - 1].first < points[index].first) &&
+					 isStrictlyIncreasing(points, index + 1));
+		}
 	}
 }
 
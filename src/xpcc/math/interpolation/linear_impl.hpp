@@ -34,8 +34,9 @@
 
 // ----------------------------------------------------------------------------
 template <typename T,
-		  template <typename> class Accessor>
-xpcc::interpolation::Linear<T, Accessor>::Linear(
+		  template <typename> class Accessor,
+		  typename Lookup>
+xpcc::interpolation::Linear<T, Accessor, Lookup>::Linear(
 		Accessor<T> supportingPoints, uint8_t numberOfPoints) :
 	supportingPoints(supportingPoints), numberOfPoints(numberOfPoints)
 {
@@ -43,9 +44,10 @@ xpcc::interpolation::Linear<T, Accessor>::Linear(
 	
 // ----------------------------------------------------------------------------
 template <typename T,
-		  template <typename> class Accessor>
-typename xpcc::interpolation::Linear<T, Accessor>::OutputType
-xpcc::interpolation::Linear<T, Accessor>::interpolate(const InputType& value) const
+		  template <typename> class Accessor,
+		  typename Lookup>
+typename xpcc::interpolation::Linear<T, Accessor, Lookup>::OutputType
+xpcc::interpolation::Linear<T, Accessor, Lookup>::interpolate(const InputType& value) const
 {
 	T current(this->supportingPoints[0]);
 	
@@ -53,30 +55,27 @@ xpcc::interpolation::Linear<T, Accessor>::interpolate(const InputType& value) co
 		return current.getSecond();
 	}
 	
-	T last(current);
-	uint8_t i;
-	for (i = 1; i < this->numberOfPoints; ++i)
-	{
-		current = this->supportingPoints[i];
-		
-		if (value <= current.getFirst())
-		{
-			InputType x1_in = last.getFirst();
-			InputType x2_in = current.getFirst();
-			
-			OutputType x1_out = last.getSecond();
-			OutputType x2_out = current.getSecond();
-			
-			InputType a = value - x1_in;		// >0
-			WideType b = static_cast<OutputSignedType>(x2_out) - 
-						 static_cast<OutputSignedType>(x1_out);
-			InputType c = x2_in - x1_in;		// >0
-			
-			return static_cast<OutputType>(((a * b) / c) + x1_out);
-		}
-		
-		last = current;
+	current = this->supportingPoints[this->numberOfPoints - 1];
+	if (value >= current.getFirst()) {
+		return current.getSecond();
 	}
 	
-	return current.getSecond();
+	uint8_t i = this->lookup.template find<T>(
+			this->supportingPoints, this->numberOfPoints, value);
+	
+	T last(this->supportingPoints[i - 1]);
+	current = this->supportingPoints[i];
+	
+	InputType x1_in = last.getFirst();
+	InputType x2_in = current.getFirst();
+	
+	OutputType x1_out = last.getSecond();
+	OutputType x2_out = current.getSecond();
+	
+	InputType a = value - x1_in;		// >0
+	WideType b = static_cast<OutputSignedType>(x2_out) - 
+				 static_cast<OutputSignedType>(x1_out);
+	InputType c = x2_in - x1_in;		// >0
+	
+	return static_cast<OutputType>(((a * b) / c) + x1_out);
 }
@@ -0,0 +1,128 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__LOOKUP_HPP
+#define	XPCC_INTERPOLATION__LOOKUP_HPP
+
+#include <stdint.h>
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Strategies to find the segment of a value
+		 *
+		 * All strategies return the index `i` of the first supporting
+		 * point with `value <= points[i].first`. They are only called
+		 * with `points[0].first < value <= points[n-1].first`, so the
+		 * result is always in the range [1, n-1].
+		 *
+		 * The supporting points must be sorted by strictly increasing
+		 * input values.
+		 *
+		 * \ingroup	interpolation
+		 */
+		namespace lookup
+		{
+			/**
+			 * \brief	Linear scan from the first supporting point
+			 *
+			 * O(n), fastest for very small tables.
+			 */
+			struct Sequential
+			{
+				template <typename T, typename Accessor>
+				inline uint8_t
+				find(const Accessor& points, uint8_t numberOfPoints,
+						const typename T::FirstType& value) const
+				{
+					uint8_t i = 1;
+					while (i < numberOfPoints - 1 && value > T(points[i]).first) {
+						++i;
+					}
+					return i;
+				}
+			};
+
+			/**
+			 * \brief	Binary search
+			 *
+			 * O(log n) reads from the accessor, at most 8 for 256 points.
+			 */
+			struct Binary
+			{
+				template <typename T, typename Accessor>
+				inline uint8_t
+				find(const Accessor& points, uint8_t numberOfPoints,
+						const typename T::FirstType& value) const
+				{
+					uint8_t low = 1;
+					uint8_t high = numberOfPoints - 1;
+					while (low < high)
+					{
+						const uint8_t middle = low + (high - low) / 2;
+						if (value <= T(points[middle]).first) {
+							high = middle;
+						}
+						else {
+							low = middle + 1;
+						}
+					}
+					return low;
+				}
+			};
+
+			/**
+			 * \brief	Starts at the segment found by the previous call
+			 *
+			 * For slowly changing signals the value is usually in the
+			 * same or a neighbouring segment, which makes the lookup O(1).
+			 * Larger jumps are handled by scanning from the last segment.
+			 *
+			 * Stores the last segment, so every interpolator needs its
+			 * own instance.
+			 */
+			class Hint
+			{
+			public:
+				Hint() :
+					segment(1)
+				{
+				}
+
+				template <typename T, typename Accessor>
+				inline uint8_t
+				find(const Accessor& points, uint8_t numberOfPoints,
+						const typename T::FirstType& value)
+				{
+					uint8_t i = this->segment;
+					if (i >= numberOfPoints) {
+						i = numberOfPoints - 1;
+					}
+
+					while (i < numberOfPoints - 1 && value > T(points[i]).first) {
+						++i;
+					}
+					while (i > 1 && value <= T(points[i - 1]).first) {
+						--i;
+					}
+
+					this->segment = i;
+					return i;
+				}
+
+			private:
+				uint8_t segment;
+			};
+		}
+	}
+}
+
+#endif	// XPCC_INTERPOLATION__LOOKUP_HPP
@@ -0,0 +1,80 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__PCHIP_HPP
+#define	XPCC_INTERPOLATION__PCHIP_HPP
+
+#include "piecewise_cubic.hpp"
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Monotone piecewise cubic Hermite interpolation (PCHIP)
+		 * 
+		 * The slopes are chosen with the method of Fritsch and Carlson,
+		 * so the curve never overshoots: between two supporting points it
+		 * stays within their output values and it is monotone wherever
+		 * the supporting points are. Only the first derivative is
+		 * continuous.
+		 * 
+		 * Well suited for calibration curves of sensors, where a
+		 * spline would introduce wiggles between the measured points.
+		 * 
+		 * \code
+		 * typedef xpcc::Pair<uint16_t, float> Point;
+		 * 
+		 * // ADC value to distance in meter
+		 * Point points[4] = { { 300, 1.5f }, { 800, 0.4f }, { 1600, 0.15f }, { 3000, 0.1f } };
+		 * 
+		 * xpcc::interpolation::Pchip<Point, 4> distance(points);
+		 * float output = distance.interpolate(adc);
+		 * \endcode
+		 * 
+		 * \see	F. N. Fritsch and R. E. Carlson, "Monotone piecewise cubic
+		 * 		interpolation", 1980
+		 * 
+		 * \tparam	T			Any specialization of xpcc::Pair<> with a
+		 * 						floating point type as second template argument.
+		 * \tparam	N			Number of supporting points, 2..255
+		 * \tparam	Accessor	Accessor class, default is xpcc::accessor::Ram.
+		 * \tparam	Lookup		Search strategy, default is
+		 * 						xpcc::interpolation::lookup::Binary.
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename T,
+				  std::size_t N,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram,
+				  typename Lookup = lookup::Binary>
+		class Pchip : public PiecewiseCubic<T, N, Accessor, Lookup>
+		{
+		public:
+			typedef typename T::FirstType InputType;
+			typedef typename T::SecondType OutputType;
+			
+		public:
+			/**
+			 * \param	supportingPoints	Array of \p N xpcc::Pair<> sorted
+			 * 								by strictly increasing input values.
+			 */
+			Pchip(Accessor<T> supportingPoints);
+			
+		private:
+			// three point estimate at the ends, limited to keep the shape
+			static OutputType
+			getEndSlope(OutputType h0, OutputType h1, OutputType s0, OutputType s1);
+		};
+	}
+}
+
+#include "pchip_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__PCHIP_HPP
@@ -0,0 +1,81 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__PCHIP_HPP
+	#error	"Don't include this file directly. Use 'xpcc/math/interpolation/pchip.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+xpcc::interpolation::Pchip<T, N, Accessor, Lookup>::Pchip(
+		Accessor<T> supportingPoints) :
+	PiecewiseCubic<T, N, Accessor, Lookup>(supportingPoints)
+{
+	if (N == 2)
+	{
+		this->b[0] = this->b[1] = this->getSecant(0);
+		this->computeCoefficients();
+		return;
+	}
+	
+	OutputType previousStep = this->getStep(0);
+	OutputType previousSecant = this->getSecant(0);
+	for (std::size_t i = 1; i < N - 1; ++i)
+	{
+		const OutputType step = this->getStep(i);
+		const OutputType secant = this->getSecant(i);
+		
+		if ((previousSecant > 0 && secant > 0) || (previousSecant < 0 && secant < 0))
+		{
+			// weighted harmonic mean
+			const OutputType w1 = 2 * step + previousStep;
+			const OutputType w2 = step + 2 * previousStep;
+			this->b[i] = (w1 + w2) / (w1 / previousSecant + w2 / secant);
+		}
+		else {
+			// local extremum
+			this->b[i] = 0;
+		}
+		
+		previousStep = step;
+		previousSecant = secant;
+	}
+	
+	this->b[0] = getEndSlope(this->getStep(0), this->getStep(1),
+			this->getSecant(0), this->getSecant(1));
+	this->b[N - 1] = getEndSlope(this->getStep(N - 2), this->getStep(N - 3),
+			this->getSecant(N - 2), this->getSecant(N - 3));
+	
+	this->computeCoefficients();
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+typename xpcc::interpolation::Pchip<T, N, Accessor, Lookup>::OutputType
+xpcc::interpolation::Pchip<T, N, Accessor, Lookup>::getEndSlope(
+		OutputType h0, OutputType h1, OutputType s0, OutputType s1)
+{
+	const OutputType slope = ((2 * h0 + h1) * s0 - h0 * s1) / (h0 + h1);
+	
+	const int8_t sign = (slope > 0) - (slope < 0);
+	const int8_t sign0 = (s0 > 0) - (s0 < 0);
+	const int8_t sign1 = (s1 > 0) - (s1 < 0);
+	
+	if (sign != sign0) {
+		return 0;
+	}
+	
+	const OutputType limit = 3 * s0;
+	if (sign0 != sign1 && ((sign0 > 0) ? (slope > limit) : (slope < limit))) {
+		return limit;
+	}
+	return slope;
+}
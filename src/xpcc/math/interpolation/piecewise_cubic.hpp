@@ -0,0 +1,112 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__PIECEWISE_CUBIC_HPP
+#define	XPCC_INTERPOLATION__PIECEWISE_CUBIC_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/container/pair.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+#include "lookup.hpp"
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Piecewise cubic polynomial through the supporting points
+		 * 
+		 * Common base of xpcc::interpolation::CubicSpline and
+		 * xpcc::interpolation::Pchip. The derived classes only calculate
+		 * the slopes at the supporting points, from which the coefficients
+		 * of the cubic Hermite polynomial of every segment are precomputed.
+		 * 
+		 * The evaluation finds the segment with a binary search by default
+		 * (see xpcc::interpolation::lookup) and evaluates the polynomial
+		 * with three multiplications and no division.
+		 * 
+		 * Outside of the supporting points the first or last output value
+		 * is returned, like xpcc::interpolation::Linear does.
+		 * 
+		 * \tparam	T			Any specialization of xpcc::Pair<> with a
+		 * 						floating point type as second template argument.
+		 * \tparam	N			Number of supporting points, 2..255
+		 * \tparam	Accessor	Accessor class, default is xpcc::accessor::Ram.
+		 * \tparam	Lookup		Search strategy, default is
+		 * 						xpcc::interpolation::lookup::Binary.
+		 * 
+		 * \ingroup	interpolation
+		 */
+		template <typename T,
+				  std::size_t N,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram,
+				  typename Lookup = lookup::Binary>
+		class PiecewiseCubic
+		{
+		public:
+			typedef typename T::FirstType InputType;
+			typedef typename T::SecondType OutputType;
+			
+			static_assert(xpcc::ArithmeticTraits<OutputType>::isFloatingPoint, 
+					"Only floating point types are allowed as second type of xpcc::Pair");
+			static_assert(N >= 2 && N <= 255, "Between 2 and 255 supporting points are supported!");
+			
+		public:
+			/**
+			 * \brief	Evaluate the polynomial of the segment containing \p value
+			 * 
+			 * \param 	value	input value
+			 * \return	interpolated value
+			 */
+			OutputType 
+			interpolate(const InputType& value) const;
+			
+			/// Slope of the curve at a supporting point
+			inline OutputType
+			getSlope(std::size_t index) const
+			{
+				return this->b[index];
+			}
+			
+		protected:
+			PiecewiseCubic(Accessor<T> supportingPoints);
+			
+			/// Distance to the next supporting point
+			OutputType
+			getStep(std::size_t index) const;
+			
+			/// Slope of the line to the next supporting point
+			OutputType
+			getSecant(std::size_t index) const;
+			
+			/// Calculates c and d from the slopes stored in b
+			void
+			computeCoefficients();
+			
+		protected:
+			const Accessor<T> supportingPoints;
+			mutable Lookup lookup;
+			
+			// y = y[i] + b[i] * t + c[i] * t^2 + d[i] * t^3 with t = x - x[i].
+			// The derived classes may use c and d as scratch space before
+			// computeCoefficients() is called.
+			OutputType b[N];
+			OutputType c[N];
+			OutputType d[N];
+		};
+	}
+}
+
+#include "piecewise_cubic_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__PIECEWISE_CUBIC_HPP
@@ -0,0 +1,85 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__PIECEWISE_CUBIC_HPP
+	#error	"Don't include this file directly. Use 'xpcc/math/interpolation/piecewise_cubic.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::PiecewiseCubic(
+		Accessor<T> supportingPoints) :
+	supportingPoints(supportingPoints)
+{
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+typename xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::OutputType
+xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::getStep(std::size_t index) const
+{
+	return static_cast<OutputType>(T(this->supportingPoints[index + 1]).getFirst()) -
+		   static_cast<OutputType>(T(this->supportingPoints[index]).getFirst());
+}
+
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+typename xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::OutputType
+xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::getSecant(std::size_t index) const
+{
+	return (T(this->supportingPoints[index + 1]).getSecond() -
+			T(this->supportingPoints[index]).getSecond()) / this->getStep(index);
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+void
+xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::computeCoefficients()
+{
+	// cubic Hermite polynomial in power form
+	for (std::size_t i = 0; i < N - 1; ++i)
+	{
+		const OutputType h = this->getStep(i);
+		const OutputType secant = this->getSecant(i);
+		
+		this->c[i] = (3 * secant - 2 * this->b[i] - this->b[i + 1]) / h;
+		this->d[i] = (this->b[i] + this->b[i + 1] - 2 * secant) / (h * h);
+	}
+	this->c[N - 1] = 0;
+	this->d[N - 1] = 0;
+}
+
+// ----------------------------------------------------------------------------
+template <typename T, std::size_t N,
+		  template <typename> class Accessor, typename Lookup>
+typename xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::OutputType
+xpcc::interpolation::PiecewiseCubic<T, N, Accessor, Lookup>::interpolate(const InputType& value) const
+{
+	T point(this->supportingPoints[0]);
+	if (value <= point.getFirst()) {
+		return point.getSecond();
+	}
+	
+	point = this->supportingPoints[N - 1];
+	if (value >= point.getFirst()) {
+		return point.getSecond();
+	}
+	
+	const uint8_t i = this->lookup.template find<T>(
+			this->supportingPoints, N, value) - 1;
+	
+	point = this->supportingPoints[i];
+	const OutputType t = static_cast<OutputType>(value) -
+						 static_cast<OutputType>(point.getFirst());
+	
+	return point.getSecond() + t * (this->b[i] + t * (this->c[i] + t * this->d[i]));
+}
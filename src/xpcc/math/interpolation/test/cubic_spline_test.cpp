@@ -0,0 +1,208 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/interpolation/cubic_spline.hpp>
+#include <xpcc/math/interpolation/pchip.hpp>
+
+#include "cubic_spline_test.hpp"
+
+typedef xpcc::Pair<float, float> Point;
+
+void
+CubicSplineTest::testNatural()
+{
+	Point points[3] =
+	{
+		{ 0, 0 },
+		{ 1, 1 },
+		{ 2, 0 }
+	};
+	
+	xpcc::interpolation::CubicSpline<Point, 3> spline(points);
+	
+	TEST_ASSERT_EQUALS_FLOAT(spline.getSlope(0),  1.5f);
+	TEST_ASSERT_EQUALS_FLOAT(spline.getSlope(1),  0.f);
+	TEST_ASSERT_EQUALS_FLOAT(spline.getSlope(2), -1.5f);
+	
+	TEST_ASSERT_EQUALS_FLOAT(spline.interpolate(0.f),  0.f);
+	TEST_ASSERT_EQUALS_FLOAT(spline.interpolate(0.5f), 0.6875f);
+	TEST_ASSERT_EQUALS_FLOAT(spline.interpolate(1.f),  1.f);
+	TEST_ASSERT_EQUALS_FLOAT(spline.interpolate(1.5f), 0.6875f);
+	TEST_ASSERT_EQUALS_FLOAT(spline.interpolate(2.f),  0.f);
+	
+	// clamped to the end points
+	TEST_ASSERT_EQUALS_FLOAT(spline.interpolate(-1.f), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(spline.interpolate(3.f),  0.f);
+}
+
+void
+CubicSplineTest::testClamped()
+{
+	// a clamped spline reproduces any cubic polynomial exactly
+	// y = x^3 - 2x, y' = 3x^2 - 2
+	Point points[5] =
+	{
+		{ -2.0f, -4.f },
+		{ -0.5f,  0.875f },
+		{  1.0f, -1.f },
+		{  1.5f,  0.375f },
+		{  3.0f, 21.f }
+	};
+	
+	xpcc::interpolation::CubicSpline<Point, 5> spline(points, 10.f, 25.f);
+	
+	for (float x = -2.f; x <= 3.f; x += 0.0625f) {
+		TEST_ASSERT_EQUALS_DELTA(spline.interpolate(x), x * x * x - 2 * x, 1e-4f);
+	}
+	TEST_ASSERT_EQUALS_DELTA(spline.getSlope(2), 1.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(spline.getSlope(3), 4.75f, 1e-5f);
+	
+	// two points with both slopes zero, e.g. a smooth start and stop
+	Point move[2] = { { 0, 0 }, { 2, 100 } };
+	xpcc::interpolation::CubicSpline<Point, 2> profile(move, 0.f, 0.f);
+	
+	TEST_ASSERT_EQUALS_FLOAT(profile.interpolate(1.f), 50.f);
+	TEST_ASSERT_EQUALS_FLOAT(profile.interpolate(0.5f), 15.625f);
+	TEST_ASSERT_EQUALS_FLOAT(profile.interpolate(1.5f), 84.375f);
+}
+
+void
+CubicSplineTest::testStraightLine()
+{
+	Point points[4] =
+	{
+		{ 0, 1 },
+		{ 1, 3 },
+		{ 3, 7 },
+		{ 6, 13 }
+	};
+	
+	xpcc::interpolation::CubicSpline<Point, 4> natural(points);
+	xpcc::interpolation::Pchip<Point, 4> pchip(points);
+	
+	for (float x = 0.f; x <= 6.f; x += 0.25f)
+	{
+		TEST_ASSERT_EQUALS_DELTA(natural.interpolate(x), 2 * x + 1, 1e-4f);
+		TEST_ASSERT_EQUALS_DELTA(pchip.interpolate(x), 2 * x + 1, 1e-4f);
+	}
+}
+
+void
+CubicSplineTest::testLookup()
+{
+	Point points[8] =
+	{
+		{ 0.0f, 0.f },
+		{ 0.3f, 1.f },
+		{ 1.0f, 4.f },
+		{ 1.2f, 2.f },
+		{ 2.0f, 2.5f },
+		{ 3.5f, 0.f },
+		{ 4.0f, -1.f },
+		{ 5.0f, 1.f }
+	};
+	
+	xpcc::interpolation::CubicSpline<Point, 8> binary(points);
+	xpcc::interpolation::CubicSpline<Point, 8, xpcc::accessor::Ram,
+			xpcc::interpolation::lookup::Sequential> sequential(points);
+	xpcc::interpolation::CubicSpline<Point, 8, xpcc::accessor::Ram,
+			xpcc::interpolation::lookup::Hint> hint(points);
+	
+	for (float x = -0.5f; x <= 5.5f; x += 0.05f)
+	{
+		TEST_ASSERT_EQUALS_FLOAT(sequential.interpolate(x), binary.interpolate(x));
+		TEST_ASSERT_EQUALS_FLOAT(hint.interpolate(x), binary.interpolate(x));
+	}
+	for (uint_fast8_t i = 0; i < 8; ++i) {
+		TEST_ASSERT_EQUALS_FLOAT(binary.interpolate(points[i].first), points[i].second);
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+CubicSplineTest::testPchip()
+{
+	// a step, where the natural spline over- and undershoots
+	Point points[6] =
+	{
+		{ 0, 0 },
+		{ 1, 0 },
+		{ 2, 0.1f },
+		{ 3, 1 },
+		{ 4, 1 },
+		{ 5, 1 }
+	};
+	
+	xpcc::interpolation::CubicSpline<Point, 6> spline(points);
+	xpcc::interpolation::Pchip<Point, 6> pchip(points);
+	
+	float minimum = 0;
+	float maximum = 1;
+	float last = 0;
+	for (float x = 0.f; x <= 5.f; x += 0.03125f)
+	{
+		const float y = pchip.interpolate(x);
+		TEST_ASSERT_TRUE(y >= last);
+		TEST_ASSERT_TRUE(y >= 0.f && y <= 1.f);
+		last = y;
+		
+		const float s = spline.interpolate(x);
+		minimum = (s < minimum) ? s : minimum;
+		maximum = (s > maximum) ? s : maximum;
+	}
+	TEST_ASSERT_TRUE(minimum < 0.f);
+	TEST_ASSERT_TRUE(maximum > 1.f);
+	
+	// flat segments stay flat
+	TEST_ASSERT_EQUALS_FLOAT(pchip.interpolate(0.5f), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(pchip.interpolate(3.5f), 1.f);
+	TEST_ASSERT_EQUALS_FLOAT(pchip.getSlope(3), 0.f);
+	
+	for (uint_fast8_t i = 0; i < 6; ++i) {
+		TEST_ASSERT_EQUALS_FLOAT(pchip.interpolate(points[i].first), points[i].second);
+	}
+	
+	// local extremum
+	Point peak[3] = { { 0, 0 }, { 1, 2 }, { 3, 0 } };
+	xpcc::interpolation::Pchip<Point, 3> peakPchip(peak);
+	TEST_ASSERT_EQUALS_FLOAT(peakPchip.getSlope(1), 0.f);
+	for (float x = 0.f; x <= 3.f; x += 0.125f) {
+		TEST_ASSERT_TRUE(peakPchip.interpolate(x) <= 2.f);
+	}
+}
+
+typedef xpcc::Pair<uint16_t, float> SensorPoint;
+
+FLASH_STORAGE(SensorPoint sensorPoints[5]) =
+{
+	{  300, 1.50f },
+	{  800, 0.40f },
+	{ 1600, 0.15f },
+	{ 2400, 0.12f },
+	{ 3000, 0.10f }
+};
+
+void
+CubicSplineTest::testPchipFlash()
+{
+	xpcc::interpolation::Pchip<SensorPoint, 5, xpcc::accessor::Flash>
+			distance(xpcc::accessor::asFlash(sensorPoints));
+	
+	TEST_ASSERT_EQUALS_FLOAT(distance.interpolate(0), 1.5f);
+	TEST_ASSERT_EQUALS_FLOAT(distance.interpolate(800), 0.4f);
+	TEST_ASSERT_EQUALS_FLOAT(distance.interpolate(4095), 0.1f);
+	
+	float last = 2.f;
+	for (uint16_t adc = 300; adc <= 3000; adc += 10)
+	{
+		const float y = distance.interpolate(adc);
+		TEST_ASSERT_TRUE(y <= last);
+		last = y;
+	}
+}
@@ -29,6 +29,7 @@
 // ----------------------------------------------------------------------------
 
 #include <xpcc/math/interpolation/lagrange.hpp>
+#include <xpcc/math/interpolation/barycentric.hpp>
 
 #include "lagrange_interpolation_test.hpp"
 
@@ -71,3 +72,74 @@ LagrangeInterpolationTest::testInterpolation()
 }
 
 
+
+// ----------------------------------------------------------------------------
+void
+LagrangeInterpolationTest::testBarycentric()
+{
+	typedef xpcc::Pair<float, float> Point;
+	
+	Point points[3] =
+	{
+		{ 1, 1 },
+		{ 2, 4 },
+		{ 3, 9 }
+	};
+	
+	xpcc::interpolation::Barycentric<Point, 3> value(points);
+	
+	TEST_ASSERT_EQUALS_FLOAT(value.getWeight(0),  0.5f);
+	TEST_ASSERT_EQUALS_FLOAT(value.getWeight(1), -1.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.getWeight(2),  0.5f);
+	
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(1.f),   1.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(1.5f),  2.25f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(2.f),   4.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(2.5f),  6.25f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(3.f),   9.f);
+	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(3.5f), 12.25f);
+	
+	// same polynomial as the direct Lagrange form
+	Point curve[6] =
+	{
+		{ -2.0f, 1.f },
+		{ -0.5f, 3.f },
+		{  0.2f, 2.f },
+		{  1.0f, -1.f },
+		{  2.5f, 0.5f },
+		{  4.0f, 2.f }
+	};
+	
+	xpcc::interpolation::Lagrange<Point> lagrange(curve, 6);
+	xpcc::interpolation::Barycentric<Point, 6> barycentric(curve);
+	
+	for (float x = -2.5f; x <= 4.5f; x += 0.125f) {
+		TEST_ASSERT_EQUALS_DELTA(barycentric.interpolate(x), lagrange.interpolate(x), 1e-3f);
+	}
+}
+
+typedef xpcc::Pair<uint8_t, float> FlashPoint;
+
+FLASH_STORAGE(FlashPoint flashPoints[4]) =
+{
+	{  10, -50.f },
+	{  50,   0.f },
+	{ 100,  50.f },
+	{ 120,  20.f }
+};
+
+void
+LagrangeInterpolationTest::testBarycentricFlash()
+{
+	xpcc::interpolation::Lagrange<FlashPoint, xpcc::accessor::Flash>
+			lagrange(xpcc::accessor::asFlash(flashPoints), 4);
+	xpcc::interpolation::Barycentric<FlashPoint, 4, xpcc::accessor::Flash>
+			barycentric(xpcc::accessor::asFlash(flashPoints));
+	
+	TEST_ASSERT_EQUALS_FLOAT(barycentric.interpolate(50), 0.f);
+	TEST_ASSERT_EQUALS_FLOAT(barycentric.interpolate(120), 20.f);
+	
+	for (uint8_t x = 0; x < 130; ++x) {
+		TEST_ASSERT_EQUALS_DELTA(barycentric.interpolate(x), lagrange.interpolate(x), 1e-2f);
+	}
+}
@@ -37,6 +37,12 @@ struct LagrangeInterpolationTest : public unittest::TestSuite
 	
 	void
 	testInterpolation();
+	
+	void
+	testBarycentric();
+	
+	void
+	testBarycentricFlash();
 };
 
 
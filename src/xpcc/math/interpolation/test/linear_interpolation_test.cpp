@@ -29,6 +29,7 @@
 // ----------------------------------------------------------------------------
 
 #include <xpcc/math/interpolation/linear.hpp>
+#include <xpcc/math/interpolation/uniform_linear.hpp>
 
 #include "linear_interpolation_test.hpp"
 
@@ -91,3 +92,144 @@ LinearInterpolationTest::testInterpolationFlash()
 	TEST_ASSERT_EQUALS(value.interpolate(230), 20000);
 	TEST_ASSERT_EQUALS(value.interpolate(250), 20000);
 }
+
+// ----------------------------------------------------------------------------
+void
+LinearInterpolationTest::testBinarySearch()
+{
+	xpcc::interpolation::Linear<MyPair, xpcc::accessor::Flash> \
+		sequential(xpcc::accessor::asFlash(flashValues), 6);
+	xpcc::interpolation::Linear<MyPair, xpcc::accessor::Flash,
+			xpcc::interpolation::lookup::Binary> \
+		binary(xpcc::accessor::asFlash(flashValues), 6);
+	
+	for (uint16_t i = 0; i <= 255; ++i) {
+		TEST_ASSERT_EQUALS(binary.interpolate(i), sequential.interpolate(i));
+	}
+	
+	typedef xpcc::Pair<int16_t, uint16_t> Point;
+	Point points[2] =
+	{
+		{ -10, 50 },
+		{  50, 10 },
+	};
+	
+	xpcc::interpolation::Linear<Point, xpcc::accessor::Ram,
+			xpcc::interpolation::lookup::Binary> value(points, 2);
+	TEST_ASSERT_EQUALS(value.interpolate(-20), 50U);
+	TEST_ASSERT_EQUALS(value.interpolate( 20), 30U);
+	TEST_ASSERT_EQUALS(value.interpolate( 60), 10U);
+}
+
+void
+LinearInterpolationTest::testSegmentHint()
+{
+	xpcc::interpolation::Linear<MyPair, xpcc::accessor::Flash> \
+		sequential(xpcc::accessor::asFlash(flashValues), 6);
+	xpcc::interpolation::Linear<MyPair, xpcc::accessor::Flash,
+			xpcc::interpolation::lookup::Hint> \
+		hint(xpcc::accessor::asFlash(flashValues), 6);
+	
+	// slowly rising and falling
+	for (uint16_t i = 0; i <= 255; ++i) {
+		TEST_ASSERT_EQUALS(hint.interpolate(i), sequential.interpolate(i));
+	}
+	for (int16_t i = 255; i >= 0; --i) {
+		TEST_ASSERT_EQUALS(hint.interpolate(i), sequential.interpolate(i));
+	}
+	
+	// jumps over several segments
+	const uint8_t jumps[] = { 40, 210, 35, 100, 219, 91, 90, 150, 151, 30, 31 };
+	for (uint8_t value : jumps) {
+		TEST_ASSERT_EQUALS(hint.interpolate(value), sequential.interpolate(value));
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+LinearInterpolationTest::testUniform()
+{
+	typedef xpcc::Pair<int16_t, int16_t> Point;
+	
+	const int16_t values[5] = { 100, 300, 250, -50, -60 };
+	const Point points[5] =
+	{
+		{ -20, 100 },
+		{  10, 300 },
+		{  40, 250 },
+		{  70, -50 },
+		{ 100, -60 },
+	};
+	
+	// step 30 needs a division and is rounded like Linear
+	xpcc::interpolation::UniformLinear<int16_t, int16_t> uniform(-20, 30, values, 5);
+	xpcc::interpolation::Linear<Point> linear(points, 5);
+	
+	for (int16_t i = -50; i <= 130; ++i) {
+		TEST_ASSERT_EQUALS(uniform.interpolate(i), linear.interpolate(i));
+	}
+	
+	// step 32 uses a shift
+	const Point shiftedPoints[5] =
+	{
+		{ -20, 100 },
+		{  12, 300 },
+		{  44, 250 },
+		{  76, -50 },
+		{ 108, -60 },
+	};
+	xpcc::interpolation::UniformLinear<int16_t, int16_t> shifted(-20, 32, values, 5);
+	xpcc::interpolation::Linear<Point> shiftedLinear(shiftedPoints, 5);
+	
+	for (int16_t i = -50; i <= 130; ++i) {
+		TEST_ASSERT_EQUALS(shifted.interpolate(i), shiftedLinear.interpolate(i));
+	}
+	
+	// the full input range without overflow
+	xpcc::interpolation::UniformLinear<int16_t, int16_t> wide(-32768, 16384, values, 5);
+	TEST_ASSERT_EQUALS(wide.interpolate(-32768), 100);
+	TEST_ASSERT_EQUALS(wide.interpolate(-24576), 200);
+	TEST_ASSERT_EQUALS(wide.interpolate(16384), -50);
+	TEST_ASSERT_EQUALS(wide.interpolate(32767), -59);
+}
+
+namespace
+{
+	constexpr uint8_t pwm[9] = { 0, 2, 5, 11, 23, 45, 91, 180, 255 };
+	
+	constexpr auto pwmTable =
+			xpcc::interpolation::makeUniformTable<uint16_t>(0, 100, pwm);
+	
+	static_assert(pwmTable.slopes[0] == 1311, "Slope not rounded!");
+	static_assert(pwmTable.slopes[7] == 49152, "Wrong slope!");
+	static_assert(pwmTable.slopes[8] == 0, "The last slope must be zero!");
+	
+	constexpr xpcc::Pair<uint8_t, int16_t> sorted[3] = { { 1, 5 }, { 2, 3 }, { 10, 0 } };
+	constexpr xpcc::Pair<uint8_t, int16_t> unsorted[3] = { { 1, 5 }, { 2, 3 }, { 2, 0 } };
+	
+	static_assert(xpcc::interpolation::isStrictlyIncreasing(sorted), "");
+	static_assert(!xpcc::interpolation::isStrictlyIncreasing(unsorted), "");
+}
+
+void
+LinearInterpolationTest::testUniformTable()
+{
+	xpcc::interpolation::UniformLinear<uint16_t, uint8_t> value(pwmTable);
+	
+	TEST_ASSERT_EQUALS(value.interpolate(0), 0);
+	TEST_ASSERT_EQUALS(value.interpolate(50), 1);
+	TEST_ASSERT_EQUALS(value.interpolate(100), 2);
+	TEST_ASSERT_EQUALS(value.interpolate(750), 218);
+	TEST_ASSERT_EQUALS(value.interpolate(799), 254);
+	TEST_ASSERT_EQUALS(value.interpolate(800), 255);
+	TEST_ASSERT_EQUALS(value.interpolate(1000), 255);
+	
+	// slopes are rounded, so the error to the exact value is at most one
+	for (uint16_t i = 0; i <= 800; ++i)
+	{
+		const uint8_t y0 = pwm[i / 100];
+		const uint8_t y1 = pwm[(i / 100 < 8) ? (i / 100 + 1) : 8];
+		const float exact = y0 + (y1 - y0) * (i % 100) / 100.f;
+		TEST_ASSERT_EQUALS_DELTA(float(value.interpolate(i)), exact, 1.f);
+	}
+}
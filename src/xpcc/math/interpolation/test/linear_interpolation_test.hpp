@@ -37,5 +37,17 @@ struct LinearInterpolationTest : public unittest::TestSuite
 	
 	void
 	testInterpolationFlash();
+	
+	void
+	testBinarySearch();
+	
+	void
+	testSegmentHint();
+	
+	void
+	testUniform();
+	
+	void
+	testUniformTable();
 };
 
@@ -0,0 +1,189 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__UNIFORM_LINEAR_HPP
+#define	XPCC_INTERPOLATION__UNIFORM_LINEAR_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/utils/index_sequence.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+namespace xpcc
+{
+	namespace interpolation
+	{
+		/**
+		 * \brief	Table of equally spaced supporting points with slopes
+		 *
+		 * The slopes are stored as signed Q16.16 values in output units
+		 * per input unit, `slopes[i]` belongs to the segment between the
+		 * points `i` and `i + 1`.
+		 *
+		 * Use makeUniformTable() to create the table at compile time.
+		 *
+		 * \ingroup	interpolation
+		 */
+		template <typename InputType, typename OutputType, std::size_t N>
+		struct UniformTable
+		{
+			InputType start;
+			InputType step;
+			OutputType values[N];
+			int32_t slopes[N];
+		};
+
+		/// \cond
+		namespace detail
+		{
+			// rounded to the nearest value
+			template <typename InputType, typename OutputType>
+			constexpr int32_t
+			uniformSlope(OutputType y0, OutputType y1, InputType step)
+			{
+				return ((int64_t(y1) - int64_t(y0)) * 65536 +
+						(y1 >= y0 ? int64_t(step) / 2 : -(int64_t(step) / 2))) / int64_t(step);
+			}
+
+			template <typename InputType, typename OutputType, std::size_t N,
+					  std::size_t... Is>
+			constexpr UniformTable<InputType, OutputType, N>
+			makeUniformTable(InputType start, InputType step,
+					const OutputType (&values)[N], xpcc::tmp::IndexSequence<Is...>)
+			{
+				return UniformTable<InputType, OutputType, N> {
+					start, step,
+					{ values[Is]... },
+					{ (Is + 1 < N) ? uniformSlope(values[Is], values[Is + 1 < N ? Is + 1 : Is], step) : 0 ... }
+				};
+			}
+
+			// not constexpr, calling it at compile time is an error
+			void
+			invalidUniformTable();
+		}
+		/// \endcond
+
+		/**
+		 * \brief	Create a table of equally spaced supporting points
+		 *
+		 * \code
+		 * // NTC voltage (12-bit ADC) to temperature in 0.1 degree
+		 * constexpr int16_t temperatures[] = { 1500, 1210, 980, ..., -400 };
+		 * constexpr auto table = xpcc::interpolation::makeUniformTable<uint16_t>(
+		 *         0, 64, temperatures);
+		 *
+		 * xpcc::interpolation::UniformLinear<uint16_t, int16_t> ntc(table);
+		 * \endcode
+		 *
+		 * Fails to compile if evaluated at compile time with less than two
+		 * values, a step which is not positive, or if the last supporting
+		 * point does not fit into `InputType`.
+		 *
+		 * \ingroup	interpolation
+		 */
+		template <typename InputType, typename OutputType, std::size_t N>
+		constexpr UniformTable<InputType, OutputType, N>
+		makeUniformTable(InputType start, InputType step, const OutputType (&values)[N])
+		{
+			return (N >= 2 && step > 0 &&
+					(int64_t(start) + int64_t(step) * (N - 1)) <=
+							int64_t(ArithmeticTraits<InputType>::max)) ?
+					detail::makeUniformTable(start, step, values,
+							typename xpcc::tmp::MakeIndexSequence<N>::Type()) :
+					(detail::invalidUniformTable(),
+					 UniformTable<InputType, OutputType, N>());
+		}
+
+		/**
+		 * \brief	Linear interpolation between equally spaced points
+		 *
+		 * The segment is calculated directly from the input value instead
+		 * of being searched, which needs a single division or, if the step
+		 * is a power of two, a shift.
+		 *
+		 * If a slope table is given (see makeUniformTable()), the value
+		 * is interpolated with a multiplication instead of a division and
+		 * rounded to the nearest value. Otherwise the value is rounded
+		 * like xpcc::interpolation::Linear.
+		 *
+		 * Example with values and slopes read from flash:
+		 * \code
+		 * typedef xpcc::interpolation::UniformTable<uint16_t, int16_t, 65> Table;
+		 * FLASH_STORAGE(Table table) =
+		 *         xpcc::interpolation::makeUniformTable<uint16_t>(0, 64, temperatures);
+		 *
+		 * xpcc::interpolation::UniformLinear<uint16_t, int16_t, xpcc::accessor::Flash>
+		 *         ntc(0, 64, xpcc::accessor::asFlash(table.values),
+		 *             xpcc::accessor::asFlash(table.slopes), 65);
+		 * \endcode
+		 *
+		 * \tparam	InputType	Integer input type
+		 * \tparam	OutputType	Integer output type
+		 * \tparam	Accessor	Accessor class, default is xpcc::accessor::Ram.
+		 *
+		 * \ingroup	interpolation
+		 */
+		template <typename InputType,
+				  typename OutputType,
+				  template <typename> class Accessor = ::xpcc::accessor::Ram>
+		class UniformLinear
+		{
+		public:
+			typedef typename ArithmeticTraits< OutputType >::SignedType OutputSignedType;
+			typedef typename ArithmeticTraits< OutputSignedType >::WideType WideType;
+			typedef typename ArithmeticTraits< InputType >::UnsignedType InputUnsignedType;
+
+			static_assert(ArithmeticTraits<InputType>::isInteger,
+					"UniformLinear needs an integer input type!");
+
+		public:
+			/**
+			 * \param	start			input value of the first point
+			 * \param	step			distance between two points, >0
+			 * \param	values			output values of the points
+			 * \param	numberOfPoints	length of \p values
+			 */
+			UniformLinear(InputType start, InputType step,
+					Accessor<OutputType> values, uint8_t numberOfPoints);
+
+			/// With precomputed Q16.16 slopes, see UniformTable
+			UniformLinear(InputType start, InputType step,
+					Accessor<OutputType> values, Accessor<int32_t> slopes,
+					uint8_t numberOfPoints);
+
+			/// Uses the values and slopes of a table in RAM
+			template <std::size_t N>
+			UniformLinear(const UniformTable<InputType, OutputType, N>& table);
+
+			OutputType
+			interpolate(const InputType& value) const;
+
+		private:
+			static uint8_t
+			getShift(InputType step);
+
+			const InputType start;
+			const InputType step;
+			const Accessor<OutputType> values;
+			const Accessor<int32_t> slopes;
+			const uint8_t numberOfPoints;
+			const bool hasSlopes;
+
+			// log2(step) or 0xff if the step is no power of two
+			const uint8_t shift;
+		};
+	}
+}
+
+#include "uniform_linear_impl.hpp"
+
+#endif	// XPCC_INTERPOLATION__UNIFORM_LINEAR_HPP
@@ -0,0 +1,113 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_INTERPOLATION__UNIFORM_LINEAR_HPP
+	#error	"Don't include this file directly. Use 'xpcc/math/interpolation/uniform_linear.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+xpcc::interpolation::UniformLinear<InputType, OutputType, Accessor>::UniformLinear(
+		InputType start, InputType step,
+		Accessor<OutputType> values, uint8_t numberOfPoints) :
+	start(start), step(step), values(values), slopes(),
+	numberOfPoints(numberOfPoints), hasSlopes(false), shift(getShift(step))
+{
+}
+
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+xpcc::interpolation::UniformLinear<InputType, OutputType, Accessor>::UniformLinear(
+		InputType start, InputType step,
+		Accessor<OutputType> values, Accessor<int32_t> slopes,
+		uint8_t numberOfPoints) :
+	start(start), step(step), values(values), slopes(slopes),
+	numberOfPoints(numberOfPoints), hasSlopes(true), shift(getShift(step))
+{
+}
+
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+template <std::size_t N>
+xpcc::interpolation::UniformLinear<InputType, OutputType, Accessor>::UniformLinear(
+		const UniformTable<InputType, OutputType, N>& table) :
+	start(table.start), step(table.step),
+	values(Accessor<OutputType>(table.values)), slopes(Accessor<int32_t>(table.slopes)),
+	numberOfPoints(N), hasSlopes(true), shift(getShift(table.step))
+{
+	static_assert(N <= 255, "UniformLinear supports at most 255 points!");
+}
+
+// ----------------------------------------------------------------------------
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+uint8_t
+xpcc::interpolation::UniformLinear<InputType, OutputType, Accessor>::getShift(InputType step)
+{
+	InputUnsignedType s = step;
+	if (s == 0 || (s & (s - 1)) != 0) {
+		return 0xff;
+	}
+
+	uint8_t shift = 0;
+	while (s > 1) {
+		s >>= 1;
+		++shift;
+	}
+	return shift;
+}
+
+// ----------------------------------------------------------------------------
+template <typename InputType, typename OutputType,
+		  template <typename> class Accessor>
+OutputType
+xpcc::interpolation::UniformLinear<InputType, OutputType, Accessor>::interpolate(
+		const InputType& value) const
+{
+	if (value <= this->start) {
+		return this->values[0];
+	}
+
+	// exact in the unsigned type, as value > start
+	const InputUnsignedType offset = static_cast<InputUnsignedType>(
+			static_cast<InputUnsignedType>(value) -
+			static_cast<InputUnsignedType>(this->start));
+
+	InputUnsignedType index;
+	InputUnsignedType remainder;
+	if (this->shift != 0xff)
+	{
+		index = offset >> this->shift;
+		remainder = offset & static_cast<InputUnsignedType>(this->step - 1);
+	}
+	else
+	{
+		index = offset / static_cast<InputUnsignedType>(this->step);
+		remainder = offset - index * static_cast<InputUnsignedType>(this->step);
+	}
+
+	if (index >= static_cast<InputUnsignedType>(this->numberOfPoints - 1)) {
+		return this->values[this->numberOfPoints - 1];
+	}
+
+	const OutputType y0 = this->values[index];
+	if (this->hasSlopes)
+	{
+		const int64_t delta = int64_t(this->slopes[index]) * remainder;
+		return static_cast<OutputType>(y0 + ((delta + (1L << 15)) >> 16));
+	}
+
+	const OutputType y1 = this->values[index + 1];
+	WideType b = static_cast<OutputSignedType>(y1) -
+				 static_cast<OutputSignedType>(y0);
+
+	return static_cast<OutputType>(
+			((static_cast<WideType>(remainder) * b) / static_cast<WideType>(this->step)) + y0);
+}
@@ -33,6 +33,7 @@
 
 #include "matrix.hpp"
 #include "geometry/vector.hpp"
+#include "triangular_solver.hpp"
 
 namespace xpcc
 {
@@ -46,6 +47,13 @@ namespace xpcc
 	 * Factorise a matrix A into an L(ower) and U(pper) matrix such that
 	 * A = L*U or P*A = L*U where P is a pivot matrix (changes the row order).
 	 * 
+	 * decomposeInPlace() works on a single matrix without the recursive
+	 * row operations, so it needs the storage of only one matrix. Its
+	 * pivot indices are `uint8_t`, so it works for every matrix size.
+	 * For symmetric positive-definite systems use
+	 * xpcc::CholeskyDecomposition, for least-squares problems
+	 * xpcc::QRDecomposition.
+	 * 
 	 * Adapted from the implementation of Gaspard Petit (gaspardpetit@gmail.com).
 	 * 
 	 * \see <a href"http://www-etud.iro.umontreal.ca/~petitg/cpp/ludecomposition.html">Homepage</a>
@@ -74,6 +82,30 @@ namespace xpcc
 		solve(const Matrix<T, N, N> &l,
 				const Matrix<T, N, N> &u,
 				Matrix<T, BXWIDTH, N> *xb);
+
+		/**
+		 * In-place decomposition with partial pivoting (P*A = L*U).
+		 *
+		 * The strictly lower triangle of `lu` is overwritten with L (its
+		 * unit diagonal is implicit), the upper triangle with U.
+		 * Row `i` of the result corresponds to row `p[i]` of the input.
+		 *
+		 * \return	`false` if the matrix is singular
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decomposeInPlace(Matrix<T, N, N> &lu, Vector<uint8_t, N> *p);
+
+		/**
+		 * Solve A*X = B using the result of decomposeInPlace().
+		 *
+		 * \param[in,out]	bx	B on entry, X on return (one system per column)
+		 */
+		template <typename T, uint8_t N, uint8_t COLUMNS>
+		static bool
+		solve(const Matrix<T, N, N> &lu,
+				const Vector<uint8_t, N> &p,
+				Matrix<T, N, COLUMNS> *bx);
 		
 	private:
 		template<typename T, uint8_t OFFSET, uint8_t WIDTH, uint8_t HEIGHT>
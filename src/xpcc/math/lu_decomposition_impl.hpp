@@ -75,6 +75,76 @@ xpcc::LUDecomposition::solve(
 	return LUSubDecomposition<T, 0, SIZE, SIZE>::solve(l, u, xb);
 }
 
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE>
+bool
+xpcc::LUDecomposition::decomposeInPlace(
+		xpcc::Matrix<T, SIZE, SIZE> &lu,
+		xpcc::Vector<uint8_t, SIZE> *p)
+{
+	for (uint_fast8_t i = 0; i < SIZE; ++i)	{
+		(*p)[i] = i;
+	}
+
+	for (uint_fast8_t k = 0; k < SIZE; ++k)
+	{
+		// select the row with the largest magnitude in this column
+		uint_fast8_t pivot = k;
+		T max = (lu[k][k] < T(0)) ? -lu[k][k] : lu[k][k];
+		for (uint_fast8_t i = k + 1; i < SIZE; ++i)
+		{
+			const T v = (lu[i][k] < T(0)) ? -lu[i][k] : lu[i][k];
+			if (v > max) {
+				max = v;
+				pivot = i;
+			}
+		}
+		if (max == T(0)) {
+			return false;
+		}
+
+		if (pivot != k)
+		{
+			const uint8_t index = (*p)[k];
+			(*p)[k] = (*p)[pivot];
+			(*p)[pivot] = index;
+			RowOperation<T, SIZE>::swap(lu[k], lu[pivot]);
+		}
+
+		const T inverse = T(1) / lu[k][k];
+		for (uint_fast8_t i = k + 1; i < SIZE; ++i)
+		{
+			const T factor = lu[i][k] * inverse;
+			lu[i][k] = factor;
+			for (uint_fast8_t j = k + 1; j < SIZE; ++j) {
+				lu[i][j] -= factor * lu[k][j];
+			}
+		}
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t COLUMNS>
+bool
+xpcc::LUDecomposition::solve(
+		const xpcc::Matrix<T, SIZE, SIZE> &lu,
+		const xpcc::Vector<uint8_t, SIZE> &p,
+		xpcc::Matrix<T, SIZE, COLUMNS> *bx)
+{
+	const xpcc::Matrix<T, SIZE, COLUMNS> b(*bx);
+	for (uint_fast8_t i = 0; i < SIZE; ++i)
+	{
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			(*bx)[i][j] = b[p[i]][j];
+		}
+	}
+
+	TriangularSolver::solveLower(lu, bx, true);
+	return TriangularSolver::solveUpper(lu, bx);
+}
+
 //=============================================================================
 // PRIVATE CLASS xpcc::LUDecomposition::RowOperation
 //=============================================================================
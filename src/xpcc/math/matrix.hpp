@@ -41,9 +41,12 @@
 #include <string.h>		// for memset() and memcmp()
 #include <stdint.h>
 
+#include <xpcc/architecture/utils.hpp>
 #include <xpcc/io/iostream.hpp>
 #include <xpcc/utils/template_metaprogramming.hpp>
 
+#include "matrix_expression.hpp"
+
 namespace xpcc
 {
 	/**
@@ -65,6 +68,15 @@ namespace xpcc
 	 * Adapted from the implementation of Gaspard Petit (gaspardpetit@gmail.com).
 	 * \see <a href"http://www-etud.iro.umontreal.ca/~petitg/cpp/matrix.html">Homepage</a>
 	 * 
+	 * Element-wise operations are evaluated lazily with expression
+	 * templates (see xpcc::MatrixExpression), so chains like `A + B * 2`
+	 * create no temporary matrices.
+	 * Every element of a matrix product is a dot product, which is
+	 * unrolled at compile time and summed up as a tree, so the
+	 * multiplications do not wait for each other. multiply() and
+	 * multiplyTransposed() write directly into an existing matrix, the
+	 * latter computes `A * B^T` without transposing `B`.
+	 * 
 	 * \tparam	ROWS		Number of rows
 	 * \tparam	COLUMNS		Number of columns
 	 * 
@@ -73,8 +85,13 @@ namespace xpcc
 	 * \author	Fabian Greif
 	 */
 	template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-	class Matrix
+	class Matrix : public MatrixExpression< Matrix<T, ROWS, COLUMNS> >
 	{
+	public:
+		typedef T ElementType;
+		static constexpr uint8_t NumberOfRows = ROWS;
+		static constexpr uint8_t NumberOfColumns = COLUMNS;
+
 	public:
 		/**
 		 * \brief	Default Constructor
@@ -103,11 +120,20 @@ namespace xpcc
 		/// Copy constructor
 		Matrix(const Matrix &m);
 		
+		/// Evaluate an expression of element-wise operations
+		template<typename E>
+		Matrix(const MatrixExpression<E> &expression);
+		
 		// TODO replace with a explicit convert function
 		template<typename U>
 		Matrix&
 		operator = (const Matrix<U, ROWS, COLUMNS> &m);
 		
+		/// Evaluate an expression of element-wise operations
+		template<typename E>
+		Matrix&
+		operator = (const MatrixExpression<E> &expression);
+		
 		/**
 		 * \brief	Get a zero matrix
 		 * 
@@ -159,25 +185,23 @@ namespace xpcc
 		const T* ptr() const;
 		T* ptr();
 		
-		Matrix operator - ();
-		Matrix operator + (const Matrix &rhs) const;
-		Matrix operator - (const Matrix &rhs) const;
-		Matrix operator * (const T &rhs) const;		///< Scalar multiplication
-		Matrix operator / (const T &rhs) const;		///< Scalar division
-		
-		Matrix& operator += (const Matrix &rhs);
-		Matrix& operator -= (const Matrix &rhs);
+		/// Element at the linear (row-major) index, see xpcc::MatrixExpression
+		inline const T&
+		evaluate(uint_fast8_t index) const
+		{
+			return element[index];
+		}
+		
+		template<typename E>
+		Matrix& operator += (const MatrixExpression<E> &rhs);
+		template<typename E>
+		Matrix& operator -= (const MatrixExpression<E> &rhs);
 		Matrix& operator *= (const T &rhs);			///< Scalar multiplication
 		Matrix& operator /= (const T &rhs);			///< Scalar division
 		
 		/// Matrix multiplication with matrices with the same size
 		Matrix operator *= (const Matrix &rhs);
 		
-		/// Matrix multiplication with different size matrices
-		template<uint8_t RHSCOL>
-		Matrix<T, ROWS, ROWS>
-		operator * (const Matrix<T, COLUMNS, RHSCOL> &rhs) const;
-		
 		Matrix<T, COLUMNS, ROWS>
 		asTransposed() const;
 		
@@ -254,6 +278,48 @@ namespace xpcc
 	IOStream&
 	operator << (IOStream&, const Matrix<T, WIDTH, HEIGHT>&);
 	
+	/**
+	 * \brief	Matrix multiplication
+	 * 
+	 * Operands which are expressions are evaluated first.
+	 * 
+	 * \ingroup	matrix
+	 */
+	template<typename L, typename R>
+	Matrix<typename L::ElementType, L::NumberOfRows, R::NumberOfColumns>
+	operator * (const MatrixExpression<L> &lhs, const MatrixExpression<R> &rhs);
+	
+	/**
+	 * \brief	Calculate `result = lhs * rhs` without a temporary matrix
+	 * 
+	 * \warning	`result` must be a different matrix than `lhs` and `rhs`!
+	 * \ingroup	matrix
+	 */
+	template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+	void
+	multiply(Matrix<T, ROWS, COLUMNS> &result,
+			const Matrix<T, ROWS, INNER> &lhs, const Matrix<T, INNER, COLUMNS> &rhs);
+	
+	/**
+	 * \brief	Calculate `result = lhs * rhs^T` without transposing `rhs`
+	 * 
+	 * Both operands are accessed row by row, which is the fastest of all
+	 * products. Typical uses are `P * H^T` or `A * P * A^T` in Kalman filters.
+	 * 
+	 * \warning	`result` must be a different matrix than `lhs` and `rhs`!
+	 * \ingroup	matrix
+	 */
+	template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+	void
+	multiplyTransposed(Matrix<T, ROWS, COLUMNS> &result,
+			const Matrix<T, ROWS, INNER> &lhs, const Matrix<T, COLUMNS, INNER> &rhs);
+	
+	/// \brief	Calculate `lhs * rhs^T` without transposing `rhs`
+	/// \ingroup	matrix
+	template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+	Matrix<T, ROWS, COLUMNS>
+	multiplyTransposed(const Matrix<T, ROWS, INNER> &lhs, const Matrix<T, COLUMNS, INNER> &rhs);
+	
 	typedef Matrix<float, 1, 1> Matrix1f;
 	typedef Matrix<float, 2, 2> Matrix2f;
 	typedef Matrix<float, 3, 3> Matrix3f;
@@ -0,0 +1,224 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__MATRIX_HPP
+#	error	"Don't include this file directly, use 'matrix.hpp' instead!"
+#endif
+
+namespace xpcc
+{
+	template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+	class Matrix;
+
+	/**
+	 * \brief	Base class of all matrix expressions
+	 *
+	 * Element-wise operations (`+`, `-`, negation, multiplication and
+	 * division by a scalar) on matrices do not compute their result
+	 * immediately, but return a lightweight expression object.
+	 * The whole chain is evaluated in a single loop when it is assigned
+	 * to a Matrix, without creating temporary matrices:
+	 *
+	 * \code
+	 * // evaluated element by element in one loop
+	 * xpcc::Matrix<float, 9, 9> P = A + B * 0.5f - C;
+	 * \endcode
+	 *
+	 * Matrix products are evaluated eagerly into a Matrix, since every
+	 * element of the result depends on multiple elements of the operands.
+	 *
+	 * Since expressions store references to the matrices they are built
+	 * from, they must not outlive them. Do not store expressions with `auto`.
+	 *
+	 * Every expression `E` provides `E::ElementType`, `E::NumberOfRows`,
+	 * `E::NumberOfColumns` and `evaluate(index)`, which returns the element
+	 * at the linear (row-major) index.
+	 *
+	 * \ingroup	matrix
+	 */
+	template<typename E>
+	class MatrixExpression
+	{
+	public:
+		inline const E&
+		derived() const
+		{
+			return static_cast<const E&>(*this);
+		}
+	};
+
+	/// \internal	Matrices are stored by reference, expressions by value
+	template<typename E>
+	struct MatrixExpressionStorage
+	{
+		typedef const E Type;
+	};
+
+	/// \internal
+	template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+	struct MatrixExpressionStorage< Matrix<T, ROWS, COLUMNS> >
+	{
+		typedef const Matrix<T, ROWS, COLUMNS>& Type;
+	};
+
+	/// \internal
+	struct MatrixAddition
+	{
+		template<typename T>
+		static inline T
+		apply(const T& a, const T& b)
+		{
+			return a + b;
+		}
+	};
+
+	/// \internal
+	struct MatrixSubtraction
+	{
+		template<typename T>
+		static inline T
+		apply(const T& a, const T& b)
+		{
+			return a - b;
+		}
+	};
+
+	/// \internal	Element-wise operation of two matrices with equal size
+	template<typename L, typename R, typename Operation>
+	class MatrixBinaryExpression :
+		public MatrixExpression< MatrixBinaryExpression<L, R, Operation> >
+	{
+	public:
+		typedef typename L::ElementType ElementType;
+		static constexpr uint8_t NumberOfRows = L::NumberOfRows;
+		static constexpr uint8_t NumberOfColumns = L::NumberOfColumns;
+
+		static_assert(L::NumberOfRows == R::NumberOfRows and
+					  L::NumberOfColumns == R::NumberOfColumns,
+					  "Element-wise operations require matrices of equal size!");
+
+		MatrixBinaryExpression(const L& lhs, const R& rhs) :
+			lhs(lhs), rhs(rhs)
+		{
+		}
+
+		inline ElementType
+		evaluate(uint_fast8_t index) const
+		{
+			return Operation::apply(lhs.evaluate(index), rhs.evaluate(index));
+		}
+
+	private:
+		typename MatrixExpressionStorage<L>::Type lhs;
+		typename MatrixExpressionStorage<R>::Type rhs;
+	};
+
+	/// \internal	Multiplication of every element with a factor
+	template<typename E, typename F>
+	class MatrixScaledExpression :
+		public MatrixExpression< MatrixScaledExpression<E, F> >
+	{
+	public:
+		typedef typename E::ElementType ElementType;
+		static constexpr uint8_t NumberOfRows = E::NumberOfRows;
+		static constexpr uint8_t NumberOfColumns = E::NumberOfColumns;
+
+		MatrixScaledExpression(const E& expression, const F& factor) :
+			expression(expression), factor(factor)
+		{
+		}
+
+		inline ElementType
+		evaluate(uint_fast8_t index) const
+		{
+			return expression.evaluate(index) * factor;
+		}
+
+	private:
+		typename MatrixExpressionStorage<E>::Type expression;
+		const F factor;
+	};
+
+	/// \internal
+	template<typename E>
+	class MatrixNegatedExpression :
+		public MatrixExpression< MatrixNegatedExpression<E> >
+	{
+	public:
+		typedef typename E::ElementType ElementType;
+		static constexpr uint8_t NumberOfRows = E::NumberOfRows;
+		static constexpr uint8_t NumberOfColumns = E::NumberOfColumns;
+
+		MatrixNegatedExpression(const E& expression) :
+			expression(expression)
+		{
+		}
+
+		inline ElementType
+		evaluate(uint_fast8_t index) const
+		{
+			return -expression.evaluate(index);
+		}
+
+	private:
+		typename MatrixExpressionStorage<E>::Type expression;
+	};
+
+	// ------------------------------------------------------------------------
+	/// \ingroup	matrix
+	template<typename L, typename R>
+	inline MatrixBinaryExpression<L, R, MatrixAddition>
+	operator + (const MatrixExpression<L>& lhs, const MatrixExpression<R>& rhs)
+	{
+		return MatrixBinaryExpression<L, R, MatrixAddition>(lhs.derived(), rhs.derived());
+	}
+
+	/// \ingroup	matrix
+	template<typename L, typename R>
+	inline MatrixBinaryExpression<L, R, MatrixSubtraction>
+	operator - (const MatrixExpression<L>& lhs, const MatrixExpression<R>& rhs)
+	{
+		return MatrixBinaryExpression<L, R, MatrixSubtraction>(lhs.derived(), rhs.derived());
+	}
+
+	/// \ingroup	matrix
+	template<typename E>
+	inline MatrixNegatedExpression<E>
+	operator - (const MatrixExpression<E>& expression)
+	{
+		return MatrixNegatedExpression<E>(expression.derived());
+	}
+
+	/// Scalar multiplication
+	/// \ingroup	matrix
+	template<typename E>
+	inline MatrixScaledExpression<E, typename E::ElementType>
+	operator * (const MatrixExpression<E>& expression, const typename E::ElementType& factor)
+	{
+		return MatrixScaledExpression<E, typename E::ElementType>(expression.derived(), factor);
+	}
+
+	/// Scalar multiplication
+	/// \ingroup	matrix
+	template<typename E>
+	inline MatrixScaledExpression<E, typename E::ElementType>
+	operator * (const typename E::ElementType& factor, const MatrixExpression<E>& expression)
+	{
+		return MatrixScaledExpression<E, typename E::ElementType>(expression.derived(), factor);
+	}
+
+	/// Scalar division, implemented as multiplication with the reciprocal
+	/// \ingroup	matrix
+	template<typename E>
+	inline MatrixScaledExpression<E, float>
+	operator / (const MatrixExpression<E>& expression, const typename E::ElementType& divisor)
+	{
+		return MatrixScaledExpression<E, float>(expression.derived(), 1.0f / divisor);
+	}
+}
@@ -56,6 +56,33 @@ xpcc::Matrix<T, ROWS, COLUMNS>::Matrix(const Matrix &m)
 	}
 }
 
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template<typename E>
+xpcc::Matrix<T, ROWS, COLUMNS>::Matrix(const MatrixExpression<E> &expression)
+{
+	*this = expression;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template<typename E>
+xpcc::Matrix<T, ROWS, COLUMNS>&
+xpcc::Matrix<T, ROWS, COLUMNS>::operator = (const MatrixExpression<E> &expression)
+{
+	static_assert(E::NumberOfRows == ROWS and E::NumberOfColumns == COLUMNS,
+			"The expression must have the same size as the matrix!");
+	
+	// element-wise expressions only access the element at the same index,
+	// so the expression may contain this matrix
+	const E& e = expression.derived();
+	for (uint_fast8_t i = 0; i < ROWS * COLUMNS; ++i) {
+		element[i] = e.evaluate(i);
+	}
+	
+	return *this;
+}
+
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 template<typename U>
@@ -195,90 +222,30 @@ xpcc::Matrix<T, ROWS, COLUMNS>::ptr()
 
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>::operator - ()
-{
-	xpcc::Matrix<T, ROWS, COLUMNS> m;
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
-		m.element[i] = -this->element[i];
-	}
-	
-	return m;
-}
-
-// ----------------------------------------------------------------------------
-template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>::operator - (const xpcc::Matrix<T, ROWS, COLUMNS> &rhs) const
-{
-	xpcc::Matrix<T, ROWS, COLUMNS> m;
-	
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
-		m.element[i] = element[i] - rhs.element[i];
-	}
-	
-	return m;
-}
-
-// ----------------------------------------------------------------------------
-template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>::operator + (const xpcc::Matrix<T, ROWS, COLUMNS> &rhs) const
-{
-	xpcc::Matrix<T, ROWS, COLUMNS> m;
-	
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
-		m.element[i] = element[i] + rhs.element[i];
-	}
-	
-	return m;
-}
-
-// ----------------------------------------------------------------------------
-template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template<typename E>
 xpcc::Matrix<T, ROWS, COLUMNS>&
-xpcc::Matrix<T, ROWS, COLUMNS>::operator += (const xpcc::Matrix<T, ROWS, COLUMNS> &rhs)
+xpcc::Matrix<T, ROWS, COLUMNS>::operator += (const MatrixExpression<E> &rhs)
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
-		element[i] += rhs.element[i];
-	}
-	
+	*this = *this + rhs;
 	return *this;
 }
 
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template<typename E>
 xpcc::Matrix<T, ROWS, COLUMNS>&
-xpcc::Matrix<T, ROWS, COLUMNS>::operator -= (const xpcc::Matrix<T, ROWS, COLUMNS> &rhs)
+xpcc::Matrix<T, ROWS, COLUMNS>::operator -= (const MatrixExpression<E> &rhs)
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
-		element[i] -= rhs.element[i];
-	}
-	
+	*this = *this - rhs;
 	return *this;
 }
 
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-template<uint8_t RHSCOL>
-xpcc::Matrix<T, ROWS, ROWS>
-xpcc::Matrix<T, ROWS, COLUMNS>::operator * (const Matrix<T, COLUMNS, RHSCOL> &rhs) const
-{
-	xpcc::Matrix<T, ROWS, ROWS> m;
-	
-	for (uint_fast8_t i = 0; i < ROWS; ++i)
-	{
-		for (uint_fast8_t j = 0; j < RHSCOL; ++j)
-		{
-			m[j][i] = element[j * COLUMNS] * rhs[0][i];
-			for (uint_fast8_t x = 1; x < COLUMNS; ++x)
-			{
-				m[j][i] += element[j * COLUMNS + x] * rhs[x][i];
-			}
-		}
-	}
-	return m;
-}
+constexpr uint8_t xpcc::Matrix<T, ROWS, COLUMNS>::NumberOfRows;
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+constexpr uint8_t xpcc::Matrix<T, ROWS, COLUMNS>::NumberOfColumns;
 
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
@@ -289,19 +256,6 @@ xpcc::Matrix<T, ROWS, COLUMNS>::operator *= (const xpcc::Matrix<T, ROWS, COLUMNS
 	return *this;
 }
 
-// ----------------------------------------------------------------------------
-template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>::operator * (const T &rhs) const
-{
-	xpcc::Matrix<T, ROWS, COLUMNS> m;
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
-		m.element[i] = element[i] * rhs;
-	}
-	
-	return m;
-}
-
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 xpcc::Matrix<T, ROWS, COLUMNS>&
@@ -314,22 +268,6 @@ xpcc::Matrix<T, ROWS, COLUMNS>::operator *= (const T &rhs)
 	return *this;
 }
 
-// ----------------------------------------------------------------------------
-template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>
-xpcc::Matrix<T, ROWS, COLUMNS>::operator / (const T &rhs) const
-{
-	xpcc::Matrix<T, ROWS, COLUMNS> m;
-	
-	float oneOverRhs = 1.0f / rhs;
-	
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
-		m.element[i] = element[i] * oneOverRhs;
-	}
-	
-	return m;
-}
-
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 xpcc::Matrix<T, ROWS, COLUMNS>&
@@ -408,22 +346,6 @@ xpcc::Matrix<T, ROWS, COLUMNS>::hasInf() const
 	return false;
 }
  
-// ----------------------------------------------------------------------------
-template<typename T, uint8_t WIDTH, uint8_t HEIGHT>
-xpcc::Matrix<T, WIDTH, HEIGHT>
-operator * (int8_t lhs, const xpcc::Matrix<T, WIDTH, HEIGHT> &m)
-{
-	return m * lhs;
-}
-
-// ----------------------------------------------------------------------------
-template<typename T, uint8_t WIDTH, uint8_t HEIGHT>
-xpcc::Matrix<T, WIDTH, HEIGHT>
-operator * (float lhs, const xpcc::Matrix<T, WIDTH, HEIGHT> &m)
-{
-	return m * lhs;
-}
-
 // ----------------------------------------------------------------------------
 /*template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 void
@@ -652,6 +574,109 @@ xpcc::operator << (xpcc::IOStream& os, const xpcc::Matrix<T, ROWS, COLUMNS> &m)
 	return os;
 }
 
+// ----------------------------------------------------------------------------
+namespace xpcc
+{
+	/// \internal	Matrices are used directly, expressions are evaluated
+	template<typename E>
+	struct MatrixEvaluation
+	{
+		typedef const Matrix<typename E::ElementType, E::NumberOfRows, E::NumberOfColumns> Type;
+	};
+	
+	/// \internal
+	template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+	struct MatrixEvaluation< Matrix<T, ROWS, COLUMNS> >
+	{
+		typedef const Matrix<T, ROWS, COLUMNS>& Type;
+	};
+	
+	/**
+	 * \internal
+	 * Dot product of N elements which are STRIDE_A and STRIDE_B elements
+	 * apart. Completely unrolled and summed up as a tree, so the partial
+	 * sums do not depend on each other and the multiplications overlap.
+	 */
+	template<typename T, uint8_t N, uint8_t STRIDE_A, uint8_t STRIDE_B>
+	struct MatrixDotProduct
+	{
+		static xpcc_always_inline T
+		apply(const T *a, const T *b)
+		{
+			return MatrixDotProduct<T, N / 2, STRIDE_A, STRIDE_B>::apply(a, b) +
+					MatrixDotProduct<T, N - N / 2, STRIDE_A, STRIDE_B>::apply(
+							a + (N / 2) * STRIDE_A, b + (N / 2) * STRIDE_B);
+		}
+	};
+	
+	/// \internal
+	template<typename T, uint8_t STRIDE_A, uint8_t STRIDE_B>
+	struct MatrixDotProduct<T, 1, STRIDE_A, STRIDE_B>
+	{
+		static xpcc_always_inline T
+		apply(const T *a, const T *b)
+		{
+			return a[0] * b[0];
+		}
+	};
+}
+
+template<typename L, typename R>
+xpcc::Matrix<typename L::ElementType, L::NumberOfRows, R::NumberOfColumns>
+xpcc::operator * (const MatrixExpression<L> &lhs, const MatrixExpression<R> &rhs)
+{
+	static_assert(L::NumberOfColumns == R::NumberOfRows,
+			"The number of columns of lhs must match the number of rows of rhs!");
+	
+	typename MatrixEvaluation<L>::Type a(lhs.derived());
+	typename MatrixEvaluation<R>::Type b(rhs.derived());
+	
+	Matrix<typename L::ElementType, L::NumberOfRows, R::NumberOfColumns> m;
+	multiply(m, a, b);
+	return m;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+void
+xpcc::multiply(Matrix<T, ROWS, COLUMNS> &result,
+		const Matrix<T, ROWS, INNER> &lhs, const Matrix<T, INNER, COLUMNS> &rhs)
+{
+	// every element is an unrolled dot product of a row of lhs and
+	// a column of rhs, kept in registers until it is stored
+	for (uint_fast8_t i = 0; i < ROWS; ++i)
+	{
+		const T *a = lhs[i];
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			result[i][j] = MatrixDotProduct<T, INNER, 1, COLUMNS>::apply(a, &rhs[0][j]);
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+void
+xpcc::multiplyTransposed(Matrix<T, ROWS, COLUMNS> &result,
+		const Matrix<T, ROWS, INNER> &lhs, const Matrix<T, COLUMNS, INNER> &rhs)
+{
+	for (uint_fast8_t i = 0; i < ROWS; ++i)
+	{
+		const T *a = lhs[i];
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			result[i][j] = MatrixDotProduct<T, INNER, 1, 1>::apply(a, rhs[j]);
+		}
+	}
+}
+
+template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+xpcc::Matrix<T, ROWS, COLUMNS>
+xpcc::multiplyTransposed(const Matrix<T, ROWS, INNER> &lhs, const Matrix<T, COLUMNS, INNER> &rhs)
+{
+	Matrix<T, ROWS, COLUMNS> m;
+	multiplyTransposed(m, lhs, rhs);
+	return m;
+}
+
 // ----------------------------------------------------------------------------
 template<typename T>
 T
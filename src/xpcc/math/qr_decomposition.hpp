@@ -0,0 +1,65 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__QR_DECOMPOSITION_HPP
+#define XPCC__QR_DECOMPOSITION_HPP
+
+#include "matrix.hpp"
+#include "geometry/vector.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Householder QR decomposition
+	 *
+	 * Factorises a matrix A with ROWS >= COLUMNS into A = Q*R in place.
+	 * Q is orthogonal and never formed explicitly, it is stored as a
+	 * sequence of Householder reflections H_k = I - tau_k * v_k * v_k^T.
+	 *
+	 * After decompose() the upper triangle of A holds R, the part below
+	 * the diagonal holds the vectors v_k (with an implicit leading 1) and
+	 * \p tau holds the scaling factors, the same layout LAPACK uses.
+	 *
+	 * solve() returns the least-squares solution of A*X = B without ever
+	 * forming the normal equations A^T*A, which would square the
+	 * condition number.
+	 *
+	 * \ingroup	matrix
+	 */
+	class QRDecomposition
+	{
+	public:
+		template <typename T, uint8_t ROWS, uint8_t COLUMNS>
+		static void
+		decompose(Matrix<T, ROWS, COLUMNS> &a, Vector<T, COLUMNS> *tau);
+
+		/// Replace B with Q^T*B
+		template <typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t BCOLUMNS>
+		static void
+		applyTransposedQ(const Matrix<T, ROWS, COLUMNS> &qr,
+				const Vector<T, COLUMNS> &tau,
+				Matrix<T, ROWS, BCOLUMNS> *b);
+
+		/**
+		 * Least-squares solution of A*X = B
+		 *
+		 * \return	`false` if A does not have full column rank
+		 */
+		template <typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t BCOLUMNS>
+		static bool
+		solve(const Matrix<T, ROWS, COLUMNS> &qr,
+				const Vector<T, COLUMNS> &tau,
+				const Matrix<T, ROWS, BCOLUMNS> &b,
+				Matrix<T, COLUMNS, BCOLUMNS> *x);
+	};
+}
+
+#include "qr_decomposition_impl.hpp"
+
+#endif // XPCC__QR_DECOMPOSITION_HPP
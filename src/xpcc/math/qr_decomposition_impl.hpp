@@ -0,0 +1,126 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__QR_DECOMPOSITION_HPP
+	#error	"Don't include this file directly, use 'qr_decomposition.hpp' instead!"
+#endif
+
+#include <cmath>
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+void
+xpcc::QRDecomposition::decompose(
+		xpcc::Matrix<T, ROWS, COLUMNS> &a,
+		xpcc::Vector<T, COLUMNS> *tau)
+{
+	static_assert(ROWS >= COLUMNS, "QR decomposition requires ROWS >= COLUMNS");
+
+	for (uint_fast8_t k = 0; k < COLUMNS; ++k)
+	{
+		const T alpha = a[k][k];
+		T sigma = T(0);
+		for (uint_fast8_t i = k + 1; i < ROWS; ++i) {
+			sigma += a[i][k] * a[i][k];
+		}
+		if (sigma == T(0))
+		{
+			// column is already reduced
+			(*tau)[k] = T(0);
+			continue;
+		}
+
+		// choose the sign to avoid cancellation in alpha - beta
+		T beta = std::sqrt(alpha * alpha + sigma);
+		if (alpha > T(0)) {
+			beta = -beta;
+		}
+		(*tau)[k] = (beta - alpha) / beta;
+
+		const T scale = T(1) / (alpha - beta);
+		for (uint_fast8_t i = k + 1; i < ROWS; ++i) {
+			a[i][k] *= scale;
+		}
+		a[k][k] = beta;
+
+		// apply the reflection to the remaining columns
+		for (uint_fast8_t j = k + 1; j < COLUMNS; ++j)
+		{
+			T w = a[k][j];
+			for (uint_fast8_t i = k + 1; i < ROWS; ++i) {
+				w += a[i][k] * a[i][j];
+			}
+			w *= (*tau)[k];
+			a[k][j] -= w;
+			for (uint_fast8_t i = k + 1; i < ROWS; ++i) {
+				a[i][j] -= w * a[i][k];
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t BCOLUMNS>
+void
+xpcc::QRDecomposition::applyTransposedQ(
+		const xpcc::Matrix<T, ROWS, COLUMNS> &qr,
+		const xpcc::Vector<T, COLUMNS> &tau,
+		xpcc::Matrix<T, ROWS, BCOLUMNS> *b)
+{
+	// Q^T = H_n-1 * ... * H_1 * H_0, every H_k is symmetric
+	for (uint_fast8_t k = 0; k < COLUMNS; ++k)
+	{
+		if (tau[k] == T(0)) {
+			continue;
+		}
+		for (uint_fast8_t j = 0; j < BCOLUMNS; ++j)
+		{
+			T w = (*b)[k][j];
+			for (uint_fast8_t i = k + 1; i < ROWS; ++i) {
+				w += qr[i][k] * (*b)[i][j];
+			}
+			w *= tau[k];
+			(*b)[k][j] -= w;
+			for (uint_fast8_t i = k + 1; i < ROWS; ++i) {
+				(*b)[i][j] -= w * qr[i][k];
+			}
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS, uint8_t BCOLUMNS>
+bool
+xpcc::QRDecomposition::solve(
+		const xpcc::Matrix<T, ROWS, COLUMNS> &qr,
+		const xpcc::Vector<T, COLUMNS> &tau,
+		const xpcc::Matrix<T, ROWS, BCOLUMNS> &b,
+		xpcc::Matrix<T, COLUMNS, BCOLUMNS> *x)
+{
+	xpcc::Matrix<T, ROWS, BCOLUMNS> qb(b);
+	applyTransposedQ(qr, tau, &qb);
+
+	// back substitution with the upper COLUMNS rows of R
+	for (uint_fast8_t i = COLUMNS; i-- > 0; )
+	{
+		if (qr[i][i] == T(0)) {
+			return false;
+		}
+		const T inverse = T(1) / qr[i][i];
+		for (uint_fast8_t j = 0; j < BCOLUMNS; ++j)
+		{
+			T s = qb[i][j];
+			for (uint_fast8_t k = i + 1; k < COLUMNS; ++k) {
+				s -= qr[i][k] * (*x)[k][j];
+			}
+			(*x)[i][j] = s * inverse;
+		}
+	}
+	return true;
+}
@@ -36,7 +36,7 @@ namespace xpcc
 {
 	// ------------------------------------------------------------------------
 	template<>
-	Saturated<int8_t>&
+	inline Saturated<int8_t>&
 	Saturated<int8_t>::operator+=(const Saturated& other) {
 		asm (
 			"add  %[x], %[y]"	"\n\t"
@@ -74,7 +74,7 @@ namespace xpcc
 
 	// ------------------------------------------------------------------------
 	template<>
-	Saturated<int8_t>&
+	inline Saturated<int8_t>&
 	Saturated<int8_t>::operator-=(const Saturated& other) {
 		asm (
 			"sub  %[x], %[y]"	"\n\t"
@@ -113,7 +113,7 @@ namespace xpcc
 	// ------------------------------------------------------------------------
 	// FIXME warum funktioniert das nicht???
 	template<>
-	Saturated<int8_t>
+	inline Saturated<int8_t>
 	operator - (const Saturated<int8_t>& a) {
 		Saturated<int8_t> temp(a);
 		asm (
@@ -129,7 +129,7 @@ namespace xpcc
 
 	// ------------------------------------------------------------------------
 	template<>
-	Saturated<int8_t>
+	inline Saturated<int8_t>
 	abs(const Saturated<int8_t>& a) {
 		Saturated<int8_t> temp(a);
 		asm (
@@ -36,7 +36,7 @@ namespace xpcc
 {
 	// ------------------------------------------------------------------------
 	template<>
-	Saturated<uint8_t>&
+	inline Saturated<uint8_t>&
 	Saturated<uint8_t>::operator += (const Saturated& other) {
 		asm (
 			"add  %[x], %[y]"   "\n\t"
@@ -82,7 +82,7 @@ namespace xpcc
 
 	// ------------------------------------------------------------------------
 	template<>
-	Saturated<uint8_t>&
+	inline Saturated<uint8_t>&
 	Saturated<uint8_t>::operator -= (const Saturated& other) {
 		asm (
 			"sub  %[x], %[y]"   "\n\t"
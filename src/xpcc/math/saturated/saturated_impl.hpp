@@ -167,19 +167,19 @@ namespace xpcc
 	// ----------------------------------------------------------------------------
 	
 	template<>
-	void
+	inline void
 	Saturated<uint8_t>::absolute()
 	{
 	}
 	
 	template<>
-	void
+	inline void
 	Saturated<uint16_t>::absolute()
 	{
 	}
 	
 	template<>
-	void
+	inline void
 	Saturated<uint32_t>::absolute()
 	{
 	}
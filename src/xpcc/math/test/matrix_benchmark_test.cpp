@@ -0,0 +1,235 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/matrix.hpp>
+#include <xpcc/math/lu_decomposition.hpp>
+#include <xpcc/math/cholesky_decomposition.hpp>
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "matrix_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+namespace
+{
+	typedef xpcc::Matrix<float, 9, 9> Matrix9;
+	typedef xpcc::Matrix<float, 9, 3> Matrix93;
+	typedef xpcc::Matrix<float, 3, 9> Matrix39;
+	typedef xpcc::Matrix<float, 3, 3> Matrix3;
+
+	const uint32_t iterations = 20000;
+
+	// The previous implementation: every operation is evaluated
+	// into a temporary, products use a plain triple loop.
+	template<typename T, uint8_t R, uint8_t K, uint8_t C>
+	xpcc::Matrix<T, R, C>
+	eagerProduct(const xpcc::Matrix<T, R, K>& a, const xpcc::Matrix<T, K, C>& b)
+	{
+		xpcc::Matrix<T, R, C> m;
+		for (uint_fast8_t i = 0; i < R; ++i) {
+			for (uint_fast8_t j = 0; j < C; ++j) {
+				m[i][j] = a[i][0] * b[0][j];
+				for (uint_fast8_t x = 1; x < K; ++x) {
+					m[i][j] += a[i][x] * b[x][j];
+				}
+			}
+		}
+		return m;
+	}
+
+	template<typename T, uint8_t R, uint8_t C>
+	xpcc::Matrix<T, R, C>
+	eagerSum(const xpcc::Matrix<T, R, C>& a, const xpcc::Matrix<T, R, C>& b, T sign)
+	{
+		xpcc::Matrix<T, R, C> m;
+		for (uint_fast8_t i = 0; i < R * C; ++i) {
+			m.element[i] = a.element[i] + sign * b.element[i];
+		}
+		return m;
+	}
+
+	void
+	eagerUpdate(Matrix9& P, const Matrix93& K, const Matrix39& H, const Matrix3& R)
+	{
+		const Matrix9 IKH = eagerSum(Matrix9::identityMatrix(), eagerProduct(K, H), -1.f);
+		P = eagerSum(
+				eagerProduct(eagerProduct(IKH, P), IKH.asTransposed()),
+				eagerProduct(eagerProduct(K, R), K.asTransposed()), 1.f);
+	}
+
+	void
+	update(Matrix9& P, const Matrix93& K, const Matrix39& H, const Matrix3& R)
+	{
+		const Matrix9 IKH = Matrix9::identityMatrix() - K * H;
+
+		Matrix9 IKHP;
+		xpcc::multiply(IKHP, IKH, P);
+		Matrix9 A;
+		xpcc::multiplyTransposed(A, IKHP, IKH);
+
+		Matrix93 KR;
+		xpcc::multiply(KR, K, R);
+		Matrix9 B;
+		xpcc::multiplyTransposed(B, KR, K);
+
+		P = A + B;
+	}
+
+	template<typename Function>
+	uint32_t
+	measure(Function function, const Matrix9& P0, const Matrix93& K,
+			const Matrix39& H, const Matrix3& R, float& checksum)
+	{
+		const unittest::Stopwatch stopwatch;
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			Matrix9 P = P0;
+			function(P, K, H, R);
+			checksum += P[i % 9][(i / 9) % 9];
+		}
+		return stopwatch.getTicks();
+	}
+}
+
+void
+MatrixBenchmarkTest::testKalmanUpdate()
+{
+	Matrix9 P0;
+	Matrix93 K;
+	Matrix39 H = Matrix39::zeroMatrix();
+	Matrix3 R = Matrix3::zeroMatrix();
+	for (uint_fast8_t i = 0; i < 9; ++i)
+	{
+		for (uint_fast8_t j = 0; j < 9; ++j) {
+			P0[i][j] = (i == j) ? 2.f : 0.1f / (1 + i + j);
+		}
+		for (uint_fast8_t j = 0; j < 3; ++j) {
+			K[i][j] = 0.05f * (i + 1) / (j + 2);
+		}
+	}
+	for (uint_fast8_t i = 0; i < 3; ++i) {
+		H[i][i * 3] = 1.f;
+		R[i][i] = 0.25f;
+	}
+
+	// both implementations must give the same result
+	Matrix9 eager = P0;
+	Matrix9 fused = P0;
+	eagerUpdate(eager, K, H, R);
+	update(fused, K, H, R);
+	for (uint_fast8_t i = 0; i < 81; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(fused.element[i], eager.element[i], 1e-5f);
+	}
+
+	float checksumEager = 0;
+	float checksumFused = 0;
+	const uint32_t ticksEager = measure(eagerUpdate, P0, K, H, R, checksumEager);
+	const uint32_t ticksFused = measure(update, P0, K, H, R, checksumFused);
+	TEST_ASSERT_EQUALS_DELTA(checksumFused, checksumEager, 1e-2f);
+
+	XPCC_LOG_INFO << "Kalman update 9x9: eager "
+			<< unittest::getNanoseconds(ticksEager, iterations)
+			<< " ns, fused "
+			<< unittest::getNanoseconds(ticksFused, iterations)
+			<< " ns" << xpcc::endl;
+}
+
+// ----------------------------------------------------------------------------
+namespace
+{
+	typedef xpcc::Matrix<float, 6, 6> Matrix6;
+
+	// the recursive LUDecomposition only handles as many right-hand
+	// sides as the matrix has rows
+	void
+	solveLu(const Matrix6& a, Matrix6& bx)
+	{
+		Matrix6 l, u;
+		xpcc::LUDecomposition::decompose(a, &l, &u);
+		xpcc::LUDecomposition::solve(l, u, &bx);
+	}
+
+	void
+	solveLuInPlace(const Matrix6& a, Matrix6& bx)
+	{
+		Matrix6 lu(a);
+		xpcc::Vector<uint8_t, 6> p;
+		xpcc::LUDecomposition::decomposeInPlace(lu, &p);
+		xpcc::LUDecomposition::solve(lu, p, &bx);
+	}
+
+	void
+	solveCholesky(const Matrix6& a, Matrix6& bx)
+	{
+		Matrix6 l(a);
+		xpcc::CholeskyDecomposition::decompose(l);
+		xpcc::CholeskyDecomposition::solve(l, &bx);
+	}
+
+	template<typename Function>
+	uint32_t
+	measureSolver(Function function, const Matrix6& a, const Matrix6& b,
+			float& checksum)
+	{
+		const unittest::Stopwatch stopwatch;
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			Matrix6 bx(b);
+			bx[i % 6][0] += 1e-3f;
+			function(a, bx);
+			checksum += bx[(i / 6) % 6][i % 6];
+		}
+		return stopwatch.getTicks();
+	}
+}
+
+void
+MatrixBenchmarkTest::testSolver()
+{
+	Matrix6 a;
+	Matrix6 b;
+	for (uint_fast8_t i = 0; i < 6; ++i)
+	{
+		for (uint_fast8_t j = 0; j < 6; ++j) {
+			a[i][j] = (i == j) ? 4.f : 1.f / (1 + i + j);
+			b[i][j] = float(i) - float(j) * 0.5f;
+		}
+	}
+
+	float checksumLu = 0;
+	float checksumInPlace = 0;
+	float checksumCholesky = 0;
+	const uint32_t ticksLu = measureSolver(solveLu, a, b, checksumLu);
+	const uint32_t ticksInPlace = measureSolver(solveLuInPlace, a, b, checksumInPlace);
+	const uint32_t ticksCholesky = measureSolver(solveCholesky, a, b, checksumCholesky);
+	TEST_ASSERT_EQUALS_DELTA(checksumInPlace, checksumLu, 1e-1f);
+	TEST_ASSERT_EQUALS_DELTA(checksumCholesky, checksumLu, 1e-1f);
+
+	XPCC_LOG_INFO << "Solve 6x6: LUDecomposition "
+			<< unittest::getNanoseconds(ticksLu, iterations)
+			<< " ns, in-place LU "
+			<< unittest::getNanoseconds(ticksInPlace, iterations)
+			<< " ns, Cholesky "
+			<< unittest::getNanoseconds(ticksCholesky, iterations)
+			<< " ns" << xpcc::endl;
+}
+
+#else
+
+void
+MatrixBenchmarkTest::testKalmanUpdate()
+{
+}
+
+void
+MatrixBenchmarkTest::testSolver()
+{
+}
+
+#endif
@@ -0,0 +1,23 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Only runs on hosted targets, the results are printed to the info log.
+class MatrixBenchmarkTest : public unittest::TestSuite
+{
+public:
+	/// Covariance update of a 9-state Kalman filter with three measurements
+	void
+	testKalmanUpdate();
+
+	/// Solve a 6x6 positive-definite system with LU and Cholesky
+	void
+	testSolver();
+};
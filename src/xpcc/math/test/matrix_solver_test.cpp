@@ -0,0 +1,374 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/math/lu_decomposition.hpp>
+#include <xpcc/math/cholesky_decomposition.hpp>
+#include <xpcc/math/qr_decomposition.hpp>
+
+#include "matrix_solver_test.hpp"
+
+namespace
+{
+	// symmetric positive-definite
+	const float spd[16] = {
+		4.f,  2.f,  0.6f, 1.f,
+		2.f,  5.f,  1.f,  0.5f,
+		0.6f, 1.f,  3.f,  0.2f,
+		1.f,  0.5f, 0.2f, 2.f,
+	};
+
+	const float solution[8] = {
+		1.f, -2.f,
+		0.5f, 3.f,
+		-1.5f, 0.f,
+		2.f, 1.f,
+	};
+
+	template<uint8_t ROWS, uint8_t COLUMNS>
+	float
+	maxDifference(const xpcc::Matrix<float, ROWS, COLUMNS> &a,
+			const xpcc::Matrix<float, ROWS, COLUMNS> &b)
+	{
+		float max = 0;
+		for (uint_fast8_t i = 0; i < ROWS * COLUMNS; ++i)
+		{
+			const float d = std::fabs(a.element[i] - b.element[i]);
+			if (d > max) {
+				max = d;
+			}
+		}
+		return max;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testTriangular()
+{
+	const float m[9] = {
+		2.f, 0.f, 0.f,
+		1.f, 4.f, 0.f,
+		-1.f, 3.f, 0.5f,
+	};
+	const xpcc::Matrix<float, 3, 3> l(m);
+	const xpcc::Matrix<float, 3, 2> x(solution);
+
+	xpcc::Matrix<float, 3, 2> bx = l * x;
+	TEST_ASSERT_TRUE(xpcc::TriangularSolver::solveLower(l, &bx));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(bx, x), 0.f, 1e-5f);
+
+	const xpcc::Matrix<float, 3, 3> u = l.asTransposed();
+	bx = u * x;
+	TEST_ASSERT_TRUE(xpcc::TriangularSolver::solveUpper(u, &bx));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(bx, x), 0.f, 1e-5f);
+
+	bx = u * x;
+	TEST_ASSERT_TRUE(xpcc::TriangularSolver::solveLowerTransposed(l, &bx));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(bx, x), 0.f, 1e-5f);
+
+	// the upper triangle must not be read
+	xpcc::Matrix<float, 3, 3> lu(l);
+	lu[0][2] = 100.f;
+	bx = l * x;
+	TEST_ASSERT_TRUE(xpcc::TriangularSolver::solveLower(lu, &bx));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(bx, x), 0.f, 1e-5f);
+
+	xpcc::Matrix<float, 3, 3> singular(l);
+	singular[1][1] = 0.f;
+	TEST_ASSERT_FALSE(xpcc::TriangularSolver::solveLower(singular, &bx));
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testLuInPlace()
+{
+	// requires pivoting, the first pivot is zero
+	const float m[9] = {
+		0.f, 2.f, 1.f,
+		1.f, 1.f, 1.f,
+		4.f, -1.f, 3.f,
+	};
+	const xpcc::Matrix<float, 3, 3> a(m);
+	const xpcc::Matrix<float, 3, 2> x(solution);
+
+	xpcc::Matrix<float, 3, 3> lu(a);
+	xpcc::Vector<uint8_t, 3> p;
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::decomposeInPlace(lu, &p));
+
+	// the largest element of the first column is chosen as pivot
+	TEST_ASSERT_EQUALS(p[0], 2);
+	TEST_ASSERT_EQUALS_FLOAT(lu[0][0], 4.f);
+
+	xpcc::Matrix<float, 3, 2> bx = a * x;
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::solve(lu, p, &bx));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(bx, x), 0.f, 1e-5f);
+
+	// the recursive variant selects the same pivots
+	xpcc::Matrix<float, 3, 3> l;
+	xpcc::Matrix<float, 3, 3> u;
+	xpcc::Vector<int8_t, 3> pivot;
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::decompose(a, &l, &u, &pivot));
+	TEST_ASSERT_EQUALS(pivot[0], 2);
+	const xpcc::Matrix<float, 3, 3> product = l * u;
+	for (uint8_t i = 0; i < 3; ++i) {
+		for (uint8_t j = 0; j < 3; ++j) {
+			TEST_ASSERT_EQUALS_DELTA(product[i][j], a[pivot[i]][j], 1e-5f);
+		}
+	}
+}
+
+void
+MatrixSolverTest::testLuSingular()
+{
+	const float m[9] = {
+		1.f, 2.f, 3.f,
+		2.f, 4.f, 6.f,
+		1.f, 0.f, 1.f,
+	};
+	xpcc::Matrix<float, 3, 3> lu(m);
+	xpcc::Vector<uint8_t, 3> p;
+	TEST_ASSERT_FALSE(xpcc::LUDecomposition::decomposeInPlace(lu, &p));
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testCholesky()
+{
+	const xpcc::Matrix<float, 4, 4> a(spd);
+	const xpcc::Matrix<float, 4, 2> x(solution);
+
+	xpcc::Matrix<float, 4, 4> l(a);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decompose(l));
+
+	for (uint_fast8_t i = 0; i < 4; ++i)
+	{
+		TEST_ASSERT_TRUE(l[i][i] > 0.f);
+		for (uint_fast8_t j = i + 1; j < 4; ++j) {
+			TEST_ASSERT_EQUALS(l[i][j], 0.f);
+		}
+	}
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(xpcc::multiplyTransposed(l, l), a), 0.f, 1e-5f);
+
+	xpcc::Matrix<float, 4, 2> bx = a * x;
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::solve(l, &bx));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(bx, x), 0.f, 1e-5f);
+}
+
+void
+MatrixSolverTest::testCholeskyNotPositiveDefinite()
+{
+	const float m[4] = {
+		1.f, 2.f,
+		2.f, 1.f,
+	};
+	xpcc::Matrix<float, 2, 2> a(m);
+	TEST_ASSERT_FALSE(xpcc::CholeskyDecomposition::decompose(a));
+
+	// but LDL^T works for symmetric indefinite matrices
+	xpcc::Matrix<float, 2, 2> ld(m);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decomposeLdlt(ld));
+	TEST_ASSERT_EQUALS_FLOAT(ld[0][0], 1.f);
+	TEST_ASSERT_EQUALS_FLOAT(ld[1][0], 2.f);
+	TEST_ASSERT_EQUALS_FLOAT(ld[1][1], -3.f);
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testLdlt()
+{
+	const xpcc::Matrix<float, 4, 4> a(spd);
+	const xpcc::Matrix<float, 4, 2> x(solution);
+
+	xpcc::Matrix<float, 4, 4> ld(a);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decomposeLdlt(ld));
+
+	// D equals the squared diagonal of the LL^T factor
+	xpcc::Matrix<float, 4, 4> l(a);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decompose(l));
+	for (uint_fast8_t i = 0; i < 4; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(ld[i][i], l[i][i] * l[i][i], 1e-5f);
+	}
+
+	xpcc::Matrix<float, 4, 2> bx = a * x;
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::solveLdlt(ld, &bx));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(bx, x), 0.f, 1e-5f);
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testCholeskyUpdate()
+{
+	const xpcc::Matrix<float, 4, 4> a(spd);
+	const float v[4] = { 0.5f, -1.f, 0.25f, 2.f };
+	const xpcc::Matrix<float, 4, 1> x(v);
+
+	xpcc::Matrix<float, 4, 4> l(a);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decompose(l));
+	const xpcc::Matrix<float, 4, 4> original(l);
+
+	xpcc::Matrix<float, 4, 4> reference = a + xpcc::multiplyTransposed(x, x);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decompose(reference));
+
+	xpcc::Matrix<float, 4, 1> scratch(x);
+	xpcc::CholeskyDecomposition::update(l, &scratch);
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(l, reference), 0.f, 1e-5f);
+
+	scratch = x;
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::downdate(l, &scratch));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(l, original), 0.f, 1e-5f);
+
+	// removing more than was there leaves an indefinite matrix
+	scratch = x * 10.f;
+	TEST_ASSERT_FALSE(xpcc::CholeskyDecomposition::downdate(l, &scratch));
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testSolveRight()
+{
+	const xpcc::Matrix<float, 4, 4> a(spd);
+	const float m[8] = {
+		1.f, 0.f, 2.f, -1.f,
+		0.5f, 3.f, 0.f, 1.f,
+	};
+	const xpcc::Matrix<float, 2, 4> b(m);
+
+	xpcc::Matrix<float, 4, 4> l(a);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decompose(l));
+
+	xpcc::Matrix<float, 2, 4> x(b);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::solveRight(l, &x));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(x * a, b), 0.f, 1e-5f);
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testQr()
+{
+	const float m[12] = {
+		1.f, 2.f, 0.f,
+		-1.f, 1.f, 3.f,
+		2.f, 0.f, 1.f,
+		0.f, 1.f, -2.f,
+	};
+	const xpcc::Matrix<float, 4, 3> a(m);
+
+	xpcc::Matrix<float, 4, 3> qr(a);
+	xpcc::Vector<float, 3> tau;
+	xpcc::QRDecomposition::decompose(qr, &tau);
+
+	// Q^T*A must reproduce R and zero everything below the diagonal
+	xpcc::Matrix<float, 4, 3> r(a);
+	xpcc::QRDecomposition::applyTransposedQ(qr, tau, &r);
+	for (uint_fast8_t i = 0; i < 4; ++i)
+	{
+		for (uint_fast8_t j = 0; j < 3; ++j)
+		{
+			if (i > j) {
+				TEST_ASSERT_EQUALS_DELTA(r[i][j], 0.f, 1e-5f);
+			}
+			else {
+				TEST_ASSERT_EQUALS_DELTA(r[i][j], qr[i][j], 1e-5f);
+			}
+		}
+	}
+
+	// Q is orthogonal, so the column norms are preserved
+	for (uint_fast8_t j = 0; j < 3; ++j)
+	{
+		float norm = 0.f;
+		float normR = 0.f;
+		for (uint_fast8_t i = 0; i < 4; ++i) {
+			norm += a[i][j] * a[i][j];
+			normR += r[i][j] * r[i][j];
+		}
+		TEST_ASSERT_EQUALS_DELTA(normR, norm, 1e-5f);
+	}
+}
+
+void
+MatrixSolverTest::testQrLeastSquares()
+{
+	// fit y = c0 + c1 * t through six points
+	const float t[6] = { 0.f, 1.f, 2.f, 3.f, 4.f, 5.f };
+	const float y[6] = { 2.1f, 4.9f, 8.2f, 10.8f, 14.1f, 16.9f };
+
+	xpcc::Matrix<float, 6, 2> a;
+	xpcc::Matrix<float, 6, 1> b;
+	for (uint_fast8_t i = 0; i < 6; ++i) {
+		a[i][0] = 1.f;
+		a[i][1] = t[i];
+		b[i][0] = y[i];
+	}
+
+	xpcc::Matrix<float, 6, 2> qr(a);
+	xpcc::Vector<float, 2> tau;
+	xpcc::QRDecomposition::decompose(qr, &tau);
+
+	xpcc::Matrix<float, 2, 1> c;
+	TEST_ASSERT_TRUE(xpcc::QRDecomposition::solve(qr, tau, b, &c));
+
+	// closed form solution of the normal equations
+	TEST_ASSERT_EQUALS_DELTA(c[0][0], 2.0571429f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(c[1][0], 2.9771429f, 1e-4f);
+
+	// the residual is orthogonal to the columns of A
+	const xpcc::Matrix<float, 6, 1> residual = b - a * c;
+	const xpcc::Matrix<float, 2, 1> projection = a.asTransposed() * residual;
+	TEST_ASSERT_EQUALS_DELTA(projection[0][0], 0.f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(projection[1][0], 0.f, 1e-4f);
+
+	// rank deficient
+	for (uint_fast8_t i = 0; i < 6; ++i) {
+		qr[i][0] = 1.f;
+		qr[i][1] = 0.f;
+	}
+	xpcc::QRDecomposition::decompose(qr, &tau);
+	TEST_ASSERT_FALSE(xpcc::QRDecomposition::solve(qr, tau, b, &c));
+}
+
+// ----------------------------------------------------------------------------
+void
+MatrixSolverTest::testHilbert()
+{
+	// condition number ~5e5, close to the limit of single precision
+	xpcc::Matrix<float, 5, 5> h;
+	for (uint_fast8_t i = 0; i < 5; ++i) {
+		for (uint_fast8_t j = 0; j < 5; ++j) {
+			h[i][j] = 1.f / (i + j + 1);
+		}
+	}
+	xpcc::Matrix<float, 5, 1> ones;
+	for (uint_fast8_t i = 0; i < 5; ++i) {
+		ones[i][0] = 1.f;
+	}
+	const xpcc::Matrix<float, 5, 1> b = h * ones;
+
+	xpcc::Matrix<float, 5, 5> l(h);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::decompose(l));
+	xpcc::Matrix<float, 5, 1> x(b);
+	TEST_ASSERT_TRUE(xpcc::CholeskyDecomposition::solve(l, &x));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(h * x, b), 0.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(x, ones), 0.f, 0.5f);
+
+	xpcc::Matrix<float, 5, 5> lu(h);
+	xpcc::Vector<uint8_t, 5> p;
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::decomposeInPlace(lu, &p));
+	x = b;
+	TEST_ASSERT_TRUE(xpcc::LUDecomposition::solve(lu, p, &x));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(h * x, b), 0.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(x, ones), 0.f, 0.5f);
+
+	xpcc::Matrix<float, 5, 5> qr(h);
+	xpcc::Vector<float, 5> tau;
+	xpcc::QRDecomposition::decompose(qr, &tau);
+	TEST_ASSERT_TRUE(xpcc::QRDecomposition::solve(qr, tau, b, &x));
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(h * x, b), 0.f, 1e-5f);
+	TEST_ASSERT_EQUALS_DELTA(maxDifference(x, ones), 0.f, 0.5f);
+}
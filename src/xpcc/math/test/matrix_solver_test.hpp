@@ -0,0 +1,48 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class MatrixSolverTest : public unittest::TestSuite
+{
+public:
+	void
+	testTriangular();
+
+	void
+	testLuInPlace();
+
+	void
+	testLuSingular();
+
+	void
+	testCholesky();
+
+	void
+	testCholeskyNotPositiveDefinite();
+
+	void
+	testLdlt();
+
+	void
+	testCholeskyUpdate();
+
+	void
+	testSolveRight();
+
+	void
+	testQr();
+
+	void
+	testQrLeastSquares();
+
+	/// Ill-conditioned system, all solvers must keep the residual small
+	void
+	testHilbert();
+};
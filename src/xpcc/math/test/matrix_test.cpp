@@ -589,3 +589,145 @@ MatrixTest::testDeterminant()
 	xpcc::Matrix<int16_t, 1, 1> d = a.subMatrix<1, 1>(1, 1);
 	TEST_ASSERT_EQUALS(d.determinant(), 5);
 }
+
+void
+MatrixTest::testExpression()
+{
+	const int16_t m[4] = {
+		1, 2,
+		3, 4,
+	};
+	const int16_t n[4] = {
+		10, 20,
+		30, 40,
+	};
+	
+	xpcc::Matrix<int16_t, 2, 2> a(m);
+	xpcc::Matrix<int16_t, 2, 2> b(n);
+	
+	xpcc::Matrix<int16_t, 2, 2> c = a * 3 + b - 2 * a;
+	TEST_ASSERT_EQUALS(c[0][0], 11);
+	TEST_ASSERT_EQUALS(c[0][1], 22);
+	TEST_ASSERT_EQUALS(c[1][0], 33);
+	TEST_ASSERT_EQUALS(c[1][1], 44);
+	
+	c = -(b - a) / 2;
+	TEST_ASSERT_EQUALS(c[0][0], -4);
+	TEST_ASSERT_EQUALS(c[0][1], -9);
+	TEST_ASSERT_EQUALS(c[1][0], -13);
+	TEST_ASSERT_EQUALS(c[1][1], -18);
+	
+	// the target may be part of the expression
+	a = a + a * 2;
+	TEST_ASSERT_EQUALS(a[0][0], 3);
+	TEST_ASSERT_EQUALS(a[1][1], 12);
+	
+	a += b - a;
+	TEST_ASSERT_TRUE(a == b);
+	
+	a -= b * 2;
+	TEST_ASSERT_EQUALS(a[0][1], -20);
+	
+	// a product inside an expression is evaluated first
+	const int16_t i[4] = {
+		1, 0,
+		0, 1,
+	};
+	xpcc::Matrix<int16_t, 2, 2> identity(i);
+	c = (identity + identity) * b + b;
+	TEST_ASSERT_EQUALS(c[0][0], 30);
+	TEST_ASSERT_EQUALS(c[1][1], 120);
+	
+	c = b * (identity - identity);
+	TEST_ASSERT_TRUE(c == (xpcc::Matrix<int16_t, 2, 2>::zeroMatrix()));
+}
+
+void
+MatrixTest::testNonSquareMultiplication()
+{
+	const int16_t m[6] = {
+		1, 2,
+		3, 4,
+		5, 6,
+	};
+	const int16_t n[8] = {
+		1, 0, 2, -1,
+		0, 1, 1, 3,
+	};
+	
+	xpcc::Matrix<int16_t, 3, 2> a(m);
+	xpcc::Matrix<int16_t, 2, 4> b(n);
+	
+	xpcc::Matrix<int16_t, 3, 4> c = a * b;
+	const int16_t expected[12] = {
+		1, 2,  4,  5,
+		3, 4, 10,  9,
+		5, 6, 16, 13,
+	};
+	TEST_ASSERT_EQUALS_ARRAY(c.element, expected, 12);
+	
+	xpcc::Matrix<int16_t, 3, 4> d;
+	xpcc::multiply(d, a, b);
+	TEST_ASSERT_TRUE(c == d);
+	
+	// the unrolled kernels split odd inner sizes unevenly
+	xpcc::Matrix<int16_t, 2, 7> f;
+	xpcc::Matrix<int16_t, 7, 3> g;
+	for (uint8_t i = 0; i < 14; ++i) {
+		f.element[i] = i - 5;
+	}
+	for (uint8_t i = 0; i < 21; ++i) {
+		g.element[i] = 3 - i / 2;
+	}
+	xpcc::Matrix<int16_t, 2, 3> h;
+	xpcc::multiply(h, f, g);
+	const xpcc::Matrix<int16_t, 2, 3> k = xpcc::multiplyTransposed(f, g.asTransposed());
+	for (uint8_t i = 0; i < 2; ++i)
+	{
+		for (uint8_t j = 0; j < 3; ++j)
+		{
+			int16_t sum = 0;
+			for (uint8_t x = 0; x < 7; ++x) {
+				sum += f[i][x] * g[x][j];
+			}
+			TEST_ASSERT_EQUALS(h[i][j], sum);
+			TEST_ASSERT_EQUALS(k[i][j], sum);
+		}
+	}
+	
+	const xpcc::Matrix<int16_t, 3, 4> outer = a.getColumn(1) * b.getRow(0);
+	TEST_ASSERT_EQUALS(outer[2][3], -6);
+}
+
+void
+MatrixTest::testMultiplyTransposed()
+{
+	const float m[6] = {
+		1, 2, 3,
+		4, 5, 6,
+	};
+	const float n[12] = {
+		1, 0, 0,
+		0, 1, 0,
+		1, 1, 1,
+		2, 0, -1,
+	};
+	
+	xpcc::Matrix<float, 2, 3> a(m);
+	xpcc::Matrix<float, 4, 3> b(n);
+	
+	xpcc::Matrix<float, 2, 4> c = xpcc::multiplyTransposed(a, b);
+	xpcc::Matrix<float, 2, 4> d = a * b.asTransposed();
+	TEST_ASSERT_TRUE(c == d);
+	
+	TEST_ASSERT_EQUALS_FLOAT(c[0][0], 1.f);
+	TEST_ASSERT_EQUALS_FLOAT(c[0][2], 6.f);
+	TEST_ASSERT_EQUALS_FLOAT(c[1][3], 2.f);
+	
+	xpcc::Matrix<float, 2, 2> e;
+	xpcc::multiplyTransposed(e, a, a);
+	TEST_ASSERT_EQUALS_FLOAT(e[0][0], 14.f);
+	TEST_ASSERT_EQUALS_FLOAT(e[0][1], 32.f);
+	TEST_ASSERT_EQUALS_FLOAT(e[1][0], 32.f);
+	TEST_ASSERT_EQUALS_FLOAT(e[1][1], 77.f);
+}
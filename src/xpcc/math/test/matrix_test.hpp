@@ -77,4 +77,13 @@ public:
 	
 	void
 	testDeterminant();
+	
+	void
+	testExpression();
+	
+	void
+	testNonSquareMultiplication();
+	
+	void
+	testMultiplyTransposed();
 };
@@ -0,0 +1,64 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__TRIANGULAR_SOLVER_HPP
+#define XPCC__TRIANGULAR_SOLVER_HPP
+
+#include "matrix.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Forward and back substitution
+	 *
+	 * Solves T*X = B for a triangular matrix T, one system per column of B.
+	 * Only the referenced triangle (including the diagonal) of T is read,
+	 * so the in-place results of xpcc::LUDecomposition::decomposeInPlace()
+	 * and xpcc::CholeskyDecomposition can be passed directly.
+	 *
+	 * All functions overwrite B with the solution and return `false` if
+	 * a zero is found on the diagonal.
+	 *
+	 * \ingroup	matrix
+	 */
+	class TriangularSolver
+	{
+	public:
+		/// Solve L*X = B
+		template <typename T, uint8_t N, uint8_t COLUMNS>
+		static bool
+		solveLower(const Matrix<T, N, N> &l, Matrix<T, N, COLUMNS> *bx,
+				bool unitDiagonal = false);
+
+		/// Solve U*X = B
+		template <typename T, uint8_t N, uint8_t COLUMNS>
+		static bool
+		solveUpper(const Matrix<T, N, N> &u, Matrix<T, N, COLUMNS> *bx,
+				bool unitDiagonal = false);
+
+		/// Solve L^T*X = B without transposing L
+		template <typename T, uint8_t N, uint8_t COLUMNS>
+		static bool
+		solveLowerTransposed(const Matrix<T, N, N> &l, Matrix<T, N, COLUMNS> *bx,
+				bool unitDiagonal = false);
+
+	private:
+		template <typename T, uint8_t COLUMNS>
+		static inline void
+		subtractRow(T *row, const T *other, const T &factor);
+
+		template <typename T, uint8_t COLUMNS>
+		static inline bool
+		divideRow(T *row, const T &divisor);
+	};
+}
+
+#include "triangular_solver_impl.hpp"
+
+#endif // XPCC__TRIANGULAR_SOLVER_HPP
@@ -0,0 +1,96 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__TRIANGULAR_SOLVER_HPP
+	#error	"Don't include this file directly, use 'triangular_solver.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t COLUMNS>
+void
+xpcc::TriangularSolver::subtractRow(T *row, const T *other, const T &factor)
+{
+	for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+		row[j] -= other[j] * factor;
+	}
+}
+
+template<typename T, uint8_t COLUMNS>
+bool
+xpcc::TriangularSolver::divideRow(T *row, const T &divisor)
+{
+	if (divisor == T(0)) {
+		return false;
+	}
+	const T inverse = T(1) / divisor;
+	for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+		row[j] *= inverse;
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N, uint8_t COLUMNS>
+bool
+xpcc::TriangularSolver::solveLower(
+		const xpcc::Matrix<T, N, N> &l,
+		xpcc::Matrix<T, N, COLUMNS> *bx,
+		bool unitDiagonal)
+{
+	for (uint_fast8_t i = 0; i < N; ++i)
+	{
+		for (uint_fast8_t k = 0; k < i; ++k) {
+			subtractRow<T, COLUMNS>((*bx)[i], (*bx)[k], l[i][k]);
+		}
+		if (!unitDiagonal and !divideRow<T, COLUMNS>((*bx)[i], l[i][i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N, uint8_t COLUMNS>
+bool
+xpcc::TriangularSolver::solveUpper(
+		const xpcc::Matrix<T, N, N> &u,
+		xpcc::Matrix<T, N, COLUMNS> *bx,
+		bool unitDiagonal)
+{
+	for (uint_fast8_t i = N; i-- > 0; )
+	{
+		for (uint_fast8_t k = i + 1; k < N; ++k) {
+			subtractRow<T, COLUMNS>((*bx)[i], (*bx)[k], u[i][k]);
+		}
+		if (!unitDiagonal and !divideRow<T, COLUMNS>((*bx)[i], u[i][i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t N, uint8_t COLUMNS>
+bool
+xpcc::TriangularSolver::solveLowerTransposed(
+		const xpcc::Matrix<T, N, N> &l,
+		xpcc::Matrix<T, N, COLUMNS> *bx,
+		bool unitDiagonal)
+{
+	for (uint_fast8_t i = N; i-- > 0; )
+	{
+		for (uint_fast8_t k = i + 1; k < N; ++k) {
+			subtractRow<T, COLUMNS>((*bx)[i], (*bx)[k], l[k][i]);
+		}
+		if (!unitDiagonal and !divideRow<T, COLUMNS>((*bx)[i], l[i][i])) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -32,6 +32,7 @@
 #define	XPCC_MATH__OPERATOR_HPP
 
 #include <cmath>
+#include <cstring>
 #include <stdint.h>
 
 #include <xpcc/architecture/utils.hpp>
@@ -92,6 +93,33 @@ namespace xpcc
 		 */
 		inline int32_t
 		mac(int32_t result, int16_t a, int16_t b);
+		
+		/**
+		 * \brief	Fast approximation of `1 / sqrt(x)` for x > 0
+		 * 
+		 * Initial guess from the bit pattern of the float followed by two
+		 * Newton iterations, the relative error is below 5e-6. Needs no
+		 * division and no square root, which makes it considerably faster
+		 * than `1.f / std::sqrt(x)` on targets without a FPU.
+		 * 
+		 * \see		C. Lomont, "Fast Inverse Square Root", 2003
+		 * \ingroup	math
+		 */
+		inline float
+		fastInverseSqrt(float x)
+		{
+			uint32_t i;
+			std::memcpy(&i, &x, sizeof(i));
+			i = 0x5f375a86 - (i >> 1);
+			
+			float y;
+			std::memcpy(&y, &i, sizeof(y));
+			
+			const float half = 0.5f * x;
+			y = y * (1.5f - half * y * y);
+			y = y * (1.5f - half * y * y);
+			return y;
+		}
 	}
 }
 
@@ -97,3 +97,20 @@ OperatorTest::testMultiplyAccumulate()
 	TEST_ASSERT_EQUALS(xpcc::math::mac(offset, (int16_t) -32000, (int16_t) -32000), 1024000000 + 1235678);
 	TEST_ASSERT_EQUALS(xpcc::math::mac(offset, (int16_t) -32000, (int16_t) 32000), -1024000000 + 1235678);
 }
+
+void
+OperatorTest::testFastInverseSqrt()
+{
+	const float values[] = { 1e-6f, 0.01f, 0.25f, 0.5f, 0.999f, 1.f, 1.001f, 2.f, 3.f, 100.f, 12345.f, 1e8f };
+	for (float x : values)
+	{
+		const float exact = 1.f / std::sqrt(x);
+		TEST_ASSERT_EQUALS_DELTA(xpcc::math::fastInverseSqrt(x), exact, exact * 5e-6f);
+	}
+	
+	for (float x = 0.5f; x < 2.f; x += 0.001f)
+	{
+		const float exact = 1.f / std::sqrt(x);
+		TEST_ASSERT_EQUALS_DELTA(xpcc::math::fastInverseSqrt(x), exact, exact * 5e-6f);
+	}
+}
@@ -41,4 +41,7 @@ public:
 	
 	void
 	testMultiplyAccumulate();
+	
+	void
+	testFastInverseSqrt();
 };
@@ -32,6 +32,7 @@
 #define XPCC_PT__MACROS_HPP
 
 #include <xpcc/processing/resumable.hpp>
+#include <xpcc/debug/profiler/profiler.hpp>
 
 /**
  * Declare start of protothread
@@ -41,6 +42,7 @@
  * \hideinitializer
  */
 #define PT_BEGIN() \
+	XPCC_PROFILE_SCOPE(this->ptProfile); \
 	switch (this->ptState) { \
 		case 0:
 
@@ -32,6 +32,7 @@
 #define XPCC_PT__THREAD_HPP
 
 #include <stdint.h>
+#include <xpcc/debug/profiler/profiler.hpp>
 #include "macros.hpp"
 
 namespace xpcc
@@ -102,8 +103,11 @@ namespace xpcc
 		 * For other examples take a look in the \c examples folder in the XPCC
 		 * root folder.
 		 *
-		 * \warning	The names \c ptState and \c ptYield are reserved and may not
-		 * 			be used as variables or function names!
+		 * If \c XPCC__PROFILER is enabled, the execution time of every call
+		 * to run() is recorded in \c ptProfile, see xpcc::profiler.
+		 *
+		 * \warning	The names \c ptState, \c ptYield and \c ptProfile are
+		 * 			reserved and may not be used as variables or function names!
 		 *
 		 * \ingroup	protothread
 		 */
@@ -189,6 +193,12 @@ namespace xpcc
 			 */
 			PtState ptState;
 			/// @endcond
+
+#if XPCC__PROFILER
+		public:
+			/// Execution time statistics of run()
+			xpcc::profiler::Record ptProfile;
+#endif
 		};
 	}
 }
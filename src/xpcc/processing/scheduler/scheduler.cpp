@@ -40,9 +40,10 @@ xpcc::Scheduler::Scheduler() :
 void
 xpcc::Scheduler::scheduleTask(Task& task,
 		uint16_t period,
-		Priority priority)
+		Priority priority,
+		const char *name)
 {
-	TaskListItem *item = new TaskListItem(task, period, priority);
+	TaskListItem *item = new TaskListItem(task, period, priority, name);
 	
 	if (taskList == 0) {
 		taskList = item;
@@ -36,6 +36,8 @@
 #include <xpcc/architecture/utils.hpp>
 #include <xpcc/architecture/driver/accessor.hpp>
 #include <xpcc/architecture/driver/atomic/lock.hpp>		// for Scheduler::scheduleInterrupt()
+#include <xpcc/debug/profiler/profiler.hpp>
+#include <xpcc/debug/trace/trace.hpp>
 
 namespace xpcc
 {
@@ -50,6 +52,15 @@ namespace xpcc
 	 *
 	 * \image	html	scheduler.png
 	 *
+	 * In hosted simulations the schedule() method can be called from the
+	 * tick handler of xpcc::SimulationClock to run the tasks in virtual time.
+	 *
+	 * If \c XPCC__PROFILER is enabled, the execution time of every task
+	 * is recorded, see xpcc::profiler. If \c XPCC__TRACE is enabled, the
+	 * start and end of every task execution is traced in the
+	 * \c Context category, identified by the lower 16 bits of the task
+	 * address.
+	 *
 	 * \warning	Works for ATmega, but currently not for the ATxmega!
 	 *
 	 * \author	Fabian Greif
@@ -73,10 +84,15 @@ namespace xpcc
 	public:
 		Scheduler();
 
+		/**
+		 * \param	name	used to identify the task in the profiler,
+		 * 					ignored if profiling is disabled
+		 */
 		void
 		scheduleTask(Task& task,
 					 uint16_t period,
-					 Priority priority = 127);
+					 Priority priority = 127,
+					 const char *name = nullptr);
 
 		// TODO	Implement this function
 		/*bool
@@ -93,11 +109,16 @@ namespace xpcc
 		{
 			TaskListItem(Task& task,
 						 uint16_t period,
-						 Priority priority) :
+						 Priority priority,
+						 const char *name) :
 				nextTask(0), nextReady(0), task(task),
 				period(period), time(period), priority(priority),
 				state(WAITING)
+#if XPCC__PROFILER
+				, profile(name)
+#endif
 			{
+				(void) name;
 			}
 
 			TaskListItem *nextTask;
@@ -114,6 +135,9 @@ namespace xpcc
 				WAITING
 			} state;
 			/// @endcond
+#if XPCC__PROFILER
+			xpcc::profiler::Record profile;
+#endif
 		};
 
 		TaskListItem *taskList;
@@ -102,7 +102,10 @@ xpcc::Scheduler::scheduleInterupt()
 			
 			// the actual execution of the task happens with interrupts
 			// enabled
+			XPCC_PROFILE_SCOPE(item->profile);
+			XPCC_TRACE_BEGIN(xpcc::trace::Category::Context, uint16_t(reinterpret_cast<uintptr_t>(&item->task)));
 			item->task.run();
+			XPCC_TRACE_END(xpcc::trace::Category::Context, uint16_t(reinterpret_cast<uintptr_t>(&item->task)));
 		}
 		currentPriority = 0;
 		item->state = TaskListItem::WAITING;
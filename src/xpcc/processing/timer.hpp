@@ -16,3 +16,4 @@
 #include "timer/timestamp.hpp"
 #include "timer/timeout.hpp"
 #include "timer/periodic_timer.hpp"
+#include "timer/monitored_periodic_timer.hpp"
@@ -0,0 +1,110 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_MONITORED_PERIODIC_TIMER_HPP
+#define XPCC_MONITORED_PERIODIC_TIMER_HPP
+
+#include "periodic_timer.hpp"
+
+namespace xpcc
+{
+
+/**
+ * Periodic software timer which records jitter and overrun statistics.
+ *
+ * This class behaves exactly like GenericPeriodicTimer, but additionally
+ * records the lateness of every execution, which is the time between
+ * the period deadline and the call to `execute()` which returned `true`.
+ * This allows validating the real-time behavior of periodic code:
+ *
+ * @code
+ * xpcc::MonitoredPeriodicTimer timer(1);
+ *
+ * if (timer.execute())
+ * {
+ *     controlLoop();
+ * }
+ * ...
+ * XPCC_LOG_INFO << "max lateness: " << timer.getMaximumLateness()
+ *               << " overruns: " << timer.getOverruns() << xpcc::endl;
+ * @endcode
+ *
+ * A period counts as overrun, if its deadline passed without `execute()`
+ * being called, so that it was either skipped or had to be caught up.
+ *
+ * @see		GenericPeriodicTimer
+ *
+ * @tparam	Clock
+ * 		Used clock which inherits from xpcc::Clock, may have a variable timebase.
+ * @tparam	TimestampType
+ * 		Used timestamp which is compatible with the chosen Clock.
+ *
+ * @ingroup	software_timer
+ */
+template< class Clock, typename TimestampType = xpcc::Timestamp >
+class GenericMonitoredPeriodicTimer : public GenericPeriodicTimer<Clock, TimestampType>
+{
+public:
+	typedef typename TimestampType::Type Type;
+
+public:
+	/// Create and start the timer
+	GenericMonitoredPeriodicTimer(const TimestampType period,
+			PeriodicTimerPolicy policy = PeriodicTimerPolicy::Skip);
+
+	/// @return `true` exactly once during each period and record its lateness
+	bool
+	execute();
+
+	/// Reset all statistics
+	void
+	resetStatistics();
+
+
+	/// @return the number of recorded executions
+	inline uint32_t
+	getExecutions() const;
+
+	/// @return the number of missed periods
+	inline uint32_t
+	getOverruns() const;
+
+	/// @return the minimum lateness of all executions, or 0 if none were recorded
+	inline Type
+	getMinimumLateness() const;
+
+	/// @return the maximum lateness of all executions
+	inline Type
+	getMaximumLateness() const;
+
+	/// @return the mean lateness of all executions
+	Type
+	getMeanLateness() const;
+
+private:
+	uint64_t latenessSum;
+	uint32_t executions;
+	uint32_t overruns;
+	Type latenessMinimum;
+	Type latenessMaximum;
+};
+
+/// Monitored periodic software timer for up to 24 days with millisecond resolution.
+/// @ingroup	software_timer
+using MonitoredPeriodicTimer        = GenericMonitoredPeriodicTimer< ::xpcc::Clock, Timestamp>;
+
+/// Monitored periodic software timer for up to 35 minutes with microsecond resolution.
+/// @ingroup	software_timer
+using MonitoredPrecisePeriodicTimer = GenericMonitoredPeriodicTimer< ::xpcc::PreciseClock, Timestamp>;
+
+}	// namespace xpcc
+
+#include "monitored_periodic_timer_impl.hpp"
+
+#endif // XPCC_MONITORED_PERIODIC_TIMER_HPP
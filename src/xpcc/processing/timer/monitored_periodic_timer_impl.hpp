@@ -0,0 +1,97 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	XPCC_MONITORED_PERIODIC_TIMER_HPP
+#	error	"Don't include this file directly, use 'monitored_periodic_timer.hpp' instead!"
+#endif
+
+template< class Clock, typename TimestampType >
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::GenericMonitoredPeriodicTimer(
+		const TimestampType period, PeriodicTimerPolicy policy) :
+	GenericPeriodicTimer<Clock, TimestampType>(period, policy)
+{
+	resetStatistics();
+}
+
+template< class Clock, typename TimestampType >
+bool
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::execute()
+{
+	// periods that are being caught up were already counted as missed,
+	// when the first late execution happened
+	uint16_t pending = 0;
+	if (this->getPolicy() == PeriodicTimerPolicy::CatchUp and this->getMissedPeriods())
+		pending = this->getMissedPeriods() - 1;
+
+	if (GenericPeriodicTimer<Clock, TimestampType>::execute())
+	{
+		const Type lateness = this->getLateness();
+
+		if (executions == 0 or lateness < latenessMinimum)
+			latenessMinimum = lateness;
+		if (lateness > latenessMaximum)
+			latenessMaximum = lateness;
+		latenessSum += lateness;
+		executions++;
+
+		if (this->getMissedPeriods() > pending)
+			overruns += this->getMissedPeriods() - pending;
+		return true;
+	}
+	return false;
+}
+
+template< class Clock, typename TimestampType >
+void
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::resetStatistics()
+{
+	latenessSum = 0;
+	executions = 0;
+	overruns = 0;
+	latenessMinimum = 0;
+	latenessMaximum = 0;
+}
+
+// ----------------------------------------------------------------------------
+template< class Clock, typename TimestampType >
+uint32_t
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::getExecutions() const
+{
+	return executions;
+}
+
+template< class Clock, typename TimestampType >
+uint32_t
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::getOverruns() const
+{
+	return overruns;
+}
+
+template< class Clock, typename TimestampType >
+typename TimestampType::Type
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::getMinimumLateness() const
+{
+	return latenessMinimum;
+}
+
+template< class Clock, typename TimestampType >
+typename TimestampType::Type
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::getMaximumLateness() const
+{
+	return latenessMaximum;
+}
+
+template< class Clock, typename TimestampType >
+typename TimestampType::Type
+xpcc::GenericMonitoredPeriodicTimer<Clock, TimestampType>::getMeanLateness() const
+{
+	if (executions == 0)
+		return 0;
+	return Type(latenessSum / executions);
+}
@@ -25,6 +25,17 @@ PeriodicTimerState : uint8_t
 	Armed  = 0b100,
 };
 
+/// Behavior of a periodic timer when one or several periods were missed
+/// @ingroup	software_timer
+enum class
+PeriodicTimerPolicy : uint8_t
+{
+	/// Execute once and discard all missed periods
+	Skip = 0,
+	/// Execute once for every missed period in a burst
+	CatchUp = 1,
+};
+
 /**
  * Generic software timeout class for variable timebase and timestamp width.
  *
@@ -71,6 +82,15 @@ Remaining:     +    |0|   +   |     -     |0|  +  | -|  + |0| +| -  |0|+| 0
  * code executions are discarded and will not be cought up.
  * Instead, `execute()` returns `true` once and then reschedules itself
  * for the next period, without any period skewing.
+ * The number of discarded periods is reported by `getMissedPeriods()`.
+ *
+ * With the `PeriodicTimerPolicy::CatchUp` policy, `execute()` instead
+ * returns `true` once for every missed period until the timer has caught
+ * up with the current time.
+ * In both cases the periods are always scheduled against absolute deadlines,
+ * so the timer does not drift, regardless of when `execute()` is polled.
+ * The time between the deadline and the call of `execute()` which returned
+ * `true` is available via `getLateness()`.
  *
  * @warning	Never use this class when a precise timebase is needed!
  *
@@ -99,7 +119,8 @@ class GenericPeriodicTimer
 {
 public:
 	/// Create and start the timer
-	GenericPeriodicTimer(const TimestampType period);
+	GenericPeriodicTimer(const TimestampType period,
+			PeriodicTimerPolicy policy = PeriodicTimerPolicy::Skip);
 
 	/// Restart the timer with the current period.
 	inline void
@@ -132,9 +153,34 @@ public:
 	inline bool
 	isStopped() const;
 
+
+	/// Set the behavior for missed periods
+	inline void
+	setPolicy(PeriodicTimerPolicy policy);
+
+	/// @return the behavior for missed periods
+	inline PeriodicTimerPolicy
+	getPolicy() const;
+
+	/**
+	 * @return the number of periods missed before the last time `execute()`
+	 * 		returned `true`.
+	 * 		For the `Skip` policy these periods were discarded, for the
+	 * 		`CatchUp` policy these periods are still to be executed.
+	 */
+	inline uint16_t
+	getMissedPeriods() const;
+
+	/// @return the time between the deadline and the last time `execute()` returned `true`
+	inline typename TimestampType::Type
+	getLateness() const;
+
 private:
 	TimestampType period;
 	GenericTimeout<Clock, TimestampType> timeout;
+	typename TimestampType::Type lateness;
+	uint16_t missed;
+	PeriodicTimerPolicy policy;
 };
 
 /**
@@ -157,6 +203,16 @@ using ShortPeriodicTimer = GenericPeriodicTimer< ::xpcc::Clock, ShortTimestamp>;
 /// @ingroup	software_timer
 using PeriodicTimer      = GenericPeriodicTimer< ::xpcc::Clock, Timestamp>;
 
+/// Periodic software timer for up to 32 milliseconds with microsecond resolution.
+/// @see	xpcc::PreciseClock
+/// @ingroup	software_timer
+using ShortPrecisePeriodicTimer = GenericPeriodicTimer< ::xpcc::PreciseClock, ShortTimestamp>;
+
+/// Periodic software timer for up to 35 minutes with microsecond resolution.
+/// @see	xpcc::PreciseClock
+/// @ingroup	software_timer
+using PrecisePeriodicTimer      = GenericPeriodicTimer< ::xpcc::PreciseClock, Timestamp>;
+
 }	// namespace
 
 #include "periodic_timer_impl.hpp"
@@ -12,8 +12,9 @@
 #endif
 
 template< class Clock , typename TimestampType >
-xpcc::GenericPeriodicTimer<Clock, TimestampType>::GenericPeriodicTimer(const TimestampType period) :
-	period(period), timeout(period)
+xpcc::GenericPeriodicTimer<Clock, TimestampType>::GenericPeriodicTimer(const TimestampType period,
+		PeriodicTimerPolicy policy) :
+	period(period), timeout(period), lateness(0), missed(0), policy(policy)
 {
 }
 
@@ -60,14 +61,30 @@ xpcc::GenericPeriodicTimer<Clock, TimestampType>::execute()
 	if (timeout.execute())
 	{
 		TimestampType now = Clock::template now<TimestampType>();
+		lateness = (now - timeout.endTime).getTime();
 
-		do
+		timeout.endTime = timeout.endTime + period;
+		missed = 0;
+		if (timeout.endTime <= now and period.getTime())
 		{
-			timeout.endTime = timeout.endTime + period;
+			typedef typename TimestampType::Type Type;
+			const Type periods = (now - timeout.endTime).getTime() / period.getTime() + 1;
+			missed = (periods > 0xffff) ? 0xffff : periods;
+
+			if (policy == PeriodicTimerPolicy::Skip)
+				timeout.endTime = timeout.endTime + TimestampType(Type(periods * period.getTime()));
 		}
-		while(timeout.endTime <= now);
 
+		// with the catch up policy the timeout is still expired
+		// if periods were missed, and will execute again immediately
 		timeout.state = timeout.ARMED;
+
+#if (XPCC__CLOCK_TESTMODE == 1)
+		// report the next deadline to the simulation, which is already
+		// due if periods have to be caught up
+		if (timeout.checkExpiration())
+			SimulationClock::reportRemaining(static_cast<const Clock *>(nullptr), 0);
+#endif
 		return true;
 	}
 	return false;
@@ -80,3 +97,31 @@ xpcc::GenericPeriodicTimer<Clock, TimestampType>::remaining() const
 	return timeout.remaining();
 }
 
+
+template< class Clock, class TimestampType >
+void
+xpcc::GenericPeriodicTimer<Clock, TimestampType>::setPolicy(PeriodicTimerPolicy policy)
+{
+	this->policy = policy;
+}
+
+template< class Clock, class TimestampType >
+xpcc::PeriodicTimerPolicy
+xpcc::GenericPeriodicTimer<Clock, TimestampType>::getPolicy() const
+{
+	return policy;
+}
+
+template< class Clock, class TimestampType >
+uint16_t
+xpcc::GenericPeriodicTimer<Clock, TimestampType>::getMissedPeriods() const
+{
+	return missed;
+}
+
+template< class Clock, class TimestampType >
+typename TimestampType::Type
+xpcc::GenericPeriodicTimer<Clock, TimestampType>::getLateness() const
+{
+	return lateness;
+}
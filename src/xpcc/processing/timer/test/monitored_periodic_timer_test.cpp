@@ -0,0 +1,97 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/processing/timer.hpp>
+#include <xpcc/architecture/driver/clock_dummy.hpp>
+
+#include "monitored_periodic_timer_test.hpp"
+
+void
+MonitoredPeriodicTimerTest::setUp()
+{
+	xpcc::ClockDummy::setTime(0);
+}
+
+void
+MonitoredPeriodicTimerTest::testStatistics()
+{
+	xpcc::GenericMonitoredPeriodicTimer<xpcc::ClockDummy, xpcc::Timestamp> timer(10);
+
+	TEST_ASSERT_EQUALS(timer.getExecutions(), 0u);
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 0u);
+	TEST_ASSERT_EQUALS(timer.getMinimumLateness(), 0u);
+	TEST_ASSERT_EQUALS(timer.getMaximumLateness(), 0u);
+	TEST_ASSERT_EQUALS(timer.getMeanLateness(), 0u);
+
+	xpcc::ClockDummy::setTime(11);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_FALSE(timer.execute());
+
+	xpcc::ClockDummy::setTime(23);
+	TEST_ASSERT_TRUE(timer.execute());
+
+	xpcc::ClockDummy::setTime(35);
+	TEST_ASSERT_TRUE(timer.execute());
+
+	TEST_ASSERT_EQUALS(timer.getExecutions(), 3u);
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 0u);
+	TEST_ASSERT_EQUALS(timer.getMinimumLateness(), 1u);
+	TEST_ASSERT_EQUALS(timer.getMaximumLateness(), 5u);
+	TEST_ASSERT_EQUALS(timer.getMeanLateness(), 3u);
+
+	// miss the deadlines at 40 and 50
+	xpcc::ClockDummy::setTime(62);
+	TEST_ASSERT_TRUE(timer.execute());
+
+	TEST_ASSERT_EQUALS(timer.getExecutions(), 4u);
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 2u);
+	TEST_ASSERT_EQUALS(timer.getMinimumLateness(), 1u);
+	TEST_ASSERT_EQUALS(timer.getMaximumLateness(), 22u);
+	TEST_ASSERT_EQUALS(timer.getMeanLateness(), 7u);
+
+	timer.resetStatistics();
+	TEST_ASSERT_EQUALS(timer.getExecutions(), 0u);
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 0u);
+	TEST_ASSERT_EQUALS(timer.getMaximumLateness(), 0u);
+
+	xpcc::ClockDummy::setTime(74);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getExecutions(), 1u);
+	TEST_ASSERT_EQUALS(timer.getMinimumLateness(), 4u);
+	TEST_ASSERT_EQUALS(timer.getMaximumLateness(), 4u);
+}
+
+void
+MonitoredPeriodicTimerTest::testCatchUpOverruns()
+{
+	xpcc::GenericMonitoredPeriodicTimer<xpcc::ClockDummy, xpcc::Timestamp> timer(10,
+			xpcc::PeriodicTimerPolicy::CatchUp);
+
+	// miss the deadlines at 20 and 30
+	xpcc::ClockDummy::setTime(30);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 2u);
+
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 2u);
+
+	// stall while catching up, missing the deadlines at 40 and 50
+	xpcc::ClockDummy::setTime(50);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 4u);
+
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_FALSE(timer.execute());
+
+	TEST_ASSERT_EQUALS(timer.getExecutions(), 5u);
+	TEST_ASSERT_EQUALS(timer.getOverruns(), 4u);
+	TEST_ASSERT_EQUALS(timer.getMinimumLateness(), 0u);
+	TEST_ASSERT_EQUALS(timer.getMaximumLateness(), 20u);
+}
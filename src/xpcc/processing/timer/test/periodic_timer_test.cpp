@@ -222,3 +222,85 @@ PeriodicTimerTest::testRestart()
 	TEST_ASSERT_TRUE(timer.execute());
 	TEST_ASSERT_FALSE(timer.execute());
 }
+
+void
+PeriodicTimerTest::testMissedPeriods()
+{
+	xpcc::GenericPeriodicTimer<xpcc::ClockDummy, xpcc::Timestamp> timer(10);
+
+	TEST_ASSERT_TRUE(timer.getPolicy() == xpcc::PeriodicTimerPolicy::Skip);
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 0);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 0u);
+
+	xpcc::ClockDummy::setTime(12);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 0);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 2u);
+	TEST_ASSERT_EQUALS(timer.remaining(), 8l);
+
+	// miss the deadlines at 30 and 40
+	xpcc::ClockDummy::setTime(47);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_FALSE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 2);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 27u);
+	TEST_ASSERT_EQUALS(timer.remaining(), 3l);
+
+	// exactly on the next deadline
+	xpcc::ClockDummy::setTime(50);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 0);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 0u);
+	TEST_ASSERT_EQUALS(timer.remaining(), 10l);
+
+	// a late execution exactly on the following deadline skips it
+	xpcc::ClockDummy::setTime(70);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 1);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 10u);
+	TEST_ASSERT_EQUALS(timer.remaining(), 10l);
+}
+
+void
+PeriodicTimerTest::testCatchUp()
+{
+	xpcc::GenericPeriodicTimer<xpcc::ClockDummy, xpcc::ShortTimestamp> timer(10,
+			xpcc::PeriodicTimerPolicy::CatchUp);
+
+	TEST_ASSERT_TRUE(timer.getPolicy() == xpcc::PeriodicTimerPolicy::CatchUp);
+
+	// miss the deadlines at 20 and 30
+	xpcc::ClockDummy::setTime(35);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 2);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 25u);
+	TEST_ASSERT_TRUE(timer.getState() == xpcc::PeriodicTimerState::Expired);
+
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 1);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 15u);
+
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 0);
+	TEST_ASSERT_EQUALS(timer.getLateness(), 5u);
+
+	// caught up, the next deadline is still at 40
+	TEST_ASSERT_FALSE(timer.execute());
+	TEST_ASSERT_TRUE(timer.getState() == xpcc::PeriodicTimerState::Armed);
+	TEST_ASSERT_EQUALS(timer.remaining(), 5l);
+
+	xpcc::ClockDummy::setTime(40);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_FALSE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.remaining(), 10l);
+
+	// switching back to skipping discards the remaining periods
+	xpcc::ClockDummy::setTime(75);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 2);
+	timer.setPolicy(xpcc::PeriodicTimerPolicy::Skip);
+	TEST_ASSERT_TRUE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.getMissedPeriods(), 1);
+	TEST_ASSERT_FALSE(timer.execute());
+	TEST_ASSERT_EQUALS(timer.remaining(), 5l);
+}
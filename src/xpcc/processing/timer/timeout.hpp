@@ -14,6 +14,8 @@
 
 #include "timestamp.hpp"
 
+#include "xpcc_config.hpp"
+
 namespace xpcc
 {
 
@@ -186,6 +188,22 @@ using ShortTimeout = GenericTimeout< ::xpcc::Clock, ShortTimestamp>;
 /// @ingroup	software_timer
 using Timeout      = GenericTimeout< ::xpcc::Clock, Timestamp>;
 
+/**
+ * Software timeout for up to 32 milliseconds with microsecond resolution.
+ *
+ * The same overflow restrictions as for ShortTimeout apply, however, at a
+ * thousand times the rate.
+ *
+ * @see		xpcc::PreciseClock
+ * @ingroup	software_timer
+ */
+using ShortPreciseTimeout = GenericTimeout< ::xpcc::PreciseClock, ShortTimestamp>;
+
+/// Software timeout for up to 35 minutes with microsecond resolution.
+/// @see	xpcc::PreciseClock
+/// @ingroup	software_timer
+using PreciseTimeout      = GenericTimeout< ::xpcc::PreciseClock, Timestamp>;
+
 }	// namespace xpcc
 
 #include "timeout_impl.hpp"
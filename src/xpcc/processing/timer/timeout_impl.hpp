@@ -11,6 +11,10 @@
 #	error	"Don't include this file directly, use 'timeout.hpp' instead!"
 #endif
 
+#if (XPCC__CLOCK_TESTMODE == 1)
+#	include <xpcc/architecture/driver/simulation_clock.hpp>
+#endif
+
 template< class Clock, class TimestampType >
 xpcc::GenericTimeout<Clock, TimestampType>::GenericTimeout() :
 	endTime(0), state(STOPPED)
@@ -107,5 +111,17 @@ template< class Clock, class TimestampType >
 bool
 xpcc::GenericTimeout<Clock, TimestampType>::checkExpiration() const
 {
-	return (state & ARMED) and (Clock::template now<TimestampType>() >= endTime);
+	if (not (state & ARMED))
+		return false;
+
+	const TimestampType now = Clock::template now<TimestampType>();
+	if (now >= endTime)
+		return true;
+
+#if (XPCC__CLOCK_TESTMODE == 1)
+	// allows the simulation to jump to the next deadline
+	SimulationClock::reportRemaining(static_cast<const Clock *>(nullptr),
+			(endTime - now).getTime());
+#endif
+	return false;
 }
@@ -9,6 +9,8 @@
 
 #include "color.hpp"
 
+#include <xpcc/architecture/driver/accessor/flash.hpp>
+
 // ----------------------------------------------------------------------------
 namespace xpcc {
 namespace color {
@@ -16,8 +18,18 @@ template<> template<>
 void
 HsvT<uint8_t>::toRgb(RgbT<uint8_t>* color) const
 {
-	uint16_t vs = value * saturation;
-	uint16_t h6 = 6 * hue;
+	*color = hsvToRgb(*this);
+}
+} // namespace color
+} // namespace xpcc
+
+// ----------------------------------------------------------------------------
+xpcc::color::Rgb
+xpcc::color::hsvToRgb(const Hsv& color)
+{
+	const uint8_t value = color.value;
+	uint16_t vs = value * color.saturation;
+	uint16_t h6 = 6 * color.hue;
 
 	uint8_t p = ((value << 8) - vs) >> 8;
 	uint8_t i = h6 >> 8;
@@ -39,10 +51,139 @@ HsvT<uint8_t>::toRgb(RgbT<uint8_t>* color) const
 		case 4: r = u; g = p; break;
 		case 5: g = p; b = u; break;
 	}
+	return Rgb(r, g, b);
+}
+
+xpcc::color::Hsv
+xpcc::color::rgbToHsv(const Rgb& color)
+{
+	const uint8_t max = xpcc::max(color.red, xpcc::max(color.green, color.blue));
+	const uint8_t min = xpcc::min(color.red, xpcc::min(color.green, color.blue));
+	const uint8_t diff = max - min;
+	if (diff == 0) {
+		return Hsv(0, 0, max);
+	}
+
+	const uint8_t saturation = (uint16_t(diff) * 255 + max / 2) / max;
+
+	// position within the six sectors of the colour circle, 0 to 6 * diff
+	int16_t position;
+	if (max == color.red) {
+		position = int16_t(color.green) - color.blue;
+		if (position < 0) {
+			position += 6 * diff;
+		}
+	}
+	else if (max == color.green) {
+		position = 2 * diff + color.blue - color.red;
+	}
+	else {
+		position = 4 * diff + color.red - color.green;
+	}
 
-	color->red = r;
-	color->green = g;
-	color->blue = b;
+	// rounding to 256 wraps around to red again
+	const uint8_t hue = (uint32_t(position) * 256 + 3 * diff) / (6 * diff);
+	return Hsv(hue, saturation, max);
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::color::hsvToRgb(const Hsv *input, Rgb *output, std::size_t count)
+{
+	for (std::size_t ii = 0; ii < count; ++ii) {
+		output[ii] = hsvToRgb(input[ii]);
+	}
+}
+
+void
+xpcc::color::rgbToHsv(const Rgb *input, Hsv *output, std::size_t count)
+{
+	for (std::size_t ii = 0; ii < count; ++ii) {
+		output[ii] = rgbToHsv(input[ii]);
+	}
+}
+
+void
+xpcc::color::rgbToRgb565(const Rgb *input, uint16_t *output, std::size_t count)
+{
+	for (std::size_t ii = 0; ii < count; ++ii) {
+		output[ii] = rgbToRgb565(input[ii]);
+	}
+}
+
+void
+xpcc::color::rgb565ToRgb(const uint16_t *input, Rgb *output, std::size_t count)
+{
+	for (std::size_t ii = 0; ii < count; ++ii) {
+		output[ii] = rgb565ToRgb(input[ii]);
+	}
+}
+
+void
+xpcc::color::luminance(const Rgb *input, uint8_t *output, std::size_t count)
+{
+	for (std::size_t ii = 0; ii < count; ++ii) {
+		output[ii] = luminance(input[ii]);
+	}
+}
+
+// ----------------------------------------------------------------------------
+namespace
+{
+	// Black body colours from 42553K down to 985K, in steps of 32 mired
+	// starting at 23.5 mired. The steps are aligned to 6600K, where the
+	// approximation changes its formula.
+	FLASH_STORAGE(uint8_t temperatureTable[32 * 3]) =
+	{
+		150, 185, 255,	// 42553 K
+		174, 201, 255,	// 18018 K
+		194, 213, 255,	// 11429 K
+		216, 227, 255,	//  8368 K
+		255, 252, 255,	//  6601 K
+		255, 237, 221,	//  5450 K
+		255, 221, 193,	//  4640 K
+		255, 207, 168,	//  4040 K
+		255, 195, 145,	//  3578 K
+		255, 184, 124,	//  3210 K
+		255, 174, 104,	//  2911 K
+		255, 165,  84,	//  2663 K
+		255, 157,  66,	//  2454 K
+		255, 150,  48,	//  2275 K
+		255, 143,  30,	//  2121 K
+		255, 136,  12,	//  1986 K
+		255, 130,   0,	//  1867 K
+		255, 124,   0,	//  1762 K
+		255, 119,   0,	//  1668 K
+		255, 114,   0,	//  1584 K
+		255, 109,   0,	//  1507 K
+		255, 104,   0,	//  1438 K
+		255, 100,   0,	//  1375 K
+		255,  95,   0,	//  1317 K
+		255,  91,   0,	//  1263 K
+		255,  87,   0,	//  1214 K
+		255,  83,   0,	//  1169 K
+		255,  80,   0,	//  1127 K
+		255,  76,   0,	//  1088 K
+		255,  73,   0,	//  1051 K
+		255,  70,   0,	//  1017 K
+		255,  66,   0,	//   985 K
+	};
+}
+
+xpcc::color::Rgb
+xpcc::color::colorTemperature(uint16_t kelvin)
+{
+	kelvin = xpcc::min(xpcc::max(kelvin, uint16_t(1000)), uint16_t(40000));
+
+	// in half mired, 50 to 2000
+	const uint16_t mired = (uint32_t(2000000) + kelvin / 2) / kelvin;
+	const uint16_t index = (mired - 47) / 64;
+	const uint8_t fraction = (mired - 47) % 64;
+
+	xpcc::accessor::Flash<uint8_t> table(temperatureTable + index * 3);
+	uint8_t rgb[3];
+	for (uint_fast8_t ii = 0; ii < 3; ++ii) {
+		rgb[ii] = (table[ii] * (64 - fraction) + table[ii + 3] * fraction + 32) / 64;
+	}
+	return Rgb(rgb[0], rgb[1], rgb[2]);
 }
-} // namespace color
-} // namespace xpcc
@@ -11,6 +11,7 @@
 #define XPCC_COLOR_HPP
 
 #include <stdint.h>
+#include <cstddef>
 #include <xpcc/io/iostream.hpp>
 #include <xpcc/utils/arithmetic_traits.hpp>
 
@@ -117,6 +118,84 @@ public:
 
 typedef HsvT<>	Hsv;
 
+/**
+ * @name	Integer conversions
+ *
+ * Conversions without floating point arithmetic for controllers without
+ * FPU. The error bounds are verified against floating point conversions
+ * for all input values by the hosted unittests.
+ *
+ * The hue uses the full 8 bit range, 256 corresponds to 360 degree.
+ * The array versions convert whole LED strips or lines of a framebuffer
+ * in one call.
+ */
+///@{
+/// HSV to RGB, at most ±1 off per channel
+Rgb
+hsvToRgb(const Hsv& color);
+
+void
+hsvToRgb(const Hsv *input, Rgb *output, std::size_t count);
+
+/**
+ * RGB to HSV, hue and saturation are rounded.
+ *
+ * Converted back with hsvToRgb() every channel is at most ±3 off.
+ */
+Hsv
+rgbToHsv(const Rgb& color);
+
+void
+rgbToHsv(const Rgb *input, Hsv *output, std::size_t count);
+
+/// RGB888 to RGB565, every channel is rounded to the nearest value
+inline uint16_t
+rgbToRgb565(const Rgb& color)
+{
+	// (x * 31 + 127) / 255 and (x * 63 + 127) / 255 for all 8 bit values
+	return (((color.red * 249U + 1014) >> 11) << 11) |
+			(((color.green * 253U + 505) >> 10) << 5) |
+			((color.blue * 249U + 1014) >> 11);
+}
+
+void
+rgbToRgb565(const Rgb *input, uint16_t *output, std::size_t count);
+
+/// RGB565 to RGB888, full scale stays full scale
+inline Rgb
+rgb565ToRgb(uint16_t color)
+{
+	// rounded (x * 255 / 31) and (x * 255 / 63)
+	return Rgb(((color >> 11) * 527 + 23) >> 6,
+			(((color >> 5) & 0x3f) * 259 + 33) >> 6,
+			((color & 0x1f) * 527 + 23) >> 6);
+}
+
+void
+rgb565ToRgb(const uint16_t *input, Rgb *output, std::size_t count);
+
+/// ITU-R BT.601 luma (0.299 R + 0.587 G + 0.114 B), at most ±1 off
+inline uint8_t
+luminance(const Rgb& color)
+{
+	return (uint32_t(19595) * color.red + uint32_t(38470) * color.green +
+			uint32_t(7471) * color.blue + 0x8000) >> 16;
+}
+
+void
+luminance(const Rgb *input, uint8_t *output, std::size_t count);
+
+/**
+ * Colour of a black body radiator, e.g. to set the white point of RGB LEDs.
+ *
+ * Interpolated from a table of 32 entries in equal mired steps, at most ±4
+ * off the approximation by Tanner Helland. The temperature is limited to
+ * 1000K to 40000K.
+ */
+Rgb
+colorTemperature(uint16_t kelvin);
+///@}
+
 template <typename UnderlyingType>
 IOStream& operator << ( IOStream& os, const color::RgbT<UnderlyingType>& color);
 
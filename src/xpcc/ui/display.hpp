@@ -38,5 +38,12 @@
 #include "display/image.hpp"
 
 #include "display/character_display.hpp"
+#include "display/buffered_character_display.hpp"
 #include "display/graphic_display.hpp"
+#include "display/glyph_cache.hpp"
 #include "display/buffered_graphic_display.hpp"
+#include "display/asynchronous_graphic_display.hpp"
+#include "display/color_graphic_display.hpp"
+#include "display/frame_buffer.hpp"
+#include "display/offscreen_display.hpp"
+#include "display/render_benchmark.hpp"
@@ -0,0 +1,135 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__ASYNCHRONOUS_GRAPHIC_DISPLAY_HPP
+#define XPCC__ASYNCHRONOUS_GRAPHIC_DISPLAY_HPP
+
+#include <xpcc/processing/resumable.hpp>
+#include "buffered_graphic_display.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Buffered display which is updated in the background
+	 *
+	 * The update is split into two steps. startUpdate() takes the changed
+	 * columns of every page and returns immediately. transmit() is a
+	 * resumable function, which sends them page by page through the
+	 * driver's writePage(), e.g. with the non-blocking
+	 * `SpiMaster::transfer()`:
+	 *
+	 * \code
+	 * // main loop
+	 * if (not display.isUpdating())
+	 * {
+	 *     drawNextFrame(display);
+	 *     display.startUpdate();
+	 * }
+	 * display.transmit();
+	 * \endcode
+	 *
+	 * With `DoubleBuffered` the changes are copied into a second buffer by
+	 * startUpdate(), so drawing the next frame overlaps the transmission
+	 * of the current one. Otherwise every page is copied just before it is
+	 * sent, which needs only `Width` bytes of RAM, but a page may already
+	 * contain parts of the next frame when it is drawn during the update.
+	 *
+	 * In both cases the pages are stored in transmission order, so every
+	 * page is sent with a single transfer.
+	 *
+	 * update() does the same and waits until all changes are sent.
+	 *
+	 * \tparam	Width			Width of the display.
+	 * \tparam	Height			Height of the display, a multiple of 8.
+	 * \tparam	DoubleBuffered	Copy the changes for the transmission.
+	 *
+	 * \ingroup	graphics
+	 */
+	template <uint16_t Width, uint16_t Height, bool DoubleBuffered = false>
+	class AsynchronousGraphicDisplay : public BufferedGraphicDisplay<Width, Height>,
+									   public xpcc::NestedResumable<2>
+	{
+		typedef BufferedGraphicDisplay<Width, Height> Buffer;
+
+	public:
+		AsynchronousGraphicDisplay();
+
+		virtual
+		~AsynchronousGraphicDisplay()
+		{
+		}
+
+		/// Transmit the changes and wait until the display shows them
+		virtual void
+		update();
+
+		/**
+		 * \brief	Start the transmission of the changes
+		 *
+		 * Returns immediately, the changes are sent by transmit().
+		 *
+		 * \return	`false` if the previous update is still running,
+		 * 			nothing was started then.
+		 */
+		bool
+		startUpdate();
+
+		/// `true` until transmit() has sent all changes taken by startUpdate()
+		inline bool
+		isUpdating() const
+		{
+			return this->updating;
+		}
+
+		/**
+		 * \brief	Send the changes taken by startUpdate()
+		 *
+		 * Has to be called until it is finished, either from the main
+		 * loop or with `RF_CALL()` from a protothread. Returns
+		 * immediately if no update is running.
+		 */
+		xpcc::ResumableResult<void>
+		transmit();
+
+	protected:
+		/**
+		 * \brief	Write a part of a page to the display controller
+		 *
+		 * Implemented by the driver as nested resumable function.
+		 *
+		 * \param	page	Page (8 rows) of the display
+		 * \param	column	First column
+		 * \param	data	`length` bytes for the columns, valid until
+		 * 					the function has finished
+		 * \param	length	Number of columns
+		 */
+		virtual xpcc::ResumableResult<void>
+		writePage(uint16_t page, uint16_t column, uint8_t *data, uint16_t length) = 0;
+
+	private:
+		/// Copy the changed columns of a page into the transmit buffer
+		void
+		copyPage(uint16_t page, uint8_t *destination);
+
+		// pages in transmission order, only one for single buffering
+		uint8_t transmitBuffer[DoubleBuffered ? (Height / 8) : 1][Width];
+
+		// columns taken by startUpdate(), first > last if unchanged
+		typename Buffer::ColumnType first[Height / 8];
+		typename Buffer::ColumnType last[Height / 8];
+
+		// page currently sent by transmit()
+		uint16_t page;
+		bool updating;
+	};
+}
+
+#include "asynchronous_graphic_display_impl.hpp"
+
+#endif	// XPCC__ASYNCHRONOUS_GRAPHIC_DISPLAY_HPP
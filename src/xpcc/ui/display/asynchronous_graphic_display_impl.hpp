@@ -0,0 +1,101 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__ASYNCHRONOUS_GRAPHIC_DISPLAY_HPP
+	#error	"Don't include this file directly, use 'asynchronous_graphic_display.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height, bool DoubleBuffered>
+xpcc::AsynchronousGraphicDisplay<Width, Height, DoubleBuffered>::AsynchronousGraphicDisplay() :
+	page(0), updating(false)
+{
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height, bool DoubleBuffered>
+void
+xpcc::AsynchronousGraphicDisplay<Width, Height, DoubleBuffered>::update()
+{
+	// finish a running update first
+	RF_CALL_BLOCKING(this->transmit());
+
+	this->startUpdate();
+	RF_CALL_BLOCKING(this->transmit());
+}
+
+template <uint16_t Width, uint16_t Height, bool DoubleBuffered>
+bool
+xpcc::AsynchronousGraphicDisplay<Width, Height, DoubleBuffered>::startUpdate()
+{
+	if (this->updating) {
+		return false;
+	}
+
+	std::size_t transmitted = 0;
+	for (uint16_t page = 0; page < Height / 8; ++page)
+	{
+		uint16_t firstColumn, lastColumn;
+		if (this->getDirtyColumns(page, firstColumn, lastColumn))
+		{
+			this->first[page] = firstColumn;
+			this->last[page] = lastColumn;
+			transmitted += lastColumn - firstColumn + 1;
+
+			if (DoubleBuffered) {
+				this->copyPage(page, this->transmitBuffer[page]);
+			}
+		}
+		else {
+			this->first[page] = 1;
+			this->last[page] = 0;
+		}
+	}
+
+	// changes from now on belong to the next update
+	this->markClean(transmitted);
+	this->updating = (transmitted > 0);
+	return true;
+}
+
+template <uint16_t Width, uint16_t Height, bool DoubleBuffered>
+xpcc::ResumableResult<void>
+xpcc::AsynchronousGraphicDisplay<Width, Height, DoubleBuffered>::transmit()
+{
+	RF_BEGIN();
+
+	for (this->page = 0; this->updating and this->page < Height / 8; ++this->page)
+	{
+		if (this->first[this->page] > this->last[this->page]) {
+			continue;
+		}
+
+		if (not DoubleBuffered) {
+			this->copyPage(this->page, this->transmitBuffer[0]);
+		}
+
+		RF_CALL(this->writePage(this->page, this->first[this->page],
+				this->transmitBuffer[DoubleBuffered ? this->page : 0] + this->first[this->page],
+				this->last[this->page] - this->first[this->page] + 1));
+	}
+	this->updating = false;
+
+	RF_END();
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height, bool DoubleBuffered>
+void
+xpcc::AsynchronousGraphicDisplay<Width, Height, DoubleBuffered>::copyPage(
+		uint16_t page, uint8_t *destination)
+{
+	for (uint16_t x = this->first[page]; x <= this->last[page]; ++x) {
+		destination[x] = this->display_buffer[x][page];
+	}
+}
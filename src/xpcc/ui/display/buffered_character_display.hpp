@@ -0,0 +1,121 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_BUFFERED_CHARACTER_DISPLAY_HPP
+#define XPCC_BUFFERED_CHARACTER_DISPLAY_HPP
+
+#include <stdint.h>
+#include <xpcc/processing/resumable.hpp>
+#include "character_display.hpp"
+
+namespace xpcc
+{
+
+/**
+ * Character display with a shadow buffer.
+ *
+ * Writing to a character display costs a busy wait or delay for every
+ * byte, so redrawing a menu directly takes tens of milliseconds. This
+ * class writes into a RAM buffer instead and remembers what the
+ * controller currently shows. update() then sends only the characters
+ * which differ, with a cursor command only where the changed characters
+ * are not contiguous.
+ *
+ * update() is a resumable function, which transfers at most one byte per
+ * call and returns while the controller is busy:
+ *
+ * @code
+ * xpcc::Hd44780<Data, Rw, Rs, E> lcd(20, 4);
+ * xpcc::BufferedCharacterDisplay<20, 4> display(lcd);
+ *
+ * display.setCursor(0, 1);
+ * display << "Voltage: " << voltage;
+ *
+ * // main loop
+ * display.update();
+ * @endcode
+ *
+ * The wrapped display must not be written directly, otherwise call
+ * invalidate() afterwards to write all characters again.
+ *
+ * @tparam	Width	characters per line
+ * @tparam	Height	number of lines
+ *
+ * @ingroup	graphics
+ */
+template< uint8_t Width, uint8_t Height >
+class BufferedCharacterDisplay : public CharacterDisplay, public xpcc::NestedResumable<1>
+{
+public:
+	BufferedCharacterDisplay(CharacterDisplay& display);
+
+	/// Write a character into the buffer at the cursor position
+	virtual void
+	writeRaw(char c);
+
+	virtual void
+	setCursor(uint8_t column, uint8_t line);
+
+	/// Fill the buffer with spaces and reset the cursor
+	void
+	clear();
+
+	/// Character in the buffer, not necessarily shown yet
+	inline char
+	getCharacter(uint8_t column, uint8_t line) const
+	{
+		return buffer[line][column];
+	}
+
+	/// `true` if the buffer differs from the display content
+	bool
+	isChanged() const;
+
+	/// Write all characters with the next update, e.g. after a reset of the display
+	inline void
+	invalidate()
+	{
+		valid = false;
+	}
+
+	/**
+	 * Write the changed characters to the display.
+	 *
+	 * Characters changed during the update are written if they have not
+	 * been passed yet, otherwise with the next update.
+	 *
+	 * @return	`true` if any character was written
+	 */
+	xpcc::ResumableResult<bool>
+	update();
+
+private:
+	CharacterDisplay& display;
+
+	char buffer[Height][Width];
+	// what the display controller shows
+	char shown[Height][Width];
+	bool valid;
+
+	// position of the pending update
+	uint8_t updateColumn;
+	uint8_t updateLine;
+	bool rewrite;
+	bool written;
+
+	// address of the display controller, a column of `Width` is unknown
+	uint8_t cursorColumn;
+	uint8_t cursorLine;
+};
+
+}	// namespace xpcc
+
+#include "buffered_character_display_impl.hpp"
+
+#endif	// XPCC_BUFFERED_CHARACTER_DISPLAY_HPP
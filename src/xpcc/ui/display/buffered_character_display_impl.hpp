@@ -0,0 +1,106 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_BUFFERED_CHARACTER_DISPLAY_HPP
+#	error	"Don't include this file directly, use 'buffered_character_display.hpp' instead!"
+#endif
+
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template< uint8_t Width, uint8_t Height >
+xpcc::BufferedCharacterDisplay<Width, Height>::BufferedCharacterDisplay(CharacterDisplay& display) :
+	CharacterDisplay(Width, Height),
+	display(display), valid(false),
+	updateColumn(0), updateLine(0), rewrite(false), written(false),
+	cursorColumn(Width), cursorLine(0)
+{
+	std::memset(buffer, ' ', sizeof(buffer));
+	std::memset(shown, ' ', sizeof(shown));
+}
+
+// ----------------------------------------------------------------------------
+template< uint8_t Width, uint8_t Height >
+void
+xpcc::BufferedCharacterDisplay<Width, Height>::writeRaw(char c)
+{
+	if (this->column < Width and this->line < Height) {
+		this->buffer[this->line][this->column] = c;
+	}
+}
+
+template< uint8_t Width, uint8_t Height >
+void
+xpcc::BufferedCharacterDisplay<Width, Height>::setCursor(uint8_t column, uint8_t line)
+{
+	this->column = column;
+	this->line = line;
+}
+
+template< uint8_t Width, uint8_t Height >
+void
+xpcc::BufferedCharacterDisplay<Width, Height>::clear()
+{
+	std::memset(buffer, ' ', sizeof(buffer));
+	this->setCursor(0, 0);
+}
+
+template< uint8_t Width, uint8_t Height >
+bool
+xpcc::BufferedCharacterDisplay<Width, Height>::isChanged() const
+{
+	return (not valid or std::memcmp(buffer, shown, sizeof(buffer)) != 0);
+}
+
+// ----------------------------------------------------------------------------
+template< uint8_t Width, uint8_t Height >
+xpcc::ResumableResult<bool>
+xpcc::BufferedCharacterDisplay<Width, Height>::update()
+{
+	RF_BEGIN();
+
+	// an invalidate() during the update applies to the next update
+	rewrite = not valid;
+	valid = true;
+	written = false;
+
+	for (updateLine = 0; updateLine < Height; ++updateLine)
+	{
+		for (updateColumn = 0; updateColumn < Width; ++updateColumn)
+		{
+			if (not rewrite and
+				buffer[updateLine][updateColumn] == shown[updateLine][updateColumn]) {
+				continue;
+			}
+
+			// the address increments after every character, so only
+			// the first of several changed characters needs a cursor command
+			if (updateColumn != cursorColumn or updateLine != cursorLine)
+			{
+				RF_WAIT_WHILE(display.isBusy());
+				display.setCursor(updateColumn, updateLine);
+				cursorColumn = updateColumn;
+				cursorLine = updateLine;
+				RF_YIELD();
+			}
+
+			RF_WAIT_WHILE(display.isBusy());
+			shown[updateLine][updateColumn] = buffer[updateLine][updateColumn];
+			display.writeRaw(shown[updateLine][updateColumn]);
+			written = true;
+
+			// after the last column the address does not continue with
+			// the next line on most controllers, `Width` is never matched
+			++cursorColumn;
+			RF_YIELD();
+		}
+	}
+
+	RF_END_RETURN(written);
+}
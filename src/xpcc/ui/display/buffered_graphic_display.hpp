@@ -32,16 +32,62 @@
 #define XPCC__BUFFERED_GRAPHIC_DISPLAY_HPP
 
 #include <stdlib.h>
+#include <cstddef>
+#include <cstring>
+#include <xpcc/utils/template_metaprogramming.hpp>
 #include "graphic_display.hpp"
 
 namespace xpcc
 {
+	/// @cond
+	namespace glcd
+	{
+		namespace raster
+		{
+			// combine the bits of `source` selected by `mask` with `destination`
+			struct Copy
+			{
+				static inline uint8_t
+				apply(uint8_t destination, uint8_t source, uint8_t mask)
+				{ return (destination & ~mask) | (source & mask); }
+			};
+
+			struct Or
+			{
+				static inline uint8_t
+				apply(uint8_t destination, uint8_t source, uint8_t mask)
+				{ return destination | (source & mask); }
+			};
+
+			struct Xor
+			{
+				static inline uint8_t
+				apply(uint8_t destination, uint8_t source, uint8_t mask)
+				{ return destination ^ (source & mask); }
+			};
+
+			struct AndNot
+			{
+				static inline uint8_t
+				apply(uint8_t destination, uint8_t source, uint8_t mask)
+				{ return destination & ~(source & mask); }
+			};
+		}
+	}
+	/// @endcond
+
 	/**
 	 * Base class for graphical displays with a RAM buffer.
 	 *
 	 * Every operation works on the internal RAM buffer, therefore the content
 	 * of the real display is not changed until a call of update().
 	 *
+	 * The buffer keeps track of the changed columns in every page (8 rows).
+	 * Drivers use this to transmit only the changed part of the buffer,
+	 * which for small changes (a counter, a cursor) is a fraction of the
+	 * complete frame. After construction and clear() the whole buffer is
+	 * marked as changed.
+	 *
 	 * \tparam	Width	Width of the display.
 	 * \tparam	Height	Height of the display. Must be a multiple of 8!
 	 *
@@ -58,7 +104,21 @@ namespace xpcc
 		static constexpr uint16_t DisplayBufferWidth = Width;
 		static constexpr uint16_t DisplayBufferHeight = Height / 8;
 
+		typedef typename xpcc::tmp::Select<(Width < 256), uint8_t, uint16_t>::Result ColumnType;
+
 	public:
+		/// Part of the buffer, which has to be transmitted
+		struct Window
+		{
+			uint16_t firstColumn;
+			uint16_t lastColumn;
+			uint16_t firstPage;
+			uint16_t lastPage;
+		};
+
+	public:
+		BufferedGraphicDisplay();
+
 		virtual
 		~BufferedGraphicDisplay()
 		{
@@ -90,14 +150,120 @@ namespace xpcc
 				uint16_t width, uint16_t height,
 				xpcc::accessor::Flash<uint8_t> data);
 
+		/**
+		 * \brief	Combine an image with the buffer
+		 *
+		 * Same format as drawImageRaw(). The image is clipped once, then
+		 * every image byte is shifted into a 16-bit word and written into
+		 * the (up to) two pages it covers.
+		 */
+		void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Flash<uint8_t> data,
+				glcd::RasterOperation operation);
+
+		// Faster version adapted for the RAM buffer
+		virtual void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Ram<uint8_t> data);
+
+		/// Combine an image from RAM with the buffer
+		void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Ram<uint8_t> data,
+				glcd::RasterOperation operation);
+
+		using GraphicDisplay::fillRectangle;
+
+		// Faster version adapted for the RAM buffer
+		virtual void
+		fillRectangle(glcd::Point upperLeft, uint16_t width, uint16_t height);
+
+		/**
+		 * \brief	Combine a filled rectangle with the buffer
+		 *
+		 * The rectangle is clipped once, then every page is updated with
+		 * a single mask for all columns. `Copy` and `Or` set the pixels,
+		 * `Xor` inverts and `AndNot` clears them.
+		 */
+		void
+		fillRectangle(glcd::Point upperLeft, uint16_t width, uint16_t height,
+				glcd::RasterOperation operation);
+
+		/// `true` if the buffer was changed since the last update()
+		bool
+		isDirty() const;
+
+		/// Transmit the complete buffer with the next update()
+		void
+		invalidate();
+
+		/// Number of bytes transmitted by all updates
+		inline uint32_t
+		getBytesTransmitted() const
+		{
+			return this->bytesTransmitted;
+		}
+
+		/// Number of bytes not transmitted, because they were unchanged
+		inline uint32_t
+		getBytesSaved() const
+		{
+			return this->bytesSaved;
+		}
+
+	protected:
+		inline void
+		markDirty(uint16_t column, uint16_t page)
+		{
+			if (column < this->dirtyFirst[page]) {
+				this->dirtyFirst[page] = column;
+			}
+			if (column > this->dirtyLast[page]) {
+				this->dirtyLast[page] = column;
+			}
+		}
+
+		/// Mark the columns [first, last] of a page as changed
+		void
+		markDirty(uint16_t first, uint16_t last, uint16_t page);
+
+		/// Changed columns of a page, returns `false` if the page is unchanged
+		inline bool
+		getDirtyColumns(uint16_t page, uint16_t& first, uint16_t& last) const
+		{
+			first = this->dirtyFirst[page];
+			last = this->dirtyLast[page];
+			return (first <= last);
+		}
+
+		/// Smallest window containing all changes, `false` if there are none
+		bool
+		getDirtyWindow(Window& window) const;
+
+		/**
+		 * \brief	Mark the complete buffer as unchanged
+		 *
+		 * Must be called by the driver when it has started to transmit
+		 * the changes. Changes made while the transfer is running are
+		 * transmitted with the next update.
+		 *
+		 * \param	transmitted		Number of buffer bytes sent to the display
+		 */
+		void
+		markClean(std::size_t transmitted);
+
 	protected:
 		// Faster version adapted for the RAM buffer
 		virtual void
 		drawHorizontalLine(glcd::Point start, uint16_t length);
 
-		// TODO Faster version adapted for the RAM buffer
-		//virtual void
-		//drawVerticalLine(glcd::Point start, uint8_t length);
+		// Faster version adapted for the RAM buffer
+		virtual void
+		drawVerticalLine(glcd::Point start, uint16_t length);
 
 		virtual void
 		setPixel(int16_t x, int16_t y);
@@ -109,6 +275,34 @@ namespace xpcc
 		getPixel(int16_t x, int16_t y);
 
 		uint8_t display_buffer[DisplayBufferWidth][DisplayBufferHeight];
+
+	private:
+		template <typename Operation>
+		void
+		fillPage(uint16_t page, uint16_t first, uint16_t last, uint8_t mask);
+
+		template <typename Accessor>
+		void
+		drawImageOperation(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				Accessor data, glcd::RasterOperation operation);
+
+		template <typename Operation, typename Accessor>
+		void
+		drawImagePages(int16_t x, int16_t y,
+				uint16_t width, uint16_t height, Accessor data);
+
+		// rows of the page inside [y0, y1)
+		static uint8_t
+		getRowMask(int32_t page, int32_t y0, int32_t y1);
+
+	private:
+		// changed columns of every page, first > last if unchanged
+		ColumnType dirtyFirst[DisplayBufferHeight];
+		ColumnType dirtyLast[DisplayBufferHeight];
+
+		uint32_t bytesTransmitted;
+		uint32_t bytesSaved;
 	};
 }
 
@@ -32,16 +32,22 @@
 	#error	"Don't include this file directly, use 'buffered_graphic_display.hpp' instead!"
 #endif
 
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+xpcc::BufferedGraphicDisplay<Width, Height>::BufferedGraphicDisplay() :
+	bytesTransmitted(0), bytesSaved(0)
+{
+	// the content of the display is unknown
+	this->invalidate();
+}
+
 // ----------------------------------------------------------------------------
 template <uint16_t Width, uint16_t Height>
 void
 xpcc::BufferedGraphicDisplay<Width, Height>::clear()
 {
-	for (uint_fast16_t y = 0; y < Height / 8; ++y) {
-		for (uint_fast16_t x = 0; x < Width; ++x) {
-			this->display_buffer[x][y] = 0;
-		}
-	}
+	std::memset(this->display_buffer, 0, sizeof(this->display_buffer));
+	this->invalidate();
 
 	// reset the cursor
 	this->cursor = glcd::Point(0, 0);
@@ -54,27 +60,92 @@ xpcc::BufferedGraphicDisplay<Width, Height>::drawHorizontalLine(
 		glcd::Point start,
 		uint16_t length)
 {
-	const uint16_t y = start.getY() / 8;
+	if (this->foregroundColor == glcd::Color::black()) {
+		this->fillRectangle(start, length, 1, glcd::RasterOperation::Or);
+	}
+	else {
+		this->fillRectangle(start, length, 1, glcd::RasterOperation::AndNot);
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::drawVerticalLine(
+		glcd::Point start,
+		uint16_t length)
+{
+	// same as drawing every pixel with setPixel()
+	this->fillRectangle(start, 1, length, glcd::RasterOperation::Or);
+}
 
-	if (this->foregroundColor == glcd::Color::black())
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::fillRectangle(glcd::Point upperLeft,
+		uint16_t width, uint16_t height)
+{
+	// same as drawing every pixel with setPixel()
+	this->fillRectangle(upperLeft, width, height, glcd::RasterOperation::Or);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::fillRectangle(glcd::Point upperLeft,
+		uint16_t width, uint16_t height, glcd::RasterOperation operation)
+{
+	// clip to the buffer, the end is exclusive
+	int32_t x0 = upperLeft.getX();
+	int32_t y0 = upperLeft.getY();
+	int32_t x1 = x0 + width;
+	int32_t y1 = y0 + height;
+	if (x0 < 0) { x0 = 0; }
+	if (y0 < 0) { y0 = 0; }
+	if (x1 > Width) { x1 = Width; }
+	if (y1 > Height) { y1 = Height; }
+	if (not this->clipRectangle(x0, y0, x1, y1)) {
+		return;
+	}
+
+	const uint16_t firstPage = y0 / 8;
+	const uint16_t lastPage = (y1 - 1) / 8;
+	for (uint_fast16_t page = firstPage; page <= lastPage; ++page)
 	{
-		const uint8_t mask = 1 << (start.getY() & 0x07);
-		for (uint_fast16_t x = start.getX(); x < static_cast<uint16_t>(start.getX() + length); ++x) {
-			if( x < Width && y < Height ) {
-				this->display_buffer[x][y] |= mask;
-			}
+		uint8_t mask = 0xff;
+		if (page == firstPage) {
+			mask &= 0xff << (y0 & 0x07);
 		}
-	}
-	else {
-		const uint8_t mask = ~(1 << (start.getY() & 0x07));
-		for (uint_fast16_t x = start.getX(); x < static_cast<uint16_t>(start.getX() + length); ++x) {
-			if( x < Width && y < Height ) {
-				this->display_buffer[x][y] &= mask;
-			}
+		if (page == lastPage) {
+			mask &= 0xff >> (7 - ((y1 - 1) & 0x07));
+		}
+
+		switch (operation)
+		{
+			case glcd::RasterOperation::Copy:
+			case glcd::RasterOperation::Or:
+				this->template fillPage<glcd::raster::Or>(page, x0, x1 - 1, mask);
+				break;
+			case glcd::RasterOperation::Xor:
+				this->template fillPage<glcd::raster::Xor>(page, x0, x1 - 1, mask);
+				break;
+			case glcd::RasterOperation::AndNot:
+				this->template fillPage<glcd::raster::AndNot>(page, x0, x1 - 1, mask);
+				break;
 		}
 	}
 }
 
+template <uint16_t Width, uint16_t Height>
+template <typename Operation>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::fillPage(uint16_t page,
+		uint16_t first, uint16_t last, uint8_t mask)
+{
+	for (uint_fast16_t x = first; x <= last; ++x) {
+		this->display_buffer[x][page] = Operation::apply(this->display_buffer[x][page], 0xff, mask);
+	}
+	this->markDirty(first, last, page);
+}
+
 // ----------------------------------------------------------------------------
 template <uint16_t Width, uint16_t Height>
 void
@@ -82,30 +153,156 @@ xpcc::BufferedGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
 		uint16_t width, uint16_t height,
 		xpcc::accessor::Flash<uint8_t> data)
 {
-	if ((upperLeft.getY() & 0x07) == 0)
+	// same as drawing every pixel with setPixel() or clearPixel()
+	this->drawImageRaw(upperLeft, width, height, data, glcd::RasterOperation::Copy);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Flash<uint8_t> data,
+		glcd::RasterOperation operation)
+{
+	this->drawImageOperation(upperLeft, width, height, data, operation);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Ram<uint8_t> data)
+{
+	this->drawImageOperation(upperLeft, width, height, data, glcd::RasterOperation::Copy);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Ram<uint8_t> data,
+		glcd::RasterOperation operation)
+{
+	this->drawImageOperation(upperLeft, width, height, data, operation);
+}
+
+template <uint16_t Width, uint16_t Height>
+template <typename Accessor>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::drawImageOperation(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		Accessor data, glcd::RasterOperation operation)
+{
+	switch (operation)
 	{
-		uint16_t row = upperLeft.getY() / 8;
-		uint16_t rowCount = (height + 7) / 8;	// always round up
+		case glcd::RasterOperation::Copy:
+			this->template drawImagePages<glcd::raster::Copy>(
+					upperLeft.getX(), upperLeft.getY(), width, height, data);
+			break;
+		case glcd::RasterOperation::Or:
+			this->template drawImagePages<glcd::raster::Or>(
+					upperLeft.getX(), upperLeft.getY(), width, height, data);
+			break;
+		case glcd::RasterOperation::Xor:
+			this->template drawImagePages<glcd::raster::Xor>(
+					upperLeft.getX(), upperLeft.getY(), width, height, data);
+			break;
+		case glcd::RasterOperation::AndNot:
+			this->template drawImagePages<glcd::raster::AndNot>(
+					upperLeft.getX(), upperLeft.getY(), width, height, data);
+			break;
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+template <typename Operation, typename Accessor>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::drawImagePages(int16_t x, int16_t y,
+		uint16_t width, uint16_t height, Accessor data)
+{
+	// visible part of the image, relative to the buffer
+	int32_t x0 = x;
+	int32_t y0 = y;
+	int32_t x1 = x0 + width;
+	int32_t y1 = y0 + height;
+	if (x0 < 0) { x0 = 0; }
+	if (y0 < 0) { y0 = 0; }
+	if (x1 > Width) { x1 = Width; }
+	if (y1 > Height) { y1 = Height; }
+	if (not this->clipRectangle(x0, y0, x1, y1)) {
+		return;
+	}
+
+	// visible columns of the image
+	const int32_t first = x0 - x;
+	const int32_t end = x1 - x;
+
+	// row k of the image is written into the pages `page + k` and `page + k + 1`
+	const uint8_t shift = y & 0x07;
+	const int16_t page = (y - shift) / 8;
+	const uint16_t rows = (height + 7) / 8;
+
+	for (uint_fast16_t k = 0; k < rows; ++k)
+	{
+		// the last row of the image may be incomplete
+		uint8_t rowMask = 0xff;
+		if (k == rows - 1u and (height & 0x07) != 0) {
+			rowMask = 0xff >> (8 - (height & 0x07));
+		}
+
+		const int32_t lower = int32_t(page) + k;
+		const int32_t upper = lower + 1;
 
-		if ((height & 0x07) == 0)
+		// visible rows of both pages
+		uint16_t mask = uint16_t(rowMask) << shift;
+		mask &= getRowMask(lower, y0, y1) | (uint16_t(getRowMask(upper, y0, y1)) << 8);
+
+		const bool writeLower = ((mask & 0xff) != 0);
+		const bool writeUpper = ((mask >> 8) != 0);
+		if (not writeLower and not writeUpper) {
+			continue;
+		}
+
+		const uint16_t offset = k * width;
+		for (int_fast16_t i = first; i < end; ++i)
 		{
-			for (uint_fast16_t i = 0; i < width; i++)
-			{
-				for (uint_fast16_t k = 0; k < rowCount; k++)
-				{
-					uint16_t x = upperLeft.getX() + i;
-					uint16_t y = k + row;
-
-					if( x < Width && y < Height ) {
-						this->display_buffer[x][y] = data[i + k * width];
-					}
-				}
+			const uint16_t bits = uint16_t(data[offset + i]) << shift;
+			uint8_t *column = this->display_buffer[x + i];
+			if (writeLower) {
+				column[lower] = Operation::apply(column[lower], bits, mask);
+			}
+			if (writeUpper) {
+				column[upper] = Operation::apply(column[upper], bits >> 8, mask >> 8);
 			}
-			return;
+		}
+
+		if (writeLower) {
+			this->markDirty(x + first, x + end - 1, lower);
+		}
+		if (writeUpper) {
+			this->markDirty(x + first, x + end - 1, upper);
 		}
 	}
+}
 
-	GraphicDisplay::drawImageRaw(upperLeft, width, height, data);
+template <uint16_t Width, uint16_t Height>
+uint8_t
+xpcc::BufferedGraphicDisplay<Width, Height>::getRowMask(int32_t page,
+		int32_t y0, int32_t y1)
+{
+	const int32_t top = page * 8;
+	if (y1 <= top or y0 >= top + 8) {
+		return 0;
+	}
+
+	uint8_t mask = 0xff;
+	if (y0 > top) {
+		mask &= 0xff << (y0 - top);
+	}
+	if (y1 < top + 8) {
+		mask &= 0xff >> (top + 8 - y1);
+	}
+	return mask;
 }
 
 // ----------------------------------------------------------------------------
@@ -115,6 +312,7 @@ xpcc::BufferedGraphicDisplay<Width, Height>::setPixel(int16_t x, int16_t y)
 {
 	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
 		this->display_buffer[x][y / 8] |= (1 << (y & 0x07));
+		this->markDirty(x, y / 8);
 	}
 }
 
@@ -124,6 +322,7 @@ xpcc::BufferedGraphicDisplay<Width, Height>::clearPixel(int16_t x, int16_t y)
 {
 	if (static_cast<uint16_t>(x) < Width && static_cast<uint16_t>(y) < Height) {
 		this->display_buffer[x][y / 8] &= ~(1 << (y & 0x07));
+		this->markDirty(x, y / 8);
 	}
 }
 
@@ -138,3 +337,82 @@ xpcc::BufferedGraphicDisplay<Width, Height>::getPixel(int16_t x, int16_t y)
 		return false;
 	}
 }
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+bool
+xpcc::BufferedGraphicDisplay<Width, Height>::isDirty() const
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page) {
+		if (this->dirtyFirst[page] <= this->dirtyLast[page]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::invalidate()
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page) {
+		this->dirtyFirst[page] = 0;
+		this->dirtyLast[page] = Width - 1;
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::markDirty(
+		uint16_t first, uint16_t last, uint16_t page)
+{
+	if (first < this->dirtyFirst[page]) {
+		this->dirtyFirst[page] = first;
+	}
+	if (last > this->dirtyLast[page]) {
+		this->dirtyLast[page] = last;
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+bool
+xpcc::BufferedGraphicDisplay<Width, Height>::getDirtyWindow(Window& window) const
+{
+	window.firstColumn = Width;
+	window.lastColumn = 0;
+	window.firstPage = Height / 8;
+	window.lastPage = 0;
+
+	for (uint_fast16_t page = 0; page < Height / 8; ++page)
+	{
+		if (this->dirtyFirst[page] <= this->dirtyLast[page])
+		{
+			if (window.firstPage > page) {
+				window.firstPage = page;
+			}
+			window.lastPage = page;
+
+			if (this->dirtyFirst[page] < window.firstColumn) {
+				window.firstColumn = this->dirtyFirst[page];
+			}
+			if (this->dirtyLast[page] > window.lastColumn) {
+				window.lastColumn = this->dirtyLast[page];
+			}
+		}
+	}
+
+	return (window.firstPage <= window.lastPage);
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::BufferedGraphicDisplay<Width, Height>::markClean(std::size_t transmitted)
+{
+	for (uint_fast16_t page = 0; page < Height / 8; ++page) {
+		this->dirtyFirst[page] = Width;
+		this->dirtyLast[page] = 0;
+	}
+
+	this->bytesTransmitted += transmitted;
+	this->bytesSaved += static_cast<uint32_t>(Width) * (Height / 8) - transmitted;
+}
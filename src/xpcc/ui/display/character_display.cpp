@@ -38,6 +38,12 @@ xpcc::CharacterDisplay::write(char c)
 	}
 }
 
+bool
+xpcc::CharacterDisplay::isBusy()
+{
+	return false;
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::CharacterDisplay::Writer::write(char c)
@@ -106,6 +106,16 @@ public:
 	void
 	clear();
 
+	/**
+	 * Check if the controller is still busy with the last command.
+	 *
+	 * Used by xpcc::BufferedCharacterDisplay to write only when no
+	 * waiting is necessary. Displays without a busy flag return always
+	 * `false`.
+	 */
+	virtual bool
+	isBusy();
+
 protected:
 	// Interface class for the IOStream
 	class Writer : public IODevice
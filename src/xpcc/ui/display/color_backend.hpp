@@ -0,0 +1,76 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__COLOR_BACKEND_HPP
+#define XPCC__COLOR_BACKEND_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include "pixel_format.hpp"
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Pixel sink of a colour display
+		 *
+		 * Works like the RAM window of most TFT controllers: setWindow()
+		 * selects a rectangle, the following pixels fill it row by row
+		 * from the upper left corner and wrap around at its end.
+		 *
+		 * A driver implements this for its bus (e.g. by writing the
+		 * window registers and streaming the pixels into the memory
+		 * register). fillPixels() can be overridden to use a hardware
+		 * fill, e.g. a register-to-memory DMA transfer.
+		 *
+		 * \see		xpcc::ColorGraphicDisplay
+		 * \see		xpcc::glcd::FrameBuffer
+		 * \ingroup	graphics
+		 */
+		template <typename Format>
+		class ColorBackend
+		{
+		public:
+			typedef typename Format::Type Pixel;
+
+		public:
+			virtual
+			~ColorBackend()
+			{
+			}
+
+			/// Only called with windows inside the display
+			virtual void
+			setWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height) = 0;
+
+			virtual void
+			writePixels(const Pixel *pixels, std::size_t count) = 0;
+
+			/// Write the same pixel `count` times
+			virtual void
+			fillPixels(Pixel pixel, std::size_t count)
+			{
+				Pixel pixels[16];
+				for (uint_fast8_t i = 0; i < 16; ++i) {
+					pixels[i] = pixel;
+				}
+
+				while (count > 16) {
+					this->writePixels(pixels, 16);
+					count -= 16;
+				}
+				this->writePixels(pixels, count);
+			}
+		};
+	}
+}
+
+#endif // XPCC__COLOR_BACKEND_HPP
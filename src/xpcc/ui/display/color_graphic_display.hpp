@@ -0,0 +1,159 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__COLOR_GRAPHIC_DISPLAY_HPP
+#define XPCC__COLOR_GRAPHIC_DISPLAY_HPP
+
+#include "graphic_display.hpp"
+#include "color_backend.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Base class for colour displays
+	 *
+	 * Draws directly into a xpcc::glcd::ColorBackend. Every primitive is
+	 * clipped once, then a single window is set and the pixels are
+	 * streamed into it. A filled rectangle or a character therefore costs
+	 * one window instead of one addressed write per pixel.
+	 *
+	 * Images (and characters) are drawn with the foreground colour for set
+	 * and the background colour for cleared pixels. The colours are given
+	 * as xpcc::glcd::Color and converted into the pixel format.
+	 *
+	 * The backend can be exchanged at runtime, e.g. to draw into an
+	 * off-screen xpcc::glcd::FrameBuffer.
+	 *
+	 * \tparam	Format	Pixel format, see xpcc::glcd::format
+	 *
+	 * \ingroup	graphics
+	 */
+	template <typename Format>
+	class ColorGraphicDisplay : public GraphicDisplay
+	{
+	public:
+		typedef typename Format::Type Pixel;
+
+	public:
+		ColorGraphicDisplay(glcd::ColorBackend<Format>& backend,
+				uint16_t width, uint16_t height);
+
+		inline void
+		setBackend(glcd::ColorBackend<Format>& backend)
+		{
+			this->backend = &backend;
+		}
+
+		inline glcd::ColorBackend<Format>&
+		getBackend()
+		{
+			return *this->backend;
+		}
+
+		virtual uint16_t
+		getWidth() const
+		{
+			return this->width;
+		}
+
+		virtual uint16_t
+		getHeight() const
+		{
+			return this->height;
+		}
+
+		/// Fill the screen with the background colour
+		virtual void
+		clear();
+
+		/// Not used, every operation is written directly to the backend
+		virtual void
+		update()
+		{
+		}
+
+		using GraphicDisplay::fillRectangle;
+
+		virtual void
+		fillRectangle(glcd::Point upperLeft, uint16_t width, uint16_t height);
+
+		/// Fill a rectangle with a pixel value
+		void
+		fillRectangle(glcd::Point upperLeft, uint16_t width, uint16_t height,
+				Pixel pixel);
+
+		// Monochrome image, see GraphicDisplay::drawImageRaw()
+		virtual void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Flash<uint8_t> data);
+
+		virtual void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Ram<uint8_t> data);
+
+		/**
+		 * \brief	Draw a colour image
+		 *
+		 * \p pixels contains `width * height` pixels row by row.
+		 */
+		void
+		drawBitmap(glcd::Point upperLeft, uint16_t width, uint16_t height,
+				const Pixel *pixels);
+
+		inline Pixel
+		getForegroundPixel() const
+		{
+			return Format::fromRgb565(this->foregroundColor.getValue());
+		}
+
+		inline Pixel
+		getBackgroundPixel() const
+		{
+			return Format::fromRgb565(this->backgroundColor.getValue());
+		}
+
+	protected:
+		virtual void
+		drawHorizontalLine(glcd::Point start, uint16_t length);
+
+		virtual void
+		drawVerticalLine(glcd::Point start, uint16_t length);
+
+		virtual void
+		setPixel(int16_t x, int16_t y);
+
+		virtual void
+		clearPixel(int16_t x, int16_t y);
+
+		/// Displays are write only, always `false`
+		virtual bool
+		getPixel(int16_t x, int16_t y);
+
+		/// Clip the rectangle to the screen, `false` if nothing is visible
+		bool
+		clip(int16_t& x, int16_t& y, uint16_t& width, uint16_t& height) const;
+
+		template <typename Accessor>
+		void
+		drawImageWindow(glcd::Point upperLeft,
+				uint16_t width, uint16_t height, Accessor data);
+
+	protected:
+		glcd::ColorBackend<Format> *backend;
+
+		const uint16_t width;
+		const uint16_t height;
+	};
+}
+
+#include "color_graphic_display_impl.hpp"
+
+#endif // XPCC__COLOR_GRAPHIC_DISPLAY_HPP
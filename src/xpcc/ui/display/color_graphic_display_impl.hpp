@@ -0,0 +1,220 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__COLOR_GRAPHIC_DISPLAY_HPP
+	#error	"Don't include this file directly, use 'color_graphic_display.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename Format>
+xpcc::ColorGraphicDisplay<Format>::ColorGraphicDisplay(
+		glcd::ColorBackend<Format>& backend, uint16_t width, uint16_t height) :
+	backend(&backend), width(width), height(height)
+{
+}
+
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::clear()
+{
+	this->backend->setWindow(0, 0, this->width, this->height);
+	this->backend->fillPixels(this->getBackgroundPixel(),
+			std::size_t(this->width) * this->height);
+
+	// reset the cursor
+	this->cursor = glcd::Point(0, 0);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format>
+bool
+xpcc::ColorGraphicDisplay<Format>::clip(int16_t& x, int16_t& y,
+		uint16_t& width, uint16_t& height) const
+{
+	int32_t x0 = x;
+	int32_t y0 = y;
+	int32_t x1 = x0 + width;
+	int32_t y1 = y0 + height;
+	if (x0 < 0) { x0 = 0; }
+	if (y0 < 0) { y0 = 0; }
+	if (x1 > this->width) { x1 = this->width; }
+	if (y1 > this->height) { y1 = this->height; }
+	if (not this->clipRectangle(x0, y0, x1, y1)) {
+		return false;
+	}
+
+	x = x0;
+	y = y0;
+	width = x1 - x0;
+	height = y1 - y0;
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::fillRectangle(glcd::Point upperLeft,
+		uint16_t width, uint16_t height)
+{
+	this->fillRectangle(upperLeft, width, height, this->getForegroundPixel());
+}
+
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::fillRectangle(glcd::Point upperLeft,
+		uint16_t width, uint16_t height, Pixel pixel)
+{
+	int16_t x = upperLeft.getX();
+	int16_t y = upperLeft.getY();
+	if (this->clip(x, y, width, height))
+	{
+		this->backend->setWindow(x, y, width, height);
+		this->backend->fillPixels(pixel, std::size_t(width) * height);
+	}
+}
+
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::drawHorizontalLine(glcd::Point start, uint16_t length)
+{
+	this->fillRectangle(start, length, 1, this->getForegroundPixel());
+}
+
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::drawVerticalLine(glcd::Point start, uint16_t length)
+{
+	this->fillRectangle(start, 1, length, this->getForegroundPixel());
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Flash<uint8_t> data)
+{
+	this->drawImageWindow(upperLeft, width, height, data);
+}
+
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Ram<uint8_t> data)
+{
+	this->drawImageWindow(upperLeft, width, height, data);
+}
+
+template <typename Format>
+template <typename Accessor>
+void
+xpcc::ColorGraphicDisplay<Format>::drawImageWindow(glcd::Point upperLeft,
+		uint16_t width, uint16_t height, Accessor data)
+{
+	int16_t x = upperLeft.getX();
+	int16_t y = upperLeft.getY();
+	uint16_t visibleWidth = width;
+	uint16_t visibleHeight = height;
+	if (not this->clip(x, y, visibleWidth, visibleHeight)) {
+		return;
+	}
+
+	const Pixel foreground = this->getForegroundPixel();
+	const Pixel background = this->getBackgroundPixel();
+
+	// visible part relative to the image
+	const uint16_t firstColumn = x - upperLeft.getX();
+	const uint16_t firstRow = y - upperLeft.getY();
+
+	this->backend->setWindow(x, y, visibleWidth, visibleHeight);
+
+	// the image is stored in pages of 8 rows, the window is filled row
+	// by row, collect the pixels in small chunks
+	Pixel pixels[32];
+	uint_fast8_t count = 0;
+	for (uint16_t row = firstRow; row < firstRow + visibleHeight; ++row)
+	{
+		const uint16_t offset = (row / 8) * width;
+		const uint8_t mask = 1 << (row & 0x07);
+		for (uint16_t column = firstColumn; column < firstColumn + visibleWidth; ++column)
+		{
+			pixels[count++] = (data[offset + column] & mask) ? foreground : background;
+			if (count == 32) {
+				this->backend->writePixels(pixels, count);
+				count = 0;
+			}
+		}
+	}
+	if (count > 0) {
+		this->backend->writePixels(pixels, count);
+	}
+}
+
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::drawBitmap(glcd::Point upperLeft,
+		uint16_t width, uint16_t height, const Pixel *pixels)
+{
+	int16_t x = upperLeft.getX();
+	int16_t y = upperLeft.getY();
+	uint16_t visibleWidth = width;
+	uint16_t visibleHeight = height;
+	if (not this->clip(x, y, visibleWidth, visibleHeight)) {
+		return;
+	}
+
+	const uint16_t firstColumn = x - upperLeft.getX();
+	const uint16_t firstRow = y - upperLeft.getY();
+	pixels += std::size_t(firstRow) * width + firstColumn;
+
+	this->backend->setWindow(x, y, visibleWidth, visibleHeight);
+	if (visibleWidth == width)
+	{
+		// complete rows are contiguous
+		this->backend->writePixels(pixels, std::size_t(width) * visibleHeight);
+	}
+	else
+	{
+		for (uint16_t row = 0; row < visibleHeight; ++row) {
+			this->backend->writePixels(pixels, visibleWidth);
+			pixels += width;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::setPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < this->width && static_cast<uint16_t>(y) < this->height)
+	{
+		this->backend->setWindow(x, y, 1, 1);
+		this->backend->fillPixels(this->getForegroundPixel(), 1);
+	}
+}
+
+template <typename Format>
+void
+xpcc::ColorGraphicDisplay<Format>::clearPixel(int16_t x, int16_t y)
+{
+	if (static_cast<uint16_t>(x) < this->width && static_cast<uint16_t>(y) < this->height)
+	{
+		this->backend->setWindow(x, y, 1, 1);
+		this->backend->fillPixels(this->getBackgroundPixel(), 1);
+	}
+}
+
+template <typename Format>
+bool
+xpcc::ColorGraphicDisplay<Format>::getPixel(int16_t, int16_t)
+{
+	return false;
+}
@@ -33,6 +33,20 @@
  *
  * Various fonts for graphical displays.
  * The fonts are created with the "FontCreator 3.0", see \c tools/font_creator.
+ *
+ * Layout of a font:
+ * - 2 bytes: total size, little endian
+ * - 6 bytes: width, height, hspace, vspace, first character, number
+ *   of characters
+ * - width of every character
+ * - glyphs of all characters, each stored like an image for
+ *   xpcc::GraphicDisplay::drawImageRaw()
+ *
+ * `font_export.py --rle` creates run-length encoded fonts, which are
+ * much smaller for large fonts (e.g. 1379 instead of 3698 bytes for
+ * Numbers46x64). They are marked by the highest bit of the size and
+ * store a 16-bit offset for every glyph in front of the encoded glyphs.
+ * These fonts can only be drawn through a xpcc::glcd::GlyphCache.
  */
 
 #include "font/scripto_narrow.hpp"
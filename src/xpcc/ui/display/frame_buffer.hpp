@@ -0,0 +1,137 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FRAME_BUFFER_HPP
+#define XPCC__FRAME_BUFFER_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include "color_backend.hpp"
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Colour pixels in RAM
+		 *
+		 * Receives the pixels of a xpcc::ColorGraphicDisplay like a
+		 * display controller. Used in two ways:
+		 *
+		 * - As an in-memory panel, e.g. to test drawing code on a hosted
+		 *   target or as shadow of a display without read access.
+		 * - As an off-screen tile: the buffer covers a part of the screen
+		 *   starting at setOrigin(), pixels outside of it are discarded.
+		 *   After drawing, flush() writes the tile with a single window
+		 *   to the real display.
+		 *
+		 * \code
+		 * xpcc::glcd::FrameBuffer<xpcc::glcd::format::Rgb565, 320, 16> tile;
+		 * display.setBackend(tile);
+		 *
+		 * for (int16_t y = 0; y < 240; y += 16)
+		 * {
+		 *     tile.setOrigin(0, y);
+		 *     drawScreen(display);
+		 *     tile.flush(panel);
+		 * }
+		 * \endcode
+		 *
+		 * \ingroup	graphics
+		 */
+		template <typename Format, uint16_t Width, uint16_t Height>
+		class FrameBuffer : public ColorBackend<Format>
+		{
+		public:
+			typedef typename Format::Type Pixel;
+
+		public:
+			FrameBuffer();
+
+			/// Screen position of the upper left pixel of the buffer
+			inline void
+			setOrigin(int16_t x, int16_t y)
+			{
+				this->originX = x;
+				this->originY = y;
+			}
+
+			inline int16_t
+			getOriginX() const
+			{
+				return this->originX;
+			}
+
+			inline int16_t
+			getOriginY() const
+			{
+				return this->originY;
+			}
+
+			/// Set every pixel of the buffer
+			void
+			fill(Pixel pixel);
+
+			/// Pixel at the position relative to the origin
+			inline Pixel
+			getPixel(uint16_t x, uint16_t y) const
+			{
+				return this->buffer[y * Width + x];
+			}
+
+			inline const Pixel*
+			getBuffer() const
+			{
+				return this->buffer;
+			}
+
+			/// Write the buffer with a single window to its origin on a display
+			void
+			flush(ColorBackend<Format>& display) const;
+
+			virtual void
+			setWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+			virtual void
+			writePixels(const Pixel *pixels, std::size_t count);
+
+			virtual void
+			fillPixels(Pixel pixel, std::size_t count);
+
+		private:
+			// Length of the next run of pixels within the current row of the
+			// window and its part [first, end) inside the buffer. Returns
+			// the target of pixel `first` or nullptr, if the run is outside
+			// of the buffer.
+			Pixel*
+			nextRun(std::size_t count, std::size_t& length,
+					std::size_t& first, std::size_t& end);
+
+			Pixel buffer[Width * Height];
+
+			int16_t originX;
+			int16_t originY;
+
+			// current window in screen coordinates
+			uint16_t windowX;
+			uint16_t windowY;
+			uint16_t windowWidth;
+			uint16_t windowHeight;
+
+			// position of the next pixel inside the window
+			uint16_t column;
+			uint16_t row;
+		};
+	}
+}
+
+#include "frame_buffer_impl.hpp"
+
+#endif // XPCC__FRAME_BUFFER_HPP
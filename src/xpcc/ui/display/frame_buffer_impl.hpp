@@ -0,0 +1,129 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__FRAME_BUFFER_HPP
+	#error	"Don't include this file directly, use 'frame_buffer.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height>
+xpcc::glcd::FrameBuffer<Format, Width, Height>::FrameBuffer() :
+	buffer(), originX(0), originY(0),
+	windowX(0), windowY(0), windowWidth(Width), windowHeight(Height),
+	column(0), row(0)
+{
+}
+
+template <typename Format, uint16_t Width, uint16_t Height>
+void
+xpcc::glcd::FrameBuffer<Format, Width, Height>::fill(Pixel pixel)
+{
+	for (std::size_t i = 0; i < std::size_t(Width) * Height; ++i) {
+		this->buffer[i] = pixel;
+	}
+}
+
+template <typename Format, uint16_t Width, uint16_t Height>
+void
+xpcc::glcd::FrameBuffer<Format, Width, Height>::flush(ColorBackend<Format>& display) const
+{
+	display.setWindow(this->originX, this->originY, Width, Height);
+	display.writePixels(this->buffer, std::size_t(Width) * Height);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height>
+void
+xpcc::glcd::FrameBuffer<Format, Width, Height>::setWindow(
+		uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	this->windowX = x;
+	this->windowY = y;
+	this->windowWidth = width;
+	this->windowHeight = height;
+	this->column = 0;
+	this->row = 0;
+}
+
+template <typename Format, uint16_t Width, uint16_t Height>
+typename xpcc::glcd::FrameBuffer<Format, Width, Height>::Pixel*
+xpcc::glcd::FrameBuffer<Format, Width, Height>::nextRun(std::size_t count,
+		std::size_t& length, std::size_t& first, std::size_t& end)
+{
+	length = this->windowWidth - this->column;
+	if (length > count) {
+		length = count;
+	}
+
+	const int32_t x = int32_t(this->windowX) + this->column - this->originX;
+	const int32_t y = int32_t(this->windowY) + this->row - this->originY;
+
+	// advance the position, wrap around like a display controller
+	this->column += length;
+	if (this->column >= this->windowWidth)
+	{
+		this->column = 0;
+		if (++this->row >= this->windowHeight) {
+			this->row = 0;
+		}
+	}
+
+	// clip the run to the buffer
+	if (y < 0 or y >= Height or x >= Width or x + int32_t(length) <= 0) {
+		return nullptr;
+	}
+	first = (x < 0) ? -x : 0;
+	end = (x + int32_t(length) > Width) ? (Width - x) : length;
+	return &this->buffer[y * Width + x + first];
+}
+
+template <typename Format, uint16_t Width, uint16_t Height>
+void
+xpcc::glcd::FrameBuffer<Format, Width, Height>::writePixels(const Pixel *pixels, std::size_t count)
+{
+	if (this->windowWidth == 0 or this->windowHeight == 0) {
+		return;
+	}
+
+	while (count > 0)
+	{
+		std::size_t length, first, end;
+		Pixel* target = this->nextRun(count, length, first, end);
+		if (target != nullptr)
+		{
+			for (std::size_t i = first; i < end; ++i) {
+				*target++ = pixels[i];
+			}
+		}
+		pixels += length;
+		count -= length;
+	}
+}
+
+template <typename Format, uint16_t Width, uint16_t Height>
+void
+xpcc::glcd::FrameBuffer<Format, Width, Height>::fillPixels(Pixel pixel, std::size_t count)
+{
+	if (this->windowWidth == 0 or this->windowHeight == 0) {
+		return;
+	}
+
+	while (count > 0)
+	{
+		std::size_t length, first, end;
+		Pixel* target = this->nextRun(count, length, first, end);
+		if (target != nullptr)
+		{
+			for (std::size_t i = first; i < end; ++i) {
+				*target++ = pixel;
+			}
+		}
+		count -= length;
+	}
+}
@@ -0,0 +1,162 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "glyph_cache.hpp"
+
+// header, followed by the width table
+static const uint8_t offsetWidthTable = 8;
+
+// ----------------------------------------------------------------------------
+xpcc::glcd::GlyphCache::GlyphCache(uint8_t *buffer, uint16_t size) :
+	buffer(buffer), size(size), used(0), misses(0),
+	font(), first(0), count(0), rows(0)
+{
+}
+
+void
+xpcc::glcd::GlyphCache::setFont(xpcc::accessor::Flash<uint8_t> font)
+{
+	this->font = font;
+	this->first = font[6];
+	this->count = font[7];
+	this->rows = (font[3] + 7) / 8;
+	this->misses = 0;
+	this->clear();
+}
+
+void
+xpcc::glcd::GlyphCache::clear()
+{
+	for (uint16_t i = 0; i < this->count; ++i) {
+		this->setSlot(i, 0);
+	}
+	this->used = 2 * this->count;
+}
+
+// ----------------------------------------------------------------------------
+uint16_t
+xpcc::glcd::GlyphCache::getSlot(uint8_t index) const
+{
+	return this->buffer[2 * index] | (this->buffer[2 * index + 1] << 8);
+}
+
+void
+xpcc::glcd::GlyphCache::setSlot(uint8_t index, uint16_t offset)
+{
+	this->buffer[2 * index] = offset;
+	this->buffer[2 * index + 1] = offset >> 8;
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::glcd::GlyphCache::getGlyph(uint8_t character, Glyph& glyph)
+{
+	if (!this->font.isValid() or
+		character < this->first or character >= this->first + this->count) {
+		return false;
+	}
+
+	const uint8_t index = character - this->first;
+	const uint8_t width = this->font[offsetWidthTable + index];
+
+	uint16_t offset = this->getSlot(index);
+	if (offset == 0)
+	{
+		if (!this->load(index, width)) {
+			return false;
+		}
+		offset = this->getSlot(index);
+	}
+
+	glyph.data = this->buffer + offset;
+	glyph.width = width;
+	return true;
+}
+
+bool
+xpcc::glcd::GlyphCache::load(uint8_t index, uint8_t width)
+{
+	const uint16_t length = width * this->rows;
+	if (this->used + length > this->size)
+	{
+		// start again with an empty cache
+		this->clear();
+		if (this->used + length > this->size) {
+			return false;
+		}
+	}
+
+	if (isRunLengthEncoded(this->font))
+	{
+		decode(getEncodedGlyph(this->font, index), this->buffer + this->used, length);
+	}
+	else
+	{
+		uint16_t position = offsetWidthTable + this->count;
+		for (uint8_t i = 0; i < index; ++i) {
+			position += this->font[offsetWidthTable + i] * this->rows;
+		}
+		for (uint16_t i = 0; i < length; ++i) {
+			this->buffer[this->used + i] = this->font[position + i];
+		}
+	}
+
+	this->setSlot(index, this->used);
+	this->used += length;
+	this->misses++;
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+uint16_t
+xpcc::glcd::GlyphCache::decode(xpcc::accessor::Flash<uint8_t> data,
+		uint8_t *output, uint16_t length)
+{
+	RunLengthDecoder decoder(data);
+	decoder.read(output, length);
+	return decoder.getPosition();
+}
+
+xpcc::accessor::Flash<uint8_t>
+xpcc::glcd::GlyphCache::getEncodedGlyph(xpcc::accessor::Flash<uint8_t> font,
+		uint8_t index)
+{
+	// glyph data starts after the table of 16-bit offsets
+	const uint8_t count = font[7];
+	const uint16_t dataStart = offsetWidthTable + count;
+	const uint16_t position = font[dataStart + 2 * index] |
+			(font[dataStart + 2 * index + 1] << 8);
+	return xpcc::accessor::Flash<uint8_t>(font.getPointer() +
+			dataStart + 2 * count + position);
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::glcd::RunLengthDecoder::read(uint8_t *output, uint16_t length)
+{
+	for (uint16_t i = 0; i < length; ++i)
+	{
+		if (this->remaining == 0)
+		{
+			const uint8_t control = this->data[this->position++];
+			if (control < 128) {
+				this->remaining = control + 1;
+				this->repeat = false;
+			}
+			else {
+				this->remaining = control - 126;
+				this->repeat = true;
+				this->value = this->data[this->position++];
+			}
+		}
+
+		output[i] = this->repeat ? this->value : this->data[this->position++];
+		this->remaining--;
+	}
+}
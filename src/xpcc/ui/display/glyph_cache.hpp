@@ -0,0 +1,195 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__GLYPH_CACHE_HPP
+#define XPCC__GLYPH_CACHE_HPP
+
+#include <stdint.h>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Glyphs of a font decoded into RAM
+		 *
+		 * Finding a character in a font needs a scan over the width table
+		 * and, for run-length encoded fonts, decoding its data. The cache
+		 * does this once per character and keeps the glyph in the same
+		 * layout as an image (see GraphicDisplay::drawImageRaw()), so
+		 * drawing a character is a single blit from RAM.
+		 *
+		 * When the buffer is full, all glyphs are dropped and the cache
+		 * is filled again. The buffer needs two bytes per character of the
+		 * font for the index plus the size of the used glyphs.
+		 *
+		 * \code
+		 * xpcc::glcd::StaticGlyphCache<512> cache;
+		 * cache.setFont(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8));
+		 * display.setFont(cache);
+		 * \endcode
+		 *
+		 * \see		xpcc::glcd::StaticGlyphCache
+		 * \ingroup	font
+		 */
+		class GlyphCache
+		{
+		public:
+			struct Glyph
+			{
+				const uint8_t *data;
+				uint8_t width;
+			};
+
+		public:
+			/// Select the font, drops all glyphs
+			void
+			setFont(xpcc::accessor::Flash<uint8_t> font);
+
+			inline const xpcc::accessor::Flash<uint8_t>&
+			getFont() const
+			{
+				return this->font;
+			}
+
+			/**
+			 * \brief	Glyph of a character
+			 *
+			 * Decodes the glyph if it is not in the cache.
+			 *
+			 * \return	`false` if the character is not part of the font
+			 * 			or its glyph is larger than the cache.
+			 */
+			bool
+			getGlyph(uint8_t character, Glyph& glyph);
+
+			/// Drop all glyphs
+			void
+			clear();
+
+			/// Number of glyphs decoded since the font was set
+			inline uint16_t
+			getMisses() const
+			{
+				return this->misses;
+			}
+
+			/**
+			 * \brief	Check the encoding of a font
+			 *
+			 * Run-length encoded fonts are marked by the highest bit of the
+			 * size field. Without a cache they are decoded again every time
+			 * a character is drawn.
+			 */
+			static inline bool
+			isRunLengthEncoded(xpcc::accessor::Flash<uint8_t> font)
+			{
+				return (font[1] & 0x80);
+			}
+
+			/**
+			 * \brief	Decode the glyph data of a run-length encoded font
+			 *
+			 * A control byte `n < 128` is followed by `n + 1` literal bytes,
+			 * a control byte `n >= 128` by one byte repeated `n - 126`
+			 * times.
+			 *
+			 * \return	Number of encoded bytes read
+			 */
+			static uint16_t
+			decode(xpcc::accessor::Flash<uint8_t> data, uint8_t *output, uint16_t length);
+
+			/// Encoded data of a glyph of a run-length encoded font
+			static xpcc::accessor::Flash<uint8_t>
+			getEncodedGlyph(xpcc::accessor::Flash<uint8_t> font, uint8_t index);
+
+		protected:
+			GlyphCache(uint8_t *buffer, uint16_t size);
+
+		private:
+			// offset of the glyph in the buffer, 0 if not loaded
+			uint16_t
+			getSlot(uint8_t index) const;
+
+			void
+			setSlot(uint8_t index, uint16_t offset);
+
+			bool
+			load(uint8_t index, uint8_t width);
+
+			uint8_t *const buffer;
+			const uint16_t size;
+			uint16_t used;
+			uint16_t misses;
+
+			xpcc::accessor::Flash<uint8_t> font;
+			uint8_t first;
+			uint8_t count;
+			uint8_t rows;
+		};
+
+		/**
+		 * \brief	Decoder for run-length encoded data in pieces
+		 *
+		 * Same encoding as GlyphCache::decode(), but runs may continue
+		 * over several calls of read(). Used to draw a glyph without a
+		 * cache through a small buffer.
+		 *
+		 * \ingroup	font
+		 */
+		class RunLengthDecoder
+		{
+		public:
+			RunLengthDecoder(xpcc::accessor::Flash<uint8_t> data) :
+				data(data), position(0), remaining(0), repeat(false), value(0)
+			{
+			}
+
+			/// Decode the next `length` bytes
+			void
+			read(uint8_t *output, uint16_t length);
+
+			/// Number of encoded bytes read
+			inline uint16_t
+			getPosition() const
+			{
+				return this->position;
+			}
+
+		private:
+			xpcc::accessor::Flash<uint8_t> data;
+			uint16_t position;
+			// bytes left of the current literal or run
+			uint8_t remaining;
+			bool repeat;
+			uint8_t value;
+		};
+
+		/**
+		 * \brief	Glyph cache with a buffer of `Size` bytes
+		 *
+		 * \ingroup	font
+		 */
+		template <uint16_t Size>
+		class StaticGlyphCache : public GlyphCache
+		{
+		public:
+			StaticGlyphCache() :
+				GlyphCache(storage, Size)
+			{
+			}
+
+		private:
+			uint8_t storage[Size];
+		};
+	}
+}
+
+#endif // XPCC__GLYPH_CACHE_HPP
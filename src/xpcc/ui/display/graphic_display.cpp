@@ -41,8 +41,12 @@ xpcc::GraphicDisplay::GraphicDisplay() :
 	draw(&xpcc::GraphicDisplay::setPixel),
 	foregroundColor(glcd::Color::white()),
 	backgroundColor(glcd::Color::black()),
-	font(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8))
+	font(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8)),
+	glyphCache(0),
+	clipDepth(0)
 {
+	this->clipArea.min = glcd::Point(INT16_MIN, INT16_MIN);
+	this->clipArea.max = glcd::Point(INT16_MAX, INT16_MAX);
 }
 
 // ----------------------------------------------------------------------------
@@ -60,7 +64,12 @@ xpcc::GraphicDisplay::setColor(const glcd::Color& newColor)
 	 * not the way it was implemented above. Maybe check if newColor equals
 	 * backgroundColor.
 	 * */
-	draw = &xpcc::GraphicDisplay::setPixel;
+	if (this->isClipped()) {
+		draw = &xpcc::GraphicDisplay::setClippedPixel;
+	}
+	else {
+		draw = &xpcc::GraphicDisplay::setPixel;
+	}
 	this->foregroundColor = newColor;
 }
 
@@ -70,6 +79,55 @@ xpcc::GraphicDisplay::setBackgroundColor(const glcd::Color& newColor)
 	this->backgroundColor = newColor;
 }
 
+// ----------------------------------------------------------------------------
+bool
+xpcc::GraphicDisplay::pushClip(glcd::Point upperLeft, uint16_t width, uint16_t height)
+{
+	if (this->clipDepth >= ClipStackSize) {
+		return false;
+	}
+	this->clipStack[this->clipDepth++] = this->clipArea;
+
+	int32_t x0 = upperLeft.getX();
+	int32_t y0 = upperLeft.getY();
+	int32_t x1 = x0 + width;
+	int32_t y1 = y0 + height;
+	if (this->clipRectangle(x0, y0, x1, y1))
+	{
+		this->clipArea.min = glcd::Point(x0, y0);
+		this->clipArea.max = glcd::Point(x1 - 1, y1 - 1);
+	}
+	else {
+		// empty, nothing is visible
+		this->clipArea.min = glcd::Point(INT16_MAX, INT16_MAX);
+		this->clipArea.max = glcd::Point(INT16_MIN, INT16_MIN);
+	}
+
+	this->draw = &xpcc::GraphicDisplay::setClippedPixel;
+	return true;
+}
+
+void
+xpcc::GraphicDisplay::popClip()
+{
+	if (this->clipDepth == 0) {
+		return;
+	}
+	this->clipArea = this->clipStack[--this->clipDepth];
+
+	if (!this->isClipped()) {
+		this->draw = &xpcc::GraphicDisplay::setPixel;
+	}
+}
+
+void
+xpcc::GraphicDisplay::setClippedPixel(int16_t x, int16_t y)
+{
+	if (this->isVisible(x, y)) {
+		this->setPixel(x, y);
+	}
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::GraphicDisplay::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
@@ -322,6 +380,22 @@ void
 xpcc::GraphicDisplay::drawImageRaw(glcd::Point upperLeft,
 		uint16_t width, uint16_t height,
 		xpcc::accessor::Flash<uint8_t> data)
+{
+	this->drawImagePixels(upperLeft, width, height, data);
+}
+
+void
+xpcc::GraphicDisplay::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Ram<uint8_t> data)
+{
+	this->drawImagePixels(upperLeft, width, height, data);
+}
+
+template <typename Accessor>
+void
+xpcc::GraphicDisplay::drawImagePixels(glcd::Point upperLeft,
+		uint16_t width, uint16_t height, Accessor data)
 {
 	uint16_t rows = (height + 7) / 8;
 	for (uint16_t i = 0; i < width; i++)
@@ -335,11 +409,16 @@ xpcc::GraphicDisplay::drawImageRaw(glcd::Point upperLeft,
 			}
 			for (uint16_t j = 0; j < rowHeight; j++)
 			{
-				if (byte & 0x01) {
-					this->setPixel(upperLeft.getX() + i, upperLeft.getY() + k * 8 + j);
-				}
-				else {
-					this->clearPixel(upperLeft.getX() + i, upperLeft.getY() + k * 8 + j);
+				const int16_t x = upperLeft.getX() + i;
+				const int16_t y = upperLeft.getY() + k * 8 + j;
+				if (!this->isClipped() or this->isVisible(x, y))
+				{
+					if (byte & 0x01) {
+						this->setPixel(x, y);
+					}
+					else {
+						this->clearPixel(x, y);
+					}
 				}
 				byte >>= 1;
 			}
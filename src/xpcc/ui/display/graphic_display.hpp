@@ -44,6 +44,8 @@ namespace xpcc
 	/// @ingroup	graphics
 	namespace glcd
 	{
+		class GlyphCache;
+
 		typedef Vector<int16_t, 2> Point;
 
 		// RGB16 (565) Format
@@ -104,6 +106,21 @@ namespace xpcc
 		private:
 			uint16_t color;
 		};
+
+		/**
+		 * How set pixels of a source are combined with the pixels of
+		 * a monochrome buffer.
+		 *
+		 * \see	xpcc::BufferedGraphicDisplay
+		 */
+		enum class
+		RasterOperation : uint8_t
+		{
+			Copy,		///< destination = source
+			Or,			///< destination = destination | source
+			Xor,		///< destination = destination ^ source
+			AndNot,		///< destination = destination & ~source
+		};
 	}
 
 	// TODO
@@ -229,10 +246,37 @@ namespace xpcc
 		//void
 		//setViewport();
 
-		// TODO Set a clipping area
-		// Everything drawn outside this area will be discarded.
-		//void
-		//setClippingWindow();
+		/**
+		 * Restrict drawing to a rectangle.
+		 *
+		 * Everything drawn outside the clipping area is discarded. The
+		 * new area is the intersection with the current one, which is
+		 * saved and restored by popClip(). Up to ClipStackSize areas
+		 * can be nested.
+		 *
+		 * \return	`false` if the stack is full, the clipping area is
+		 * 			not changed then.
+		 */
+		bool
+		pushClip(glcd::Point upperLeft, uint16_t width, uint16_t height);
+
+		/// Restore the clipping area active before the last pushClip()
+		void
+		popClip();
+
+		inline bool
+		isClipped() const
+		{
+			return (this->clipDepth > 0);
+		}
+
+		/// Check if a pixel is inside the clipping area
+		inline bool
+		isVisible(int16_t x, int16_t y) const
+		{
+			return (this->clipArea.min.x <= x and x <= this->clipArea.max.x and
+					this->clipArea.min.y <= y and y <= this->clipArea.max.y);
+		}
 
 		/**
 		 * Draw a pixel in currently active foreground color.
@@ -342,10 +386,16 @@ namespace xpcc
 				uint16_t width, uint16_t height,
 				xpcc::accessor::Flash<uint8_t> data);
 
+		/// Draw an image from RAM, same format as above
+		virtual void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Ram<uint8_t> data);
+
 		/**
 		 * Fill a rectangle.
 		 */
-		void
+		virtual void
 		fillRectangle(glcd::Point upperLeft, uint16_t width, uint16_t height);
 
 		inline void
@@ -373,14 +423,28 @@ namespace xpcc
 		setFont(const uint8_t *newFont)
 		{
 			this->font = xpcc::accessor::asFlash(newFont);
+			this->glyphCache = 0;
 		}
 
 		inline void
 		setFont(const xpcc::accessor::Flash<uint8_t> *font)
 		{
 			this->font = *font;
+			this->glyphCache = 0;
 		}
 
+		/**
+		 * Use the font of a glyph cache.
+		 *
+		 * The characters are drawn from the glyphs decoded into RAM.
+		 * Recommended for run-length encoded fonts, which are decoded
+		 * again for every character otherwise.
+		 *
+		 * \see	xpcc::glcd::GlyphCache
+		 */
+		void
+		setFont(glcd::GlyphCache& cache);
+
 		/**
 		 * Get the height of a character.
 		 */
@@ -392,6 +456,9 @@ namespace xpcc
 
 		/**
 		* Get the width of (null terminated) string.
+		*
+		* Same width as the cursor moves when writing the string,
+		* without drawing anything.
 		*/
 		uint16_t
 		getStringWidth(const char* s) const;
@@ -446,7 +513,44 @@ namespace xpcc
 		void
 		write(char c);
 
+	public:
+		static constexpr uint8_t ClipStackSize = 4;
+
 	protected:
+		/// Clipping area, both corners are inside
+		struct ClipArea
+		{
+			glcd::Point min;
+			glcd::Point max;
+		};
+
+		/**
+		 * Limit a rectangle to the clipping area.
+		 *
+		 * The lower right corner `(x1, y1)` is exclusive.
+		 *
+		 * \return	`false` if nothing is left
+		 */
+		inline bool
+		clipRectangle(int32_t& x0, int32_t& y0, int32_t& x1, int32_t& y1) const
+		{
+			if (x0 < this->clipArea.min.x) { x0 = this->clipArea.min.x; }
+			if (y0 < this->clipArea.min.y) { y0 = this->clipArea.min.y; }
+			if (x1 > int32_t(this->clipArea.max.x) + 1) { x1 = int32_t(this->clipArea.max.x) + 1; }
+			if (y1 > int32_t(this->clipArea.max.y) + 1) { y1 = int32_t(this->clipArea.max.y) + 1; }
+			return (x0 < x1 and y0 < y1);
+		}
+
+		/// Draw callback while a clipping area is active
+		void
+		setClippedPixel(int16_t x, int16_t y);
+
+		/// Draw an image pixel by pixel
+		template <typename Accessor>
+		void
+		drawImagePixels(glcd::Point upperLeft,
+				uint16_t width, uint16_t height, Accessor data);
+
 		/// helper method for drawCircle() and drawEllipse()
 		void
 		drawCircle4(glcd::Point center, int16_t x, int16_t y);
@@ -503,7 +607,12 @@ namespace xpcc
 		glcd::Color foregroundColor;
 		glcd::Color backgroundColor;
 		xpcc::accessor::Flash<uint8_t> font;
+		glcd::GlyphCache *glyphCache;
 		glcd::Point cursor;
+
+		ClipArea clipArea;
+		ClipArea clipStack[ClipStackSize];
+		uint8_t clipDepth;
 	};
 }
 
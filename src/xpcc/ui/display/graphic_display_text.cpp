@@ -29,6 +29,7 @@
 // ----------------------------------------------------------------------------
 
 #include "graphic_display.hpp"
+#include "glyph_cache.hpp"
 
 // ----------------------------------------------------------------------------
 uint8_t
@@ -63,12 +64,19 @@ xpcc::GraphicDisplay::getStringWidth(const char* s, const xpcc::accessor::Flash<
 	const uint8_t offsetWidthTable 	= 8;
 	const uint8_t vspace 			= (*font)[5];
 	const uint8_t first 			= (*font)[6];
+	const uint8_t count 			= (*font)[7];
 
 	uint16_t width = 0;
 
 	while(*s) {
-		width += (*font)[offsetWidthTable + (static_cast<uint8_t>(*s) - first)];
-		width += vspace;
+		const uint8_t character = static_cast<uint8_t>(*s);
+		if (character >= first and character < first + count)
+		{
+			width += (*font)[offsetWidthTable + (character - first)];
+			if (character < 128) {
+				width += vspace;
+			}
+		}
 		s++;
 	}
 
@@ -101,18 +109,46 @@ xpcc::GraphicDisplay::write(char c)
 	}
 	
 	const uint8_t offsetWidthTable = 8;
+	const uint8_t width = font[character - first + offsetWidthTable];
 	
-	uint16_t offset = count + offsetWidthTable;
-	uint8_t position = character - first + offsetWidthTable;
-	const uint8_t usedRows = (height + 7) / 8;	// round up
-	for (uint8_t i = offsetWidthTable; i < position; i++)
+	glcd::GlyphCache::Glyph glyph;
+	if (this->glyphCache != 0 and this->glyphCache->getGlyph(character, glyph))
 	{
-		offset += font[i] * usedRows;
+		this->drawImageRaw(cursor, width, height,
+				xpcc::accessor::Ram<uint8_t>(glyph.data));
+	}
+	else if (!glcd::GlyphCache::isRunLengthEncoded(font))
+	{
+		uint16_t offset = count + offsetWidthTable;
+		uint8_t position = character - first + offsetWidthTable;
+		const uint8_t usedRows = (height + 7) / 8;	// round up
+		for (uint8_t i = offsetWidthTable; i < position; i++)
+		{
+			offset += font[i] * usedRows;
+		}
+		
+		this->drawImageRaw(cursor, width, height,
+				accessor::asFlash(font.getPointer() + offset));
+	}
+	else
+	{
+		// no cache, decode the glyph in pieces of one page
+		glcd::RunLengthDecoder decoder(
+				glcd::GlyphCache::getEncodedGlyph(font, character - first));
+		const uint8_t pieceWidth = 16;
+		uint8_t buffer[pieceWidth];
+		for (uint16_t y = 0; y < height; y += 8)
+		{
+			const uint8_t rowHeight = (height - y < 8) ? (height - y) : 8;
+			for (uint16_t x = 0; x < width; x += pieceWidth)
+			{
+				const uint8_t columns = (width - x < pieceWidth) ? (width - x) : pieceWidth;
+				decoder.read(buffer, columns);
+				this->drawImageRaw(glcd::Point(cursor.getX() + x, cursor.getY() + y),
+						columns, rowHeight, xpcc::accessor::Ram<uint8_t>(buffer));
+			}
+		}
 	}
-	uint8_t width = font[position];
-	
-	this->drawImageRaw(cursor, width, height,
-			accessor::asFlash(font.getPointer() + offset));
 	
 	cursor.setX(cursor.getX() + width);
 	
@@ -132,6 +168,14 @@ xpcc::GraphicDisplay::write(char c)
 	}
 }
 
+// ----------------------------------------------------------------------------
+void
+xpcc::GraphicDisplay::setFont(glcd::GlyphCache& cache)
+{
+	this->font = cache.getFont();
+	this->glyphCache = &cache;
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::GraphicDisplay::Writer::write(char c)
@@ -0,0 +1,172 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__OFFSCREEN_DISPLAY_HPP
+#define XPCC__OFFSCREEN_DISPLAY_HPP
+
+#include <stdint.h>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+#include "buffered_graphic_display.hpp"
+#include "color_graphic_display.hpp"
+#include "frame_buffer.hpp"
+#include "pnm.hpp"
+
+namespace xpcc
+{
+	/**
+	 * \brief	Monochrome display in RAM
+	 *
+	 * Renders exactly like a xpcc::BufferedGraphicDisplay, but update()
+	 * transmits nothing. Used to run drawing code without hardware or a
+	 * windowing system, e.g. in unit tests and benchmarks on a hosted
+	 * target.
+	 *
+	 * The content can be written as PBM image and compared with a golden
+	 * image, see xpcc::glcd::pnm:
+	 * \code
+	 * xpcc::OffscreenDisplay<128, 64> display;
+	 * drawScreen(display);
+	 *
+	 * // number of differing pixels or -1 if the image does not fit
+	 * int32_t difference = display.compareSnapshot(golden, sizeof(golden));
+	 * if (difference != 0) {
+	 *     display.writeSnapshot(file);
+	 * }
+	 * \endcode
+	 *
+	 * \tparam	Width	Width of the display.
+	 * \tparam	Height	Height of the display. Must be a multiple of 8!
+	 *
+	 * \ingroup	graphics
+	 */
+	template <uint16_t Width, uint16_t Height>
+	class OffscreenDisplay : public BufferedGraphicDisplay<Width, Height>
+	{
+	public:
+		/// Starts with a cleared buffer
+		OffscreenDisplay();
+
+		/// Only marks the buffer as unchanged
+		virtual void
+		update();
+
+		/// `true` if the pixel is set (black)
+		inline bool
+		isSet(int16_t x, int16_t y)
+		{
+			return this->getPixel(x, y);
+		}
+
+		/// Number of update() calls
+		inline uint32_t
+		getUpdates() const
+		{
+			return this->updates;
+		}
+
+		/// Write the content as binary PBM image (`P4`)
+		void
+		writeSnapshot(IODevice& device) const;
+
+		/**
+		 * \brief	Compare the content with an image
+		 *
+		 * Every format of xpcc::glcd::pnm is accepted, pixels of colour
+		 * images are set if they are darker than mid grey.
+		 *
+		 * \return	Number of differing pixels, -1 if the image is invalid,
+		 * 			too short or has another size than the display.
+		 */
+		int32_t
+		compareSnapshot(const uint8_t *image, std::size_t size);
+
+		inline int32_t
+		compareSnapshot(const char *image, std::size_t size)
+		{
+			return this->compareSnapshot(
+					reinterpret_cast<const uint8_t *>(image), size);
+		}
+
+	private:
+		uint32_t updates;
+	};
+
+	/**
+	 * \brief	Colour display in RAM
+	 *
+	 * A xpcc::ColorGraphicDisplay drawing into its own
+	 * xpcc::glcd::FrameBuffer. The content can be written as PPM image
+	 * and compared with a golden image, see xpcc::OffscreenDisplay.
+	 *
+	 * \code
+	 * xpcc::OffscreenColorDisplay<xpcc::glcd::format::Rgb565, 320, 240> display;
+	 * \endcode
+	 *
+	 * \tparam	Format	Pixel format, see xpcc::glcd::format
+	 *
+	 * \ingroup	graphics
+	 */
+	template <typename Format, uint16_t Width, uint16_t Height>
+	class OffscreenColorDisplay : public ColorGraphicDisplay<Format>
+	{
+	public:
+		typedef typename Format::Type Pixel;
+
+	public:
+		OffscreenColorDisplay();
+
+		inline const glcd::FrameBuffer<Format, Width, Height>&
+		getFrameBuffer() const
+		{
+			return this->frameBuffer;
+		}
+
+		inline Pixel
+		getPixelValue(uint16_t x, uint16_t y) const
+		{
+			return this->frameBuffer.getPixel(x, y);
+		}
+
+		/// Write the content as binary PPM image (`P6`)
+		void
+		writeSnapshot(IODevice& device) const;
+
+		/**
+		 * \brief	Compare the content with an image
+		 *
+		 * \param	tolerance	Maximum difference of every colour channel,
+		 * 						e.g. to compare an Rgb565 display with
+		 * 						a 24-bit image.
+		 *
+		 * \return	Number of differing pixels, -1 if the image is invalid,
+		 * 			too short or has another size than the display.
+		 */
+		int32_t
+		compareSnapshot(const uint8_t *image, std::size_t size,
+				uint8_t tolerance = 0) const;
+
+		inline int32_t
+		compareSnapshot(const char *image, std::size_t size,
+				uint8_t tolerance = 0) const
+		{
+			return this->compareSnapshot(
+					reinterpret_cast<const uint8_t *>(image), size, tolerance);
+		}
+
+	private:
+		glcd::FrameBuffer<Format, Width, Height> frameBuffer;
+	};
+}
+
+#include "offscreen_display_impl.hpp"
+
+#endif // XPCC__OFFSCREEN_DISPLAY_HPP
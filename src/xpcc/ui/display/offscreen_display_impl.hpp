@@ -0,0 +1,135 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__OFFSCREEN_DISPLAY_HPP
+	#error	"Don't include this file directly, use 'offscreen_display.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+xpcc::OffscreenDisplay<Width, Height>::OffscreenDisplay() :
+	updates(0)
+{
+	std::memset(this->display_buffer, 0, sizeof(this->display_buffer));
+}
+
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::OffscreenDisplay<Width, Height>::update()
+{
+	++this->updates;
+	this->markClean(0);
+}
+
+// ----------------------------------------------------------------------------
+template <uint16_t Width, uint16_t Height>
+void
+xpcc::OffscreenDisplay<Width, Height>::writeSnapshot(IODevice& device) const
+{
+	glcd::pnm::writeHeader(device, '4', Width, Height);
+
+	// rows from the top, eight pixels per byte with the leftmost in the MSB
+	for (uint16_t y = 0; y < Height; ++y)
+	{
+		const uint8_t bit = 1 << (y & 0x07);
+		for (uint16_t x = 0; x < Width; x += 8)
+		{
+			uint8_t byte = 0;
+			for (uint8_t i = 0; i < 8 and (x + i) < Width; ++i)
+			{
+				if (this->display_buffer[x + i][y / 8] & bit) {
+					byte |= (0x80 >> i);
+				}
+			}
+			device.write(char(byte));
+		}
+	}
+}
+
+template <uint16_t Width, uint16_t Height>
+int32_t
+xpcc::OffscreenDisplay<Width, Height>::compareSnapshot(
+		const uint8_t *image, std::size_t size)
+{
+	glcd::pnm::Reader reader(image, size);
+	if (not reader.isValid() or
+			reader.getWidth() != Width or reader.getHeight() != Height) {
+		return -1;
+	}
+
+	int32_t differences = 0;
+	color::Rgb pixel;
+	for (uint16_t y = 0; y < Height; ++y)
+	{
+		for (uint16_t x = 0; x < Width; ++x)
+		{
+			if (not reader.read(pixel)) {
+				return -1;
+			}
+			const bool black = (uint16_t(pixel.red) + pixel.green + pixel.blue) < 3 * 128;
+			if (black != this->isSet(x, y)) {
+				++differences;
+			}
+		}
+	}
+	return differences;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Format, uint16_t Width, uint16_t Height>
+xpcc::OffscreenColorDisplay<Format, Width, Height>::OffscreenColorDisplay() :
+	ColorGraphicDisplay<Format>(frameBuffer, Width, Height)
+{
+}
+
+template <typename Format, uint16_t Width, uint16_t Height>
+void
+xpcc::OffscreenColorDisplay<Format, Width, Height>::writeSnapshot(
+		IODevice& device) const
+{
+	glcd::pnm::writeHeader(device, '6', Width, Height);
+
+	const Pixel *pixel = this->frameBuffer.getBuffer();
+	for (std::size_t i = 0; i < std::size_t(Width) * Height; ++i)
+	{
+		const color::Rgb rgb = Format::toRgb(*pixel++);
+		device.write(char(rgb.red));
+		device.write(char(rgb.green));
+		device.write(char(rgb.blue));
+	}
+}
+
+template <typename Format, uint16_t Width, uint16_t Height>
+int32_t
+xpcc::OffscreenColorDisplay<Format, Width, Height>::compareSnapshot(
+		const uint8_t *image, std::size_t size, uint8_t tolerance) const
+{
+	glcd::pnm::Reader reader(image, size);
+	if (not reader.isValid() or
+			reader.getWidth() != Width or reader.getHeight() != Height) {
+		return -1;
+	}
+
+	int32_t differences = 0;
+	const Pixel *buffer = this->frameBuffer.getBuffer();
+	color::Rgb expected;
+	for (std::size_t i = 0; i < std::size_t(Width) * Height; ++i)
+	{
+		if (not reader.read(expected)) {
+			return -1;
+		}
+		const color::Rgb actual = Format::toRgb(buffer[i]);
+		if (std::abs(int16_t(actual.red) - expected.red) > tolerance or
+				std::abs(int16_t(actual.green) - expected.green) > tolerance or
+				std::abs(int16_t(actual.blue) - expected.blue) > tolerance) {
+			++differences;
+		}
+	}
+	return differences;
+}
@@ -0,0 +1,119 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__PIXEL_FORMAT_HPP
+#define XPCC__PIXEL_FORMAT_HPP
+
+#include <stdint.h>
+#include <xpcc/ui/color.hpp>
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Pixel formats of colour displays
+		 *
+		 * Every format defines the native pixel `Type` and the conversion
+		 * from and to xpcc::color::Rgb. `fromRgb565()` converts the value
+		 * of a xpcc::glcd::Color. The conversions are the rounding ones of
+		 * xpcc::color, so a display and a colour buffer agree.
+		 *
+		 * \see		xpcc::ColorGraphicDisplay
+		 * \ingroup	graphics
+		 */
+		namespace format
+		{
+			/// 16-bit colour, 5 bits red, 6 bits green, 5 bits blue
+			struct Rgb565
+			{
+				typedef uint16_t Type;
+
+				static inline Type
+				fromRgb(uint8_t red, uint8_t green, uint8_t blue)
+				{
+					return color::rgbToRgb565(color::Rgb(red, green, blue));
+				}
+
+				static constexpr Type
+				fromRgb565(uint16_t color)
+				{
+					return color;
+				}
+
+				static inline color::Rgb
+				toRgb(Type pixel)
+				{
+					return color::rgb565ToRgb(pixel);
+				}
+			};
+
+			/// 24-bit colour, stored as 0x00RRGGBB
+			struct Rgb888
+			{
+				typedef uint32_t Type;
+
+				static constexpr Type
+				fromRgb(uint8_t red, uint8_t green, uint8_t blue)
+				{
+					return (uint32_t(red) << 16) | (uint32_t(green) << 8) | blue;
+				}
+
+				static inline Type
+				fromRgb565(uint16_t color)
+				{
+					const color::Rgb rgb = Rgb565::toRgb(color);
+					return fromRgb(rgb.red, rgb.green, rgb.blue);
+				}
+
+				static inline color::Rgb
+				toRgb(Type pixel)
+				{
+					return color::Rgb(pixel >> 16, pixel >> 8, pixel);
+				}
+			};
+
+			/// 8-bit luminance (grey scale)
+			struct L8
+			{
+				typedef uint8_t Type;
+
+				/// ITU-R BT.601 luma, see xpcc::color::luminance()
+				static inline Type
+				fromRgb(uint8_t red, uint8_t green, uint8_t blue)
+				{
+					return color::luminance(color::Rgb(red, green, blue));
+				}
+
+				static inline Type
+				fromRgb565(uint16_t color)
+				{
+					const color::Rgb rgb = Rgb565::toRgb(color);
+					return fromRgb(rgb.red, rgb.green, rgb.blue);
+				}
+
+				static inline color::Rgb
+				toRgb(Type pixel)
+				{
+					return color::Rgb(pixel, pixel, pixel);
+				}
+			};
+		}
+
+		/// Convert a colour into a pixel of the format
+		template <typename Format>
+		inline typename Format::Type
+		toPixel(const color::Rgb& color)
+		{
+			return Format::fromRgb(color.red, color.green, color.blue);
+		}
+	}
+}
+
+#endif // XPCC__PIXEL_FORMAT_HPP
@@ -0,0 +1,218 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "pnm.hpp"
+
+static void
+writeNumber(xpcc::IODevice& device, uint16_t value)
+{
+	char digits[5];
+	uint8_t count = 0;
+	do {
+		digits[count++] = '0' + (value % 10);
+		value /= 10;
+	} while (value > 0);
+
+	while (count > 0) {
+		device.write(digits[--count]);
+	}
+}
+
+static inline bool
+isWhitespace(uint8_t c)
+{
+	return (c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == '\v' or c == '\f');
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::glcd::pnm::writeHeader(IODevice& device, char type, uint16_t width, uint16_t height)
+{
+	device.write('P');
+	device.write(type);
+	device.write('\n');
+	writeNumber(device, width);
+	device.write(' ');
+	writeNumber(device, height);
+	device.write('\n');
+	if (type == '3' or type == '6') {
+		device.write("255\n");
+	}
+}
+
+// ----------------------------------------------------------------------------
+xpcc::glcd::pnm::Reader::Reader(const uint8_t *data, std::size_t size) :
+	data(data), size(size), position(2),
+	type(0), width(0), height(0), maximum(1),
+	column(0), row(0), bits(0), mask(0)
+{
+	if (size < 2 or data[0] != 'P') {
+		return;
+	}
+
+	const char t = data[1];
+	if (t != '1' and t != '3' and t != '4' and t != '6') {
+		return;
+	}
+
+	if (not this->readNumber(this->width) or not this->readNumber(this->height)) {
+		return;
+	}
+	if (t == '3' or t == '6')
+	{
+		if (not this->readNumber(this->maximum) or
+				this->maximum == 0 or this->maximum > 255) {
+			return;
+		}
+	}
+
+	if (t == '4' or t == '6')
+	{
+		// exactly one whitespace character separates the binary data
+		if (this->position >= size or not isWhitespace(data[this->position])) {
+			return;
+		}
+		++this->position;
+	}
+	this->type = t;
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::glcd::pnm::Reader::read(color::Rgb& pixel)
+{
+	if (this->type == 0 or this->row >= this->height) {
+		return false;
+	}
+
+	if (this->isBitmap())
+	{
+		bool bit;
+		if (not this->readBit(bit)) {
+			return false;
+		}
+		const uint8_t value = bit ? 0 : 255;
+		pixel = color::Rgb(value, value, value);
+	}
+	else if (this->type == '6')
+	{
+		if (this->position + 3 > this->size) {
+			return false;
+		}
+		pixel = color::Rgb(this->scale(this->data[this->position]),
+				this->scale(this->data[this->position + 1]),
+				this->scale(this->data[this->position + 2]));
+		this->position += 3;
+	}
+	else
+	{
+		uint16_t red, green, blue;
+		if (not this->readNumber(red) or not this->readNumber(green) or
+				not this->readNumber(blue)) {
+			return false;
+		}
+		pixel = color::Rgb(this->scale(red), this->scale(green), this->scale(blue));
+	}
+
+	if (++this->column >= this->width)
+	{
+		this->column = 0;
+		++this->row;
+		// rows of a binary bitmap start with a new byte
+		this->mask = 0;
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::glcd::pnm::Reader::readNumber(uint16_t& value)
+{
+	this->skip();
+
+	uint32_t number = 0;
+	const std::size_t start = this->position;
+	while (this->position < this->size)
+	{
+		const uint8_t c = this->data[this->position];
+		if (c < '0' or c > '9') {
+			break;
+		}
+		number = number * 10 + (c - '0');
+		if (number > 0xffff) {
+			return false;
+		}
+		++this->position;
+	}
+
+	value = number;
+	return (this->position != start);
+}
+
+bool
+xpcc::glcd::pnm::Reader::readBit(bool& bit)
+{
+	if (this->type == '1')
+	{
+		// digits may follow each other without whitespace
+		this->skip();
+		if (this->position >= this->size) {
+			return false;
+		}
+		const uint8_t c = this->data[this->position++];
+		if (c != '0' and c != '1') {
+			return false;
+		}
+		bit = (c == '1');
+		return true;
+	}
+
+	if (this->mask == 0)
+	{
+		if (this->position >= this->size) {
+			return false;
+		}
+		this->bits = this->data[this->position++];
+		this->mask = 0x80;
+	}
+	bit = (this->bits & this->mask);
+	this->mask >>= 1;
+	return true;
+}
+
+uint8_t
+xpcc::glcd::pnm::Reader::scale(uint16_t value) const
+{
+	if (value >= this->maximum) {
+		return 255;
+	}
+	return (uint32_t(value) * 255 + this->maximum / 2) / this->maximum;
+}
+
+void
+xpcc::glcd::pnm::Reader::skip()
+{
+	while (this->position < this->size)
+	{
+		const uint8_t c = this->data[this->position];
+		if (c == '#')
+		{
+			while (this->position < this->size and
+					this->data[this->position] != '\n') {
+				++this->position;
+			}
+		}
+		else if (isWhitespace(c)) {
+			++this->position;
+		}
+		else {
+			break;
+		}
+	}
+}
@@ -0,0 +1,153 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__PNM_HPP
+#define XPCC__PNM_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include <xpcc/io/iodevice.hpp>
+#include <xpcc/ui/color.hpp>
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Netpbm images (PBM and PPM)
+		 *
+		 * The simplest image formats which every image viewer can open,
+		 * used for snapshots of off-screen displays and as golden images
+		 * in tests. Supported are the bitmaps `P1` (ASCII) and `P4`
+		 * (binary), where a set bit is black, and the colour images `P3`
+		 * (ASCII) and `P6` (binary) with a maximum value up to 255.
+		 *
+		 * An ASCII bitmap can be written directly as C string and is
+		 * readable in the source code:
+		 * \code
+		 * const char golden[] =
+		 *     "P1 5 3\n"
+		 *     "0 1 1 1 0\n"
+		 *     "1 0 0 0 1\n"
+		 *     "0 1 1 1 0\n";
+		 * \endcode
+		 *
+		 * \see		xpcc::OffscreenDisplay
+		 * \ingroup	graphics
+		 */
+		namespace pnm
+		{
+			/// Write the header of a `P4` bitmap or `P6` colour image
+			void
+			writeHeader(IODevice& device, char type, uint16_t width, uint16_t height);
+
+			/**
+			 * \brief	Reads the pixels of an image in memory
+			 *
+			 * \code
+			 * xpcc::glcd::pnm::Reader reader(image, sizeof(image));
+			 * xpcc::color::Rgb pixel;
+			 * while (reader.read(pixel)) {
+			 *     ...
+			 * }
+			 * \endcode
+			 */
+			class Reader
+			{
+			public:
+				/// Parses the header, see isValid()
+				Reader(const uint8_t *data, std::size_t size);
+
+				inline
+				Reader(const char *data, std::size_t size) :
+					Reader(reinterpret_cast<const uint8_t *>(data), size)
+				{
+				}
+
+				/// `false` if the header is not understood
+				inline bool
+				isValid() const
+				{
+					return (this->type != 0);
+				}
+
+				/// `'1'`, `'3'`, `'4'` or `'6'`, 0 if invalid
+				inline char
+				getType() const
+				{
+					return this->type;
+				}
+
+				inline bool
+				isBitmap() const
+				{
+					return (this->type == '1' or this->type == '4');
+				}
+
+				inline uint16_t
+				getWidth() const
+				{
+					return this->width;
+				}
+
+				inline uint16_t
+				getHeight() const
+				{
+					return this->height;
+				}
+
+				/**
+				 * \brief	Next pixel, row by row
+				 *
+				 * Bits are returned as black or white and colours are
+				 * scaled to 0..255.
+				 *
+				 * \return	`false` after the last pixel or if the data ends
+				 * 			too early.
+				 */
+				bool
+				read(color::Rgb& pixel);
+
+			private:
+				bool
+				readNumber(uint16_t& value);
+
+				bool
+				readBit(bool& bit);
+
+				uint8_t
+				scale(uint16_t value) const;
+
+				// skip whitespace and comments
+				void
+				skip();
+
+				const uint8_t *data;
+				std::size_t size;
+				std::size_t position;
+
+				char type;
+				uint16_t width;
+				uint16_t height;
+				uint16_t maximum;
+
+				// position of the next pixel
+				uint16_t column;
+				uint16_t row;
+
+				// current byte of a binary bitmap
+				uint8_t bits;
+				uint8_t mask;
+			};
+		}
+	}
+}
+
+#endif // XPCC__PNM_HPP
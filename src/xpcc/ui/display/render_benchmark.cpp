@@ -0,0 +1,128 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "render_benchmark.hpp"
+
+// ----------------------------------------------------------------------------
+xpcc::glcd::RenderBenchmark::RenderBenchmark(GraphicDisplay& display,
+		uint16_t iterations) :
+	lines("lines"), rectangles("rectangles"), circles("circles"), text("text"),
+	display(display), iterations(iterations)
+{
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::glcd::RenderBenchmark::runLines()
+{
+	const int16_t width = this->display.getWidth();
+	const int16_t height = this->display.getHeight();
+
+	this->measure(this->lines, [width, height](GraphicDisplay& display)
+	{
+		for (int16_t y = 0; y < height; y += 4) {
+			display.drawLine(0, y, width - 1, y);
+		}
+		for (int16_t x = 0; x < width; x += 4) {
+			display.drawLine(x, 0, x, height - 1);
+		}
+		// a fan of diagonal lines from the upper left corner
+		for (int16_t x = 0; x < width; x += 8) {
+			display.drawLine(0, 0, x, height - 1);
+		}
+		for (int16_t y = 0; y < height; y += 8) {
+			display.drawLine(0, 0, width - 1, y);
+		}
+	});
+}
+
+void
+xpcc::glcd::RenderBenchmark::runRectangles()
+{
+	const uint16_t width = this->display.getWidth();
+	const uint16_t height = this->display.getHeight();
+
+	this->measure(this->rectangles, [width, height](GraphicDisplay& display)
+	{
+		for (uint16_t i = 0; 2 * i + 2 < width and 2 * i + 2 < height; i += 3) {
+			display.drawRectangle(glcd::Point(i, i), width - 2 * i, height - 2 * i);
+		}
+		for (uint16_t i = 0; i < 8; ++i) {
+			display.fillRectangle(glcd::Point(i * width / 8, i * height / 8),
+					width / 4, height / 4);
+		}
+		display.fillRectangle(glcd::Point(0, 0), width, height);
+	});
+}
+
+void
+xpcc::glcd::RenderBenchmark::runCircles()
+{
+	const int16_t width = this->display.getWidth();
+	const int16_t height = this->display.getHeight();
+	const int16_t radius = ((width < height) ? width : height) / 2;
+
+	this->measure(this->circles, [width, height, radius](GraphicDisplay& display)
+	{
+		const glcd::Point center(width / 2, height / 2);
+		for (int16_t r = 2; r < radius; r += 3) {
+			display.drawCircle(center, r);
+		}
+		display.drawEllipse(center, width / 2 - 1, height / 2 - 1);
+		display.fillCircle(center, radius / 2);
+		display.fillCircle(glcd::Point(0, 0), radius / 2);
+	});
+}
+
+void
+xpcc::glcd::RenderBenchmark::runText()
+{
+	const uint16_t lineHeight = this->display.getFontHeight() + 1;
+	const uint16_t characterWidth = this->display.getStringWidth("0");
+	if (lineHeight <= 1 or characterWidth == 0) {
+		// no font
+		return;
+	}
+
+	const int16_t height = this->display.getHeight();
+	const uint16_t characters = this->display.getWidth() / characterWidth + 1;
+
+	this->measure(this->text, [height, lineHeight, characters](GraphicDisplay& display)
+	{
+		char c = ' ';
+		for (int16_t y = 0; y < height; y += lineHeight)
+		{
+			display.setCursor(0, y);
+			for (uint16_t i = 0; i < characters; ++i)
+			{
+				display.write(c);
+				c = (c == '~') ? ' ' : c + 1;
+			}
+		}
+	});
+}
+
+void
+xpcc::glcd::RenderBenchmark::runAll()
+{
+	this->runLines();
+	this->runRectangles();
+	this->runCircles();
+	this->runText();
+}
+
+// ----------------------------------------------------------------------------
+uint32_t
+xpcc::glcd::RenderBenchmark::getNanoseconds(const profiler::Record& record)
+{
+	if (record.getCount() == 0) {
+		return 0;
+	}
+	return uint32_t(profiler::toNanoseconds(record.getTotal()) / record.getCount());
+}
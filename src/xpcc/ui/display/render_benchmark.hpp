@@ -0,0 +1,107 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__RENDER_BENCHMARK_HPP
+#define XPCC__RENDER_BENCHMARK_HPP
+
+#include <stdint.h>
+
+#include <xpcc/debug/profiler/profiler.hpp>
+#include "graphic_display.hpp"
+
+namespace xpcc
+{
+	namespace glcd
+	{
+		/**
+		 * \brief	Measures the drawing speed of a display
+		 *
+		 * Every workload is drawn a number of times, the duration of each
+		 * run is added to a xpcc::profiler::Record. The results are
+		 * therefore available through xpcc::profiler::dump() or as binary
+		 * snapshot through xpcc::profiler::writeSnapshot(), e.g. to track
+		 * regressions with an xpcc::OffscreenDisplay on a build server.
+		 *
+		 * The standard workloads always draw the same scene, scaled to
+		 * the size of the display. Own workloads (e.g. widgets) are
+		 * measured with measure():
+		 * \code
+		 * xpcc::OffscreenDisplay<128, 64> display;
+		 * xpcc::glcd::RenderBenchmark benchmark(display, 100);
+		 * benchmark.runAll();
+		 *
+		 * xpcc::profiler::Record record("button");
+		 * benchmark.measure(record, [&](xpcc::GraphicDisplay& display) {
+		 *     button.draw(&display);
+		 * });
+		 *
+		 * xpcc::profiler::dump(stream);
+		 * \endcode
+		 *
+		 * \ingroup	graphics
+		 */
+		class RenderBenchmark
+		{
+		public:
+			RenderBenchmark(GraphicDisplay& display, uint16_t iterations);
+
+			/**
+			 * \brief	Call `function(display)` for every iteration
+			 *
+			 * The display is cleared once before the first iteration.
+			 */
+			template <typename Function>
+			void
+			measure(profiler::Record& record, Function function)
+			{
+				this->display.clear();
+				for (uint16_t i = 0; i < this->iterations; ++i)
+				{
+					profiler::Scope scope(record);
+					function(this->display);
+				}
+			}
+
+			/// Horizontal, vertical and diagonal lines
+			void
+			runLines();
+
+			/// Outlined and filled rectangles
+			void
+			runRectangles();
+
+			/// Outlined and filled circles and ellipses
+			void
+			runCircles();
+
+			/// A screen full of text in the current font, see GraphicDisplay::setFont()
+			void
+			runText();
+
+			void
+			runAll();
+
+			/// Mean duration of a run in nanoseconds
+			static uint32_t
+			getNanoseconds(const profiler::Record& record);
+
+		public:
+			profiler::Record lines;
+			profiler::Record rectangles;
+			profiler::Record circles;
+			profiler::Record text;
+
+		private:
+			GraphicDisplay& display;
+			const uint16_t iterations;
+		};
+	}
+}
+
+#endif // XPCC__RENDER_BENCHMARK_HPP
@@ -0,0 +1,210 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+#include <cstring>
+#include <xpcc/ui/display/asynchronous_graphic_display.hpp>
+
+#include "asynchronous_graphic_display_test.hpp"
+
+namespace
+{
+	// records the transfers into a simulated display RAM, every page
+	// needs two more calls of transmit() like a slow SPI transfer
+	template <bool DoubleBuffered>
+	class TestDisplay : public xpcc::AsynchronousGraphicDisplay<32, 16, DoubleBuffered>
+	{
+	public:
+		TestDisplay() :
+			transfers(0), lastPage(0), lastColumn(0), lastLength(0)
+		{
+			std::memset(ram, 0, sizeof(ram));
+			this->clear();
+		}
+
+		/// Calls of transmit() until the update is finished
+		uint16_t
+		run()
+		{
+			uint16_t calls = 0;
+			while (this->transmit().getState() == xpcc::rf::Running) {
+				++calls;
+			}
+			return calls;
+		}
+
+		uint8_t ram[2][32];
+
+		uint16_t transfers;
+		uint16_t lastPage;
+		uint16_t lastColumn;
+		uint16_t lastLength;
+
+	protected:
+		virtual xpcc::ResumableResult<void>
+		writePage(uint16_t page, uint16_t column, uint8_t *data, uint16_t length)
+		{
+			RF_BEGIN();
+
+			RF_YIELD();
+			RF_YIELD();
+
+			std::memcpy(&ram[page][column], data, length);
+			++transfers;
+			lastPage = page;
+			lastColumn = column;
+			lastLength = length;
+
+			RF_END();
+		}
+	};
+}
+
+// ----------------------------------------------------------------------------
+void
+AsynchronousGraphicDisplayTest::testStartUpdate()
+{
+	TestDisplay<false> display;
+	TEST_ASSERT_FALSE(display.isUpdating());
+
+	// the whole display is sent initially
+	display.fillRectangle(xpcc::glcd::Point(0, 0), 32, 16);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	TEST_ASSERT_TRUE(display.isUpdating());
+	TEST_ASSERT_FALSE(display.isDirty());
+	TEST_ASSERT_EQUALS(display.transfers, 0);
+
+	TEST_ASSERT_EQUALS(display.run(), 4);
+	TEST_ASSERT_FALSE(display.isUpdating());
+	TEST_ASSERT_EQUALS(display.transfers, 2);
+	TEST_ASSERT_EQUALS(display.ram[0][0], 0xff);
+	TEST_ASSERT_EQUALS(display.ram[1][31], 0xff);
+	TEST_ASSERT_EQUALS(display.getBytesTransmitted(), 64U);
+
+	// nothing changed, nothing to send
+	TEST_ASSERT_TRUE(display.startUpdate());
+	TEST_ASSERT_FALSE(display.isUpdating());
+	TEST_ASSERT_EQUALS(display.run(), 0);
+	TEST_ASSERT_EQUALS(display.transfers, 2);
+}
+
+void
+AsynchronousGraphicDisplayTest::testChangedColumns()
+{
+	TestDisplay<false> display;
+	display.update();
+	display.transfers = 0;
+
+	display.drawPixel(5, 10);
+	display.drawPixel(20, 9);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.run();
+
+	// only the changed columns of the second page
+	TEST_ASSERT_EQUALS(display.transfers, 1);
+	TEST_ASSERT_EQUALS(display.lastPage, 1);
+	TEST_ASSERT_EQUALS(display.lastColumn, 5);
+	TEST_ASSERT_EQUALS(display.lastLength, 16);
+	TEST_ASSERT_EQUALS(display.ram[1][5], 0x04);
+	TEST_ASSERT_EQUALS(display.ram[1][20], 0x02);
+	TEST_ASSERT_EQUALS(display.getBytesTransmitted(), 64U + 16U);
+}
+
+void
+AsynchronousGraphicDisplayTest::testStartWhileUpdating()
+{
+	TestDisplay<false> display;
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.transmit();
+
+	display.drawPixel(0, 0);
+	TEST_ASSERT_FALSE(display.startUpdate());
+	TEST_ASSERT_TRUE(display.isDirty());
+
+	display.run();
+	TEST_ASSERT_EQUALS(display.transfers, 2);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.run();
+	TEST_ASSERT_EQUALS(display.transfers, 3);
+	TEST_ASSERT_FALSE(display.isDirty());
+}
+
+// ----------------------------------------------------------------------------
+void
+AsynchronousGraphicDisplayTest::testDoubleBuffered()
+{
+	TestDisplay<true> display;
+	display.update();
+
+	display.drawPixel(0, 0);
+	display.drawPixel(0, 8);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.transmit();
+
+	// the next frame is drawn while the current one is sent
+	display.clear();
+	display.drawPixel(1, 8);
+	display.run();
+	TEST_ASSERT_EQUALS(display.ram[0][0], 0x01);
+	TEST_ASSERT_EQUALS(display.ram[1][0], 0x01);
+	TEST_ASSERT_EQUALS(display.ram[1][1], 0x00);
+
+	// and follows with the next update
+	TEST_ASSERT_TRUE(display.isDirty());
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.run();
+	TEST_ASSERT_EQUALS(display.ram[0][0], 0x00);
+	TEST_ASSERT_EQUALS(display.ram[1][0], 0x00);
+	TEST_ASSERT_EQUALS(display.ram[1][1], 0x01);
+}
+
+void
+AsynchronousGraphicDisplayTest::testSingleBuffered()
+{
+	TestDisplay<false> display;
+	display.update();
+
+	display.drawPixel(0, 0);
+	display.drawPixel(0, 8);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.transmit();
+
+	// the first page is already copied, the second is not
+	display.clear();
+	display.drawPixel(0, 9);
+	display.run();
+	TEST_ASSERT_EQUALS(display.ram[0][0], 0x01);
+	TEST_ASSERT_EQUALS(display.ram[1][0], 0x02);
+
+	// the display shows the new frame after the next update
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.run();
+	TEST_ASSERT_EQUALS(display.ram[0][0], 0x00);
+	TEST_ASSERT_EQUALS(display.ram[1][0], 0x02);
+}
+
+void
+AsynchronousGraphicDisplayTest::testBlockingUpdate()
+{
+	TestDisplay<true> display;
+	display.drawPixel(31, 15);
+	display.update();
+	TEST_ASSERT_FALSE(display.isUpdating());
+	TEST_ASSERT_FALSE(display.isDirty());
+	TEST_ASSERT_EQUALS(display.transfers, 2);
+	TEST_ASSERT_EQUALS(display.ram[1][31], 0x80);
+
+	// a running update is finished first
+	display.drawPixel(0, 0);
+	TEST_ASSERT_TRUE(display.startUpdate());
+	display.transmit();
+	display.drawPixel(1, 0);
+	display.update();
+	TEST_ASSERT_EQUALS(display.transfers, 4);
+	TEST_ASSERT_EQUALS(display.ram[0][0], 0x01);
+	TEST_ASSERT_EQUALS(display.ram[0][1], 0x01);
+}
@@ -0,0 +1,282 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+#include <cstring>
+#include <xpcc/ui/display/buffered_character_display.hpp>
+
+#include "buffered_character_display_test.hpp"
+
+namespace
+{
+	// records the transfers like a HD44780 with auto increment
+	class TestCharacterDisplay : public xpcc::CharacterDisplay
+	{
+	public:
+		TestCharacterDisplay() :
+			CharacterDisplay(8, 2),
+			address(0), cursorCommands(0), characters(0),
+			busyTime(0), busy(0), transferWhileBusy(false)
+		{
+			std::memset(ram, 0, sizeof(ram));
+		}
+
+		virtual void
+		writeRaw(char c)
+		{
+			transfer();
+			ram[address++ % sizeof(ram)] = c;
+			++characters;
+		}
+
+		virtual void
+		setCursor(uint8_t column, uint8_t line)
+		{
+			transfer();
+			address = column + 0x40 * line;
+			++cursorCommands;
+		}
+
+		virtual bool
+		isBusy()
+		{
+			if (busy > 0) {
+				--busy;
+				return true;
+			}
+			return false;
+		}
+
+		char
+		getCharacter(uint8_t column, uint8_t line) const
+		{
+			return ram[column + 0x40 * line];
+		}
+
+		void
+		reset()
+		{
+			cursorCommands = 0;
+			characters = 0;
+		}
+
+		char ram[0x80];
+		uint8_t address;
+
+		uint16_t cursorCommands;
+		uint16_t characters;
+
+		// polls of isBusy() after every transfer
+		uint8_t busyTime;
+		uint8_t busy;
+		bool transferWhileBusy;
+
+	private:
+		void
+		transfer()
+		{
+			transferWhileBusy |= (busy > 0);
+			busy = busyTime;
+		}
+	};
+
+	typedef xpcc::BufferedCharacterDisplay<8, 2> Display;
+
+	// number of calls until the update is finished
+	uint16_t
+	update(Display& display)
+	{
+		uint16_t calls = 1;
+		while (display.update().getState() == xpcc::rf::Running) {
+			++calls;
+		}
+		return calls;
+	}
+
+	bool
+	shows(const TestCharacterDisplay& lcd, uint8_t line, const char *text)
+	{
+		for (uint8_t column = 0; column < 8; ++column)
+		{
+			if (lcd.getCharacter(column, line) != text[column]) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+BufferedCharacterDisplayTest::testFirstUpdate()
+{
+	TestCharacterDisplay lcd;
+	Display display(lcd);
+	TEST_ASSERT_TRUE(display.isChanged());
+
+	// the content of the display is unknown
+	update(display);
+	TEST_ASSERT_EQUALS(lcd.characters, 16);
+	TEST_ASSERT_EQUALS(lcd.cursorCommands, 2);
+	TEST_ASSERT_TRUE(shows(lcd, 0, "        "));
+	TEST_ASSERT_TRUE(shows(lcd, 1, "        "));
+	TEST_ASSERT_FALSE(display.isChanged());
+
+	// nothing to do
+	lcd.reset();
+	TEST_ASSERT_EQUALS(update(display), 1);
+	TEST_ASSERT_EQUALS(lcd.characters, 0);
+	TEST_ASSERT_EQUALS(lcd.cursorCommands, 0);
+}
+
+void
+BufferedCharacterDisplayTest::testChangedCharacters()
+{
+	TestCharacterDisplay lcd;
+	Display display(lcd);
+	update(display);
+	lcd.reset();
+
+	display.setCursor(2, 1);
+	display << "abc";
+	display.setCursor(6, 0);
+	display << "x";
+	TEST_ASSERT_EQUALS(display.getCharacter(3, 1), 'b');
+	TEST_ASSERT_TRUE(display.isChanged());
+
+	// not written before the update
+	TEST_ASSERT_TRUE(shows(lcd, 1, "        "));
+
+	update(display);
+	TEST_ASSERT_EQUALS(lcd.characters, 4);
+	TEST_ASSERT_EQUALS(lcd.cursorCommands, 2);
+	TEST_ASSERT_TRUE(shows(lcd, 0, "      x "));
+	TEST_ASSERT_TRUE(shows(lcd, 1, "  abc   "));
+
+	// the same text again is no change
+	lcd.reset();
+	display.setCursor(2, 1);
+	display << "abd";
+	update(display);
+	TEST_ASSERT_EQUALS(lcd.characters, 1);
+	TEST_ASSERT_EQUALS(lcd.cursorCommands, 1);
+	TEST_ASSERT_TRUE(shows(lcd, 1, "  abd   "));
+}
+
+void
+BufferedCharacterDisplayTest::testContiguousCharacters()
+{
+	TestCharacterDisplay lcd;
+	Display display(lcd);
+	update(display);
+
+	// the end of a line and the start of the next need a cursor command
+	display.setCursor(6, 0);
+	display << "12";
+	display.setCursor(0, 1);
+	display << "34";
+	lcd.reset();
+	update(display);
+	TEST_ASSERT_EQUALS(lcd.characters, 4);
+	TEST_ASSERT_EQUALS(lcd.cursorCommands, 2);
+	TEST_ASSERT_TRUE(shows(lcd, 0, "      12"));
+	TEST_ASSERT_TRUE(shows(lcd, 1, "34      "));
+
+	// the cursor is still behind the last written character
+	display.setCursor(2, 1);
+	display << "5";
+	lcd.reset();
+	update(display);
+	TEST_ASSERT_EQUALS(lcd.characters, 1);
+	TEST_ASSERT_EQUALS(lcd.cursorCommands, 0);
+}
+
+void
+BufferedCharacterDisplayTest::testBusyDisplay()
+{
+	TestCharacterDisplay lcd;
+	lcd.busyTime = 3;
+	Display display(lcd);
+	display << "busy";
+
+	// one transfer per call, no transfer while the controller is busy
+	const uint16_t calls = update(display);
+	TEST_ASSERT_FALSE(lcd.transferWhileBusy);
+	TEST_ASSERT_EQUALS(lcd.characters, 16);
+	TEST_ASSERT_TRUE(calls >= 2 * 16 + 2);
+	TEST_ASSERT_TRUE(shows(lcd, 0, "busy    "));
+
+	// the result tells whether anything was written
+	TEST_ASSERT_FALSE(display.update().getResult());
+}
+
+void
+BufferedCharacterDisplayTest::testInvalidate()
+{
+	TestCharacterDisplay lcd;
+	Display display(lcd);
+	update(display);
+
+	// e.g. after the display was reset
+	std::memset(lcd.ram, 0, sizeof(lcd.ram));
+	display.invalidate();
+	TEST_ASSERT_TRUE(display.isChanged());
+	lcd.reset();
+	update(display);
+	TEST_ASSERT_EQUALS(lcd.characters, 16);
+	TEST_ASSERT_TRUE(shows(lcd, 1, "        "));
+}
+
+void
+BufferedCharacterDisplayTest::testChangeDuringUpdate()
+{
+	TestCharacterDisplay lcd;
+	Display display(lcd);
+	update(display);
+
+	display.setCursor(0, 0);
+	display << "ab";
+	display.setCursor(0, 1);
+	display << "cd";
+
+	// first cursor command and the 'a'
+	display.update();
+	display.update();
+
+	// behind the update, written with the next update
+	display.setCursor(0, 0);
+	display << "x";
+	// ahead of the update
+	display.setCursor(3, 1);
+	display << "e";
+	update(display);
+	TEST_ASSERT_TRUE(shows(lcd, 0, "ab      "));
+	TEST_ASSERT_TRUE(shows(lcd, 1, "cd e    "));
+	TEST_ASSERT_TRUE(display.isChanged());
+
+	update(display);
+	TEST_ASSERT_TRUE(shows(lcd, 0, "xb      "));
+	TEST_ASSERT_FALSE(display.isChanged());
+}
+
+void
+BufferedCharacterDisplayTest::testStream()
+{
+	TestCharacterDisplay lcd;
+	Display display(lcd);
+
+	// wraps at the end of the line
+	display << "0123456789";
+	TEST_ASSERT_EQUALS(display.getCharacter(7, 0), '7');
+	TEST_ASSERT_EQUALS(display.getCharacter(1, 1), '9');
+
+	display.clear();
+	display << "a\nb";
+	update(display);
+	TEST_ASSERT_TRUE(shows(lcd, 0, "a       "));
+	TEST_ASSERT_TRUE(shows(lcd, 1, "b       "));
+}
@@ -0,0 +1,137 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "buffered_graphic_display_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+#include <xpcc/ui/display/virtual_graphic_display.hpp>
+
+#include "test_display.hpp"
+
+namespace
+{
+	const uint32_t frames = 500;
+
+	// 32x32 pixel icon
+	uint8_t icon[32 * 4];
+
+	void
+	createIcon()
+	{
+		uint32_t state = 7;
+		for (uint8_t &byte : icon) {
+			state = state * 1103515245 + 12345;
+			byte = state >> 16;
+		}
+	}
+
+	// status screen: frame, title bar and seven lines of text
+	void
+	drawText(xpcc::GraphicDisplay& display, uint32_t frame)
+	{
+		display.clear();
+		display.drawRectangle(xpcc::glcd::Point(0, 0), 124, 62);
+		display.fillRectangle(xpcc::glcd::Point(1, 1), 122, 9);
+
+		for (uint8_t line = 0; line < 6; ++line) {
+			display.setCursor(3, 11 + line * 8);
+			display << "Channel " << line << ": " << (frame * 7 + line * 1000);
+		}
+	}
+
+	// menu screen: icons at unaligned positions and their labels
+	void
+	drawImages(xpcc::GraphicDisplay& display, uint32_t frame)
+	{
+		display.clear();
+		for (uint8_t i = 0; i < 3; ++i)
+		{
+			const int16_t x = 4 + i * 40;
+			const int16_t y = 3 + ((frame + i) % 5);
+			display.drawImageRaw(xpcc::glcd::Point(x, y), 32, 32,
+					xpcc::accessor::asFlash(icon));
+			display.drawRectangle(xpcc::glcd::Point(x - 1, y - 1), 34, 34);
+			display.setCursor(x, 45);
+			display << "Item" << i;
+		}
+		display.fillRectangle(xpcc::glcd::Point(4 + (frame % 3) * 40, 54), 32, 5);
+	}
+
+	uint32_t
+	render(void (*draw)(xpcc::GraphicDisplay&, uint32_t), xpcc::GraphicDisplay& display)
+	{
+		display.clear();
+
+		// leave a frame around the screen
+		xpcc::VirtualGraphicDisplay screen(&display,
+				xpcc::glcd::Point(2, 1), xpcc::glcd::Point(126, 63));
+
+		const unittest::Stopwatch stopwatch;
+		for (uint32_t i = 0; i < frames; ++i) {
+			draw(screen, i);
+		}
+		return stopwatch.getTicks();
+	}
+
+	void
+	compare(const char *name, uint32_t pixelTicks, uint32_t pageTicks)
+	{
+		XPCC_LOG_INFO << name << ": "
+				<< unittest::getNanoseconds(pixelTicks, frames)
+				<< " ns/frame pixel by pixel, "
+				<< unittest::getNanoseconds(pageTicks, frames)
+				<< " ns/frame with page primitives, "
+				<< (pixelTicks / (pageTicks ? pageTicks : 1)) << "x faster" << xpcc::endl;
+	}
+}
+
+void
+BufferedGraphicDisplayBenchmarkTest::testText()
+{
+	PixelDisplay reference;
+	TestDisplay display;
+
+	const uint32_t pixelTicks = render(drawText, reference);
+	const uint32_t pageTicks = render(drawText, display);
+	compare("text screen", pixelTicks, pageTicks);
+
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+}
+
+void
+BufferedGraphicDisplayBenchmarkTest::testImages()
+{
+	createIcon();
+
+	PixelDisplay reference;
+	TestDisplay display;
+
+	const uint32_t pixelTicks = render(drawImages, reference);
+	const uint32_t pageTicks = render(drawImages, display);
+	compare("image screen", pixelTicks, pageTicks);
+
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+}
+
+#else
+
+void
+BufferedGraphicDisplayBenchmarkTest::testText()
+{
+}
+
+void
+BufferedGraphicDisplayBenchmarkTest::testImages()
+{
+}
+
+#endif
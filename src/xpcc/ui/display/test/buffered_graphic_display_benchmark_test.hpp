@@ -0,0 +1,24 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Renders text and image heavy screens through a virtual display, once
+/// pixel by pixel and once with the page primitives of the buffered
+/// display. Only runs on hosted targets, the results are printed to the
+/// info log.
+class BufferedGraphicDisplayBenchmarkTest : public unittest::TestSuite
+{
+public:
+	void
+	testText();
+
+	void
+	testImages();
+};
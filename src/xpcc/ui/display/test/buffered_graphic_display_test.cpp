@@ -0,0 +1,437 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/virtual_graphic_display.hpp>
+
+#include "test_display.hpp"
+#include "buffered_graphic_display_test.hpp"
+
+namespace
+{
+	// 12x12 checkerboard with a frame
+	FLASH_STORAGE(uint8_t image[]) =
+	{
+		0xff, 0x01, 0xa9, 0x55, 0xa9, 0x55, 0xa9, 0x55, 0xa9, 0x55, 0x01, 0xff,
+		0x0f, 0x08, 0x0a, 0x09, 0x0a, 0x09, 0x0a, 0x09, 0x0a, 0x09, 0x08, 0x0f,
+	};
+}
+
+void
+BufferedGraphicDisplayTest::testInitiallyDirty()
+{
+	TestDisplay display;
+	TEST_ASSERT_TRUE(display.isDirty());
+
+	TestDisplay::Window window;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(window));
+	TEST_ASSERT_EQUALS(window.firstColumn, 0);
+	TEST_ASSERT_EQUALS(window.lastColumn, 127);
+	TEST_ASSERT_EQUALS(window.firstPage, 0);
+	TEST_ASSERT_EQUALS(window.lastPage, 7);
+
+	display.update();
+	TEST_ASSERT_FALSE(display.isDirty());
+	TEST_ASSERT_FALSE(display.getDirtyWindow(window));
+	TEST_ASSERT_EQUALS(display.getBytesTransmitted(), 1024U);
+	TEST_ASSERT_EQUALS(display.getBytesSaved(), 0U);
+}
+
+void
+BufferedGraphicDisplayTest::testPixel()
+{
+	TestDisplay display;
+	display.update();
+
+	display.drawPixel(10, 20);
+	display.drawPixel(30, 21);
+	TEST_ASSERT_TRUE(display.isDirty());
+
+	uint16_t first, last;
+	TEST_ASSERT_FALSE(display.getDirtyColumns(1, first, last));
+	TEST_ASSERT_TRUE(display.getDirtyColumns(2, first, last));
+	TEST_ASSERT_EQUALS(first, 10);
+	TEST_ASSERT_EQUALS(last, 30);
+
+	// clearing a pixel changes the buffer too
+	display.update();
+	display.setColor(xpcc::glcd::Color::white());
+	display.drawPixel(127, 63);
+	TEST_ASSERT_TRUE(display.getDirtyColumns(7, first, last));
+	TEST_ASSERT_EQUALS(first, 127);
+	TEST_ASSERT_EQUALS(last, 127);
+
+	// outside of the display
+	display.update();
+	display.setColor(xpcc::glcd::Color::black());
+	display.drawPixel(128, 10);
+	display.drawPixel(-1, 10);
+	display.drawPixel(10, 64);
+	TEST_ASSERT_FALSE(display.isDirty());
+}
+
+void
+BufferedGraphicDisplayTest::testHorizontalLine()
+{
+	TestDisplay display;
+	display.update();
+
+	display.drawLine(xpcc::glcd::Point(100, 9), xpcc::glcd::Point(200, 9));
+
+	TestDisplay::Window window;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(window));
+	TEST_ASSERT_EQUALS(window.firstColumn, 100);
+	TEST_ASSERT_EQUALS(window.lastColumn, 127);
+	TEST_ASSERT_EQUALS(window.firstPage, 1);
+	TEST_ASSERT_EQUALS(window.lastPage, 1);
+
+	// below the display
+	display.update();
+	display.drawLine(xpcc::glcd::Point(0, 70), xpcc::glcd::Point(50, 70));
+	TEST_ASSERT_FALSE(display.isDirty());
+}
+
+void
+BufferedGraphicDisplayTest::testRectangle()
+{
+	TestDisplay display;
+	display.update();
+
+	display.fillRectangle(xpcc::glcd::Point(20, 12), 8, 10);
+
+	TestDisplay::Window window;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(window));
+	TEST_ASSERT_EQUALS(window.firstColumn, 20);
+	TEST_ASSERT_EQUALS(window.lastColumn, 27);
+	TEST_ASSERT_EQUALS(window.firstPage, 1);
+	TEST_ASSERT_EQUALS(window.lastPage, 2);
+
+	uint16_t first, last;
+	TEST_ASSERT_FALSE(display.getDirtyColumns(0, first, last));
+	TEST_ASSERT_FALSE(display.getDirtyColumns(3, first, last));
+}
+
+void
+BufferedGraphicDisplayTest::testClear()
+{
+	TestDisplay display;
+	display.update();
+	TEST_ASSERT_FALSE(display.isDirty());
+
+	display.clear();
+
+	TestDisplay::Window window;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(window));
+	TEST_ASSERT_EQUALS(window.firstColumn, 0);
+	TEST_ASSERT_EQUALS(window.lastColumn, 127);
+	TEST_ASSERT_EQUALS(window.firstPage, 0);
+	TEST_ASSERT_EQUALS(window.lastPage, 7);
+
+	display.update();
+	display.invalidate();
+	TEST_ASSERT_TRUE(display.isDirty());
+}
+
+void
+BufferedGraphicDisplayTest::testBytesSaved()
+{
+	TestDisplay display;
+	display.update();
+
+	// a 3x3 block within one page
+	display.fillRectangle(xpcc::glcd::Point(60, 33), 3, 3);
+	display.update();
+	TEST_ASSERT_EQUALS(display.getBytesTransmitted(), 1024U + 3U);
+	TEST_ASSERT_EQUALS(display.getBytesSaved(), 1024U - 3U);
+
+	// no changes at all
+	display.update();
+	TEST_ASSERT_EQUALS(display.getBytesTransmitted(), 1024U + 3U);
+	TEST_ASSERT_EQUALS(display.getBytesSaved(), 2 * 1024U - 3U);
+}
+
+void
+BufferedGraphicDisplayTest::testFillOperations()
+{
+	TestDisplay display;
+	PixelDisplay reference;
+
+	// horizontal lines of buffered displays clear the pixels for other colors
+	display.setColor(xpcc::glcd::Color::black());
+	reference.setColor(xpcc::glcd::Color::black());
+
+	// aligned, unaligned and single page rectangles, partly outside
+	const int16_t rectangles[][4] = {
+		{ 0, 0, 128, 64 }, { 5, 3, 20, 30 }, { 30, 17, 4, 5 },
+		{ -10, 60, 30, 20 }, { 120, -5, 20, 14 }, { 64, 8, 16, 16 },
+	};
+
+	for (const auto& r : rectangles)
+	{
+		display.clear();
+		reference.clear();
+
+		// checkerboard background
+		for (int16_t y = 0; y < 64; y += 2) {
+			display.drawLine(0, y, 127, y);
+			reference.drawLine(0, y, 127, y);
+		}
+
+		display.fillRectangle(r[0], r[1], r[2], r[3]);
+		// GraphicDisplay::fillRectangle() draws nothing at negative positions
+		for (int16_t x = r[0]; x < r[0] + r[2]; ++x) {
+			for (int16_t y = r[1]; y < r[1] + r[3]; ++y) {
+				reference.drawPixel(x, y);
+			}
+		}
+		TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+	}
+
+	// Xor twice restores the buffer
+	display.clear();
+	reference.clear();
+	display.fillRectangle(xpcc::glcd::Point(3, 3), 50, 50);
+	display.fillRectangle(xpcc::glcd::Point(10, 13), 20, 7, xpcc::glcd::RasterOperation::Xor);
+	TEST_ASSERT_FALSE(display.isSet(10, 13));
+	TEST_ASSERT_TRUE(display.isSet(10, 12));
+	TEST_ASSERT_TRUE(display.isSet(9, 13));
+	display.fillRectangle(xpcc::glcd::Point(10, 13), 20, 7, xpcc::glcd::RasterOperation::Xor);
+	reference.fillRectangle(xpcc::glcd::Point(3, 3), 50, 50);
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+
+	// AndNot clears
+	display.fillRectangle(xpcc::glcd::Point(0, 0), 128, 64, xpcc::glcd::RasterOperation::AndNot);
+	reference.clear();
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+}
+
+void
+BufferedGraphicDisplayTest::testImage()
+{
+	TestDisplay display;
+	PixelDisplay reference;
+
+	// every vertical alignment and the borders of the display
+	const int16_t positions[][2] = {
+		{ 0, 0 }, { 10, 1 }, { 10, 5 }, { 10, 7 }, { 10, 8 }, { 10, 13 },
+		{ -4, -3 }, { 120, 58 }, { -11, 20 }, { 100, -11 }, { 127, 63 },
+	};
+
+	for (const auto& p : positions)
+	{
+		display.clear();
+		reference.clear();
+		display.fillRectangle(xpcc::glcd::Point(0, 0), 128, 64);
+		reference.fillRectangle(xpcc::glcd::Point(0, 0), 128, 64);
+
+		display.drawImageRaw(xpcc::glcd::Point(p[0], p[1]), 12, 12,
+				xpcc::accessor::asFlash(image));
+		reference.drawImageRaw(xpcc::glcd::Point(p[0], p[1]), 12, 12,
+				xpcc::accessor::asFlash(image));
+		TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+	}
+}
+
+void
+BufferedGraphicDisplayTest::testImageOperations()
+{
+	TestDisplay display;
+	display.clear();
+	display.fillRectangle(xpcc::glcd::Point(0, 0), 6, 64);
+
+	// the left column of the image is completely set
+	display.drawImageRaw(xpcc::glcd::Point(4, 3), 12, 12,
+			xpcc::accessor::asFlash(image), xpcc::glcd::RasterOperation::Or);
+	TEST_ASSERT_TRUE(display.isSet(4, 2));
+	TEST_ASSERT_TRUE(display.isSet(4, 3));
+	TEST_ASSERT_TRUE(display.isSet(7, 3));
+	TEST_ASSERT_FALSE(display.isSet(7, 4));
+	TEST_ASSERT_FALSE(display.isSet(16, 3));
+
+	display.drawImageRaw(xpcc::glcd::Point(4, 3), 12, 12,
+			xpcc::accessor::asFlash(image), xpcc::glcd::RasterOperation::AndNot);
+	TEST_ASSERT_FALSE(display.isSet(4, 3));
+	TEST_ASSERT_FALSE(display.isSet(4, 14));
+	TEST_ASSERT_TRUE(display.isSet(4, 15));
+	TEST_ASSERT_TRUE(display.isSet(5, 4));
+
+	display.drawImageRaw(xpcc::glcd::Point(4, 3), 12, 12,
+			xpcc::accessor::asFlash(image), xpcc::glcd::RasterOperation::Xor);
+	TEST_ASSERT_TRUE(display.isSet(4, 3));
+	TEST_ASSERT_TRUE(display.isSet(7, 3));
+
+	// only the columns of the image are marked as changed
+	display.update();
+	display.drawImageRaw(xpcc::glcd::Point(30, 20), 12, 12,
+			xpcc::accessor::asFlash(image), xpcc::glcd::RasterOperation::Xor);
+
+	TestDisplay::Window window;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(window));
+	TEST_ASSERT_EQUALS(window.firstColumn, 30);
+	TEST_ASSERT_EQUALS(window.lastColumn, 41);
+	TEST_ASSERT_EQUALS(window.firstPage, 2);
+	TEST_ASSERT_EQUALS(window.lastPage, 3);
+}
+
+void
+BufferedGraphicDisplayTest::testVirtualDisplay()
+{
+	TestDisplay display;
+	PixelDisplay reference;
+	display.clear();
+	reference.clear();
+
+	xpcc::VirtualGraphicDisplay window(&display,
+			xpcc::glcd::Point(20, 10), xpcc::glcd::Point(100, 50));
+	xpcc::VirtualGraphicDisplay referenceWindow(&reference,
+			xpcc::glcd::Point(20, 10), xpcc::glcd::Point(100, 50));
+
+	window.drawRectangle(xpcc::glcd::Point(0, 0), 80, 40);
+	referenceWindow.drawRectangle(xpcc::glcd::Point(0, 0), 80, 40);
+	window.fillRectangle(xpcc::glcd::Point(5, 3), 11, 9);
+	referenceWindow.fillRectangle(xpcc::glcd::Point(5, 3), 11, 9);
+	window.setCursor(3, 21);
+	referenceWindow.setCursor(3, 21);
+	window << "xpcc 42";
+	referenceWindow << "xpcc 42";
+
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+	TEST_ASSERT_TRUE(display.isSet(20, 10));
+	TEST_ASSERT_TRUE(display.isSet(25, 13));
+}
+
+namespace
+{
+	void
+	drawScene(xpcc::GraphicDisplay& display)
+	{
+		display.setColor(xpcc::glcd::Color::black());
+		display.fillRectangle(xpcc::glcd::Point(5, 2), 50, 30);
+		display.drawLine(0, 0, 127, 63);
+		display.drawCircle(xpcc::glcd::Point(64, 32), 20);
+		display.drawImageRaw(xpcc::glcd::Point(25, 11), 12, 12,
+				xpcc::accessor::asFlash(image));
+		display.setCursor(20, 30);
+		display << "Clipped text";
+	}
+}
+
+void
+BufferedGraphicDisplayTest::testClip()
+{
+	TestDisplay display;
+	PixelDisplay reference;
+	display.clear();
+	reference.clear();
+
+	TEST_ASSERT_FALSE(display.isClipped());
+	TEST_ASSERT_TRUE(display.pushClip(xpcc::glcd::Point(21, 9), 37, 26));
+	TEST_ASSERT_TRUE(reference.pushClip(xpcc::glcd::Point(21, 9), 37, 26));
+	TEST_ASSERT_TRUE(display.isClipped());
+
+	display.update();
+	drawScene(display);
+	drawScene(reference);
+
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+	TEST_ASSERT_TRUE(display.isSet(21, 9));
+	TEST_ASSERT_FALSE(display.isSet(20, 9));
+	TEST_ASSERT_FALSE(display.isSet(21, 8));
+	TEST_ASSERT_TRUE(display.isSet(50, 15));
+
+	// nothing outside of the clipping area has changed
+	for (int16_t x = 0; x < 128; ++x) {
+		for (int16_t y = 0; y < 64; ++y) {
+			if (x < 21 or x >= 58 or y < 9 or y >= 35) {
+				TEST_ASSERT_FALSE(display.isSet(x, y));
+			}
+		}
+	}
+
+	// only the pages of the clipping area are transmitted
+	TestDisplay::Window window;
+	TEST_ASSERT_TRUE(display.getDirtyWindow(window));
+	TEST_ASSERT_EQUALS(window.firstColumn, 21);
+	TEST_ASSERT_EQUALS(window.lastColumn, 57);
+	TEST_ASSERT_EQUALS(window.firstPage, 1);
+	TEST_ASSERT_EQUALS(window.lastPage, 4);
+
+	display.popClip();
+	TEST_ASSERT_FALSE(display.isClipped());
+	display.fillRectangle(xpcc::glcd::Point(0, 60), 4, 4);
+	TEST_ASSERT_TRUE(display.isSet(0, 63));
+}
+
+void
+BufferedGraphicDisplayTest::testClipStack()
+{
+	TestDisplay display;
+	display.clear();
+
+	// intersection of the nested areas
+	display.pushClip(xpcc::glcd::Point(10, 10), 40, 40);
+	display.pushClip(xpcc::glcd::Point(30, 0), 40, 20);
+	display.fillRectangle(xpcc::glcd::Point(0, 0), 128, 64);
+	TEST_ASSERT_TRUE(display.isSet(30, 10));
+	TEST_ASSERT_TRUE(display.isSet(49, 19));
+	TEST_ASSERT_FALSE(display.isSet(50, 19));
+	TEST_ASSERT_FALSE(display.isSet(30, 20));
+	TEST_ASSERT_FALSE(display.isSet(29, 10));
+
+	display.popClip();
+	display.fillRectangle(xpcc::glcd::Point(0, 0), 128, 64);
+	TEST_ASSERT_TRUE(display.isSet(10, 49));
+	TEST_ASSERT_FALSE(display.isSet(10, 50));
+
+	// empty intersection
+	display.pushClip(xpcc::glcd::Point(100, 0), 10, 10);
+	display.drawPixel(100, 0);
+	display.fillRectangle(xpcc::glcd::Point(0, 0), 128, 64);
+	TEST_ASSERT_FALSE(display.isSet(100, 0));
+	display.popClip();
+	display.popClip();
+
+	for (uint8_t i = 0; i < xpcc::GraphicDisplay::ClipStackSize; ++i) {
+		TEST_ASSERT_TRUE(display.pushClip(xpcc::glcd::Point(0, 0), 128 - i, 64));
+	}
+	TEST_ASSERT_FALSE(display.pushClip(xpcc::glcd::Point(0, 0), 1, 1));
+	for (uint8_t i = 0; i < xpcc::GraphicDisplay::ClipStackSize; ++i) {
+		display.popClip();
+	}
+	TEST_ASSERT_FALSE(display.isClipped());
+
+	// popping an empty stack does nothing
+	display.popClip();
+	display.drawPixel(127, 63);
+	TEST_ASSERT_TRUE(display.isSet(127, 63));
+}
+
+void
+BufferedGraphicDisplayTest::testVirtualDisplayClip()
+{
+	TestDisplay display;
+	PixelDisplay reference;
+	display.clear();
+	reference.clear();
+
+	xpcc::VirtualGraphicDisplay window(&display,
+			xpcc::glcd::Point(20, 10), xpcc::glcd::Point(100, 50));
+	xpcc::VirtualGraphicDisplay referenceWindow(&reference,
+			xpcc::glcd::Point(20, 10), xpcc::glcd::Point(100, 50));
+
+	window.pushClip(xpcc::glcd::Point(4, 4), 30, 20);
+	referenceWindow.pushClip(xpcc::glcd::Point(4, 4), 30, 20);
+	drawScene(window);
+	drawScene(referenceWindow);
+	window.popClip();
+
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0U);
+	TEST_ASSERT_TRUE(display.isSet(26, 14));
+	TEST_ASSERT_FALSE(display.isSet(26, 13));
+	TEST_ASSERT_FALSE(display.isClipped());
+}
@@ -0,0 +1,53 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+class BufferedGraphicDisplayTest : public unittest::TestSuite
+{
+public:
+	void
+	testInitiallyDirty();
+
+	void
+	testPixel();
+
+	void
+	testHorizontalLine();
+
+	void
+	testRectangle();
+
+	void
+	testClear();
+
+	void
+	testBytesSaved();
+
+	void
+	testFillOperations();
+
+	void
+	testImage();
+
+	void
+	testImageOperations();
+
+	void
+	testVirtualDisplay();
+
+	void
+	testClip();
+
+	void
+	testClipStack();
+
+	void
+	testVirtualDisplayClip();
+};
@@ -0,0 +1,297 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/color_graphic_display.hpp>
+#include <xpcc/ui/display/frame_buffer.hpp>
+
+#include "color_graphic_display_test.hpp"
+
+namespace
+{
+	typedef xpcc::glcd::format::Rgb565 Rgb565;
+	typedef xpcc::glcd::FrameBuffer<Rgb565, 40, 30> Panel;
+	typedef xpcc::ColorGraphicDisplay<Rgb565> Display;
+
+	const uint16_t red = 0xf800;
+	const uint16_t blue = 0x001f;
+
+	// Counts the windows and pixels sent to a panel
+	class CountingBackend : public xpcc::glcd::ColorBackend<Rgb565>
+	{
+	public:
+		CountingBackend(xpcc::glcd::ColorBackend<Rgb565>& panel) :
+			panel(panel), windows(0), pixels(0)
+		{
+		}
+
+		virtual void
+		setWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+		{
+			++windows;
+			panel.setWindow(x, y, width, height);
+		}
+
+		virtual void
+		writePixels(const Pixel *pixels, std::size_t count)
+		{
+			this->pixels += count;
+			panel.writePixels(pixels, count);
+		}
+
+		xpcc::glcd::ColorBackend<Rgb565>& panel;
+		uint32_t windows;
+		uint32_t pixels;
+	};
+
+	// 5x10 arrow
+	FLASH_STORAGE(uint8_t arrow[]) =
+	{
+		0x10, 0x38, 0x7c, 0xfe, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x03,
+	};
+
+	uint16_t
+	countPixels(const Panel& panel, uint16_t pixel)
+	{
+		uint16_t count = 0;
+		for (uint16_t y = 0; y < 30; ++y) {
+			for (uint16_t x = 0; x < 40; ++x) {
+				if (panel.getPixel(x, y) == pixel) {
+					++count;
+				}
+			}
+		}
+		return count;
+	}
+}
+
+void
+ColorGraphicDisplayTest::testPixelFormats()
+{
+	TEST_ASSERT_EQUALS(Rgb565::fromRgb(255, 0, 0), 0xf800);
+	TEST_ASSERT_EQUALS(Rgb565::fromRgb(0, 255, 0), 0x07e0);
+	TEST_ASSERT_EQUALS(Rgb565::fromRgb(255, 255, 255), 0xffff);
+
+	xpcc::color::Rgb rgb = Rgb565::toRgb(0xffff);
+	TEST_ASSERT_EQUALS(rgb.red, 255);
+	TEST_ASSERT_EQUALS(rgb.green, 255);
+	TEST_ASSERT_EQUALS(rgb.blue, 255);
+
+	rgb = Rgb565::toRgb(Rgb565::fromRgb(200, 100, 50));
+	TEST_ASSERT_EQUALS_DELTA(rgb.red, 200, 7);
+	TEST_ASSERT_EQUALS_DELTA(rgb.green, 100, 3);
+	TEST_ASSERT_EQUALS_DELTA(rgb.blue, 50, 7);
+
+	// same rounding as the xpcc::color conversions
+	TEST_ASSERT_EQUALS(Rgb565::fromRgb(0, 0, 7), 0x0001);
+	uint32_t wrong = 0;
+	for (uint32_t ii = 0; ii <= 0xffff; ++ii)
+	{
+		rgb = Rgb565::toRgb(ii);
+		const xpcc::color::Rgb expected = xpcc::color::rgb565ToRgb(ii);
+		wrong += (rgb.red != expected.red) || (rgb.green != expected.green) ||
+				(rgb.blue != expected.blue) ||
+				(Rgb565::fromRgb(rgb.red, rgb.green, rgb.blue) != ii);
+	}
+	TEST_ASSERT_EQUALS(wrong, 0U);
+
+	typedef xpcc::glcd::format::Rgb888 Rgb888;
+	TEST_ASSERT_EQUALS(Rgb888::fromRgb(0x12, 0x34, 0x56), 0x123456U);
+	TEST_ASSERT_EQUALS(Rgb888::fromRgb565(0xf800), 0xff0000U);
+	TEST_ASSERT_EQUALS(Rgb888::toRgb(0x123456).green, 0x34);
+
+	typedef xpcc::glcd::format::L8 L8;
+	TEST_ASSERT_EQUALS(L8::fromRgb(255, 255, 255), 255);
+	TEST_ASSERT_EQUALS(L8::fromRgb(0, 0, 0), 0);
+	TEST_ASSERT_TRUE(L8::fromRgb(0, 255, 0) > L8::fromRgb(255, 0, 0));
+	TEST_ASSERT_TRUE(L8::fromRgb(255, 0, 0) > L8::fromRgb(0, 0, 255));
+	TEST_ASSERT_EQUALS(L8::fromRgb(0, 255, 0), 150);
+	TEST_ASSERT_EQUALS(L8::fromRgb(100, 150, 200),
+			xpcc::color::luminance(xpcc::color::Rgb(100, 150, 200)));
+
+	TEST_ASSERT_EQUALS(xpcc::glcd::toPixel<Rgb565>(xpcc::color::Rgb(0, 0, 255)), blue);
+}
+
+void
+ColorGraphicDisplayTest::testFillRectangle()
+{
+	Panel panel;
+	Display display(panel, 40, 30);
+	display.setBackgroundColor(xpcc::glcd::Color::blue());
+	display.clear();
+	TEST_ASSERT_EQUALS(countPixels(panel, blue), 40 * 30);
+
+	display.setColor(xpcc::glcd::Color::red());
+	display.fillRectangle(5, 6, 10, 4);
+	TEST_ASSERT_EQUALS(countPixels(panel, red), 40);
+	TEST_ASSERT_EQUALS(panel.getPixel(5, 6), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(14, 9), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(15, 9), blue);
+	TEST_ASSERT_EQUALS(panel.getPixel(14, 10), blue);
+
+	// clipped at the borders
+	display.clear();
+	display.fillRectangle(-3, -2, 5, 4);
+	display.fillRectangle(38, 28, 10, 10);
+	TEST_ASSERT_EQUALS(countPixels(panel, red), 2 * 2 + 2 * 2);
+	TEST_ASSERT_EQUALS(panel.getPixel(0, 0), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(39, 29), red);
+
+	display.clear();
+	display.drawRectangle(xpcc::glcd::Point(2, 2), 10, 5);
+	TEST_ASSERT_EQUALS(countPixels(panel, red), 2 * 10 + 2 * 3);
+
+	display.clear();
+	display.drawLine(0, 0, 9, 9);
+	TEST_ASSERT_EQUALS(countPixels(panel, red), 10);
+	TEST_ASSERT_EQUALS(panel.getPixel(4, 4), red);
+}
+
+void
+ColorGraphicDisplayTest::testSingleWindow()
+{
+	Panel panel;
+	CountingBackend backend(panel);
+	Display display(backend, 40, 30);
+
+	display.fillRectangle(0, 0, 20, 10);
+	TEST_ASSERT_EQUALS(backend.windows, 1U);
+	TEST_ASSERT_EQUALS(backend.pixels, 200U);
+
+	// a character of the default 5x8 font
+	backend.windows = 0;
+	backend.pixels = 0;
+	display.setCursor(3, 3);
+	display << 'A';
+	TEST_ASSERT_EQUALS(backend.windows, 1U);
+	TEST_ASSERT_EQUALS(backend.pixels, 5U * 8U);
+}
+
+void
+ColorGraphicDisplayTest::testImage()
+{
+	Panel panel;
+	Display display(panel, 40, 30);
+	display.setColor(xpcc::glcd::Color::red());
+	display.setBackgroundColor(xpcc::glcd::Color::blue());
+	display.clear();
+
+	display.drawImageRaw(xpcc::glcd::Point(10, 3), 5, 10, xpcc::accessor::asFlash(arrow));
+	TEST_ASSERT_EQUALS(countPixels(panel, red), 1 + 3 + 5 + 7 + 8 + 2);
+	TEST_ASSERT_EQUALS(panel.getPixel(10, 7), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(10, 6), blue);
+	TEST_ASSERT_EQUALS(panel.getPixel(14, 3), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(14, 12), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(13, 12), blue);
+
+	// partly outside, the visible part stays at its position
+	display.clear();
+	display.drawImageRaw(xpcc::glcd::Point(-4, -4), 5, 10, xpcc::accessor::asFlash(arrow));
+	TEST_ASSERT_EQUALS(countPixels(panel, red), 6);
+	TEST_ASSERT_EQUALS(panel.getPixel(0, 0), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(0, 5), red);
+	TEST_ASSERT_EQUALS(panel.getPixel(1, 0), blue);
+}
+
+void
+ColorGraphicDisplayTest::testBitmap()
+{
+	Panel panel;
+	Display display(panel, 40, 30);
+	display.clear();
+
+	uint16_t bitmap[4 * 3];
+	for (uint16_t i = 0; i < 12; ++i) {
+		bitmap[i] = i + 1;
+	}
+
+	display.drawBitmap(xpcc::glcd::Point(2, 1), 4, 3, bitmap);
+	TEST_ASSERT_EQUALS(panel.getPixel(2, 1), 1);
+	TEST_ASSERT_EQUALS(panel.getPixel(5, 1), 4);
+	TEST_ASSERT_EQUALS(panel.getPixel(2, 2), 5);
+	TEST_ASSERT_EQUALS(panel.getPixel(5, 3), 12);
+
+	// clipped on the left and the bottom
+	display.clear();
+	display.drawBitmap(xpcc::glcd::Point(-2, 28), 4, 3, bitmap);
+	TEST_ASSERT_EQUALS(panel.getPixel(0, 28), 3);
+	TEST_ASSERT_EQUALS(panel.getPixel(1, 28), 4);
+	TEST_ASSERT_EQUALS(panel.getPixel(0, 29), 7);
+	TEST_ASSERT_EQUALS(panel.getPixel(1, 29), 8);
+	TEST_ASSERT_EQUALS(panel.getPixel(2, 29), 0);
+}
+
+void
+ColorGraphicDisplayTest::testTiles()
+{
+	// draw directly
+	Panel direct;
+	Display display(direct, 40, 30);
+	display.setColor(xpcc::glcd::Color::red());
+	display.clear();
+	display.fillRectangle(3, 4, 30, 20);
+	display.setColor(xpcc::glcd::Color::white());
+	display.drawCircle(xpcc::glcd::Point(20, 15), 9);
+	display.setCursor(7, 11);
+	display << "xpcc";
+
+	// the same in tiles of 16x8 pixels
+	Panel panel;
+	CountingBackend backend(panel);
+	xpcc::glcd::FrameBuffer<Rgb565, 16, 8> tile;
+	display.setBackend(tile);
+	for (int16_t y = 0; y < 30; y += 8)
+	{
+		for (int16_t x = 0; x < 40; x += 16)
+		{
+			tile.setOrigin(x, y);
+			display.setColor(xpcc::glcd::Color::red());
+			display.clear();
+			display.fillRectangle(3, 4, 30, 20);
+			display.setColor(xpcc::glcd::Color::white());
+			display.drawCircle(xpcc::glcd::Point(20, 15), 9);
+			display.setCursor(7, 11);
+			display << "xpcc";
+			tile.flush(backend);
+		}
+	}
+
+	// one window per tile
+	TEST_ASSERT_EQUALS(backend.windows, 3U * 4U);
+
+	uint16_t differences = 0;
+	for (uint16_t y = 0; y < 30; ++y) {
+		for (uint16_t x = 0; x < 40; ++x) {
+			if (panel.getPixel(x, y) != direct.getPixel(x, y)) {
+				++differences;
+			}
+		}
+	}
+	TEST_ASSERT_EQUALS(differences, 0);
+}
+
+void
+ColorGraphicDisplayTest::testFormats()
+{
+	xpcc::glcd::FrameBuffer<xpcc::glcd::format::Rgb888, 8, 8> rgb888;
+	xpcc::ColorGraphicDisplay<xpcc::glcd::format::Rgb888> display888(rgb888, 8, 8);
+	display888.setBackgroundColor(xpcc::glcd::Color::white());
+	display888.clear();
+	display888.setColor(xpcc::glcd::Color::red());
+	display888.drawPixel(3, 4);
+	TEST_ASSERT_EQUALS(rgb888.getPixel(3, 4), 0xff0000U);
+	TEST_ASSERT_EQUALS(rgb888.getPixel(4, 4), 0xffffffU);
+
+	xpcc::glcd::FrameBuffer<xpcc::glcd::format::L8, 8, 8> l8;
+	xpcc::ColorGraphicDisplay<xpcc::glcd::format::L8> displayL8(l8, 8, 8);
+	displayL8.clear();
+	displayL8.fillRectangle(2, 2, 2, 2);
+	TEST_ASSERT_EQUALS(l8.getPixel(2, 2), 255);
+	TEST_ASSERT_EQUALS(l8.getPixel(1, 1), 0);
+}
@@ -0,0 +1,92 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "glyph_cache_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+#include <xpcc/ui/display/glyph_cache.hpp>
+
+#include "test_display.hpp"
+
+namespace
+{
+	const uint32_t frames = 500;
+
+	// 21 characters of 5+1 pixel in 8 lines of 8 pixel
+	uint32_t
+	render(TestDisplay& display)
+	{
+		char line[22];
+		line[21] = '\0';
+
+		const unittest::Stopwatch stopwatch;
+		for (uint32_t frame = 0; frame < frames; ++frame)
+		{
+			display.setCursor(0, 0);
+			for (uint8_t row = 0; row < 8; ++row)
+			{
+				for (uint8_t column = 0; column < 21; ++column) {
+					line[column] = ' ' + (frame + row * 21 + column) % 95;
+				}
+				display.setCursor(0, row * 8);
+				display << line;
+			}
+		}
+		return stopwatch.getTicks();
+	}
+}
+
+void
+GlyphCacheBenchmarkTest::testTextScreen()
+{
+	TestDisplay flash;
+	flash.clear();
+	const uint32_t flashTicks = render(flash);
+
+	xpcc::glcd::StaticGlyphCache<2 * 96 + 96 * 5> cache;
+	cache.setFont(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8));
+
+	TestDisplay cached;
+	cached.clear();
+	cached.setFont(cache);
+	const uint32_t cacheTicks = render(cached);
+
+	const uint32_t speedup = uint64_t(flashTicks) * 10 / (cacheTicks ? cacheTicks : 1);
+	XPCC_LOG_INFO << "21x8 text screen: "
+			<< unittest::getNanoseconds(flashTicks, frames)
+			<< " ns/frame from flash, "
+			<< unittest::getNanoseconds(cacheTicks, frames)
+			<< " ns/frame with glyph cache, "
+			<< (speedup / 10) << "." << (speedup % 10) << "x faster" << xpcc::endl;
+
+	uint16_t differences = 0;
+	for (int16_t x = 0; x < 128; ++x) {
+		for (int16_t y = 0; y < 64; ++y) {
+			if (flash.isSet(x, y) != cached.isSet(x, y)) {
+				++differences;
+			}
+		}
+	}
+	TEST_ASSERT_EQUALS(differences, 0U);
+
+	// all 95 printable characters were decoded only once
+	TEST_ASSERT_EQUALS(cache.getMisses(), 95U);
+}
+
+#else
+
+void
+GlyphCacheBenchmarkTest::testTextScreen()
+{
+}
+
+#endif
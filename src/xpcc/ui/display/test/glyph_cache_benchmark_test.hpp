@@ -0,0 +1,20 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Redraws a full screen of 21x8 characters, once with the glyphs read
+/// from flash and once through a glyph cache. Only runs on hosted
+/// targets, the results are printed to the info log.
+class GlyphCacheBenchmarkTest : public unittest::TestSuite
+{
+public:
+	void
+	testTextScreen();
+};
@@ -0,0 +1,244 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/glyph_cache.hpp>
+
+#include "test_display.hpp"
+#include "glyph_cache_test.hpp"
+
+namespace
+{
+	// 'A' to 'C', 8 pixel high
+	FLASH_STORAGE(uint8_t plainFont[]) =
+	{
+		20, 0, 3, 8, 1, 1, 'A', 3,
+		3, 4, 2,
+		0x7e, 0x09, 0x7e,
+		0x7f, 0x49, 0x49, 0x36,
+		0xff, 0xff,
+	};
+
+	// same glyphs, run-length encoded
+	FLASH_STORAGE(uint8_t encodedFont[]) =
+	{
+		29, 0x80, 3, 8, 1, 1, 'A', 3,
+		3, 4, 2,
+		0, 0, 4, 0, 10, 0,
+		0x02, 0x7e, 0x09, 0x7e,
+		0x00, 0x7f, 0x80, 0x49, 0x00, 0x36,
+		0x80, 0xff,
+	};
+
+	// 'A' with 20 x 12 pixels, wider than the buffer for drawing without cache
+	FLASH_STORAGE(uint8_t plainWideFont[]) =
+	{
+		49, 0, 20, 12, 1, 1, 'A', 1,
+		20,
+		0x00, 0x0d, 0x1a, 0x27, 0x34, 0x41, 0x4e, 0x5b, 0x68, 0x75,
+		0x82, 0x8f, 0x9c, 0xa9, 0xb6, 0xc3, 0xd0, 0xdd, 0xea, 0xf7,
+		0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+		0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	};
+
+	// 20 literals and a run of 20 bytes
+	FLASH_STORAGE(uint8_t encodedWideFont[]) =
+	{
+		34, 0x80, 20, 12, 1, 1, 'A', 1,
+		20,
+		0, 0,
+		0x13,
+		0x00, 0x0d, 0x1a, 0x27, 0x34, 0x41, 0x4e, 0x5b, 0x68, 0x75,
+		0x82, 0x8f, 0x9c, 0xa9, 0xb6, 0xc3, 0xd0, 0xdd, 0xea, 0xf7,
+		0x92, 0x0f,
+	};
+
+	// two literals, 0xaa five times, one literal, 0x00 129 times
+	FLASH_STORAGE(uint8_t encodedData[]) =
+	{
+		0x01, 0x12, 0x34, 0x83, 0xaa, 0x00, 0x56, 0xff, 0x00,
+	};
+}
+
+void
+GlyphCacheTest::testDecode()
+{
+	uint8_t output[137];
+	TEST_ASSERT_EQUALS(xpcc::glcd::GlyphCache::decode(
+			xpcc::accessor::asFlash(encodedData), output, 137), 9);
+
+	TEST_ASSERT_EQUALS(output[0], 0x12);
+	TEST_ASSERT_EQUALS(output[1], 0x34);
+	for (uint8_t i = 2; i < 7; ++i) {
+		TEST_ASSERT_EQUALS(output[i], 0xaa);
+	}
+	TEST_ASSERT_EQUALS(output[7], 0x56);
+	for (uint8_t i = 8; i < 137; ++i) {
+		TEST_ASSERT_EQUALS(output[i], 0x00);
+	}
+}
+
+void
+GlyphCacheTest::testGlyph()
+{
+	xpcc::glcd::StaticGlyphCache<32> cache;
+	cache.setFont(xpcc::accessor::asFlash(encodedFont));
+	TEST_ASSERT_TRUE(xpcc::glcd::GlyphCache::isRunLengthEncoded(cache.getFont()));
+
+	xpcc::glcd::GlyphCache::Glyph glyph;
+	TEST_ASSERT_FALSE(cache.getGlyph('@', glyph));
+	TEST_ASSERT_FALSE(cache.getGlyph('D', glyph));
+
+	TEST_ASSERT_TRUE(cache.getGlyph('B', glyph));
+	TEST_ASSERT_EQUALS(glyph.width, 4);
+	const uint8_t expected[] = { 0x7f, 0x49, 0x49, 0x36 };
+	TEST_ASSERT_EQUALS_ARRAY(glyph.data, expected, 4);
+	TEST_ASSERT_EQUALS(cache.getMisses(), 1);
+
+	// second access is served from the cache
+	const uint8_t *data = glyph.data;
+	TEST_ASSERT_TRUE(cache.getGlyph('B', glyph));
+	TEST_ASSERT_TRUE(glyph.data == data);
+	TEST_ASSERT_EQUALS(cache.getMisses(), 1);
+
+	TEST_ASSERT_TRUE(cache.getGlyph('C', glyph));
+	TEST_ASSERT_EQUALS(glyph.width, 2);
+	TEST_ASSERT_EQUALS(glyph.data[0], 0xff);
+	TEST_ASSERT_EQUALS(glyph.data[1], 0xff);
+	TEST_ASSERT_EQUALS(cache.getMisses(), 2);
+}
+
+void
+GlyphCacheTest::testPlainFont()
+{
+	xpcc::glcd::StaticGlyphCache<512> cache;
+	cache.setFont(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8));
+
+	TestDisplay display;
+	display.clear();
+	display.setFont(cache);
+
+	PixelDisplay reference;
+
+	const int16_t positions[][2] = { {0, 0}, {3, 13}, {-2, 29}, {100, 59} };
+	for (auto p : positions)
+	{
+		display.setCursor(p[0], p[1]);
+		display << "Hello World 123";
+		reference.setCursor(p[0], p[1]);
+		reference << "Hello World 123";
+
+		TEST_ASSERT_EQUALS(display.getCursor().getX(), reference.getCursor().getX());
+	}
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0);
+
+	// every character is decoded only once
+	TEST_ASSERT_EQUALS(cache.getMisses(), 11);
+}
+
+void
+GlyphCacheTest::testRunLengthFont()
+{
+	xpcc::glcd::StaticGlyphCache<32> cache;
+	cache.setFont(xpcc::accessor::asFlash(encodedFont));
+
+	TestDisplay display;
+	display.clear();
+	display.setFont(cache);
+	display.setCursor(5, 3);
+	display << "ABCCBA";
+
+	PixelDisplay reference;
+	reference.setFont(plainFont);
+	reference.setCursor(5, 3);
+	reference << "ABCCBA";
+
+	TEST_ASSERT_EQUALS(display.getCursor().getX(), reference.getCursor().getX());
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0);
+	TEST_ASSERT_EQUALS(cache.getMisses(), 3);
+}
+
+void
+GlyphCacheTest::testRunLengthFontWithoutCache()
+{
+	// decoded again for every character
+	TestDisplay display;
+	display.clear();
+	display.setFont(encodedFont);
+	display.setCursor(5, 3);
+	display << "ABCCBA";
+
+	PixelDisplay reference;
+	reference.setFont(plainFont);
+	reference.setCursor(5, 3);
+	reference << "ABCCBA";
+
+	TEST_ASSERT_EQUALS(display.getCursor().getX(), reference.getCursor().getX());
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0);
+
+	// glyph of several pieces, runs continue across them
+	display.clear();
+	display.setFont(encodedWideFont);
+	display.setCursor(-3, 50);
+	display << "AA";
+
+	reference.clear();
+	reference.setFont(plainWideFont);
+	reference.setCursor(-3, 50);
+	reference << "AA";
+
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0);
+}
+
+void
+GlyphCacheTest::testEviction()
+{
+	// index for three characters, 'A' and 'B' fit together
+	xpcc::glcd::StaticGlyphCache<13> cache;
+	cache.setFont(xpcc::accessor::asFlash(encodedFont));
+
+	TestDisplay display;
+	display.clear();
+	display.setFont(cache);
+	display << "ABCAB";
+
+	PixelDisplay reference;
+	reference.setFont(plainFont);
+	reference << "ABCAB";
+
+	TEST_ASSERT_EQUALS(countDifferences(display, reference), 0);
+
+	// 'C' dropped 'A' and 'B'
+	TEST_ASSERT_EQUALS(cache.getMisses(), 5);
+
+	// too small for any glyph
+	xpcc::glcd::StaticGlyphCache<9> tiny;
+	tiny.setFont(xpcc::accessor::asFlash(encodedFont));
+	xpcc::glcd::GlyphCache::Glyph glyph;
+	TEST_ASSERT_FALSE(tiny.getGlyph('B', glyph));
+	TEST_ASSERT_TRUE(tiny.getGlyph('A', glyph));
+}
+
+void
+GlyphCacheTest::testStringWidth()
+{
+	TestDisplay display;
+	display.setFont(plainFont);
+
+	// '?' is not part of the font
+	TEST_ASSERT_EQUALS(display.getStringWidth("A?BC"), 12);
+	display.setCursor(0, 0);
+	display << "A?BC";
+	TEST_ASSERT_EQUALS(display.getCursor().getX(), 12);
+
+	display.setFont(xpcc::font::FixedWidth5x8);
+	const char *text = "Width: 42";
+	display.setCursor(0, 0);
+	display << text;
+	TEST_ASSERT_EQUALS(display.getStringWidth(text), display.getCursor().getX());
+}
@@ -0,0 +1,281 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/display/offscreen_display.hpp>
+#include <xpcc/ui/display/virtual_graphic_display.hpp>
+#include <xpcc/ui/display/pixel_format.hpp>
+#include <xpcc/ui/display/font.hpp>
+
+#include "offscreen_display_test.hpp"
+
+namespace
+{
+	// stores all data in a memory buffer
+	class MemoryWriter : public xpcc::IODevice
+	{
+	public:
+		MemoryWriter() :
+			bytesWritten(0)
+		{
+		}
+
+		virtual void
+		write(char c)
+		{
+			if (bytesWritten < sizeof(buffer)) {
+				buffer[bytesWritten++] = c;
+			}
+		}
+
+		using xpcc::IODevice::write;
+
+		virtual void
+		flush()
+		{
+		}
+
+		virtual bool
+		read(char& /*c*/)
+		{
+			return false;
+		}
+
+		uint8_t buffer[400];
+		std::size_t bytesWritten;
+	};
+
+	const char goldenText[] =
+		"P1\n"
+		"# \"xpcc\" in FixedWidth5x8\n"
+		"24 8\n"
+		"000000000000000000000000\n"
+		"000000000000000000000000\n"
+		"100100111100011100011100\n"
+		"100100100010100010100010\n"
+		"011000100010100000100000\n"
+		"100100111100100010100010\n"
+		"100100100000011100011100\n"
+		"000000100000000000000000\n";
+
+	const char goldenWindow[] =
+		"P1 16 16\n"
+		"0000000000000000\n"
+		"0000000000000000\n"
+		"0000000000000000\n"
+		"0000000000000000\n"
+		"0000111111111100\n"
+		"0000110000111100\n"
+		"0000101000111100\n"
+		"0000100100111100\n"
+		"0000100010000100\n"
+		"0000100001000100\n"
+		"0000100000100100\n"
+		"0000100000010100\n"
+		"0000100000001100\n"
+		"0000111111111100\n"
+		"0000000000000000\n"
+		"0000000000000000\n";
+
+	typedef xpcc::glcd::format::Rgb565 Rgb565;
+}
+
+// ----------------------------------------------------------------------------
+void
+OffscreenDisplayTest::testReadBitmap()
+{
+	// ASCII with comments and digits without separator
+	const char ascii[] = "P1 # comment\n3 2\n1 0 1\n010";
+	xpcc::glcd::pnm::Reader reader(ascii, sizeof(ascii) - 1);
+	TEST_ASSERT_TRUE(reader.isValid());
+	TEST_ASSERT_TRUE(reader.isBitmap());
+	TEST_ASSERT_EQUALS(reader.getWidth(), 3);
+	TEST_ASSERT_EQUALS(reader.getHeight(), 2);
+
+	const bool expected[] = { true, false, true, false, true, false };
+	xpcc::color::Rgb pixel;
+	for (uint8_t i = 0; i < 6; ++i)
+	{
+		TEST_ASSERT_TRUE(reader.read(pixel));
+		TEST_ASSERT_EQUALS(pixel.red, expected[i] ? 0 : 255);
+	}
+	TEST_ASSERT_FALSE(reader.read(pixel));
+
+	// binary, every row starts with a new byte
+	const uint8_t binary[] = { 'P', '4', ' ', '1', '0', ' ', '2', '\n',
+			0xc0, 0x40, 0x80, 0x00 };
+	xpcc::glcd::pnm::Reader reader2(binary, sizeof(binary));
+	TEST_ASSERT_TRUE(reader2.isValid());
+	TEST_ASSERT_EQUALS(reader2.getType(), '4');
+
+	uint8_t set = 0;
+	uint8_t count = 0;
+	while (reader2.read(pixel))
+	{
+		if (pixel.red == 0)
+		{
+			// (0, 0), (1, 0), (9, 0) and (0, 1)
+			TEST_ASSERT_TRUE(count == 0 or count == 1 or count == 9 or count == 10);
+			++set;
+		}
+		++count;
+	}
+	TEST_ASSERT_EQUALS(count, 20);
+	TEST_ASSERT_EQUALS(set, 4);
+}
+
+void
+OffscreenDisplayTest::testReadColorImage()
+{
+	// maximum 15 is scaled to 255
+	const char ascii[] = "P3\n2 1\n15\n15 0 5  0 15 15\n";
+	xpcc::glcd::pnm::Reader reader(ascii, sizeof(ascii) - 1);
+	TEST_ASSERT_TRUE(reader.isValid());
+	TEST_ASSERT_FALSE(reader.isBitmap());
+
+	xpcc::color::Rgb pixel;
+	TEST_ASSERT_TRUE(reader.read(pixel));
+	TEST_ASSERT_EQUALS(pixel.red, 255);
+	TEST_ASSERT_EQUALS(pixel.green, 0);
+	TEST_ASSERT_EQUALS(pixel.blue, 85);
+	TEST_ASSERT_TRUE(reader.read(pixel));
+	TEST_ASSERT_EQUALS(pixel.red, 0);
+	TEST_ASSERT_EQUALS(pixel.green, 255);
+	TEST_ASSERT_FALSE(reader.read(pixel));
+
+	const uint8_t binary[] = { 'P', '6', '\n', '1', ' ', '1', '\n', '2', '5', '5', '\n',
+			10, 20, 30 };
+	xpcc::glcd::pnm::Reader reader2(binary, sizeof(binary));
+	TEST_ASSERT_TRUE(reader2.read(pixel));
+	TEST_ASSERT_EQUALS(pixel.red, 10);
+	TEST_ASSERT_EQUALS(pixel.green, 20);
+	TEST_ASSERT_EQUALS(pixel.blue, 30);
+
+	// data ends too early
+	xpcc::glcd::pnm::Reader reader3(binary, sizeof(binary) - 1);
+	TEST_ASSERT_TRUE(reader3.isValid());
+	TEST_ASSERT_FALSE(reader3.read(pixel));
+}
+
+void
+OffscreenDisplayTest::testInvalidImage()
+{
+	TEST_ASSERT_FALSE(xpcc::glcd::pnm::Reader("P2 1 1 1 0", 10).isValid());
+	TEST_ASSERT_FALSE(xpcc::glcd::pnm::Reader("P1 1", 4).isValid());
+	TEST_ASSERT_FALSE(xpcc::glcd::pnm::Reader("P3 1 1 256 0 0 0", 16).isValid());
+	TEST_ASSERT_FALSE(xpcc::glcd::pnm::Reader("X", 1).isValid());
+
+	xpcc::OffscreenDisplay<8, 8> display;
+	TEST_ASSERT_EQUALS(display.compareSnapshot("P1 8 7", 6), -1);
+	TEST_ASSERT_EQUALS(display.compareSnapshot("P1 8 8 1", 8), -1);
+	TEST_ASSERT_EQUALS(display.compareSnapshot("P5 8 8 255", 10), -1);
+}
+
+// ----------------------------------------------------------------------------
+void
+OffscreenDisplayTest::testSnapshot()
+{
+	xpcc::OffscreenDisplay<12, 8> display;
+	display.setColor(xpcc::glcd::Color::black());
+	display.fillRectangle(xpcc::glcd::Point(0, 0), 9, 2);
+	display.drawLine(11, 0, 11, 7);
+
+	MemoryWriter writer;
+	display.writeSnapshot(writer);
+
+	const uint8_t expected[] = { 'P', '4', '\n', '1', '2', ' ', '8', '\n',
+			0xff, 0x90, 0xff, 0x90, 0x00, 0x10, 0x00, 0x10,
+			0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10 };
+	TEST_ASSERT_EQUALS(writer.bytesWritten, sizeof(expected));
+	TEST_ASSERT_EQUALS_ARRAY(writer.buffer, expected, sizeof(expected));
+
+	// a snapshot is its own golden image
+	TEST_ASSERT_EQUALS(display.compareSnapshot(writer.buffer, writer.bytesWritten), 0);
+
+	display.drawPixel(5, 5);
+	TEST_ASSERT_EQUALS(display.compareSnapshot(writer.buffer, writer.bytesWritten), 1);
+
+	TEST_ASSERT_EQUALS(display.getUpdates(), 0U);
+	display.update();
+	TEST_ASSERT_EQUALS(display.getUpdates(), 1U);
+	TEST_ASSERT_FALSE(display.isDirty());
+}
+
+void
+OffscreenDisplayTest::testGoldenText()
+{
+	xpcc::OffscreenDisplay<24, 8> display;
+	display.setFont(xpcc::font::FixedWidth5x8);
+	display.setColor(xpcc::glcd::Color::black());
+	display << "xpcc";
+
+	TEST_ASSERT_EQUALS(display.compareSnapshot(goldenText, sizeof(goldenText) - 1), 0);
+
+	display.clear();
+	display.setCursor(0, 0);
+	display << "xpc";
+	// the second 'c' has 11 set pixels
+	TEST_ASSERT_EQUALS(display.compareSnapshot(goldenText, sizeof(goldenText) - 1), 11);
+}
+
+void
+OffscreenDisplayTest::testGoldenVirtualDisplay()
+{
+	xpcc::OffscreenDisplay<16, 16> display;
+	display.setColor(xpcc::glcd::Color::black());
+
+	xpcc::VirtualGraphicDisplay window(&display,
+			xpcc::glcd::Point(4, 4), xpcc::glcd::Point(14, 14));
+	window.drawRectangle(xpcc::glcd::Point(0, 0), 10, 10);
+	window.drawLine(0, 0, 9, 9);
+	window.fillRectangle(xpcc::glcd::Point(6, 1), 3, 3);
+
+	TEST_ASSERT_EQUALS(display.compareSnapshot(goldenWindow, sizeof(goldenWindow) - 1), 0);
+}
+
+// ----------------------------------------------------------------------------
+void
+OffscreenDisplayTest::testColorSnapshot()
+{
+	xpcc::OffscreenColorDisplay<Rgb565, 4, 2> display;
+	display.setColor(xpcc::glcd::Color::red());
+	display.fillRectangle(xpcc::glcd::Point(1, 0), 2, 2);
+	TEST_ASSERT_EQUALS(display.getPixelValue(1, 0), 0xf800);
+	TEST_ASSERT_EQUALS(display.getPixelValue(0, 0), 0x0000);
+
+	MemoryWriter writer;
+	display.writeSnapshot(writer);
+
+	const uint8_t header[] = { 'P', '6', '\n', '4', ' ', '2', '\n', '2', '5', '5', '\n' };
+	TEST_ASSERT_EQUALS(writer.bytesWritten, sizeof(header) + 4 * 2 * 3);
+	TEST_ASSERT_EQUALS_ARRAY(writer.buffer, header, sizeof(header));
+
+	const uint8_t pixels[] = { 0, 0, 0, 255, 0, 0, 255, 0, 0, 0, 0, 0 };
+	TEST_ASSERT_EQUALS_ARRAY(writer.buffer + sizeof(header), pixels, sizeof(pixels));
+
+	TEST_ASSERT_EQUALS(display.compareSnapshot(writer.buffer, writer.bytesWritten), 0);
+
+	display.setColor(xpcc::glcd::Color::blue());
+	display.fillRectangle(xpcc::glcd::Point(0, 1), 4, 1);
+	TEST_ASSERT_EQUALS(display.compareSnapshot(writer.buffer, writer.bytesWritten), 4);
+}
+
+void
+OffscreenDisplayTest::testColorGolden()
+{
+	xpcc::OffscreenColorDisplay<Rgb565, 3, 1> display;
+	display.setColor(xpcc::glcd::Color(100, 150, 200));
+	display.fillRectangle(xpcc::glcd::Point(1, 0), 1, 1);
+	display.setColor(xpcc::glcd::Color::white());
+	display.fillRectangle(xpcc::glcd::Point(2, 0), 1, 1);
+
+	// Rgb565 loses the lower bits of the 24-bit colour
+	const char golden[] = "P3 3 1 255  0 0 0  100 150 200  255 255 255";
+	TEST_ASSERT_EQUALS(display.compareSnapshot(golden, sizeof(golden) - 1), 1);
+	TEST_ASSERT_EQUALS(display.compareSnapshot(golden, sizeof(golden) - 1, 8), 0);
+}
@@ -0,0 +1,85 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "render_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+#include <xpcc/ui/display/offscreen_display.hpp>
+#include <xpcc/ui/display/pixel_format.hpp>
+#include <xpcc/ui/display/render_benchmark.hpp>
+#include <xpcc/ui/display/font.hpp>
+
+namespace
+{
+	const uint16_t iterations = 50;
+
+	void
+	printResults(const char *display, const xpcc::glcd::RenderBenchmark& benchmark)
+	{
+		typedef xpcc::glcd::RenderBenchmark Benchmark;
+		XPCC_LOG_INFO << display << ": "
+				<< Benchmark::getNanoseconds(benchmark.lines) << " ns lines, "
+				<< Benchmark::getNanoseconds(benchmark.rectangles) << " ns rectangles, "
+				<< Benchmark::getNanoseconds(benchmark.circles) << " ns circles, "
+				<< Benchmark::getNanoseconds(benchmark.text) << " ns text"
+				<< xpcc::endl;
+	}
+}
+
+void
+RenderBenchmarkTest::testMonochrome()
+{
+	xpcc::OffscreenDisplay<128, 64> display;
+	display.setFont(xpcc::font::FixedWidth5x8);
+	display.setColor(xpcc::glcd::Color::black());
+
+	xpcc::glcd::RenderBenchmark benchmark(display, iterations);
+	benchmark.runAll();
+	printResults("128x64 monochrome", benchmark);
+
+	TEST_ASSERT_EQUALS(benchmark.lines.getCount(), iterations);
+	TEST_ASSERT_EQUALS(benchmark.rectangles.getCount(), iterations);
+	TEST_ASSERT_EQUALS(benchmark.circles.getCount(), iterations);
+	TEST_ASSERT_EQUALS(benchmark.text.getCount(), iterations);
+
+	// the last run of the text workload is still visible
+	TEST_ASSERT_TRUE(display.isDirty());
+}
+
+void
+RenderBenchmarkTest::testColor()
+{
+	xpcc::OffscreenColorDisplay<xpcc::glcd::format::Rgb565, 320, 240> display;
+	display.setFont(xpcc::font::FixedWidth5x8);
+	display.setColor(xpcc::glcd::Color::orange());
+
+	xpcc::glcd::RenderBenchmark benchmark(display, iterations);
+	benchmark.runAll();
+	printResults("320x240 Rgb565", benchmark);
+
+	TEST_ASSERT_EQUALS(benchmark.lines.getCount(), iterations);
+	TEST_ASSERT_EQUALS(benchmark.text.getCount(), iterations);
+}
+
+#else
+
+void
+RenderBenchmarkTest::testMonochrome()
+{
+}
+
+void
+RenderBenchmarkTest::testColor()
+{
+}
+
+#endif
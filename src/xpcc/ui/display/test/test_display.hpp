@@ -0,0 +1,133 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC__TEST_DISPLAY_HPP
+#define XPCC__TEST_DISPLAY_HPP
+
+#include <cstring>
+#include <xpcc/ui/display/buffered_graphic_display.hpp>
+
+/// Transmits the dirty window like a display with vertical addressing
+class TestDisplay : public xpcc::BufferedGraphicDisplay<128, 64>
+{
+public:
+	using xpcc::BufferedGraphicDisplay<128, 64>::getDirtyWindow;
+	using xpcc::BufferedGraphicDisplay<128, 64>::getDirtyColumns;
+
+	virtual void
+	update()
+	{
+		Window window;
+		if (this->getDirtyWindow(window)) {
+			this->markClean((window.lastColumn - window.firstColumn + 1) *
+					(window.lastPage - window.firstPage + 1));
+		}
+		else {
+			this->markClean(0);
+		}
+	}
+
+	bool
+	isSet(int16_t x, int16_t y)
+	{
+		return this->getPixel(x, y);
+	}
+};
+
+/**
+ * Same buffer layout, but only the pixel primitives.
+ *
+ * Everything is drawn pixel by pixel by the generic implementations
+ * of xpcc::GraphicDisplay. Used as reference for the optimized
+ * primitives of xpcc::BufferedGraphicDisplay.
+ */
+class PixelDisplay : public xpcc::GraphicDisplay
+{
+public:
+	PixelDisplay()
+	{
+		std::memset(this->buffer, 0, sizeof(this->buffer));
+	}
+
+	virtual uint16_t
+	getWidth() const
+	{
+		return 128;
+	}
+
+	virtual uint16_t
+	getHeight() const
+	{
+		return 64;
+	}
+
+	virtual void
+	clear()
+	{
+		std::memset(this->buffer, 0, sizeof(this->buffer));
+		this->cursor = xpcc::glcd::Point(0, 0);
+	}
+
+	virtual void
+	update()
+	{
+	}
+
+	bool
+	isSet(int16_t x, int16_t y)
+	{
+		return this->getPixel(x, y);
+	}
+
+protected:
+	virtual void
+	setPixel(int16_t x, int16_t y)
+	{
+		if (static_cast<uint16_t>(x) < 128 && static_cast<uint16_t>(y) < 64) {
+			this->buffer[x][y / 8] |= (1 << (y & 0x07));
+		}
+	}
+
+	virtual void
+	clearPixel(int16_t x, int16_t y)
+	{
+		if (static_cast<uint16_t>(x) < 128 && static_cast<uint16_t>(y) < 64) {
+			this->buffer[x][y / 8] &= ~(1 << (y & 0x07));
+		}
+	}
+
+	virtual bool
+	getPixel(int16_t x, int16_t y)
+	{
+		if (static_cast<uint16_t>(x) < 128 && static_cast<uint16_t>(y) < 64) {
+			return (this->buffer[x][y / 8] & (1 << (y & 0x07)));
+		}
+		return false;
+	}
+
+private:
+	uint8_t buffer[128][8];
+};
+
+/// Number of pixels which differ between both displays
+inline uint16_t
+countDifferences(TestDisplay& display, PixelDisplay& reference)
+{
+	uint16_t count = 0;
+	for (int16_t x = 0; x < 128; ++x) {
+		for (int16_t y = 0; y < 64; ++y) {
+			if (display.isSet(x, y) != reference.isSet(x, y)) {
+				++count;
+			}
+		}
+	}
+	return count;
+}
+
+#endif // XPCC__TEST_DISPLAY_HPP
@@ -31,16 +31,80 @@ xpcc::VirtualGraphicDisplay::update()
 	return;
 }
 
+void
+xpcc::VirtualGraphicDisplay::fillRectangle(glcd::Point upperLeft,
+		uint16_t width, uint16_t height)
+{
+	const bool clipped = this->forwardClip();
+	this->display->fillRectangle(upperLeft + this->leftUpper, width, height);
+	if (clipped) {
+		this->display->popClip();
+	}
+}
+
+void
+xpcc::VirtualGraphicDisplay::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Flash<uint8_t> data)
+{
+	const bool clipped = this->forwardClip();
+	this->display->drawImageRaw(upperLeft + this->leftUpper, width, height, data);
+	if (clipped) {
+		this->display->popClip();
+	}
+}
+
+void
+xpcc::VirtualGraphicDisplay::drawImageRaw(glcd::Point upperLeft,
+		uint16_t width, uint16_t height,
+		xpcc::accessor::Ram<uint8_t> data)
+{
+	const bool clipped = this->forwardClip();
+	this->display->drawImageRaw(upperLeft + this->leftUpper, width, height, data);
+	if (clipped) {
+		this->display->popClip();
+	}
+}
+
+void
+xpcc::VirtualGraphicDisplay::drawHorizontalLine(glcd::Point start, uint16_t length)
+{
+	// the pixels of a line are drawn with setPixel(), like a rectangle
+	const bool clipped = this->forwardClip();
+	this->display->fillRectangle(start + this->leftUpper, length, 1);
+	if (clipped) {
+		this->display->popClip();
+	}
+}
+
+void
+xpcc::VirtualGraphicDisplay::drawVerticalLine(glcd::Point start, uint16_t length)
+{
+	const bool clipped = this->forwardClip();
+	this->display->fillRectangle(start + this->leftUpper, 1, length);
+	if (clipped) {
+		this->display->popClip();
+	}
+}
+
 void
 xpcc::VirtualGraphicDisplay::setPixel(int16_t x, int16_t y)
 {
-	this->display->setPixel(x + this->leftUpper[0], y + this->leftUpper[1]);
+	x += this->leftUpper[0];
+	y += this->leftUpper[1];
+	if (!this->display->isClipped() or this->display->isVisible(x, y)) {
+		this->display->setPixel(x, y);
+	}
 }
 
 void
 xpcc::VirtualGraphicDisplay::clearPixel(int16_t x, int16_t y)
 {
-	this->display->clearPixel(x + this->leftUpper[0], y + this->leftUpper[1] );
+	x += this->leftUpper[0];
+	y += this->leftUpper[1];
+	if (!this->display->isClipped() or this->display->isVisible(x, y)) {
+		this->display->clearPixel(x, y);
+	}
 }
 
 bool
@@ -48,3 +112,21 @@ xpcc::VirtualGraphicDisplay::getPixel(int16_t x, int16_t y)
 {
 	return this->display->getPixel(x + this->leftUpper[0], y + this->leftUpper[1] );
 }
+
+bool
+xpcc::VirtualGraphicDisplay::forwardClip()
+{
+	if (!this->isClipped()) {
+		return false;
+	}
+
+	uint16_t width = 0;
+	uint16_t height = 0;
+	if (this->clipArea.min.x <= this->clipArea.max.x and
+		this->clipArea.min.y <= this->clipArea.max.y)
+	{
+		width = this->clipArea.max.x - this->clipArea.min.x + 1;
+		height = this->clipArea.max.y - this->clipArea.min.y + 1;
+	}
+	return this->display->pushClip(this->clipArea.min + this->leftUpper, width, height);
+}
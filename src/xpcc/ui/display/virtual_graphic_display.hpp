@@ -64,7 +64,30 @@ namespace xpcc
 		virtual void
 		update();
 
+		using GraphicDisplay::fillRectangle;
+
+		virtual void
+		fillRectangle(glcd::Point upperLeft, uint16_t width, uint16_t height);
+
+		virtual void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Flash<uint8_t> data);
+
+		virtual void
+		drawImageRaw(glcd::Point upperLeft,
+				uint16_t width, uint16_t height,
+				xpcc::accessor::Ram<uint8_t> data);
+
 	protected:
+		// Forward whole primitives, so that the display can use its
+		// faster versions instead of drawing every pixel
+		virtual void
+		drawHorizontalLine(glcd::Point start, uint16_t length);
+
+		virtual void
+		drawVerticalLine(glcd::Point start, uint16_t length);
+
 
 		virtual void
 		setPixel(int16_t x, int16_t y);
@@ -75,6 +98,11 @@ namespace xpcc
 		virtual bool
 		getPixel(int16_t x, int16_t y);
 
+		// Apply the own clipping area to the display, returns `true`
+		// if popClip() must be called on the display afterwards
+		bool
+		forwardClip();
+
  	private:
 		xpcc::GraphicDisplay* display;
 		xpcc::glcd::Point leftUpper;
@@ -0,0 +1,86 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include "damage_list.hpp"
+
+// ----------------------------------------------------------------------------
+void
+xpcc::gui::DamageList::add(BoundingBox area)
+{
+	if (area.isEmpty())
+		return;
+
+	while (true)
+	{
+		// merge with all overlapping areas, the merged area may overlap
+		// areas which have already been checked
+		bool merged = true;
+		while (merged)
+		{
+			merged = false;
+			for (uint8_t i = 0; i < this->size; )
+			{
+				if (this->areas[i].intersects(area))
+				{
+					area.expand(this->areas[i]);
+					this->areas[i] = this->areas[--this->size];
+					merged = true;
+				}
+				else {
+					++i;
+				}
+			}
+		}
+
+		if (this->size < Capacity)
+		{
+			this->areas[this->size++] = area;
+			return;
+		}
+
+		// full, combine with the area which grows the least
+		uint8_t best = 0;
+		uint32_t bestGrowth = UINT32_MAX;
+		for (uint8_t i = 0; i < this->size; ++i)
+		{
+			BoundingBox combined = this->areas[i];
+			combined.expand(area);
+			const uint32_t growth = getPixelCount(combined) - getPixelCount(this->areas[i]);
+			if (growth < bestGrowth)
+			{
+				best = i;
+				bestGrowth = growth;
+			}
+		}
+		area.expand(this->areas[best]);
+		this->areas[best] = this->areas[--this->size];
+	}
+}
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::gui::DamageList::intersects(const BoundingBox& box) const
+{
+	for (uint8_t i = 0; i < this->size; ++i)
+	{
+		if (this->areas[i].intersects(box))
+			return true;
+	}
+	return false;
+}
+
+uint32_t
+xpcc::gui::DamageList::getPixelCount(const BoundingBox& box)
+{
+	if (box.isEmpty())
+		return 0;
+
+	return uint32_t(box.getMax().x - box.getMin().x + 1) *
+			uint32_t(box.getMax().y - box.getMin().y + 1);
+}
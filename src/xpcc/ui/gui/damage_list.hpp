@@ -0,0 +1,87 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_GUI_DAMAGE_LIST_HPP
+#define XPCC_GUI_DAMAGE_LIST_HPP
+
+#include <stdint.h>
+#include "types.hpp"
+
+namespace xpcc
+{
+
+namespace gui
+{
+
+/**
+ * Areas of the screen which have to be redrawn
+ *
+ * Overlapping areas are merged into their bounding box, so every pixel
+ * is redrawn only once. If the list is full, the new area is merged
+ * with the area which grows the least.
+ *
+ * @ingroup	gui
+ */
+class DamageList
+{
+public:
+	static constexpr uint8_t Capacity = 4;
+
+public:
+	DamageList() :
+		size(0)
+	{
+	}
+
+	/// Add an area, empty areas are ignored
+	void
+	add(BoundingBox area);
+
+	inline void
+	clear()
+	{
+		this->size = 0;
+	}
+
+	inline bool
+	isEmpty() const
+	{
+		return (this->size == 0);
+	}
+
+	inline uint8_t
+	getSize() const
+	{
+		return this->size;
+	}
+
+	inline const BoundingBox&
+	operator [](uint8_t index) const
+	{
+		return this->areas[index];
+	}
+
+	/// Check if any area overlaps the box
+	bool
+	intersects(const BoundingBox& box) const;
+
+	/// Number of pixels covered by the box
+	static uint32_t
+	getPixelCount(const BoundingBox& box);
+
+private:
+	BoundingBox areas[Capacity];
+	uint8_t size;
+};
+
+}	// namespace gui
+
+}	// namespace xpcc
+
+#endif  // XPCC_GUI_DAMAGE_LIST_HPP
@@ -0,0 +1,116 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/gui/damage_list.hpp>
+
+#include "damage_list_test.hpp"
+
+using xpcc::gui::BoundingBox;
+using xpcc::gui::DamageList;
+using xpcc::glcd::Point;
+
+namespace
+{
+	BoundingBox
+	box(int16_t x, int16_t y, int16_t width, int16_t height)
+	{
+		return BoundingBox(Point(x, y), Point(x + width - 1, y + height - 1));
+	}
+
+	bool
+	equals(const BoundingBox& a, const BoundingBox& b)
+	{
+		return (a.getMin() == b.getMin() and a.getMax() == b.getMax());
+	}
+}
+
+void
+DamageListTest::testEmpty()
+{
+	DamageList damage;
+	TEST_ASSERT_TRUE(damage.isEmpty());
+
+	damage.add(BoundingBox());
+	TEST_ASSERT_TRUE(damage.isEmpty());
+	TEST_ASSERT_FALSE(damage.intersects(box(0, 0, 100, 100)));
+}
+
+void
+DamageListTest::testSeparateAreas()
+{
+	DamageList damage;
+	damage.add(box(0, 0, 10, 10));
+	damage.add(box(20, 0, 10, 10));
+	damage.add(box(0, 20, 10, 10));
+
+	TEST_ASSERT_EQUALS(damage.getSize(), 3);
+	TEST_ASSERT_TRUE(damage.intersects(box(5, 25, 1, 1)));
+	TEST_ASSERT_FALSE(damage.intersects(box(12, 12, 5, 5)));
+	TEST_ASSERT_EQUALS(DamageList::getPixelCount(damage[0]), 100U);
+
+	damage.clear();
+	TEST_ASSERT_TRUE(damage.isEmpty());
+}
+
+void
+DamageListTest::testMerge()
+{
+	DamageList damage;
+	damage.add(box(0, 0, 10, 10));
+	damage.add(box(5, 5, 10, 10));
+
+	TEST_ASSERT_EQUALS(damage.getSize(), 1);
+	TEST_ASSERT_TRUE(equals(damage[0], box(0, 0, 15, 15)));
+
+	// inside of an existing area
+	damage.add(box(2, 2, 3, 3));
+	TEST_ASSERT_EQUALS(damage.getSize(), 1);
+	TEST_ASSERT_TRUE(equals(damage[0], box(0, 0, 15, 15)));
+}
+
+void
+DamageListTest::testChainedMerge()
+{
+	DamageList damage;
+	damage.add(box(0, 0, 10, 10));
+	damage.add(box(30, 0, 10, 10));
+	TEST_ASSERT_EQUALS(damage.getSize(), 2);
+
+	// connects both areas
+	damage.add(box(5, 20, 20, 5));
+	TEST_ASSERT_EQUALS(damage.getSize(), 3);
+	damage.add(box(5, 5, 2, 20));
+	TEST_ASSERT_EQUALS(damage.getSize(), 2);
+
+	// the merged area now overlaps the second one
+	damage.add(box(20, 9, 12, 2));
+	TEST_ASSERT_EQUALS(damage.getSize(), 1);
+	TEST_ASSERT_TRUE(equals(damage[0], box(0, 0, 40, 25)));
+}
+
+void
+DamageListTest::testFull()
+{
+	DamageList damage;
+	for (uint8_t i = 0; i < DamageList::Capacity; ++i) {
+		damage.add(box(i * 20, 0, 10, 10));
+	}
+	TEST_ASSERT_EQUALS(damage.getSize(), DamageList::Capacity);
+
+	// combined with the nearest area
+	damage.add(box(0, 12, 10, 5));
+	TEST_ASSERT_EQUALS(damage.getSize(), DamageList::Capacity);
+
+	bool found = false;
+	for (uint8_t i = 0; i < damage.getSize(); ++i) {
+		found |= equals(damage[i], box(0, 0, 10, 17));
+	}
+	TEST_ASSERT_TRUE(found);
+	TEST_ASSERT_TRUE(damage.intersects(box(40, 5, 1, 1)));
+}
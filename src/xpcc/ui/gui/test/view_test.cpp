@@ -0,0 +1,272 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cstring>
+#include <xpcc/ui/gui.hpp>
+
+#include "view_test.hpp"
+
+namespace
+{
+	/// Counts how often every pixel was written
+	class CountingDisplay : public xpcc::GraphicDisplay
+	{
+	public:
+		CountingDisplay()
+		{
+			this->reset();
+		}
+
+		virtual uint16_t
+		getWidth() const
+		{
+			return 64;
+		}
+
+		virtual uint16_t
+		getHeight() const
+		{
+			return 32;
+		}
+
+		virtual void
+		clear()
+		{
+		}
+
+		virtual void
+		update()
+		{
+			++this->updates;
+		}
+
+		void
+		reset()
+		{
+			std::memset(this->writes, 0, sizeof(this->writes));
+			this->updates = 0;
+		}
+
+		uint16_t
+		getWrites(int16_t x, int16_t y) const
+		{
+			return this->writes[x][y];
+		}
+
+		/// Number of pixels written inside or outside of the rectangle
+		uint16_t
+		countWritten(int16_t x, int16_t y, int16_t width, int16_t height,
+				bool inside) const
+		{
+			uint16_t count = 0;
+			for (int16_t i = 0; i < 64; ++i) {
+				for (int16_t k = 0; k < 32; ++k)
+				{
+					const bool contained = (i >= x and i < x + width and
+											k >= y and k < y + height);
+					if (contained == inside and this->writes[i][k] > 0) {
+						++count;
+					}
+				}
+			}
+			return count;
+		}
+
+		uint16_t updates;
+
+	protected:
+		virtual void
+		setPixel(int16_t x, int16_t y)
+		{
+			if (static_cast<uint16_t>(x) < 64 and static_cast<uint16_t>(y) < 32) {
+				++this->writes[x][y];
+			}
+		}
+
+		virtual void
+		clearPixel(int16_t x, int16_t y)
+		{
+			this->setPixel(x, y);
+		}
+
+		virtual bool
+		getPixel(int16_t, int16_t)
+		{
+			return false;
+		}
+
+	private:
+		uint16_t writes[64][32];
+	};
+
+	class TestView : public xpcc::gui::View
+	{
+	public:
+		TestView(xpcc::gui::GuiViewStack* stack) :
+			View(stack, 1, xpcc::gui::Dimension(64, 32)),
+			label("Hello", xpcc::glcd::Color::white()),
+			button("OK", xpcc::gui::Dimension(20, 12))
+		{
+		}
+
+		xpcc::gui::Label label;
+		xpcc::gui::ButtonWidget button;
+	};
+
+	struct Fixture
+	{
+		Fixture() :
+			stack(&display, &queue)
+		{
+		}
+
+		CountingDisplay display;
+		xpcc::gui::inputQueue queue;
+		xpcc::gui::GuiViewStack stack;
+	};
+}
+
+void
+ViewTest::testInitialDraw()
+{
+	Fixture f;
+	TestView *view = new TestView(&f.stack);
+	view->pack(&view->label, xpcc::glcd::Point(2, 2));
+	view->pack(&view->button, xpcc::glcd::Point(40, 10));
+	TEST_ASSERT_TRUE(view->hasChanged());
+
+	f.stack.push(view);
+	TEST_ASSERT_FALSE(view->hasChanged());
+	TEST_ASSERT_TRUE(f.display.getWrites(2, 2) > 0);
+	TEST_ASSERT_TRUE(f.display.getWrites(59, 21) > 0);
+	TEST_ASSERT_EQUALS(f.display.getWrites(0, 31), 0);
+}
+
+void
+ViewTest::testUnchanged()
+{
+	Fixture f;
+	TestView *view = new TestView(&f.stack);
+	view->pack(&view->label, xpcc::glcd::Point(2, 2));
+	f.stack.push(view);
+	f.display.reset();
+
+	f.stack.update();
+	TEST_ASSERT_EQUALS(f.display.countWritten(0, 0, 64, 32, true), 0);
+	TEST_ASSERT_EQUALS(f.display.updates, 0);
+}
+
+void
+ViewTest::testChangedWidget()
+{
+	Fixture f;
+	TestView *view = new TestView(&f.stack);
+	view->pack(&view->label, xpcc::glcd::Point(2, 2));
+	view->pack(&view->button, xpcc::glcd::Point(40, 10));
+	f.stack.push(view);
+	f.display.reset();
+
+	// "Hello" covers 30x8 pixels, the shorter text has to clear them
+	view->label.setLabel("Hi");
+	TEST_ASSERT_TRUE(view->hasChanged());
+	f.stack.update();
+
+	TEST_ASSERT_FALSE(view->hasChanged());
+	TEST_ASSERT_EQUALS(f.display.updates, 1);
+	TEST_ASSERT_EQUALS(f.display.countWritten(2, 2, 30, 8, false), 0);
+	TEST_ASSERT_EQUALS(f.display.countWritten(2, 2, 30, 8, true), 30 * 8);
+
+	// now only the area of the shorter text
+	f.display.reset();
+	view->label.markDirty();
+	f.stack.update();
+	TEST_ASSERT_EQUALS(f.display.countWritten(2, 2, 12, 8, false), 0);
+	TEST_ASSERT_EQUALS(f.display.countWritten(2, 2, 12, 8, true), 12 * 8);
+}
+
+void
+ViewTest::testOverlappingWidgets()
+{
+	Fixture f;
+	TestView *view = new TestView(&f.stack);
+	view->pack(&view->label, xpcc::glcd::Point(2, 2));
+	view->pack(&view->button, xpcc::glcd::Point(20, 0));
+	f.stack.push(view);
+	f.display.reset();
+
+	// the button on top is redrawn, but only inside the area of the label
+	view->label.markDirty();
+	f.stack.update();
+
+	TEST_ASSERT_EQUALS(f.display.countWritten(2, 2, 30, 8, false), 0);
+	TEST_ASSERT_EQUALS(f.display.getWrites(25, 5), 3);
+	TEST_ASSERT_EQUALS(f.display.getWrites(35, 5), 0);
+	TEST_ASSERT_FALSE(view->button.isDirty());
+}
+
+void
+ViewTest::testInvalidate()
+{
+	Fixture f;
+	TestView *view = new TestView(&f.stack);
+	view->pack(&view->button, xpcc::glcd::Point(40, 10));
+	f.stack.push(view);
+	f.display.reset();
+
+	view->invalidate(xpcc::gui::BoundingBox(xpcc::glcd::Point(0, 0), xpcc::glcd::Point(9, 9)));
+	view->invalidate(xpcc::gui::BoundingBox(xpcc::glcd::Point(50, 20), xpcc::glcd::Point(60, 30)));
+	TEST_ASSERT_TRUE(view->hasChanged());
+	f.stack.update();
+
+	TEST_ASSERT_EQUALS(f.display.countWritten(0, 0, 10, 10, true), 100);
+	TEST_ASSERT_EQUALS(f.display.getWrites(55, 25), 1);
+	TEST_ASSERT_TRUE(f.display.getWrites(55, 20) >= 2);
+	TEST_ASSERT_EQUALS(f.display.getWrites(45, 15), 0);
+	TEST_ASSERT_EQUALS(f.display.countWritten(10, 0, 54, 20, true), 0);
+}
+
+void
+ViewTest::testFullClipStack()
+{
+	Fixture f;
+	TestView *view = new TestView(&f.stack);
+	view->pack(&view->button, xpcc::glcd::Point(40, 10));
+	f.stack.push(view);
+	f.display.reset();
+
+	// e.g. the view is drawn into a nested window
+	for (uint8_t i = 0; i < xpcc::GraphicDisplay::ClipStackSize; ++i) {
+		TEST_ASSERT_TRUE(f.display.pushClip(xpcc::glcd::Point(30, 0), 34, 32));
+	}
+
+	// the damaged area is not drawn unclipped
+	view->invalidate(xpcc::gui::BoundingBox(xpcc::glcd::Point(25, 5), xpcc::glcd::Point(45, 15)));
+	view->button.markDirty();
+	f.stack.update();
+	TEST_ASSERT_EQUALS(f.display.countWritten(0, 0, 64, 32, true), 0);
+
+	// but kept for the next update
+	TEST_ASSERT_TRUE(view->hasChanged());
+	TEST_ASSERT_TRUE(view->button.isDirty());
+
+	// and the clipping areas of the display are kept
+	for (uint8_t i = 0; i < xpcc::GraphicDisplay::ClipStackSize; ++i)
+	{
+		TEST_ASSERT_TRUE(f.display.isClipped());
+		f.display.popClip();
+	}
+	TEST_ASSERT_FALSE(f.display.isClipped());
+
+	// the area is drawn once the display has room for the clip again
+	f.stack.update();
+	TEST_ASSERT_TRUE(f.display.countWritten(25, 5, 21, 11, true) > 0);
+	TEST_ASSERT_TRUE(f.display.countWritten(40, 10, 20, 12, true) > 0);
+	TEST_ASSERT_FALSE(view->button.isDirty());
+	TEST_ASSERT_FALSE(view->hasChanged());
+}
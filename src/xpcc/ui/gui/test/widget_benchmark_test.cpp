@@ -0,0 +1,97 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "widget_benchmark_test.hpp"
+
+#if XPCC__BENCHMARK
+
+#include <xpcc/ui/gui.hpp>
+#include <xpcc/ui/display/offscreen_display.hpp>
+#include <xpcc/ui/display/pixel_format.hpp>
+#include <xpcc/ui/display/render_benchmark.hpp>
+
+namespace
+{
+	const uint16_t iterations = 50;
+
+	typedef xpcc::OffscreenColorDisplay<xpcc::glcd::format::Rgb565, 320, 240> Display;
+
+	class BenchmarkView : public xpcc::gui::View
+	{
+	public:
+		BenchmarkView(xpcc::gui::GuiViewStack* stack) :
+			View(stack, 1, xpcc::gui::Dimension(320, 240)),
+			title("Benchmark", xpcc::glcd::Color::white()),
+			ok("OK", xpcc::gui::Dimension(80, 30)),
+			cancel("Cancel", xpcc::gui::Dimension(80, 30)),
+			option(true, xpcc::gui::Dimension(30, 30))
+		{
+			this->pack(&this->title, xpcc::glcd::Point(10, 10));
+			this->pack(&this->ok, xpcc::glcd::Point(20, 190));
+			this->pack(&this->cancel, xpcc::glcd::Point(220, 190));
+			this->pack(&this->option, xpcc::glcd::Point(20, 60));
+		}
+
+		xpcc::gui::Label title;
+		xpcc::gui::ButtonWidget ok;
+		xpcc::gui::ButtonWidget cancel;
+		xpcc::gui::CheckboxWidget option;
+	};
+}
+
+void
+WidgetBenchmarkTest::testView()
+{
+	Display display;
+	xpcc::gui::inputQueue queue;
+	xpcc::gui::GuiViewStack stack(&display, &queue);
+
+	BenchmarkView *view = new BenchmarkView(&stack);
+	stack.push(view);
+
+	xpcc::glcd::RenderBenchmark benchmark(display, iterations);
+
+	xpcc::profiler::Record redraw("view redraw");
+	benchmark.measure(redraw, [view](xpcc::GraphicDisplay&)
+	{
+		view->markDirty();
+		view->draw();
+	});
+
+	// only the label and the area of its previous text
+	xpcc::profiler::Record label("label change");
+	bool toggle = false;
+	benchmark.measure(label, [view, &toggle](xpcc::GraphicDisplay&)
+	{
+		toggle = not toggle;
+		view->title.setLabel(toggle ? "Bench" : "Benchmark");
+		view->draw();
+	});
+
+	typedef xpcc::glcd::RenderBenchmark Benchmark;
+	XPCC_LOG_INFO << "320x240 Rgb565 view: "
+			<< Benchmark::getNanoseconds(redraw) << " ns redraw, "
+			<< Benchmark::getNanoseconds(label) << " ns label change"
+			<< xpcc::endl;
+
+	TEST_ASSERT_EQUALS(redraw.getCount(), iterations);
+	TEST_ASSERT_EQUALS(label.getCount(), iterations);
+	TEST_ASSERT_FALSE(view->hasChanged());
+}
+
+#else
+
+void
+WidgetBenchmarkTest::testView()
+{
+}
+
+#endif
@@ -0,0 +1,20 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Draws a view with some widgets into an off-screen colour display,
+/// completely and after a single change. Only runs on hosted targets,
+/// the results are printed to the info log.
+class WidgetBenchmarkTest : public unittest::TestSuite
+{
+public:
+	void
+	testView();
+};
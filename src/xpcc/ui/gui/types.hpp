@@ -11,6 +11,7 @@
 #define XPCC_GUI_TYPES_HPP
 
 #include <xpcc/ui/display.hpp>
+#include <xpcc/math/geometry/bounding_box_2d.hpp>
 #include <xpcc/container/dynamic_array.hpp>
 #include <xpcc/container/linked_list.hpp>
 #include <xpcc/container/queue.hpp>
@@ -146,6 +147,9 @@ typedef struct Dimension
 
 typedef xpcc::glcd::Point Point;
 
+/// Area on the screen, both corners are inside
+typedef xpcc::BoundingBox2D<int16_t> BoundingBox;
+
 }	// namespace gui
 
 }	// namespace xpcc
@@ -103,22 +103,88 @@ xpcc::gui::View::remove()
 }
 
 // ----------------------------------------------------------------------------
-void xpcc::gui::View::draw()
+bool
+xpcc::gui::View::hasChanged()
+{
+	if (!this->damage.isEmpty())
+		return true;
+
+	for(auto iter = widgets.begin(); iter != widgets.end(); ++iter)
+	{
+		if((*iter)->isDirty())
+			return true;
+	}
+	return false;
+}
+
+void
+xpcc::gui::View::invalidate(const BoundingBox& area)
 {
-//	auto display = &this->stack->getDisplay();
+	this->damage.add(area);
+}
 
+// ----------------------------------------------------------------------------
+void xpcc::gui::View::draw()
+{
 	for(auto iter = widgets.begin(); iter != widgets.end(); ++iter)
 	{
-		/* Only redraw when widget is dirty */
 		if((*iter)->isDirty())
 		{
-			/* draw widget
-			 * redrawing widgets on top, that would be overdrawn, is handled
-			 * inside Widget::draw()
-			 * */
-			(*iter)->draw(this);
+			this->damage.add((*iter)->getDamage());
 		}
 	}
+
+	if (this->damage.isEmpty())
+		return;
+
+	// areas which could not be drawn now, they are retried on the next update
+	DamageList skipped;
+
+	xpcc::GraphicDisplay& out = this->display();
+	for(uint8_t i = 0; i < this->damage.getSize(); ++i)
+	{
+		const BoundingBox& area = this->damage[i];
+		const xpcc::glcd::Point min = area.getMin();
+		const uint16_t width = area.getMax().x - min.x + 1;
+		const uint16_t height = area.getMax().y - min.y + 1;
+
+		if (not out.pushClip(min, width, height)) {
+			// the clip stack of the display is full, drawing would
+			// overwrite the areas around
+			skipped.add(area);
+			continue;
+		}
+
+		out.setColor(this->colorpalette[Color::BACKGROUND]);
+		out.fillRectangle(min, width, height);
+
+		/* Redraw every widget inside the area in the order they were
+		 * packed. Widgets on top are drawn later, so the intersection
+		 * lists of the widgets are not needed here. */
+		for(auto iter = widgets.begin(); iter != widgets.end(); ++iter)
+		{
+			if((*iter)->getBoundingBox().intersects(area))
+			{
+				// groups only draw their dirty children
+				(*iter)->markDirty();
+				(*iter)->render(this);
+			}
+		}
+
+		out.popClip();
+	}
+
+	for(auto iter = widgets.begin(); iter != widgets.end(); ++iter)
+	{
+		// widgets in a skipped area stay dirty
+		if((*iter)->isDirty() and
+				not skipped.intersects((*iter)->getBoundingBox()))
+		{
+			(*iter)->setDrawn();
+		}
+	}
+
+	this->damage = skipped;
 }
 
 // ----------------------------------------------------------------------------
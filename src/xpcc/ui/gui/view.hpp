@@ -15,6 +15,7 @@
 #include "types.hpp"
 #include "widgets/widget.hpp"
 #include "colorpalette.hpp"
+#include "damage_list.hpp"
 
 #include "../menu/abstract_view.hpp"
 
@@ -63,10 +64,27 @@ public:
 	{
 	}
 
-	/// Draw determine the output on the Graphic Display
+	/// Whether some widgets or areas have to be redrawn
+	virtual bool
+	hasChanged();
+
+	/**
+	 * Redraw the damaged areas of the screen.
+	 *
+	 * Every dirty widget adds the area it covers now and covered at
+	 * its last drawing. Overlapping areas are merged. Every area is
+	 * cleared with the background color and all widgets inside are
+	 * drawn again from bottom to top, clipped to the area. Areas which
+	 * cannot be clipped, because the clip stack of the display is full,
+	 * are kept and drawn on the next update.
+	 */
 	virtual void
 	draw();
 
+	/// Redraw an area with the next draw()
+	void
+	invalidate(const BoundingBox& area);
+
 	/// Add widget to view
 	bool
 	pack(Widget *w, const xpcc::glcd::Point &coord);
@@ -103,6 +121,9 @@ protected:
 	WidgetContainer widgets;
 
 	xpcc::gui::ColorPalette colorpalette;
+
+	/// areas which have to be redrawn
+	DamageList damage;
 };
 
 }	// namespace gui
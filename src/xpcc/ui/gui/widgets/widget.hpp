@@ -47,7 +47,8 @@ public:
 		relative_position(xpcc::glcd::Point(-10,-10)),
 		dirty(true),
 		is_interactive(is_interactive),
-		font(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8))
+		font(xpcc::accessor::asFlash(xpcc::font::FixedWidth5x8)),
+		drawn_box()
 	{
 		// assign unique id
 		uid = uid_global++;
@@ -71,7 +72,7 @@ public:
 	{
 		// render widget on screen
 		this->render(view);
-		this->markDrawn();
+		this->setDrawn();
 
 		// if there are widgets on top, redraw them
 		if(this->hasIntersections())
@@ -235,6 +236,40 @@ public:
 		return this->dimension.height;
 	}
 
+	/// Area covered by the widget on screen
+	inline BoundingBox
+	getBoundingBox()
+	{
+		if (this->dimension.width <= 0 || this->dimension.height <= 0)
+			return BoundingBox();
+
+		return BoundingBox(this->position,
+				this->position + xpcc::glcd::Point(this->dimension.width - 1,
+												   this->dimension.height - 1));
+	}
+
+	/**
+	 * Area which has to be redrawn when the widget is dirty.
+	 *
+	 * Includes the area covered by the last drawing, which has to be
+	 * cleared if the widget has been moved or became smaller.
+	 */
+	inline BoundingBox
+	getDamage()
+	{
+		BoundingBox damage = this->getBoundingBox();
+		damage.expand(this->drawn_box);
+		return damage;
+	}
+
+	/// Remember the area covered on screen after drawing
+	inline void
+	setDrawn()
+	{
+		this->markDrawn();
+		this->drawn_box = this->getBoundingBox();
+	}
+
 	/// Whether widget needs to be redrawn or not.
 	virtual bool
 	isDirty()
@@ -324,6 +359,9 @@ public:
 
 	/// list of widgets that intersect with this widget
 	WidgetContainer intersecting_widgets;
+
+	/// area covered on screen by the last drawing, empty if not drawn
+	BoundingBox drawn_box;
 };
 
 /**
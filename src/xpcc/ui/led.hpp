@@ -15,6 +15,8 @@
  */
 
 #include "led/tables.hpp"
+#include "led/brightness_table.hpp"
 #include "led/led.hpp"
 #include "led/rgb.hpp"
+#include "led/group.hpp"
 
@@ -0,0 +1,191 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_UI_BRIGHTNESS_TABLE_HPP
+#define XPCC_UI_BRIGHTNESS_TABLE_HPP
+
+#include <stdint.h>
+#include <cstddef>
+
+#include <xpcc/utils/arithmetic_traits.hpp>
+#include <xpcc/utils/index_sequence.hpp>
+
+namespace xpcc
+{
+
+namespace ui
+{
+
+/**
+ * Lookup table from a brightness step to a PWM value.
+ *
+ * Created at compile time by makeGammaTable() or makeCieTable(), so
+ * any combination of steps and PWM resolution is possible without
+ * generating source files. The table can be placed in flash:
+ *
+ * @code
+ * typedef xpcc::ui::BrightnessTable<uint16_t, 256> Table;
+ * FLASH_STORAGE(Table table) = xpcc::ui::makeCieTable<uint16_t, 256>(4095);
+ *
+ * xpcc::ui::LedGroup<48, uint16_t, xpcc::accessor::Flash>
+ *         leds(xpcc::accessor::asFlash(table.values));
+ * @endcode
+ *
+ * @ingroup led
+ */
+template< typename T, std::size_t N >
+struct BrightnessTable
+{
+	T values[N];
+
+	constexpr T
+	operator [] (std::size_t index) const
+	{ return values[index]; }
+
+	static constexpr std::size_t
+	size()
+	{ return N; }
+};
+
+/// @cond
+namespace detail
+{
+	constexpr double ln2 = 0.69314718055994530942;
+
+	// 2 * (z + z^3/3 + z^5/5 + ...) = ln((1 + z) / (1 - z)), |z| <= 1/3
+	constexpr double
+	logSeries(double z2, double term, int n)
+	{
+		return (n > 41) ? 0 : term / n + logSeries(z2, term * z2, n + 2);
+	}
+
+	constexpr double
+	logMantissa(double z)
+	{
+		return 2 * logSeries(z * z, z, 1);
+	}
+
+	/// Natural logarithm for x > 0, reduced to [1, 2)
+	constexpr double
+	logarithm(double x)
+	{
+		return (x < 1) ? logarithm(2 * x) - ln2 :
+			   (x >= 2) ? logarithm(x / 2) + ln2 :
+			   logMantissa((x - 1) / (x + 1));
+	}
+
+	constexpr double
+	expSeries(double y, double term, int n)
+	{
+		return (n > 20) ? term : term + expSeries(y, term * y / n, n + 1);
+	}
+
+	constexpr double
+	square(double x)
+	{
+		return x * x;
+	}
+
+	/// e^y, halved until |y| <= 1/2
+	constexpr double
+	exponential(double y)
+	{
+		return (y < -0.5 or y > 0.5) ? square(exponential(y / 2)) :
+				expSeries(y, 1, 1);
+	}
+
+	/// x^gamma for 0 <= x <= 1
+	constexpr double
+	power(double x, double gamma)
+	{
+		return (x <= 0) ? 0 : (x >= 1) ? 1 : exponential(gamma * logarithm(x));
+	}
+
+	/// CIE 1931 luminance of the lightness L* (0..100), 0..1
+	constexpr double
+	cieLuminance(double lightness)
+	{
+		return (lightness > 8) ?
+				square((lightness + 16) / 116) * ((lightness + 16) / 116) :
+				lightness / 903.3;
+	}
+
+	// rounded, but only the first step is 0, so every step is visible
+	template< typename T >
+	constexpr T
+	toPwm(double value, std::size_t index, T maximum)
+	{
+		return (index > 0 and value * maximum < 0.5) ? T(1) :
+				T(value * maximum + 0.5);
+	}
+
+	template< typename T, std::size_t N, std::size_t... Is >
+	constexpr BrightnessTable<T, N>
+	makeGammaTable(double gamma, T maximum, xpcc::tmp::IndexSequence<Is...>)
+	{
+		return BrightnessTable<T, N> {
+			{ toPwm<T>(power(double(Is) / (N - 1), gamma), Is, maximum)... }
+		};
+	}
+
+	template< typename T, std::size_t N, std::size_t... Is >
+	constexpr BrightnessTable<T, N>
+	makeCieTable(T maximum, xpcc::tmp::IndexSequence<Is...>)
+	{
+		return BrightnessTable<T, N> {
+			{ toPwm<T>(cieLuminance(100.0 * Is / (N - 1)), Is, maximum)... }
+		};
+	}
+}
+/// @endcond
+
+/**
+ * Brightness table with a power law: `maximum * (i / (N - 1))^gamma`.
+ *
+ * A gamma of 2.2 gives the same values as the precomputed tables in
+ * `tables.hpp` (±1 because of rounding).
+ *
+ * @code
+ * // 1000 steps for a 16-bit timer
+ * constexpr auto table = xpcc::ui::makeGammaTable<uint16_t, 1000>(2.2, 0xffff);
+ * @endcode
+ *
+ * @ingroup led
+ */
+template< typename T, std::size_t N >
+constexpr BrightnessTable<T, N>
+makeGammaTable(double gamma, T maximum = xpcc::ArithmeticTraits<T>::max)
+{
+	static_assert(N >= 2, "A brightness table needs at least two steps!");
+	return detail::makeGammaTable<T, N>(gamma, maximum,
+			typename xpcc::tmp::MakeIndexSequence<N>::Type());
+}
+
+/**
+ * Brightness table following the CIE 1931 lightness curve.
+ *
+ * The steps are perceived as equally spaced. Compared to a gamma
+ * of 2.2 the lowest steps are brighter.
+ *
+ * @ingroup led
+ */
+template< typename T, std::size_t N >
+constexpr BrightnessTable<T, N>
+makeCieTable(T maximum = xpcc::ArithmeticTraits<T>::max)
+{
+	static_assert(N >= 2, "A brightness table needs at least two steps!");
+	return detail::makeCieTable<T, N>(maximum,
+			typename xpcc::tmp::MakeIndexSequence<N>::Type());
+}
+
+}	// namespace ui
+
+}	// namespace xpcc
+
+#endif	// XPCC_UI_BRIGHTNESS_TABLE_HPP
@@ -0,0 +1,188 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_UI_LED_GROUP_HPP
+#define XPCC_UI_LED_GROUP_HPP
+
+#include <stdint.h>
+#include <xpcc/architecture/driver/clock.hpp>
+#include <xpcc/architecture/driver/accessor.hpp>
+
+namespace xpcc
+{
+
+namespace ui
+{
+
+/**
+ * Fades many LED channels in a single pass.
+ *
+ * Instead of one xpcc::ui::Led with its own animation and callback per
+ * channel, the state of all channels is kept in separate arrays
+ * (brightness, step, remaining time). update() walks these arrays once
+ * per tick, converts the changed brightness through the lookup table
+ * into the PWM output buffer and marks the channel as changed.
+ *
+ * The PWM drivers are then written only for the changed channels, as
+ * few contiguous ranges as possible:
+ *
+ * @code
+ * xpcc::ui::LedGroup<32, uint16_t, xpcc::accessor::Flash>
+ *         leds(xpcc::ui::table22_12_256);
+ *
+ * leds.fadeTo(3, 255, 500);
+ *
+ * // main loop
+ * if (leds.update())
+ * {
+ *     uint16_t first, count;
+ *     // one I2C transaction per run, runs do not cross the 16 channels of a chip
+ *     while (leds.getNextRun(first, count, 2, 16)) {
+ *         RF_CALL_BLOCKING(pwm[first / 16].setChannels(first % 16,
+ *                 leds.getOutput() + first, count));
+ *     }
+ * }
+ * @endcode
+ *
+ * Fading times up to 65s are possible, even for small changes of the
+ * brightness.
+ *
+ * @tparam	Channels	Number of LED channels
+ * @tparam	Pwm			Type of the PWM values
+ * @tparam	Accessor	Accessor of the lookup table with 256 entries,
+ * 						see xpcc::ui::makeGammaTable()
+ *
+ * @ingroup led
+ */
+template< uint16_t Channels,
+		  typename Pwm = uint8_t,
+		  template <typename> class Accessor = ::xpcc::accessor::Ram >
+class LedGroup
+{
+public:
+	/// Without a table the brightness is used as PWM value
+	LedGroup();
+
+	LedGroup(Accessor<Pwm> table);
+
+	static constexpr uint16_t
+	getChannels()
+	{ return Channels; }
+
+	/// Stops any fading of the channel
+	void
+	setBrightness(uint16_t channel, uint8_t brightness);
+
+	/// Set all channels and stop their fading
+	void
+	setAllBrightness(uint8_t brightness);
+
+	inline uint8_t
+	getBrightness(uint16_t channel) const
+	{ return value[channel] >> 16; }
+
+	/// Fade from the current brightness to a new brightness in the specified ms
+	void
+	fadeTo(uint16_t channel, uint8_t brightness, uint16_t time);
+
+	inline void
+	on(uint16_t channel, uint16_t time = 75)
+	{ fadeTo(channel, 255, time); }
+
+	inline void
+	off(uint16_t channel, uint16_t time = 120)
+	{ fadeTo(channel, 0, time); }
+
+	inline bool
+	isFading(uint16_t channel) const
+	{ return (remaining[channel] > 0); }
+
+	/// Number of channels currently fading
+	inline uint16_t
+	getFadingChannels() const
+	{ return fading; }
+
+	/// Steps the fading by the time passed since the last call
+	bool
+	update();
+
+	/**
+	 * Steps the fading of all channels.
+	 *
+	 * @param	milliseconds	time passed since the last step
+	 * @return	`true` if the output of any channel has changed
+	 */
+	bool
+	update(uint16_t milliseconds);
+
+	/// PWM values of all channels
+	inline const Pwm*
+	getOutput() const
+	{ return output; }
+
+	/// `true` if any output has changed since it was read by getNextRun()
+	bool
+	isChanged() const;
+
+	/// Mark all channels as changed, e.g. after a reset of the drivers
+	void
+	invalidate();
+
+	/**
+	 * Next range of channels to be written to the drivers.
+	 *
+	 * Finds the next changed channel and extends the range over all
+	 * following changed channels. The range is marked as unchanged.
+	 *
+	 * @param	first		first channel of the range
+	 * @param	count		number of channels
+	 * @param	gap			unchanged channels which may be included to
+	 * 						merge two ranges into one transfer
+	 * @param	boundary	ranges do not cross multiples of this channel
+	 * 						number, e.g. the channels of a driver chip
+	 * @return	`false` if no channel is changed
+	 */
+	bool
+	getNextRun(uint16_t& first, uint16_t& count,
+			uint16_t gap = 0, uint16_t boundary = Channels);
+
+private:
+	inline bool
+	isChanged(uint16_t channel) const
+	{ return changed[channel / 8] & (1 << (channel % 8)); }
+
+	inline void
+	setOutput(uint16_t channel, uint8_t brightness);
+
+	Accessor<Pwm> table;
+	bool hasTable;
+
+	// brightness in 8.16 fixed point, the fraction starts at 1/2
+	uint32_t value[Channels];
+	// change per ms in 8.16 fixed point, fine enough for slow fades
+	// over a few steps
+	int32_t step[Channels];
+	// ms until the target is reached, 0 if not fading
+	uint16_t remaining[Channels];
+	uint8_t target[Channels];
+
+	Pwm output[Channels];
+	uint8_t changed[(Channels + 7) / 8];
+
+	uint16_t fading;
+	xpcc::ShortTimestamp previous;
+};
+
+}	// namespace ui
+
+}	// namespace xpcc
+
+#include "group_impl.hpp"
+
+#endif	// XPCC_UI_LED_GROUP_HPP
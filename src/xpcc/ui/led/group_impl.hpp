@@ -0,0 +1,217 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_UI_LED_GROUP_HPP
+#	error	"Don't include this file directly, use 'xpcc/ui/led/group.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::LedGroup()
+:	table(), hasTable(false), fading(0), previous(xpcc::Clock::nowShort())
+{
+	setAllBrightness(0);
+}
+
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::LedGroup(Accessor<Pwm> table)
+:	table(table), hasTable(true), fading(0), previous(xpcc::Clock::nowShort())
+{
+	setAllBrightness(0);
+}
+
+// ----------------------------------------------------------------------------
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+void
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::setOutput(uint16_t channel, uint8_t brightness)
+{
+	Pwm pwm = hasTable ? Pwm(table[brightness]) : Pwm(brightness);
+	if (output[channel] != pwm)
+	{
+		output[channel] = pwm;
+		changed[channel / 8] |= (1 << (channel % 8));
+	}
+}
+
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+void
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::setBrightness(uint16_t channel, uint8_t brightness)
+{
+	if (channel >= Channels)
+		return;
+
+	if (remaining[channel] > 0)
+	{
+		remaining[channel] = 0;
+		--fading;
+	}
+	value[channel] = (uint32_t(brightness) << 16) | 0x8000;
+	target[channel] = brightness;
+	setOutput(channel, brightness);
+}
+
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+void
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::setAllBrightness(uint8_t brightness)
+{
+	const Pwm pwm = hasTable ? Pwm(table[brightness]) : Pwm(brightness);
+	for (uint_fast16_t ii = 0; ii < Channels; ++ii)
+	{
+		value[ii] = (uint32_t(brightness) << 16) | 0x8000;
+		step[ii] = 0;
+		remaining[ii] = 0;
+		target[ii] = brightness;
+		output[ii] = pwm;
+	}
+	fading = 0;
+	invalidate();
+}
+
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+void
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::fadeTo(uint16_t channel,
+		uint8_t brightness, uint16_t time)
+{
+	if (channel >= Channels)
+		return;
+
+	if (time == 0 or brightness == getBrightness(channel))
+	{
+		setBrightness(channel, brightness);
+		return;
+	}
+
+	if (remaining[channel] == 0)
+		++fading;
+
+	// continue from the current fraction, so a running fade does not jump
+	const int32_t delta = ((int32_t(brightness) << 16) | 0x8000) - int32_t(value[channel]);
+	// a fade of 1ms is finished with the next step, the step is not needed
+	step[channel] = (time > 1) ? (delta / time) : 0;
+	remaining[channel] = time;
+	target[channel] = brightness;
+}
+
+// ----------------------------------------------------------------------------
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+bool
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::update()
+{
+	const xpcc::ShortTimestamp now = xpcc::Clock::nowShort();
+	const uint16_t milliseconds = (now - previous).getTime();
+	if (milliseconds == 0)
+		return false;
+
+	previous = now;
+	return update(milliseconds);
+}
+
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+bool
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::update(uint16_t milliseconds)
+{
+	if (fading == 0 or milliseconds == 0)
+		return false;
+
+	bool updated = false;
+	for (uint_fast16_t ii = 0; ii < Channels; ++ii)
+	{
+		if (remaining[ii] == 0)
+			continue;
+
+		const uint8_t previousBrightness = value[ii] >> 16;
+		if (remaining[ii] <= milliseconds)
+		{
+			remaining[ii] = 0;
+			--fading;
+			value[ii] = (uint32_t(target[ii]) << 16) | 0x8000;
+		}
+		else
+		{
+			remaining[ii] -= milliseconds;
+			// less than the remaining difference, so no overflow
+			value[ii] += step[ii] * int32_t(milliseconds);
+		}
+
+		const uint8_t brightness = value[ii] >> 16;
+		if (brightness != previousBrightness)
+		{
+			setOutput(ii, brightness);
+			updated = true;
+		}
+	}
+	return updated;
+}
+
+// ----------------------------------------------------------------------------
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+bool
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::isChanged() const
+{
+	for (uint_fast16_t ii = 0; ii < sizeof(changed); ++ii)
+	{
+		if (changed[ii])
+			return true;
+	}
+	return false;
+}
+
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+void
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::invalidate()
+{
+	for (uint_fast16_t ii = 0; ii < sizeof(changed); ++ii)
+		changed[ii] = 0xff;
+
+	// the unused bits of the last byte are never changed
+	if (Channels % 8)
+		changed[sizeof(changed) - 1] = (1 << (Channels % 8)) - 1;
+}
+
+template< uint16_t Channels, typename Pwm, template <typename> class Accessor >
+bool
+xpcc::ui::LedGroup<Channels, Pwm, Accessor>::getNextRun(uint16_t& first,
+		uint16_t& count, uint16_t gap, uint16_t boundary)
+{
+	// skip the unchanged bytes at once
+	uint_fast16_t channel = 0;
+	while (channel < Channels and changed[channel / 8] == 0)
+		channel += 8;
+
+	while (channel < Channels and not isChanged(channel))
+		++channel;
+
+	if (channel >= Channels)
+		return false;
+
+	first = channel;
+	const uint_fast16_t end = (boundary > 0) ?
+			((first / boundary) + 1) * boundary : Channels;
+
+	// extend over changed channels and at most `gap` unchanged in between
+	uint_fast16_t last = channel;
+	uint_fast16_t unchanged = 0;
+	for (++channel; channel < Channels and channel < end; ++channel)
+	{
+		if (isChanged(channel))
+		{
+			last = channel;
+			unchanged = 0;
+		}
+		else if (++unchanged > gap) {
+			break;
+		}
+	}
+
+	count = last - first + 1;
+	for (channel = first; channel <= last; ++channel)
+		changed[channel / 8] &= ~(1 << (channel % 8));
+
+	return true;
+}
@@ -0,0 +1,90 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <xpcc/ui/led/brightness_table.hpp>
+#include <xpcc/ui/led/tables.hpp>
+
+#include "brightness_table_test.hpp"
+
+namespace
+{
+	constexpr auto gamma8 = xpcc::ui::makeGammaTable<uint8_t, 256>(2.2);
+	constexpr auto gamma12 = xpcc::ui::makeGammaTable<uint16_t, 256>(2.2, 4095);
+	constexpr auto cie12 = xpcc::ui::makeCieTable<uint16_t, 256>(4095);
+
+	// evaluated by the compiler
+	static_assert(gamma8[0] == 0 and gamma8[255] == 255, "gamma table end points");
+	static_assert(gamma8[1] == 1, "only the first step is off");
+	static_assert(cie12[255] == 4095, "cie table end point");
+}
+
+void
+BrightnessTableTest::testGammaTable()
+{
+	TEST_ASSERT_EQUALS(gamma8.size(), 256U);
+	TEST_ASSERT_EQUALS(gamma12[0], 0);
+	TEST_ASSERT_EQUALS(gamma12[255], 4095);
+
+	for (uint16_t ii = 1; ii < 256; ++ii)
+	{
+		const double expected = 4095 * std::pow(ii / 255.0, 2.2);
+		TEST_ASSERT_TRUE(gamma12[ii] >= gamma12[ii - 1]);
+		if (expected >= 0.5) {
+			TEST_ASSERT_EQUALS(gamma12[ii], uint16_t(expected + 0.5));
+		}
+	}
+}
+
+void
+BrightnessTableTest::testPrecomputedTables()
+{
+	// the generated tables differ only by rounding
+	for (uint16_t ii = 0; ii < 256; ++ii)
+	{
+		const int16_t difference = gamma12[ii] - xpcc::ui::table22_12_256[ii];
+		TEST_ASSERT_TRUE(difference >= -1 and difference <= 1);
+	}
+}
+
+void
+BrightnessTableTest::testCieTable()
+{
+	TEST_ASSERT_EQUALS(cie12[0], 0);
+	for (uint16_t ii = 1; ii < 256; ++ii)
+	{
+		const double lightness = ii * 100.0 / 255;
+		const double luminance = (lightness > 8) ?
+				std::pow((lightness + 16) / 116, 3) : lightness / 903.3;
+		const double expected = 4095 * luminance;
+
+		TEST_ASSERT_TRUE(cie12[ii] > 0);
+		TEST_ASSERT_TRUE(cie12[ii] >= cie12[ii - 1]);
+		if (expected >= 0.5) {
+			TEST_ASSERT_EQUALS(cie12[ii], uint16_t(expected + 0.5));
+		}
+	}
+
+	// brighter than gamma 2.2 in the lower half
+	TEST_ASSERT_TRUE(cie12[32] > gamma12[32]);
+}
+
+void
+BrightnessTableTest::testResolution()
+{
+	// more steps than template recursion would allow
+	static constexpr auto table = xpcc::ui::makeGammaTable<uint16_t, 2000>(2.8);
+	static_assert(table[1999] == 0xffff, "16-bit end point");
+
+	TEST_ASSERT_EQUALS(table.size(), 2000U);
+	TEST_ASSERT_EQUALS(table[0], 0);
+	TEST_ASSERT_EQUALS(table[1], 1);
+	TEST_ASSERT_EQUALS(table[1000], uint16_t(65535 * std::pow(1000 / 1999.0, 2.8) + 0.5));
+	TEST_ASSERT_EQUALS(table[1999], 0xffff);
+}
@@ -0,0 +1,244 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/led/group.hpp>
+#include <xpcc/ui/led/brightness_table.hpp>
+#include <xpcc/ui/led/tables.hpp>
+
+#include "led_group_test.hpp"
+
+namespace
+{
+	// mark all channels as written
+	template< typename Group >
+	void
+	flush(Group& group)
+	{
+		uint16_t first, count;
+		while (group.getNextRun(first, count)) {
+		}
+	}
+}
+
+void
+LedGroupTest::testBrightness()
+{
+	xpcc::ui::LedGroup<20> leds;
+	TEST_ASSERT_EQUALS(leds.getChannels(), 20);
+	TEST_ASSERT_TRUE(leds.isChanged());
+	flush(leds);
+	TEST_ASSERT_FALSE(leds.isChanged());
+
+	leds.setBrightness(4, 100);
+	TEST_ASSERT_EQUALS(leds.getBrightness(4), 100);
+	TEST_ASSERT_EQUALS(leds.getOutput()[4], 100);
+	TEST_ASSERT_TRUE(leds.isChanged());
+
+	// out of range is ignored
+	leds.setBrightness(20, 100);
+	leds.fadeTo(20, 100, 10);
+	TEST_ASSERT_EQUALS(leds.getFadingChannels(), 0);
+
+	// the same value is no change
+	flush(leds);
+	leds.setBrightness(4, 100);
+	TEST_ASSERT_FALSE(leds.isChanged());
+
+	leds.setAllBrightness(7);
+	TEST_ASSERT_EQUALS(leds.getBrightness(19), 7);
+	TEST_ASSERT_TRUE(leds.isChanged());
+}
+
+void
+LedGroupTest::testFade()
+{
+	xpcc::ui::LedGroup<8> leds;
+	flush(leds);
+
+	leds.fadeTo(2, 200, 100);
+	leds.fadeTo(5, 100, 50);
+	TEST_ASSERT_EQUALS(leds.getFadingChannels(), 2);
+	TEST_ASSERT_TRUE(leds.isFading(2));
+	TEST_ASSERT_FALSE(leds.isFading(3));
+
+	TEST_ASSERT_FALSE(leds.update(0));
+	TEST_ASSERT_TRUE(leds.update(25));
+	TEST_ASSERT_EQUALS(leds.getBrightness(2), 50);
+	TEST_ASSERT_EQUALS(leds.getBrightness(5), 50);
+
+	// several ms at once
+	TEST_ASSERT_TRUE(leds.update(25));
+	TEST_ASSERT_EQUALS(leds.getBrightness(2), 100);
+	TEST_ASSERT_EQUALS(leds.getBrightness(5), 100);
+	TEST_ASSERT_FALSE(leds.isFading(5));
+	TEST_ASSERT_EQUALS(leds.getFadingChannels(), 1);
+
+	// the end value is exact, even if the time is passed
+	TEST_ASSERT_TRUE(leds.update(200));
+	TEST_ASSERT_EQUALS(leds.getBrightness(2), 200);
+	TEST_ASSERT_EQUALS(leds.getOutput()[2], 200);
+	TEST_ASSERT_EQUALS(leds.getFadingChannels(), 0);
+	TEST_ASSERT_FALSE(leds.update(10));
+
+	// no other channel was touched
+	uint16_t first, count;
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count));
+	TEST_ASSERT_EQUALS(first, 2);
+	TEST_ASSERT_EQUALS(count, 1);
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count));
+	TEST_ASSERT_EQUALS(first, 5);
+	TEST_ASSERT_FALSE(leds.getNextRun(first, count));
+}
+
+void
+LedGroupTest::testFadeReverse()
+{
+	xpcc::ui::LedGroup<4> leds;
+	leds.setBrightness(0, 255);
+
+	leds.off(0, 255);
+	uint8_t previous = 255;
+	for (uint16_t ms = 0; ms < 254; ++ms)
+	{
+		leds.update(1);
+		TEST_ASSERT_TRUE(leds.getBrightness(0) <= previous);
+		TEST_ASSERT_TRUE(leds.getBrightness(0) + 1 >= previous);
+		previous = leds.getBrightness(0);
+	}
+	TEST_ASSERT_TRUE(leds.isFading(0));
+	leds.update(1);
+	TEST_ASSERT_EQUALS(leds.getBrightness(0), 0);
+	TEST_ASSERT_FALSE(leds.isFading(0));
+
+	// a new fade continues from the current brightness
+	leds.on(1, 100);
+	leds.update(50);
+	leds.fadeTo(1, 0, 10);
+	TEST_ASSERT_EQUALS(leds.getFadingChannels(), 1);
+	leds.update(5);
+	TEST_ASSERT_EQUALS(leds.getBrightness(1), 64);
+
+	// a short fade ends with the next step
+	leds.fadeTo(2, 255, 1);
+	leds.update(1);
+	TEST_ASSERT_EQUALS(leds.getBrightness(2), 255);
+	TEST_ASSERT_FALSE(leds.isFading(2));
+}
+
+void
+LedGroupTest::testSlowFade()
+{
+	xpcc::ui::LedGroup<2> leds;
+	leds.setBrightness(0, 100);
+
+	// one step every 300 ms, much less than one step per ms
+	leds.fadeTo(0, 110, 3000);
+	for (uint8_t step = 1; step < 10; ++step)
+	{
+		leds.update(300);
+		TEST_ASSERT_EQUALS(leds.getBrightness(0), 100 + step);
+	}
+	leds.update(300);
+	TEST_ASSERT_EQUALS(leds.getBrightness(0), 110);
+	TEST_ASSERT_FALSE(leds.isFading(0));
+
+	// the full range over a minute has no jump at the end
+	leds.fadeTo(1, 255, 60000);
+	uint8_t previous = 0;
+	for (uint16_t ms = 0; ms < 59999; ++ms)
+	{
+		leds.update(1);
+		TEST_ASSERT_TRUE(leds.getBrightness(1) <= previous + 1);
+		previous = leds.getBrightness(1);
+	}
+	TEST_ASSERT_TRUE(previous >= 254);
+	leds.update(1);
+	TEST_ASSERT_EQUALS(leds.getBrightness(1), 255);
+	TEST_ASSERT_FALSE(leds.isFading(1));
+}
+
+void
+LedGroupTest::testTable()
+{
+	xpcc::ui::LedGroup<4, uint16_t, xpcc::accessor::Flash> leds(xpcc::ui::table22_12_256);
+	leds.setBrightness(1, 128);
+	TEST_ASSERT_EQUALS(leds.getOutput()[0], 0);
+	TEST_ASSERT_EQUALS(leds.getOutput()[1], xpcc::ui::table22_12_256[128]);
+
+	static constexpr auto table = xpcc::ui::makeCieTable<uint16_t, 256>(1000);
+	xpcc::ui::LedGroup<4, uint16_t> cie(table.values);
+	cie.fadeTo(3, 255, 10);
+	cie.update(10);
+	TEST_ASSERT_EQUALS(cie.getOutput()[3], 1000);
+}
+
+void
+LedGroupTest::testRuns()
+{
+	xpcc::ui::LedGroup<40> leds;
+	uint16_t first, count;
+
+	// everything is changed after construction
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count));
+	TEST_ASSERT_EQUALS(first, 0);
+	TEST_ASSERT_EQUALS(count, 40);
+	TEST_ASSERT_FALSE(leds.getNextRun(first, count));
+
+	for (uint16_t ch = 10; ch < 20; ++ch) {
+		leds.setBrightness(ch, 1);
+	}
+	leds.setBrightness(33, 1);
+	leds.setBrightness(39, 1);
+
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count));
+	TEST_ASSERT_EQUALS(first, 10);
+	TEST_ASSERT_EQUALS(count, 10);
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count));
+	TEST_ASSERT_EQUALS(first, 33);
+	TEST_ASSERT_EQUALS(count, 1);
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count));
+	TEST_ASSERT_EQUALS(first, 39);
+	TEST_ASSERT_EQUALS(count, 1);
+	TEST_ASSERT_FALSE(leds.getNextRun(first, count));
+
+	leds.invalidate();
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count));
+	TEST_ASSERT_EQUALS(count, 40);
+}
+
+void
+LedGroupTest::testRunGapAndBoundary()
+{
+	xpcc::ui::LedGroup<32> leds;
+	flush(leds);
+	uint16_t first, count;
+
+	leds.setBrightness(2, 1);
+	leds.setBrightness(4, 1);
+	leds.setBrightness(8, 1);
+	leds.setBrightness(15, 1);
+	leds.setBrightness(16, 1);
+
+	// channel 3 is written again instead of a second transfer
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count, 1, 16));
+	TEST_ASSERT_EQUALS(first, 2);
+	TEST_ASSERT_EQUALS(count, 3);
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count, 1, 16));
+	TEST_ASSERT_EQUALS(first, 8);
+	TEST_ASSERT_EQUALS(count, 1);
+
+	// 15 and 16 belong to different chips
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count, 1, 16));
+	TEST_ASSERT_EQUALS(first, 15);
+	TEST_ASSERT_EQUALS(count, 1);
+	TEST_ASSERT_TRUE(leds.getNextRun(first, count, 1, 16));
+	TEST_ASSERT_EQUALS(first, 16);
+	TEST_ASSERT_EQUALS(count, 1);
+	TEST_ASSERT_FALSE(leds.getNextRun(first, count, 1, 16));
+}
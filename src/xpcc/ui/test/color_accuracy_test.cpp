@@ -0,0 +1,280 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/debug/profiler/test/benchmark.hpp>
+
+#include "color_accuracy_test.hpp"
+
+#if XPCC__BENCHMARK
+
+#include <cmath>
+#include <vector>
+#include <xpcc/ui/color.hpp>
+
+using xpcc::color::Rgb;
+using xpcc::color::Hsv;
+
+namespace
+{
+	int
+	difference(int a, int b)
+	{
+		return (a > b) ? (a - b) : (b - a);
+	}
+
+	// distance on the colour circle of 256 steps
+	int
+	hueDifference(int a, int b)
+	{
+		const int d = difference(a, b);
+		return (d > 128) ? (256 - d) : d;
+	}
+
+	uint8_t
+	round(double value)
+	{
+		return uint8_t(value * 255 + 0.5);
+	}
+
+	Rgb
+	hsvToRgbFloat(const Hsv& color)
+	{
+		const double h = color.hue * 6 / 256.0;
+		const double s = color.saturation / 255.0;
+		const double v = color.value / 255.0;
+		const int sector = int(h);
+		const double f = h - sector;
+		const double p = v * (1 - s);
+		const double q = v * (1 - s * f);
+		const double t = v * (1 - s * (1 - f));
+		switch (sector)
+		{
+			case 0: return Rgb(round(v), round(t), round(p));
+			case 1: return Rgb(round(q), round(v), round(p));
+			case 2: return Rgb(round(p), round(v), round(t));
+			case 3: return Rgb(round(p), round(q), round(v));
+			case 4: return Rgb(round(t), round(p), round(v));
+			default: return Rgb(round(v), round(p), round(q));
+		}
+	}
+
+	// Tanner Helland, "How to Convert Temperature (K) to RGB"
+	double
+	limit(double value)
+	{
+		return (value < 0) ? 0 : (value > 255) ? 255 : value;
+	}
+
+	Rgb
+	colorTemperatureFloat(uint16_t kelvin)
+	{
+		const double t = kelvin / 100.0;
+		const double red = (t <= 66) ? 255 : limit(329.698727446 * std::pow(t - 60, -0.1332047592));
+		const double green = (t <= 66) ?
+				limit(99.4708025861 * std::log(t) - 161.1195681661) :
+				limit(288.1221695283 * std::pow(t - 60, -0.0755148492));
+		const double blue = (t >= 66) ? 255 : (t <= 19) ? 0 :
+				limit(138.5177312231 * std::log(t - 10) - 305.0447927307);
+		return Rgb(red + 0.5, green + 0.5, blue + 0.5);
+	}
+
+	int
+	maximumDifference(const Rgb& a, const Rgb& b)
+	{
+		return std::max(difference(a.red, b.red),
+				std::max(difference(a.green, b.green), difference(a.blue, b.blue)));
+	}
+}
+
+// ----------------------------------------------------------------------------
+void
+ColorAccuracyTest::testHsvToRgb()
+{
+	int error = 0;
+	for (uint32_t ii = 0; ii < (1UL << 24); ++ii)
+	{
+		const Hsv hsv(ii >> 16, ii >> 8, ii);
+		error = std::max(error, maximumDifference(
+				xpcc::color::hsvToRgb(hsv), hsvToRgbFloat(hsv)));
+	}
+	TEST_ASSERT_TRUE(error <= 1);
+}
+
+void
+ColorAccuracyTest::testRgbToHsv()
+{
+	// the float conversion truncates and uses 255 for 360 degree
+	int hueError = 0;
+	int saturationError = 0;
+	int valueError = 0;
+	for (uint32_t ii = 0; ii < (1UL << 24); ++ii)
+	{
+		const Rgb rgb(ii >> 16, ii >> 8, ii);
+		Hsv reference;
+		rgb.toHsv(&reference);
+		const Hsv hsv = xpcc::color::rgbToHsv(rgb);
+
+		if (hsv.saturation > 0) {
+			hueError = std::max(hueError, hueDifference(hsv.hue, reference.hue));
+		}
+		saturationError = std::max(saturationError,
+				difference(hsv.saturation, reference.saturation));
+		valueError = std::max(valueError, difference(hsv.value, reference.value));
+	}
+	TEST_ASSERT_TRUE(hueError <= 2);
+	TEST_ASSERT_TRUE(saturationError <= 1);
+	TEST_ASSERT_EQUALS(valueError, 0);
+}
+
+void
+ColorAccuracyTest::testRoundTrip()
+{
+	int error = 0;
+	for (uint32_t ii = 0; ii < (1UL << 24); ++ii)
+	{
+		const Rgb rgb(ii >> 16, ii >> 8, ii);
+		error = std::max(error, maximumDifference(rgb,
+				xpcc::color::hsvToRgb(xpcc::color::rgbToHsv(rgb))));
+	}
+	TEST_ASSERT_TRUE(error <= 3);
+}
+
+void
+ColorAccuracyTest::testRgb565()
+{
+	// every channel is rounded to the nearest value
+	uint16_t wrong = 0;
+	for (uint16_t ii = 0; ii < 256; ++ii)
+	{
+		const uint16_t pixel = xpcc::color::rgbToRgb565(Rgb(ii, ii, ii));
+		wrong += ((pixel >> 11) != std::lround(ii * 31 / 255.0));
+		wrong += (((pixel >> 5) & 0x3f) != std::lround(ii * 63 / 255.0));
+	}
+	TEST_ASSERT_EQUALS(wrong, 0);
+
+	// expanding and reducing again is lossless
+	for (uint32_t ii = 0; ii < 0x10000; ++ii)
+	{
+		const Rgb rgb = xpcc::color::rgb565ToRgb(ii);
+		wrong += (xpcc::color::rgbToRgb565(rgb) != ii);
+		wrong += (rgb.red != std::lround((ii >> 11) * 255 / 31.0));
+		wrong += (rgb.green != std::lround(((ii >> 5) & 0x3f) * 255 / 63.0));
+	}
+	TEST_ASSERT_EQUALS(wrong, 0);
+}
+
+void
+ColorAccuracyTest::testLuminance()
+{
+	int error = 0;
+	for (uint32_t ii = 0; ii < (1UL << 24); ++ii)
+	{
+		const Rgb rgb(ii >> 16, ii >> 8, ii);
+		const double luma = 0.299 * rgb.red + 0.587 * rgb.green + 0.114 * rgb.blue;
+		error = std::max(error, difference(xpcc::color::luminance(rgb), int(luma + 0.5)));
+	}
+	TEST_ASSERT_TRUE(error <= 1);
+}
+
+void
+ColorAccuracyTest::testColorTemperature()
+{
+	int error = 0;
+	for (uint16_t kelvin = 1000; kelvin <= 40000; ++kelvin)
+	{
+		error = std::max(error, maximumDifference(
+				xpcc::color::colorTemperature(kelvin), colorTemperatureFloat(kelvin)));
+	}
+	TEST_ASSERT_TRUE(error <= 4);
+}
+
+// ----------------------------------------------------------------------------
+void
+ColorAccuracyTest::testThroughput()
+{
+	const uint32_t pixels = 1UL << 16;
+	std::vector<Rgb> rgb(pixels);
+	std::vector<Hsv> hsv(pixels);
+	std::vector<uint16_t> rgb565(pixels);
+	for (uint32_t ii = 0; ii < pixels; ++ii) {
+		rgb[ii] = Rgb(ii * 7, ii >> 4, ii >> 8);
+	}
+
+	xpcc::profiler::Record integer("rgbToHsv");
+	xpcc::profiler::Record floating("toHsv");
+	xpcc::profiler::Record back("hsvToRgb");
+	xpcc::profiler::Record reduce("rgbToRgb565");
+	{
+		xpcc::profiler::Scope scope(integer);
+		xpcc::color::rgbToHsv(rgb.data(), hsv.data(), pixels);
+	}
+	{
+		xpcc::profiler::Scope scope(floating);
+		for (uint32_t ii = 0; ii < pixels; ++ii) {
+			rgb[ii].toHsv(&hsv[ii]);
+		}
+	}
+	{
+		xpcc::profiler::Scope scope(back);
+		xpcc::color::hsvToRgb(hsv.data(), rgb.data(), pixels);
+	}
+	{
+		xpcc::profiler::Scope scope(reduce);
+		xpcc::color::rgbToRgb565(rgb.data(), rgb565.data(), pixels);
+	}
+
+	XPCC_LOG_INFO << "colour conversion per pixel: "
+			<< unittest::getNanoseconds(integer.getTotal(), pixels) << " ns rgbToHsv, "
+			<< unittest::getNanoseconds(floating.getTotal(), pixels) << " ns toHsv (float), "
+			<< unittest::getNanoseconds(back.getTotal(), pixels) << " ns hsvToRgb, "
+			<< unittest::getNanoseconds(reduce.getTotal(), pixels) << " ns rgbToRgb565"
+			<< xpcc::endl;
+
+	TEST_ASSERT_EQUALS(integer.getCount(), 1U);
+	TEST_ASSERT_EQUALS(floating.getCount(), 1U);
+}
+
+#else
+
+void
+ColorAccuracyTest::testHsvToRgb()
+{
+}
+
+void
+ColorAccuracyTest::testRgbToHsv()
+{
+}
+
+void
+ColorAccuracyTest::testRoundTrip()
+{
+}
+
+void
+ColorAccuracyTest::testRgb565()
+{
+}
+
+void
+ColorAccuracyTest::testLuminance()
+{
+}
+
+void
+ColorAccuracyTest::testColorTemperature()
+{
+}
+
+void
+ColorAccuracyTest::testThroughput()
+{
+}
+
+#endif
@@ -0,0 +1,37 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// Compares the integer colour conversions with floating point for all
+/// input values. Only runs on hosted targets.
+class ColorAccuracyTest : public unittest::TestSuite
+{
+public:
+	void
+	testHsvToRgb();
+
+	void
+	testRgbToHsv();
+
+	void
+	testRoundTrip();
+
+	void
+	testRgb565();
+
+	void
+	testLuminance();
+
+	void
+	testColorTemperature();
+
+	void
+	testThroughput();
+};
@@ -0,0 +1,170 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#include <xpcc/ui/color.hpp>
+
+#include "color_test.hpp"
+
+using xpcc::color::Rgb;
+using xpcc::color::Hsv;
+
+void
+ColorTest::testHsvToRgb()
+{
+	Rgb rgb = xpcc::color::hsvToRgb(Hsv(0, 255, 255));
+	TEST_ASSERT_EQUALS(rgb.red, 255);
+	TEST_ASSERT_EQUALS(rgb.green, 0);
+	TEST_ASSERT_EQUALS(rgb.blue, 0);
+
+	// 119.5 degree
+	rgb = xpcc::color::hsvToRgb(Hsv(85, 255, 255));
+	TEST_ASSERT_EQUALS(rgb.red, 2);
+	TEST_ASSERT_EQUALS(rgb.green, 255);
+	TEST_ASSERT_EQUALS(rgb.blue, 0);
+
+	// no saturation is grey
+	rgb = xpcc::color::hsvToRgb(Hsv(200, 0, 100));
+	TEST_ASSERT_EQUALS(rgb.red, 100);
+	TEST_ASSERT_EQUALS(rgb.green, 100);
+	TEST_ASSERT_EQUALS(rgb.blue, 100);
+
+	// the member function gives the same result
+	Rgb member;
+	Hsv(170, 128, 200).toRgb(&member);
+	rgb = xpcc::color::hsvToRgb(Hsv(170, 128, 200));
+	TEST_ASSERT_EQUALS(member.red, rgb.red);
+	TEST_ASSERT_EQUALS(member.green, rgb.green);
+	TEST_ASSERT_EQUALS(member.blue, rgb.blue);
+}
+
+void
+ColorTest::testRgbToHsv()
+{
+	Hsv hsv = xpcc::color::rgbToHsv(Rgb(255, 0, 0));
+	TEST_ASSERT_EQUALS(hsv.hue, 0);
+	TEST_ASSERT_EQUALS(hsv.saturation, 255);
+	TEST_ASSERT_EQUALS(hsv.value, 255);
+
+	hsv = xpcc::color::rgbToHsv(Rgb(0, 0, 200));
+	TEST_ASSERT_EQUALS(hsv.hue, 171);
+	TEST_ASSERT_EQUALS(hsv.saturation, 255);
+	TEST_ASSERT_EQUALS(hsv.value, 200);
+
+	// just below 360 degree rounds to red
+	hsv = xpcc::color::rgbToHsv(Rgb(255, 0, 1));
+	TEST_ASSERT_EQUALS(hsv.hue, 0);
+
+	hsv = xpcc::color::rgbToHsv(Rgb(100, 50, 50));
+	TEST_ASSERT_EQUALS(hsv.hue, 0);
+	TEST_ASSERT_EQUALS(hsv.saturation, 128);
+	TEST_ASSERT_EQUALS(hsv.value, 100);
+
+	hsv = xpcc::color::rgbToHsv(Rgb(30, 30, 30));
+	TEST_ASSERT_EQUALS(hsv.saturation, 0);
+	TEST_ASSERT_EQUALS(hsv.value, 30);
+
+	hsv = xpcc::color::rgbToHsv(Rgb(0, 0, 0));
+	TEST_ASSERT_EQUALS(hsv.value, 0);
+}
+
+void
+ColorTest::testRgb565()
+{
+	TEST_ASSERT_EQUALS(xpcc::color::rgbToRgb565(Rgb(255, 255, 255)), 0xffff);
+	TEST_ASSERT_EQUALS(xpcc::color::rgbToRgb565(Rgb(255, 0, 0)), 0xf800);
+	TEST_ASSERT_EQUALS(xpcc::color::rgbToRgb565(Rgb(0, 255, 0)), 0x07e0);
+	// rounded instead of truncated
+	TEST_ASSERT_EQUALS(xpcc::color::rgbToRgb565(Rgb(0, 0, 7)), 0x0001);
+	TEST_ASSERT_EQUALS(xpcc::color::rgbToRgb565(Rgb(0, 0, 4)), 0x0000);
+
+	Rgb rgb = xpcc::color::rgb565ToRgb(0xffff);
+	TEST_ASSERT_EQUALS(rgb.red, 255);
+	TEST_ASSERT_EQUALS(rgb.green, 255);
+	TEST_ASSERT_EQUALS(rgb.blue, 255);
+
+	rgb = xpcc::color::rgb565ToRgb(0x0821);
+	TEST_ASSERT_EQUALS(rgb.red, 8);
+	TEST_ASSERT_EQUALS(rgb.green, 4);
+	TEST_ASSERT_EQUALS(rgb.blue, 8);
+}
+
+void
+ColorTest::testLuminance()
+{
+	TEST_ASSERT_EQUALS(xpcc::color::luminance(Rgb(0, 0, 0)), 0);
+	TEST_ASSERT_EQUALS(xpcc::color::luminance(Rgb(255, 255, 255)), 255);
+	TEST_ASSERT_EQUALS(xpcc::color::luminance(Rgb(255, 0, 0)), 76);
+	TEST_ASSERT_EQUALS(xpcc::color::luminance(Rgb(0, 255, 0)), 150);
+	TEST_ASSERT_EQUALS(xpcc::color::luminance(Rgb(0, 0, 255)), 29);
+}
+
+void
+ColorTest::testColorTemperature()
+{
+	// candle light
+	Rgb rgb = xpcc::color::colorTemperature(1800);
+	TEST_ASSERT_EQUALS(rgb.red, 255);
+	TEST_ASSERT_EQUALS(rgb.blue, 0);
+
+	// daylight is nearly white
+	rgb = xpcc::color::colorTemperature(6500);
+	TEST_ASSERT_EQUALS(rgb.red, 255);
+	TEST_ASSERT_TRUE(rgb.green > 245);
+	TEST_ASSERT_TRUE(rgb.blue > 245);
+
+	// blue sky
+	rgb = xpcc::color::colorTemperature(15000);
+	TEST_ASSERT_TRUE(rgb.red < rgb.green);
+	TEST_ASSERT_EQUALS(rgb.blue, 255);
+
+	// limited to 1000K to 40000K
+	rgb = xpcc::color::colorTemperature(0);
+	Rgb limit = xpcc::color::colorTemperature(1000);
+	TEST_ASSERT_EQUALS(rgb.green, limit.green);
+	rgb = xpcc::color::colorTemperature(65535);
+	limit = xpcc::color::colorTemperature(40000);
+	TEST_ASSERT_EQUALS(rgb.red, limit.red);
+
+	// warmer is always redder
+	for (uint16_t kelvin = 1000; kelvin < 40000; kelvin += 100)
+	{
+		const Rgb warm = xpcc::color::colorTemperature(kelvin);
+		const Rgb cold = xpcc::color::colorTemperature(kelvin + 100);
+		TEST_ASSERT_TRUE(warm.red >= cold.red);
+		TEST_ASSERT_TRUE(warm.blue <= cold.blue);
+	}
+}
+
+void
+ColorTest::testArrays()
+{
+	const Rgb strip[4] = { Rgb(255, 0, 0), Rgb(0, 255, 0), Rgb(0, 0, 255), Rgb(10, 20, 30) };
+
+	Hsv hsv[4];
+	xpcc::color::rgbToHsv(strip, hsv, 4);
+	Rgb rgb[4];
+	xpcc::color::hsvToRgb(hsv, rgb, 4);
+	uint16_t pixels[4];
+	xpcc::color::rgbToRgb565(strip, pixels, 4);
+	Rgb expanded[4];
+	xpcc::color::rgb565ToRgb(pixels, expanded, 4);
+	uint8_t luma[4];
+	xpcc::color::luminance(strip, luma, 4);
+
+	for (uint8_t ii = 0; ii < 4; ++ii)
+	{
+		const Hsv single = xpcc::color::rgbToHsv(strip[ii]);
+		TEST_ASSERT_EQUALS(hsv[ii].hue, single.hue);
+		TEST_ASSERT_EQUALS(hsv[ii].saturation, single.saturation);
+		TEST_ASSERT_EQUALS(rgb[ii].blue, xpcc::color::hsvToRgb(single).blue);
+		TEST_ASSERT_EQUALS(pixels[ii], xpcc::color::rgbToRgb565(strip[ii]));
+		TEST_ASSERT_EQUALS(expanded[ii].green, xpcc::color::rgb565ToRgb(pixels[ii]).green);
+		TEST_ASSERT_EQUALS(luma[ii], xpcc::color::luminance(strip[ii]));
+	}
+}
@@ -39,5 +39,6 @@
 #include "utils/allocator.hpp"
 #include "utils/arithmetic_traits.hpp"
 #include "utils/template_metaprogramming.hpp"
+#include "utils/index_sequence.hpp"
 #include "utils/dummy.hpp"
 #include "utils/bit_constants.hpp"
@@ -0,0 +1,86 @@
+// coding: utf-8
+/* Copyright (c) 2016, Roboterclub Aachen e.V.
+ * All Rights Reserved.
+ *
+ * The file is part of the xpcc library and is released under the 3-clause BSD
+ * license. See the file `LICENSE` for the full license governing this code.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef XPCC_TMP__INDEX_SEQUENCE_HPP
+#define XPCC_TMP__INDEX_SEQUENCE_HPP
+
+#include <cstddef>
+
+namespace xpcc
+{
+	namespace tmp
+	{
+		/**
+		 * \brief	Compile-time sequence of indices
+		 *
+		 * Used to expand arrays in `constexpr` functions, like
+		 * `std::index_sequence` of C++14:
+		 *
+		 * \code
+		 * template <std::size_t N, std::size_t... Is>
+		 * constexpr Table<N>
+		 * makeTable(xpcc::tmp::IndexSequence<Is...>)
+		 * {
+		 *     return Table<N> { { f(Is)... } };
+		 * }
+		 *
+		 * makeTable<N>(typename xpcc::tmp::MakeIndexSequence<N>::Type());
+		 * \endcode
+		 *
+		 * \ingroup	tmp
+		 */
+		template <std::size_t... Is>
+		struct IndexSequence
+		{
+		};
+
+		/// \cond
+		template <typename First, typename Second>
+		struct ConcatIndexSequence;
+
+		template <std::size_t... I1, std::size_t... I2>
+		struct ConcatIndexSequence< IndexSequence<I1...>, IndexSequence<I2...> >
+		{
+			typedef IndexSequence<I1..., (sizeof...(I1) + I2)...> Type;
+		};
+		/// \endcond
+
+		/**
+		 * \brief	`MakeIndexSequence<N>::Type` is `IndexSequence<0, ..., N-1>`
+		 *
+		 * The recursion depth grows only logarithmically with N, so
+		 * sequences with thousands of indices compile.
+		 *
+		 * \ingroup	tmp
+		 */
+		template <std::size_t N>
+		struct MakeIndexSequence
+		{
+			typedef typename ConcatIndexSequence<
+					typename MakeIndexSequence<N / 2>::Type,
+					typename MakeIndexSequence<N - N / 2>::Type >::Type Type;
+		};
+
+		/// \cond
+		template <>
+		struct MakeIndexSequence<0>
+		{
+			typedef IndexSequence<> Type;
+		};
+
+		template <>
+		struct MakeIndexSequence<1>
+		{
+			typedef IndexSequence<0> Type;
+		};
+		/// \endcond
+	}
+}
+
+#endif	// XPCC_TMP__INDEX_SEQUENCE_HPP
@@ -65,7 +65,7 @@ namespace xpcc
 			${char_width}
 			
 			// font data
-			// bit field of all characters
+			// ${data_description}
 			${font_data}
 		};
 	}
@@ -96,7 +96,7 @@ namespace xpcc
 		 * - first char      : ${first}
 		 * - last char       : ${last}
 		 * - number of chars : ${count}
-		 * - size in bytes   : ${size}
+		 * - size in bytes   : ${size}${encoding}
 		 * 
 		 * \\ingroup	font
 		 */
@@ -224,15 +224,55 @@ def read_font_file(filename):
 	
 	return font
 
+# -----------------------------------------------------------------------------
+def encode_rle(data):
+	""" Run-length encoding of the glyph data
+	
+	A control byte n < 128 is followed by n + 1 literal bytes, a control
+	byte n >= 128 by a single byte which is repeated n - 126 times.
+	"""
+	output = []
+	literal = []
+	
+	def flush(literal):
+		while len(literal) > 0:
+			chunk = literal[:128]
+			output.append(len(chunk) - 1)
+			output.extend(chunk)
+			literal = literal[128:]
+	
+	i = 0
+	while i < len(data):
+		run = 1
+		while i + run < len(data) and data[i + run] == data[i] and run < 129:
+			run += 1
+		
+		if run >= 3:
+			flush(literal)
+			literal = []
+			output.append(0x80 + run - 2)
+			output.append(data[i])
+			i += run
+		else:
+			literal.append(data[i])
+			i += 1
+	flush(literal)
+	return output
+
 # -----------------------------------------------------------------------------
 if __name__ == '__main__':
+	args = os.sys.argv[1:]
+	rle = '--rle' in args
+	if rle:
+		args.remove('--rle')
+	
 	try:
-		filename = os.sys.argv[1]
+		filename = args[0]
 		if not filename.endswith('.font'):
 			raise
-		outfile = os.sys.argv[2]
+		outfile = args[1]
 	except:
-		print "usage: %s *.font outfile" % os.sys.argv[0]
+		print "usage: %s [--rle] *.font outfile" % os.sys.argv[0]
 		exit(1)
 	
 	try:
@@ -249,8 +289,19 @@ if __name__ == '__main__':
 	
 	# 8 byte header, width table
 	size = 8 + len(font.chars)
+	if rle:
+		# 16-bit offset of every glyph
+		size += 2 * len(font.chars)
+		glyph_offsets = []
+		glyph_offset = 0
+	
 	for char in font.chars:
-		size += len(char.data)
+		char_data = char.data
+		if rle:
+			char_data = encode_rle(char.data)
+			glyph_offsets.append("0x%02X, 0x%02X, " % (glyph_offset & 0xff, glyph_offset >> 8))
+			glyph_offset += len(char_data)
+		size += len(char_data)
 		
 		char_width_line += "%2i, " % char.width
 		
@@ -262,7 +313,7 @@ if __name__ == '__main__':
 			char_width_line = ""
 		
 		data = ""
-		for c in char.data:
+		for c in char_data:
 			data += "0x%02X, " % c
 		data += "// %i" % char.index
 		font_data.append(data)
@@ -272,6 +323,16 @@ if __name__ == '__main__':
 	if char_width_line != "":
 		char_width.append(char_width_line)
 	
+	size_high = size >> 8
+	if rle:
+		if size >= 0x8000:
+			print "Error: run-length encoded fonts must be smaller than 32kB"
+			exit(1)
+		# marks the encoding, see xpcc::glcd::GlyphCache
+		size_high |= 0x80
+		font_data = ["".join(glyph_offsets[i:i+8]) for i in range(0, len(glyph_offsets), 8)] + \
+				["", "// run-length encoded glyphs"] + font_data
+	
 	preferred_width = 0
 	max = 0
 	for key, value in width_histogram.items():
@@ -285,7 +346,7 @@ if __name__ == '__main__':
 		'array_name': ''.join([s[0].upper() + s[1:] for s in font.name.split(' ')]),
 		'size': size,
 		'size_low': "0x%02X" % (size & 0xff),
-		'size_high': "0x%02X" % (size >> 8),
+		'size_high': "0x%02X" % size_high,
 		'width': preferred_width,
 		'width_string': "fixed width    " if (len(width_histogram) == 1) else "preferred width",
 		'height': font.height,
@@ -296,6 +357,8 @@ if __name__ == '__main__':
 		'count': len(font.chars),
 		'char_width': "\n\t\t\t".join(char_width),
 		'font_data': "\n\t\t\t".join(font_data),
+		'data_description': "offset of every glyph, followed by the encoded glyphs" if rle else "bit field of all characters",
+		'encoding': "\n\t\t * - run-length encoded, use xpcc::glcd::GlyphCache" if rle else "",
 		'include_guard': "XPCC_FONT__" + os.path.basename(outfile).upper().replace(" ", "_") + "_HPP"
 	}
 	
@@ -0,0 +1,67 @@
+#!/usr/bin/env python2
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2016, Roboterclub Aachen e.V.
+# All Rights Reserved.
+#
+# The file is part of the xpcc library and is released under the 3-clause BSD
+# license. See the file `LICENSE` for the full license governing this code.
+# -----------------------------------------------------------------------------
+"""
+Decodes the binary snapshot written by `xpcc::profiler::writeSnapshot()`.
+
+Usage:
+	profiler_snapshot.py snapshot.bin
+"""
+
+import sys
+import struct
+
+HEADER = struct.Struct('<2sBHI')
+RECORD = struct.Struct('<IQIIB')
+
+class Record:
+	def __init__(self, name, count, total, maximum, last):
+		self.name = name
+		self.count = count
+		self.total = total
+		self.maximum = maximum
+		self.last = last
+
+def decode(data):
+	""" Returns the ticks per second and the list of records of a snapshot """
+	magic, version, count, ticks = HEADER.unpack_from(data, 0)
+	if magic != b'PR' or version != 1:
+		raise ValueError("Not a profiler snapshot (version 1)!")
+
+	records = []
+	offset = HEADER.size
+	for _ in range(count):
+		values = RECORD.unpack_from(data, offset)
+		offset += RECORD.size
+		length = values[-1]
+		name = data[offset:offset + length].decode('ascii', 'replace')
+		offset += length
+		records.append(Record(name, *values[:-1]))
+
+	return ticks, records
+
+def format(ticks, records):
+	""" Formats the records as table with times in microseconds """
+	us = lambda value: value * 1e6 / ticks
+	lines = ["%-24s %10s %12s %10s %10s %10s" %
+			("name", "count", "total [us]", "mean [us]", "max [us]", "last [us]")]
+	for r in sorted(records, key=lambda r: r.total, reverse=True):
+		mean = us(r.total) / r.count if r.count else 0
+		lines.append("%-24s %10d %12.1f %10.2f %10.2f %10.2f" %
+				(r.name or "<unnamed>", r.count, us(r.total), mean, us(r.maximum), us(r.last)))
+	return "\n".join(lines)
+
+if __name__ == '__main__':
+	if len(sys.argv) != 2:
+		print(__doc__)
+		exit(1)
+
+	with open(sys.argv[1], 'rb') as snapshot:
+		ticks, records = decode(snapshot.read())
+	print(format(ticks, records))
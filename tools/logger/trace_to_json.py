@@ -0,0 +1,101 @@
+#!/usr/bin/env python2
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2016, Roboterclub Aachen e.V.
+# All Rights Reserved.
+#
+# The file is part of the xpcc library and is released under the 3-clause BSD
+# license. See the file `LICENSE` for the full license governing this code.
+# -----------------------------------------------------------------------------
+"""
+Converts the binary event stream written by
+`xpcc::trace::TraceBuffer::writeEvents()` into the Chrome trace event format,
+which can be opened in `chrome://tracing` or https://ui.perfetto.dev.
+
+The input may contain any number of consecutive `writeEvents()` blocks.
+
+Usage:
+	trace_to_json.py trace.bin > trace.json
+"""
+
+import sys
+import json
+import struct
+
+HEADER = struct.Struct('<2sBIIH')
+EVENT = struct.Struct('<IBBHI')
+
+CATEGORIES = ['interrupt', 'context', 'dispatcher', 'user']
+PHASES = ['B', 'E', 'i', 'C']
+
+def category_name(category):
+	if category < len(CATEGORIES):
+		return CATEGORIES[category]
+	return 'category%d' % category
+
+def decode(data):
+	""" Returns the list of (timestamp in seconds, category, type, id, value)
+	tuples and the number of lost events.
+
+	The 32-bit timestamps are unwrapped, so that long traces stay monotonic
+	as long as two consecutive events are less than 2^31 ticks apart.
+	"""
+	events = []
+	lost = 0
+	offset = 0
+	last = None
+	ticks = 0
+	while offset + HEADER.size <= len(data):
+		magic, version, frequency, block_lost, count = HEADER.unpack_from(data, offset)
+		if magic != b'TR' or version != 1:
+			raise ValueError("Not a trace stream (version 1) at offset %d!" % offset)
+		offset += HEADER.size
+		lost += block_lost
+
+		for _ in range(count):
+			timestamp, category, type, id, value = EVENT.unpack_from(data, offset)
+			offset += EVENT.size
+			if last is not None:
+				delta = (timestamp - last) & 0xffffffff
+				if delta >= 0x80000000:
+					delta -= 0x100000000
+				ticks += delta
+			last = timestamp
+			events.append((float(ticks) / frequency, category, type, id, value))
+	return events, lost
+
+def to_chrome(events):
+	""" Converts the decoded events into a list of Chrome trace events """
+	result = []
+	for time, category, type, id, value in events:
+		name = category_name(category)
+		entry = {
+			'name': '%s %d' % (name, id),
+			'cat': name,
+			'ph': PHASES[type] if type < len(PHASES) else 'i',
+			'ts': time * 1e6,
+			'pid': 0,
+			'tid': category,
+		}
+		if type == 2:
+			entry['s'] = 't'
+			entry['args'] = {'value': value}
+		elif type == 3:
+			entry['args'] = {'value': value}
+		result.append(entry)
+	return result
+
+if __name__ == '__main__':
+	if len(sys.argv) != 2:
+		print(__doc__)
+		sys.exit(1)
+
+	with open(sys.argv[1], 'rb') as f:
+		events, lost = decode(f.read())
+
+	if lost:
+		sys.stderr.write("Warning: %d events were lost!\n" % lost)
+
+	json.dump({'traceEvents': to_chrome(events), 'displayTimeUnit': 'ns'},
+			sys.stdout, indent=1)
+	sys.stdout.write('\n')
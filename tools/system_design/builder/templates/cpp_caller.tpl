@@ -92,6 +92,7 @@ public:
 		virtual void
 		update()
 		{
+			XPCC_PROFILE_SCOPE(this->taskProfile);
 			this->run();
 		}
 